@@ -20,6 +20,20 @@
 
 #include <stdint.h>
 
+// Enough of a file's lstat to tell whether its contents may have changed
+struct FileStamp {
+  int64_t device;
+  int64_t inode;
+  int64_t size;
+  int64_t modified;  // as returned by getmtime_ns
+  // Status change timestamp in nanoseconds since 1970, or 0 for a file with
+  // more than one link. Linking or unlinking any name of a file changes its
+  // ctime, so the outputs that a job cache hit hardlinks from the shared store
+  // would otherwise be rehashed whenever another workspace uses the same blob.
+  // Changes to such a file are only noticed through its size and mtime.
+  int64_t changed;
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -28,6 +42,9 @@ extern "C" {
 // On error, returns -1 and sets errno.
 extern int64_t getmtime_ns(const char *file);
 
+// On error, returns -1, sets errno and every field of stamp to -1.
+extern int getstamp(const char *file, struct FileStamp *stamp);
+
 #ifdef __cplusplus
 };
 #endif
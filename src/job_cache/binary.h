@@ -0,0 +1,229 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hash.h"
+
+namespace job_cache {
+
+// Messages between wake and the daemon are null terminated JSON by default.
+// Requests with many visible files are large so they can instead be sent as
+// length prefixed binary frames:
+//
+//   [binary_frame_magic] [u32 little endian body size] [method] [body...]
+//
+// The magic byte is a UTF-8 continuation byte so it can never start a JSON
+// message. This lets both encodings share a connection, which keeps JSON
+// around for debugging. The daemon always answers in the encoding it was
+// asked in. MessageParser returns frames whole, header included.
+//
+// Many requests share one connection so the body of every request starts
+// with a varint id, chosen by the client, that the response starts with too.
+// A ReadBatch body is instead a varint count of reads each made of an id and
+// a Read body. Every read in the batch gets its own Response.
+constexpr uint8_t binary_frame_magic = 0xb7;
+constexpr size_t binary_frame_header_size = 5;
+
+enum class BinaryMethod : uint8_t { Read = 1, Add = 2, Response = 3, ReadBatch = 4 };
+
+inline bool is_binary_message(const std::string &message) {
+  return !message.empty() && uint8_t(message[0]) == binary_frame_magic;
+}
+
+// Only valid once the first binary_frame_header_size bytes are present
+inline uint32_t binary_frame_size(const std::string &header) {
+  uint32_t size = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    size |= uint32_t(uint8_t(header[1 + i])) << (8 * i);
+  }
+  return size;
+}
+
+class BinaryWriter {
+ private:
+  std::string buff;
+  std::unordered_map<std::string, uint64_t> dirs;
+
+ public:
+  explicit BinaryWriter(BinaryMethod method) {
+    buff.resize(binary_frame_header_size);
+    buff[0] = char(binary_frame_magic);
+    buff += char(method);
+  }
+
+  void write_varint(uint64_t x) {
+    while (x >= 0x80) {
+      buff += char(uint8_t(x) | 0x80);
+      x >>= 7;
+    }
+    buff += char(x);
+  }
+
+  void write_bool(bool x) { buff += char(x); }
+
+  void write_double(double x) { buff.append(reinterpret_cast<const char *>(&x), sizeof(x)); }
+
+  void write_string(const std::string &str) {
+    write_varint(str.size());
+    buff += str;
+  }
+
+  // Hashes are written raw rather than as hex
+  void write_hash(const Hash256 &hash) {
+    buff.append(reinterpret_cast<const char *>(hash.data), sizeof(hash.data));
+  }
+
+  // Paths are split after their last '/'. The directory half is spelled out
+  // the first time it's written and referred to by index after that, so a
+  // large set of paths costs little more than their base names.
+  void write_path(const std::string &path) {
+    size_t split = path.rfind('/');
+    split = split == std::string::npos ? 0 : split + 1;
+    std::string dir = path.substr(0, split);
+
+    auto iter = dirs.find(dir);
+    if (iter != dirs.end()) {
+      write_varint(iter->second + 1);
+    } else {
+      write_varint(0);
+      write_string(dir);
+      dirs.emplace(std::move(dir), dirs.size());
+    }
+
+    write_varint(path.size() - split);
+    buff.append(path, split, std::string::npos);
+  }
+
+  // Fills in the frame size and hands back the finished frame
+  std::string finish() {
+    uint32_t size = buff.size() - binary_frame_header_size;
+    for (size_t i = 0; i < 4; ++i) {
+      buff[1 + i] = char(uint8_t(size >> (8 * i)));
+    }
+    return std::move(buff);
+  }
+};
+
+// Reads back what BinaryWriter wrote. Running off the end of the frame or
+// reading something malformed sets failed() and returns empty values from
+// then on, so callers decode everything and check failed() once at the end.
+class BinaryReader {
+ private:
+  const std::string &buff;
+  size_t pos = binary_frame_header_size;
+  bool failed_ = false;
+  BinaryMethod method_ = BinaryMethod::Read;
+  std::vector<std::string> dirs;
+
+  bool take(size_t size) {
+    if (failed_ || buff.size() - pos < size) {
+      failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+ public:
+  explicit BinaryReader(const std::string &message) : buff(message) {
+    if (!is_binary_message(buff) || buff.size() <= binary_frame_header_size ||
+        binary_frame_size(buff) != buff.size() - binary_frame_header_size) {
+      failed_ = true;
+      pos = buff.size();
+      return;
+    }
+    method_ = BinaryMethod(buff[pos++]);
+  }
+
+  bool failed() const { return failed_; }
+  BinaryMethod method() const { return method_; }
+
+  uint64_t read_varint() {
+    uint64_t x = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (!take(1)) return 0;
+      uint8_t byte = buff[pos++];
+      x |= uint64_t(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return x;
+    }
+    failed_ = true;
+    return 0;
+  }
+
+  // Every element takes at least a byte so a count larger than what's
+  // left of the frame must be malformed. Checking here stops a bad
+  // message from sending decoding around a huge loop.
+  size_t read_count() {
+    uint64_t count = read_varint();
+    if (count > buff.size() - pos) {
+      failed_ = true;
+      return 0;
+    }
+    return count;
+  }
+
+  bool read_bool() {
+    if (!take(1)) return false;
+    return buff[pos++] != 0;
+  }
+
+  double read_double() {
+    double x = 0;
+    if (!take(sizeof(x))) return x;
+    std::memcpy(&x, buff.data() + pos, sizeof(x));
+    pos += sizeof(x);
+    return x;
+  }
+
+  std::string read_string() {
+    size_t size = read_count();
+    if (!take(size)) return "";
+    std::string out = buff.substr(pos, size);
+    pos += size;
+    return out;
+  }
+
+  Hash256 read_hash() {
+    Hash256 out;
+    if (!take(sizeof(out.data))) return out;
+    std::memcpy(out.data, buff.data() + pos, sizeof(out.data));
+    pos += sizeof(out.data);
+    return out;
+  }
+
+  std::string read_path() {
+    uint64_t dir_index = read_varint();
+    if (dir_index == 0) {
+      dirs.emplace_back(read_string());
+      dir_index = dirs.size();
+    }
+    if (dir_index > dirs.size()) {
+      failed_ = true;
+      return "";
+    }
+    return dirs[dir_index - 1] + read_string();
+  }
+};
+
+}  // namespace job_cache
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// NOTE: Like db_helpers.h this should only be included from .cpp files in this dir.
+#include <wcl/defer.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "db_helpers.h"
+
+namespace job_cache {
+
+// Output files are stored once per unique hash, see blob_path(). The blobs
+// table records the size of each stored blob and, via triggers on output_files,
+// how many job outputs reference it. Once a blob is no longer referenced it
+// can be collected.
+class BlobStore {
+ private:
+  PreparedStatement find_blob;
+  PreparedStatement add_blob;
+  PreparedStatement find_dead_blobs;
+  PreparedStatement remove_dead_blobs;
+
+ public:
+  static constexpr const char *find_blob_query = "select size from blobs where hash = ?";
+
+  static constexpr const char *add_blob_query =
+      "insert into blobs (hash, size, refcount) values (?, ?, 0)";
+
+  static constexpr const char *find_dead_blobs_query = "select hash from blobs where refcount = 0";
+
+  static constexpr const char *remove_dead_blobs_query = "delete from blobs where refcount = 0";
+
+  BlobStore(std::shared_ptr<job_cache::Database> db)
+      : find_blob(db, find_blob_query),
+        add_blob(db, add_blob_query),
+        find_dead_blobs(db, find_dead_blobs_query),
+        remove_dead_blobs(db, remove_dead_blobs_query) {
+    find_blob.set_why("Could not find blob");
+    add_blob.set_why("Could not insert blob");
+    find_dead_blobs.set_why("Could not find unreferenced blobs");
+    remove_dead_blobs.set_why("Could not remove unreferenced blobs");
+  }
+
+  bool contains(const std::string &hash) {
+    auto defer_reset = wcl::make_defer([this]() { find_blob.reset(); });
+    find_blob.bind_string(1, hash);
+    return find_blob.step() == SQLITE_ROW;
+  }
+
+  // A blob must be inserted before the output_files that reference it
+  void insert(const std::string &hash, int64_t size) {
+    add_blob.bind_string(1, hash);
+    add_blob.bind_integer(2, size);
+    add_blob.step();
+    add_blob.reset();
+  }
+
+  // Removes every blob no longer referenced by a job from the database and
+  // returns their hashes so that the caller can stash_blobs() them.
+  // NOTE: It is assumed that this is already running inside of a transaction
+  std::vector<std::string> collect() {
+    std::vector<std::string> out;
+    {
+      auto defer_reset = wcl::make_defer([this]() { find_dead_blobs.reset(); });
+      while (find_dead_blobs.step() == SQLITE_ROW) {
+        out.emplace_back(find_dead_blobs.read_string(0));
+      }
+    }
+    if (!out.empty()) {
+      remove_dead_blobs.step();
+      remove_dead_blobs.reset();
+    }
+    return out;
+  }
+};
+
+}  // namespace job_cache
@@ -18,15 +18,59 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "hash.h"
 
-// TODO: Make the bloom filter bigger
+// A bloom filter over the content hashes of a job's inputs. A cached job can
+// only match a request if the job's filter is a subset of the request's filter
+// so a wide filter lets us skip most non-matching candidates without reading
+// their input manifests from the job_inputs table.
 class BloomFilter {
-  uint64_t bits = 0;
+ public:
+  // Changing either of these changes the on disk format so existing caches
+  // need an upgrade step, see upgrade_cache in daemon_cache.cpp.
+  static constexpr size_t bits = 1024;
+  static constexpr size_t hashes = 3;
+  static_assert(bits % 64 == 0, "bloom filter width must be a multiple of 64");
+
+ private:
+  static constexpr size_t words = bits / 64;
+  uint64_t bits_[words] = {};
 
  public:
-  void add_hash(Hash256 hash) { bits |= 1 << (hash.data[0] & 0x1F); }
-  size_t size() const { return sizeof(bits); }
-  const uint8_t *data() const { return reinterpret_cast<const uint8_t *>(&bits); }
+  // The hashes are blake2b digests so their words are already uniformly
+  // distributed. We derive the k bit indexes via double hashing.
+  void add_hash(const Hash256 &hash) {
+    uint64_t h1 = hash.data[0];
+    uint64_t h2 = hash.data[1] | 1;
+    for (size_t i = 0; i < hashes; ++i) {
+      uint64_t bit = (h1 + i * h2) % bits;
+      bits_[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+  }
+
+  // Branch free so the compiler can vectorize it.
+  bool is_subset_of(const BloomFilter &other) const {
+    uint64_t extra = 0;
+    for (size_t i = 0; i < words; ++i) {
+      extra |= bits_[i] & ~other.bits_[i];
+    }
+    return extra == 0;
+  }
+
+  // Filters read back from the database that don't have the expected width
+  // are treated as full so that they never match anything.
+  static BloomFilter from_data(const void *data, size_t size) {
+    BloomFilter out;
+    if (size == sizeof(out.bits_)) {
+      std::memcpy(out.bits_, data, size);
+    } else {
+      std::memset(out.bits_, 0xff, sizeof(out.bits_));
+    }
+    return out;
+  }
+
+  size_t size() const { return sizeof(bits_); }
+  const uint8_t *data() const { return reinterpret_cast<const uint8_t *>(bits_); }
 };
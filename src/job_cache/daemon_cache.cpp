@@ -23,6 +23,7 @@
 
 #include <json/json5.h>
 #include <sqlite3.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <sys/wait.h>
@@ -34,13 +35,21 @@
 #include <wcl/unique_fd.h>
 #include <wcl/xoshiro_256.h>
 
+#include <condition_variable>
 #include <ctime>
+#include <deque>
 #include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "blob_store.h"
 #include "db_helpers.h"
 #include "eviction_command.h"
 #include "eviction_policy.h"
+#include "input_manifest.h"
 #include "job_cache_impl_common.h"
 #include "message_parser.h"
 #include "message_sender.h"
@@ -270,45 +279,25 @@ int create_cache_socket(const std::string &dir, const std::string &key) {
 }
 
 // Database classes
-class InputFiles {
+class JobInputs {
  private:
-  PreparedStatement add_input_file;
+  PreparedStatement add_job_inputs;
 
  public:
   static constexpr const char *insert_query =
-      "insert into input_files (path, hash, job) values (?, ?, ?)";
+      "insert into job_inputs (job, files, dirs) values (?, ?, ?)";
 
-  InputFiles(std::shared_ptr<job_cache::Database> db) : add_input_file(db, insert_query) {
-    add_input_file.set_why("Could not insert input file");
+  JobInputs(std::shared_ptr<job_cache::Database> db) : add_job_inputs(db, insert_query) {
+    add_job_inputs.set_why("Could not insert job inputs");
   }
 
-  void insert(const std::string &path, Hash256 hash, int64_t job_id) {
-    add_input_file.bind_string(1, path);
-    add_input_file.bind_string(2, hash.to_hex());
-    add_input_file.bind_integer(3, job_id);
-    add_input_file.step();
-    add_input_file.reset();
-  }
-};
-
-class InputDirs {
- private:
-  PreparedStatement add_input_dir;
-
- public:
-  static constexpr const char *insert_query =
-      "insert into input_dirs (path, hash, job) values (?, ?, ?)";
-
-  InputDirs(std::shared_ptr<job_cache::Database> db) : add_input_dir(db, insert_query) {
-    add_input_dir.set_why("Could not insert input directory");
-  }
-
-  void insert(const std::string &path, Hash256 hash, int64_t job_id) {
-    add_input_dir.bind_string(1, path);
-    add_input_dir.bind_string(2, hash.to_hex());
-    add_input_dir.bind_integer(3, job_id);
-    add_input_dir.step();
-    add_input_dir.reset();
+  // Both are InputManifests
+  void insert(int64_t job_id, const std::string &files, const std::string &dirs) {
+    add_job_inputs.bind_integer(1, job_id);
+    add_job_inputs.bind_blob(2, files.data(), files.size());
+    add_job_inputs.bind_blob(3, dirs.data(), dirs.size());
+    add_job_inputs.step();
+    add_job_inputs.reset();
   }
 };
 
@@ -409,12 +398,11 @@ class JobTable {
   int64_t insert(const std::string &cwd, const std::string &cmd, const std::string &env,
                  const std::string &stdin_str, BloomFilter bloom, const std::string &hash,
                  int64_t time) {
-    int64_t bloom_integer = *reinterpret_cast<const int64_t *>(bloom.data());
     add_job.bind_string(1, cwd);
     add_job.bind_string(2, cmd);
     add_job.bind_string(3, env);
     add_job.bind_string(4, stdin_str);
-    add_job.bind_integer(5, bloom_integer);
+    add_job.bind_blob(5, bloom.data(), bloom.size());
     add_job.bind_string(6, hash);
     add_job.bind_integer(7, time);
     add_job.step();
@@ -446,30 +434,57 @@ class JobTable {
   }
 };
 
+// The visible files of a request keyed by path. Keys refer to the strings
+// already held by FindJobRequest::visible so building it copies no paths.
+class VisibleIndex {
+ private:
+  struct PathHash {
+    size_t operator()(const std::string &path) const { return std::hash<std::string>()(path); }
+  };
+  struct PathEqual {
+    bool operator()(const std::string &a, const std::string &b) const { return a == b; }
+  };
+  std::unordered_map<std::reference_wrapper<const std::string>, const Hash256 *, PathHash,
+                     PathEqual>
+      index;
+
+ public:
+  explicit VisibleIndex(const FindJobRequest &find_job_request) {
+    index.reserve(find_job_request.visible.size());
+    for (const auto &input : find_job_request.visible) {
+      index.emplace(std::cref(input.first), &input.second);
+    }
+  }
+
+  const Hash256 *find(const std::string &path) const {
+    auto iter = index.find(std::cref(path));
+    return iter == index.end() ? nullptr : iter->second;
+  }
+};
+
 class SelectMatchingJobs {
  private:
   PreparedStatement find_jobs;
-  PreparedStatement find_files;
-  PreparedStatement find_dirs;
   PreparedStatement find_outputs;
   PreparedStatement find_output_dirs;
   PreparedStatement find_output_symlinks;
   PreparedStatement find_job_output_info;
 
-  static wcl::optional<std::vector<std::string>> all_match(PreparedStatement &find, int64_t job_id,
-                                                           const FindJobRequest &find_job_request) {
-    auto defer_reset = wcl::make_defer([&find]() { find.reset(); });
-    find.bind_integer(1, job_id);
+  // Checks every entry of an InputManifest against the visible files of
+  // the request, returning the paths if they all match.
+  static wcl::optional<std::vector<std::string>> all_match(PreparedStatement &find, int column,
+                                                           const VisibleIndex &visible) {
+    size_t size;
+    const void *manifest = find.read_blob(column, &size);
     std::vector<std::string> out;
-    while (find.step() == SQLITE_ROW) {
-      std::string path = find.read_string(1);
-      Hash256 hash = Hash256::from_hex(find.read_string(2));
-      auto iter = find_job_request.visible.find(path);
-      if (iter == find_job_request.visible.end() || hash != iter->second) {
-        return {};
-      }
-      out.emplace_back(std::move(path));
-    }
+    bool matched = InputManifest::for_each(manifest, size, [&](const std::string &path,
+                                                               Hash256 hash) {
+      const Hash256 *visible_hash = visible.find(path);
+      if (!visible_hash || hash != *visible_hash) return false;
+      out.emplace_back(path);
+      return true;
+    });
+    if (!matched) return {};
     return {wcl::in_place_t{}, std::move(out)};
   }
 
@@ -537,20 +552,18 @@ class SelectMatchingJobs {
 
  public:
   // First we manually read everything in and we do additional
-  // processing on match.
+  // processing on match. SQLite can't do bitwise operations on blobs
+  // so the bloom filter check happens as we step through the results.
+  // The input manifests are only read for jobs that pass the bloom filter.
   static constexpr const char *sql_find_jobs =
-      "select job_id from jobs"
+      "select job_id, bloom_filter, files, dirs from jobs"
+      "  join job_inputs on job = job_id"
       "  where directory = ?"
       "  and   commandline = ?"
       "  and   environment = ?"
       "  and   stdin = ?"
-      "  and   bloom_filter & ~? = 0"
       "  and   runner_hash = ?";
 
-  // When we find a match we check all of its input files and input directories
-  static constexpr const char *sql_find_files = "select * from input_files where job = ?";
-  static constexpr const char *sql_input_dirs = "select * from input_dirs where job = ?";
-
   // Lastly if we find a job we need to read all of its outputs
   static constexpr const char *sql_output_files = "select * from output_files where job = ?";
   static constexpr const char *sql_output_dirs = "select * from output_dirs where job = ?";
@@ -563,15 +576,11 @@ class SelectMatchingJobs {
 
   SelectMatchingJobs(std::shared_ptr<job_cache::Database> db)
       : find_jobs(db, sql_find_jobs),
-        find_files(db, sql_find_files),
-        find_dirs(db, sql_input_dirs),
         find_outputs(db, sql_output_files),
         find_output_dirs(db, sql_output_dirs),
         find_output_symlinks(db, sql_output_symlinks),
         find_job_output_info(db, sql_job_output_info) {
     find_jobs.set_why("Could not find matching jobs");
-    find_files.set_why("Could not find files of the given job");
-    find_dirs.set_why("Could not find dirs of the given job");
   }
 
   // NOTE: It is assumed that this is already running inside of a transaction
@@ -584,14 +593,20 @@ class SelectMatchingJobs {
     find_jobs.bind_string(2, find_job_request.command_line);
     find_jobs.bind_string(3, find_job_request.environment);
     find_jobs.bind_string(4, find_job_request.stdin_str);
-    find_jobs.bind_string(6, find_job_request.runner_hash);
+    find_jobs.bind_string(5, find_job_request.runner_hash);
 
-    // The bloom filter of a matching job has to be a subset of this one
-    uint64_t bloom_integer = *reinterpret_cast<const uint64_t *>(find_job_request.bloom.data());
-    find_jobs.bind_integer(5, bloom_integer);
+    // Only built once a candidate gets past the bloom filter
+    wcl::optional<VisibleIndex> visible;
 
     // Loop over all matching jobs
     while (find_jobs.step() == SQLITE_ROW) {
+      // The bloom filter of a matching job has to be a subset of this one
+      size_t bloom_size;
+      const void *bloom_data = find_jobs.read_blob(1, &bloom_size);
+      if (!BloomFilter::from_data(bloom_data, bloom_size).is_subset_of(find_job_request.bloom)) {
+        continue;
+      }
+
       // Having found a matching job we need to check all the files
       // and directories have matching hashes.
       int64_t job_id = find_jobs.read_integer(0);
@@ -601,9 +616,10 @@ class SelectMatchingJobs {
       auto output_info = read_output_info(job_id);
       if (!output_info) continue;
 
-      auto found_input_files = all_match(find_files, job_id, find_job_request);
+      if (!visible) visible = wcl::make_some<VisibleIndex>(find_job_request);
+      auto found_input_files = all_match(find_jobs, 2, *visible);
       if (!found_input_files) continue;
-      auto found_input_dirs = all_match(find_dirs, job_id, find_job_request);
+      auto found_input_dirs = all_match(find_jobs, 3, *visible);
       if (!found_input_dirs) continue;
 
       // Ok this is the job, it matches *exactly* so we should
@@ -636,6 +652,214 @@ static void mkdir_all(Iter begin, Iter end) {
   }
 }
 
+// Older caches are upgraded in place when the daemon starts. user_version
+// records which of these upgrades a cache has had:
+//   1: jobs.bloom_filter widened from a 64-bit integer to a BloomFilter blob
+//   2: input_files/input_dirs rows packed into job_inputs manifests
+//   3: output files moved from <group>/<job_id>/<hash> into the blob store
+static constexpr int64_t cache_version = 3;
+
+// The old integer filters were built with a different hash and would never
+// pass the subset check so rebuild them from the stored input hashes.
+static void upgrade_bloom_filters(std::shared_ptr<job_cache::Database> db,
+                                  const std::vector<int64_t> &job_ids) {
+  PreparedStatement select_hashes(
+      db,
+      "select hash from input_files where job = ?1"
+      " union all select hash from input_dirs where job = ?1");
+  PreparedStatement update_bloom(db, "update jobs set bloom_filter = ? where job_id = ?");
+  select_hashes.set_why("Could not select input hashes");
+  update_bloom.set_why("Could not upgrade bloom filter");
+
+  for (int64_t job_id : job_ids) {
+    BloomFilter bloom;
+    select_hashes.bind_integer(1, job_id);
+    while (select_hashes.step() == SQLITE_ROW) {
+      bloom.add_hash(Hash256::from_hex(select_hashes.read_string(0)));
+    }
+    select_hashes.reset();
+
+    update_bloom.bind_blob(1, bloom.data(), bloom.size());
+    update_bloom.bind_integer(2, job_id);
+    update_bloom.step();
+    update_bloom.reset();
+  }
+}
+
+static std::string read_input_manifest(PreparedStatement &select, int64_t job_id) {
+  std::vector<std::pair<std::string, Hash256>> entries;
+  select.bind_integer(1, job_id);
+  while (select.step() == SQLITE_ROW) {
+    entries.emplace_back(select.read_string(0), Hash256::from_hex(select.read_string(1)));
+  }
+  select.reset();
+  return InputManifest::encode(std::move(entries));
+}
+
+static void upgrade_input_manifests(std::shared_ptr<job_cache::Database> db,
+                                    const std::vector<int64_t> &job_ids) {
+  PreparedStatement select_files(db, "select path, hash from input_files where job = ?");
+  PreparedStatement select_dirs(db, "select path, hash from input_dirs where job = ?");
+  PreparedStatement clear_files(db, "delete from input_files");
+  PreparedStatement clear_dirs(db, "delete from input_dirs");
+  select_files.set_why("Could not select input files");
+  select_dirs.set_why("Could not select input dirs");
+  clear_files.set_why("Could not clear input files");
+  clear_dirs.set_why("Could not clear input dirs");
+  JobInputs job_inputs(db);
+
+  for (int64_t job_id : job_ids) {
+    std::string files = read_input_manifest(select_files, job_id);
+    std::string dirs = read_input_manifest(select_dirs, job_id);
+    job_inputs.insert(job_id, files, dirs);
+  }
+
+  clear_files.step();
+  clear_files.reset();
+  clear_dirs.step();
+  clear_dirs.reset();
+}
+
+static std::string legacy_group_dir(int64_t job_id) {
+  group_id_t group_id = job_id & 0xFF;
+  return wcl::to_hex(&group_id);
+}
+
+static std::string legacy_job_dir(int64_t job_id) {
+  return wcl::join_paths(legacy_group_dir(job_id), std::to_string(job_id));
+}
+
+// Caches from before the blob store kept a copy of every output in its job's
+// folder and have no blobs rows for them. Without those rows evicting one job
+// would collect a blob other jobs still use, and the outputs would be missing
+// from the total size. Move one copy of each output into the blob store and
+// count its references. Jobs whose outputs can no longer be found are dropped.
+// Returns the jobs whose folders should be removed once this commits.
+static std::vector<int64_t> upgrade_blob_store(std::shared_ptr<job_cache::Database> db) {
+  PreparedStatement select_hashes(
+      db, "select distinct hash from output_files where hash not in (select hash from blobs)");
+  PreparedStatement select_jobs(db, "select distinct job from output_files where hash = ?");
+  PreparedStatement add_blob(db,
+                             "insert into blobs (hash, size, refcount)"
+                             " select ?1, ?2, count(*) from output_files where hash = ?1");
+  PreparedStatement drop_jobs(
+      db, "delete from jobs where job_id in (select job from output_files where hash = ?)");
+  select_hashes.set_why("Could not select legacy output hashes");
+  select_jobs.set_why("Could not select legacy output jobs");
+  add_blob.set_why("Could not insert legacy blob");
+  drop_jobs.set_why("Could not drop jobs with missing outputs");
+
+  std::vector<std::string> hashes;
+  while (select_hashes.step() == SQLITE_ROW) {
+    hashes.push_back(select_hashes.read_string(0));
+  }
+  select_hashes.reset();
+
+  std::unordered_set<int64_t> legacy_jobs;
+  size_t moved = 0, dropped = 0;
+  for (const auto &hash : hashes) {
+    std::vector<int64_t> jobs;
+    select_jobs.bind_string(1, hash);
+    while (select_jobs.step() == SQLITE_ROW) {
+      jobs.push_back(select_jobs.read_integer(0));
+    }
+    select_jobs.reset();
+    // Dropping an earlier job may have removed every reference
+    if (jobs.empty()) continue;
+    legacy_jobs.insert(jobs.begin(), jobs.end());
+
+    // An interrupted upgrade may have already moved this blob into place
+    std::string blob = blob_path(hash);
+    struct stat buf;
+    bool found = stat(blob.c_str(), &buf) == 0;
+    for (size_t i = 0; !found && i < jobs.size(); ++i) {
+      std::string legacy = wcl::join_paths(legacy_job_dir(jobs[i]), hash);
+      if (stat(legacy.c_str(), &buf) != 0) continue;
+      mkdir_no_fail("blobs");
+      mkdir_no_fail(wcl::join_paths("blobs", hash.substr(0, 2)).c_str());
+      rename_no_fail(legacy.c_str(), blob.c_str());
+      found = true;
+    }
+
+    if (!found) {
+      drop_jobs.bind_string(1, hash);
+      drop_jobs.step();
+      drop_jobs.reset();
+      dropped += jobs.size();
+      continue;
+    }
+
+    add_blob.bind_string(1, hash);
+    add_blob.bind_integer(2, buf.st_size);
+    add_blob.step();
+    add_blob.reset();
+    ++moved;
+  }
+
+  if (!hashes.empty()) {
+    wcl::log::info("Moved %lu legacy outputs into the blob store, dropped %lu jobs", moved,
+                   dropped)();
+  }
+  return std::vector<int64_t>(legacy_jobs.begin(), legacy_jobs.end());
+}
+
+// The remaining files are copies of blobs that are now in the store. Failing
+// to remove them only wastes space so errors are logged and ignored.
+static void remove_legacy_job_dirs(const std::vector<int64_t> &job_ids) {
+  for (int64_t job_id : job_ids) {
+    std::string job_dir = legacy_job_dir(job_id);
+    auto dir_res = wcl::directory_range::open(job_dir);
+    if (!dir_res) continue;
+    for (const auto &entry : *dir_res) {
+      if (!entry || entry->name == "." || entry->name == "..") continue;
+      unlink(wcl::join_paths(job_dir, entry->name).c_str());
+    }
+    if (rmdir(job_dir.c_str()) != 0) {
+      wcl::log::info("rmdir(%s): %s", job_dir.c_str(), strerror(errno))();
+    }
+    // The group folder goes away with its last job
+    (void)rmdir(legacy_group_dir(job_id).c_str());
+  }
+}
+
+static void upgrade_cache(std::shared_ptr<job_cache::Database> db) {
+  PreparedStatement get_version(db, "pragma user_version");
+  get_version.set_why("Could not read the cache version");
+  get_version.step();
+  int64_t version = get_version.read_integer(0);
+  get_version.reset();
+  if (version >= cache_version) return;
+
+  PreparedStatement select_jobs(db, "select job_id from jobs");
+  PreparedStatement set_version(db, "pragma user_version = " + std::to_string(cache_version));
+  select_jobs.set_why("Could not select jobs to upgrade");
+  set_version.set_why("Could not set the cache version");
+
+  std::vector<int64_t> legacy_jobs;
+  Transaction transact(db);
+  transact.run([&]() {
+    std::vector<int64_t> job_ids;
+    while (select_jobs.step() == SQLITE_ROW) {
+      job_ids.push_back(select_jobs.read_integer(0));
+    }
+    select_jobs.reset();
+
+    if (version < 1) upgrade_bloom_filters(db, job_ids);
+    if (version < 2) upgrade_input_manifests(db, job_ids);
+    if (version < 3) legacy_jobs = upgrade_blob_store(db);
+
+    set_version.step();
+    set_version.reset();
+
+    if (!job_ids.empty()) {
+      wcl::log::info("Upgraded %lu jobs from cache version %ld to %ld", job_ids.size(), version,
+                     cache_version)();
+    }
+  });
+
+  remove_legacy_job_dirs(legacy_jobs);
+}
+
 }  // namespace
 
 namespace job_cache {
@@ -646,11 +870,11 @@ struct CacheDbImpl {
 
  public:
   JobTable jobs;
-  InputFiles input_files;
-  InputDirs input_dirs;
+  JobInputs job_inputs;
   OutputFiles output_files;
   OutputDirs output_dirs;
   OutputSymlinks output_symlinks;
+  BlobStore blobs;
   Transaction transact;
   SelectMatchingJobs matching_jobs;
   std::unique_ptr<EvictionPolicy> policy;
@@ -658,13 +882,15 @@ struct CacheDbImpl {
   CacheDbImpl(EvictionConfig config, const std::string &_dir)
       : db(std::make_unique<job_cache::Database>(_dir)),
         jobs(db),
-        input_files(db),
-        input_dirs(db),
+        job_inputs(db),
         output_files(db),
         output_dirs(db),
         output_symlinks(db),
+        blobs(db),
         transact(db),
         matching_jobs(db) {
+    upgrade_cache(db);
+
     switch (config.type) {
       case EvictionPolicyType::TTL:
         wcl::log::info("Using TTL eviction policy, seconds_to_live = %lu",
@@ -681,153 +907,105 @@ struct CacheDbImpl {
   }
 };
 
-DaemonCache::DaemonCache(std::string dir, std::string bulk_dir, EvictionConfig config)
-    : rng(wcl::xoshiro_256::get_rng_seed()), config(config) {
-  mkdir_no_fail(dir.c_str());
-  chdir_no_fail(dir.c_str());
-
-  initialize_logging(bulk_dir);
-
-  wcl::log::info("Launching DaemonCache. dir = %s", dir.c_str())();
-
-  // Get some random bits to name our domain socket with
-  key = rng.unique_name();
-  listen_socket_fd = create_cache_socket(".", key);
-
-  impl = std::make_unique<CacheDbImpl>(config, ".");
-}
-
-int DaemonCache::run() {
-  auto cleanup = wcl::make_defer([]() {
-    unlink_no_fail(".key");
-    wcl::log::info("Exiting run loop.")();
-  });
-
-  poll.add(listen_socket_fd, EPOLLIN);
-  uint32_t no_events_sec_counter = 0;
-  while (!exit_now) {
-    // While the daemon exits after 10 minutes,
-    // we only have our epoll timeout set at
-    // 5 seconds. This is to ensure that we can
-    // hit all of our timeout deadlines to within
-    // 5 seconds.
-    struct timespec wait_until;
-    wait_until.tv_sec = 5;
-    wait_until.tv_nsec = 0;
+// The result of a cache/read served by a CacheReader
+struct ReadResult {
+  int client_fd;
+  uint64_t generation;   // of the client that asked
+  uint64_t request_id;   // the client's id for the request
+  std::string response;      // null terminated json of the FindJobResponse
+  int64_t job_id = -1;       // the job that was read, if any
+  std::string missing_blob;  // set if the job's outputs could not be linked
+};
 
-    wcl::log::info("daemon: Waiting on an event")();
-    auto events = poll.wait(&wait_until, nullptr);
-    wcl::log::info("received %zu events!", events.size())();
+// One or more reads sent together by a client. The reads of a batch are
+// matched in one transaction and answered one by one.
+struct ReadRequest {
+  int client_fd;
+  uint64_t generation;
+  std::deque<std::pair<uint64_t, FindJobRequest>> reads;  // by request id
+  bool binary;  // answer with binary frames rather than json
+};
 
-    if (events.empty()) {
-      no_events_sec_counter += wait_until.tv_sec;
-      if (no_events_sec_counter >= 10 * 60) {
-        wcl::log::info("No events for 10 minutes, exiting.")();
-        return 0;
-      }
-    } else {
-      no_events_sec_counter = 0;
-    }
+// Serves cache/read requests from a worker thread. Each reader has its own
+// read only connection to the database so matching never waits on the writer
+// for longer than a transaction, and the file work happens outside of it.
+// Anything that writes to the database is left to the daemon's main thread.
+struct CacheReader {
+  std::shared_ptr<job_cache::Database> db;
+  ReadTransaction transact;
+  SelectMatchingJobs matching_jobs;
+  wcl::xoshiro_256 rng;
 
-    for (auto event : events) {
-      // The only events we check for on the listen socket
-      // are accepting new connections
-      if (event.data.fd == listen_socket_fd) {
-        wcl::log::info("processing listen socket event!")();
-        handle_new_client();
-        continue;
-      }
+  explicit CacheReader(const std::string &dir)
+      : db(std::make_shared<job_cache::Database>(dir, true)),
+        transact(db),
+        matching_jobs(db),
+        rng(wcl::xoshiro_256::get_rng_seed()) {}
 
-      // Check if this was a read event that we can handle
-      if (event.events & EPOLLIN) {
-        wcl::log::info("processing EPOLLIN event on %d", event.data.fd)();
-        handle_read_msg(event.data.fd);
-      }
+  // Calls `done` with the result of each read as soon as it's ready, so
+  // misses are answered before any hit's outputs have been put in place.
+  void read(const ReadRequest &request, const std::function<void(ReadResult &&)> &done);
 
-      // Check if we can write something again
-      if (event.events & EPOLLOUT) {
-        wcl::log::info("processing EPOLLOUT event on %d", event.data.fd)();
-        handle_write(event.data.fd);
-      }
+ private:
+  FindJobResponse put_outputs(const FindJobRequest &find_request,
+                              wcl::optional<std::pair<int, MatchingJob>> &matching_job,
+                              ReadResult &out);
+};
 
-      if ((event.events & (EPOLLIN | EPOLLOUT)) == 0) {
-        wcl::log::info("Unrecognized event on %d: events = %d", event.data.fd, event.events)();
-      }
-    }
+void CacheReader::read(const ReadRequest &request,
+                       const std::function<void(ReadResult &&)> &done) {
+  std::vector<wcl::optional<std::pair<int, MatchingJob>>> matching_jobs_found;
+  matching_jobs_found.reserve(request.reads.size());
 
-    // Check for timeouts
-    std::unordered_set<int> clients_to_close;
-    for (auto &client : message_senders) {
-      if (client.second.has_timed_out()) {
-        clients_to_close.insert(client.first);
-      }
+  // We want to hold the database lock for as little time as possible. The
+  // whole batch is matched under one lock and outputs are put in place after.
+  transact.run([this, &request, &matching_jobs_found]() {
+    for (const auto &read : request.reads) {
+      matching_jobs_found.emplace_back(matching_jobs.find(read.second));
     }
+  });
 
-    for (auto &client : message_parsers) {
-      if (client.second.has_timed_out()) {
-        clients_to_close.insert(client.first);
-      }
-    }
+  auto respond = [&](size_t i, ReadResult &result, const FindJobResponse &response) {
+    result.client_fd = request.client_fd;
+    result.generation = request.generation;
+    result.request_id = request.reads[i].first;
 
-    for (auto client_fd : clients_to_close) {
-      close_client(client_fd);
+    if (request.binary) {
+      BinaryWriter out(BinaryMethod::Response);
+      out.write_varint(result.request_id);
+      response.to_binary(out);
+      result.response = out.finish();
+    } else {
+      // Convert the json to a string with a null terminator
+      JAST json = response.to_json();
+      json.add("id", int64_t(result.request_id));
+      std::stringstream ss;
+      ss << json;
+      ss << '\0';
+      result.response = ss.str();
     }
-  }
-
-  return 0;
-}
-
-void DaemonCache::remove_corrupt_job(int64_t job_id) {
-  // First remove this job from the database so that we don't get hung up on it anymore
-  impl->jobs.remove(job_id);
-
-  // Find this job directory so we can remove all the files
-  group_id_t group_id = job_id & 0xFF;
-  std::string job_dir = wcl::join_paths(wcl::to_hex(&group_id), std::to_string(job_id));
+    done(std::move(result));
+  };
 
-  // Iterate over these files collecting the paths to delete
-  std::vector<std::string> to_delete;
-  auto dir_res = wcl::directory_range::open(job_dir);
-  if (!dir_res) {
-    // We can keep going even with this failure but we need to at least log it
-    wcl::log::error("cleaning corrupt job: wcl::directory_range::open(%s): %s", job_dir.c_str(),
-                    strerror(dir_res.error()))();
-    return;
+  FindJobResponse miss(wcl::optional<MatchingJob>{});
+  for (size_t i = 0; i < request.reads.size(); ++i) {
+    if (matching_jobs_found[i]) continue;
+    ReadResult result;
+    respond(i, result, miss);
   }
 
-  // Find all the entries to remove
-  for (const auto &entry : *dir_res) {
-    if (!entry) {
-      // It isn't critical that we remove this so just log the error and move on
-      wcl::log::error("cleaning corrupt job: bad entry in %s: %s", job_dir.c_str(),
-                      strerror(entry.error()))();
-      return;
-    }
-    to_delete.emplace_back(wcl::join_paths(job_dir, entry->name));
+  for (size_t i = 0; i < request.reads.size(); ++i) {
+    if (!matching_jobs_found[i]) continue;
+    ReadResult result;
+    FindJobResponse response =
+        put_outputs(request.reads[i].second, matching_jobs_found[i], result);
+    respond(i, result, response);
   }
-
-  // Unlink them all
-  for (const auto &file : to_delete) {
-    // We don't want to fail if this fails for some reason, so just
-    // ignore the error.
-    unlink(file.c_str());
-  }
-
-  // Remove the files, but don't fail if the rmdir fails
-  rmdir(job_dir.c_str());
 }
 
-FindJobResponse DaemonCache::read(const FindJobRequest &find_request) {
-  wcl::optional<std::pair<int, MatchingJob>> matching_job;
-
-  // We want to hold the database lock for as little time as possible
-  impl->transact.run([this, &find_request, &matching_job]() {
-    matching_job = impl->matching_jobs.find(find_request);
-  });
-
-  // Return early if there was no match.
-  if (!matching_job) return FindJobResponse(wcl::optional<MatchingJob>{});
-
+FindJobResponse CacheReader::put_outputs(const FindJobRequest &find_request,
+                                         wcl::optional<std::pair<int, MatchingJob>> &matching_job,
+                                         ReadResult &out) {
   int job_id = matching_job->first;
   MatchingJob &result = matching_job->second;
 
@@ -835,27 +1013,26 @@ FindJobResponse DaemonCache::read(const FindJobRequest &find_request) {
   std::string tmp_job_dir = "tmp_outputs_" + rng.unique_name();
   mkdir_no_fail(tmp_job_dir.c_str());
 
-  // We also need to know what directory we're reading out of
-  group_id_t group_id = job_id & 0xFF;
-  std::string job_dir = wcl::join_paths(wcl::to_hex(&group_id), std::to_string(job_id));
-
   // We then hard link each file to a new location atomically.
   // If any of these hard links fail then we fail this read
   // and clean up. This allows job cleanup to occur during
   // a read. That would be an unfortunate situation but its
   // very unlikely to occur so its better to commit the
   // transaction early and suffer the consequences of unlinking
-  // one of the files just before we need it.
+  // one of the files just before we need it. A blob can also
+  // be missing because the job is still being added, so we
+  // only report it and let the writer decide if it's corrupt.
   std::vector<std::tuple<std::string, std::string, mode_t>> to_copy;
   bool success = true;
   for (const auto &output_file : result.output_files) {
     std::string hash_name = output_file.hash.to_hex();
-    std::string cur_file = wcl::join_paths(job_dir, hash_name);
+    std::string cur_file = blob_path(hash_name);
     std::string tmp_file = wcl::join_paths(tmp_job_dir, hash_name);
     int ret = link(cur_file.c_str(), tmp_file.c_str());
     if (ret < 0 && errno != EEXIST) {
       success = false;
-      remove_corrupt_job(job_id);
+      out.job_id = job_id;
+      out.missing_blob = std::move(cur_file);
       break;
     }
     to_copy.emplace_back(std::make_tuple(std::move(tmp_file), output_file.path, output_file.mode));
@@ -916,10 +1093,21 @@ FindJobResponse DaemonCache::read(const FindJobRequest &find_request) {
       // in this case.
       mkdir_all(pair.second.begin(), pair.second.end());
 
-      // Finally copy the file (as efficently as we can) to
-      // the destination.
+      // Finally put the file in place as the client's policy allows. Read only
+      // outputs can share the blob's inode outright, everything else
+      // gets its own copy (or reflink) so that it can be modified.
       std::string tmp_dst = pair.first + ".local-cache-tmp." + rng.unique_name();
-      copy_or_reflink(tmp_file.c_str(), tmp_dst.c_str(), mode, O_EXCL);
+      switch (find_request.materialize) {
+        case MaterializePolicy::HardlinkReadonly:
+          if (try_hardlink_readonly(tmp_file.c_str(), tmp_dst.c_str(), mode)) break;
+          // fallthrough
+        case MaterializePolicy::Reflink:
+          copy_or_reflink(tmp_file.c_str(), tmp_dst.c_str(), mode, O_EXCL);
+          break;
+        case MaterializePolicy::Copy:
+          copy_file(tmp_file.c_str(), tmp_dst.c_str(), mode, O_EXCL);
+          break;
+      }
       rename_no_fail(tmp_dst.c_str(), pair.first.c_str());
     }
 
@@ -996,11 +1184,210 @@ FindJobResponse DaemonCache::read(const FindJobRequest &find_request) {
     redirect_path(input_dir);
   }
 
-  impl->policy->read(job_id);
+  out.job_id = job_id;
 
   return FindJobResponse(wcl::make_some<MatchingJob>(std::move(result)));
 }
 
+// A fixed pool of threads, each with its own CacheReader. The epoll thread
+// pushes requests and is woken through `event_fd` when results are ready.
+struct ReadWorkers {
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::deque<ReadRequest> requests;
+  std::deque<ReadResult> results;
+  std::vector<std::thread> threads;
+  int event_fd;
+  bool stop = false;
+
+  ReadWorkers(const std::string &dir, size_t num_threads) {
+    event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd == -1) {
+      wcl::log::error("eventfd: %s", strerror(errno)).urgent()();
+      exit(1);
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+      threads.emplace_back([this, dir]() { work(dir); });
+    }
+  }
+
+  ~ReadWorkers() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    wake.notify_all();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    close(event_fd);
+  }
+
+  void push(ReadRequest &&request) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      requests.emplace_back(std::move(request));
+    }
+    wake.notify_one();
+  }
+
+  // Called from the epoll thread once event_fd is readable
+  std::deque<ReadResult> pop_results() {
+    uint64_t count;
+    while (::read(event_fd, &count, sizeof(count)) < 0 && errno == EINTR) {
+    }
+    std::deque<ReadResult> out;
+    std::lock_guard<std::mutex> lock(mutex);
+    out.swap(results);
+    return out;
+  }
+
+ private:
+  void work(const std::string &dir) {
+    CacheReader reader(dir);
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex);
+      wake.wait(lock, [this]() { return stop || !requests.empty(); });
+      if (stop) return;
+      ReadRequest request = std::move(requests.front());
+      requests.pop_front();
+      lock.unlock();
+
+      reader.read(request, [this](ReadResult &&result) {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          results.emplace_back(std::move(result));
+        }
+
+        uint64_t one = 1;
+        while (write(event_fd, &one, sizeof(one)) < 0 && errno == EINTR) {
+        }
+      });
+    }
+  }
+};
+
+DaemonCache::DaemonCache(std::string dir, std::string bulk_dir, EvictionConfig config,
+                         size_t worker_threads)
+    : rng(wcl::xoshiro_256::get_rng_seed()), config(config) {
+  mkdir_no_fail(dir.c_str());
+  chdir_no_fail(dir.c_str());
+
+  initialize_logging(bulk_dir);
+
+  wcl::log::info("Launching DaemonCache. dir = %s", dir.c_str())();
+
+  // Get some random bits to name our domain socket with
+  key = rng.unique_name();
+  listen_socket_fd = create_cache_socket(".", key);
+
+  mkdir_no_fail("blobs");
+  impl = std::make_unique<CacheDbImpl>(config, ".");
+
+  // The workers open the database only after the schema has been applied
+  wcl::log::info("Launching %zu read workers", worker_threads)();
+  workers = std::make_unique<ReadWorkers>(".", std::max<size_t>(1, worker_threads));
+}
+
+int DaemonCache::run() {
+  auto cleanup = wcl::make_defer([]() {
+    unlink_no_fail(".key");
+    wcl::log::info("Exiting run loop.")();
+  });
+
+  poll.add(listen_socket_fd, EPOLLIN);
+  poll.add(workers->event_fd, EPOLLIN);
+  uint32_t no_events_sec_counter = 0;
+  while (!exit_now) {
+    // While the daemon exits after 10 minutes,
+    // we only have our epoll timeout set at
+    // 5 seconds. This is to ensure that we can
+    // hit all of our timeout deadlines to within
+    // 5 seconds.
+    struct timespec wait_until;
+    wait_until.tv_sec = 5;
+    wait_until.tv_nsec = 0;
+
+    wcl::log::info("daemon: Waiting on an event")();
+    auto events = poll.wait(&wait_until, nullptr);
+    wcl::log::info("received %zu events!", events.size())();
+
+    if (events.empty()) {
+      no_events_sec_counter += wait_until.tv_sec;
+      if (no_events_sec_counter >= 10 * 60) {
+        wcl::log::info("No events for 10 minutes, exiting.")();
+        return 0;
+      }
+    } else {
+      no_events_sec_counter = 0;
+    }
+
+    for (auto event : events) {
+      // The only events we check for on the listen socket
+      // are accepting new connections
+      if (event.data.fd == listen_socket_fd) {
+        wcl::log::info("processing listen socket event!")();
+        handle_new_client();
+        continue;
+      }
+
+      // Workers signal this when they have finished reads
+      if (event.data.fd == workers->event_fd) {
+        handle_read_done();
+        continue;
+      }
+
+      // Check if this was a read event that we can handle
+      if (event.events & EPOLLIN) {
+        wcl::log::info("processing EPOLLIN event on %d", event.data.fd)();
+        handle_read_msg(event.data.fd);
+      }
+
+      // Check if we can write something again
+      if (event.events & EPOLLOUT) {
+        wcl::log::info("processing EPOLLOUT event on %d", event.data.fd)();
+        handle_write(event.data.fd);
+      }
+
+      if ((event.events & (EPOLLIN | EPOLLOUT)) == 0) {
+        wcl::log::info("Unrecognized event on %d: events = %d", event.data.fd, event.events)();
+      }
+    }
+
+    // Check for clients that have stopped reading their responses. Clients
+    // that are just idle are left alone since they keep their connection.
+    std::unordered_set<int> clients_to_close;
+    for (auto &client : clients) {
+      if (!client.second.senders.empty() && client.second.senders.front().has_timed_out()) {
+        clients_to_close.insert(client.first);
+      }
+    }
+
+    for (auto client_fd : clients_to_close) {
+      close_client(client_fd);
+    }
+
+    impl->policy->tick();
+  }
+
+  return 0;
+}
+
+void DaemonCache::remove_corrupt_job(int64_t job_id) {
+  // First remove this job from the database so that we don't get hung up on it anymore.
+  // Any blobs only it referenced go with it.
+  std::vector<std::string> dead_blobs;
+  impl->transact.run([this, job_id, &dead_blobs]() {
+    impl->jobs.remove(job_id);
+    dead_blobs = impl->blobs.collect();
+  });
+
+  // Then remove the backing files of those blobs
+  std::string stash_dir = "tmp_corrupt_" + rng.unique_name();
+  stash_blobs(dead_blobs, stash_dir);
+  remove_stashed_blobs(stash_dir);
+}
+
 void DaemonCache::add(const AddJobRequest &add_request) {
   // Create a unique name for the job dir (will rename later to correct name)
   std::string tmp_job_dir = "tmp_" + rng.unique_name();
@@ -1011,24 +1398,62 @@ void DaemonCache::add(const AddJobRequest &add_request) {
   clock_gettime(CLOCK_REALTIME, &tp);
   int64_t time = 1000000ll * int64_t(tp.tv_sec) + tp.tv_nsec / 1000;
 
-  // Copy the output files into the temp dir
-  for (auto output_file : add_request.outputs) {
-    // TODO(jake): See if this file already exists in another job to
-    //             avoid the copy by using a link and also save disk
-    //             space.
-    std::string blob_path = wcl::join_paths(tmp_job_dir, output_file.hash.to_hex());
+  // Copies an output into the temp dir to be stored as a new blob
+  std::vector<std::pair<std::string, int64_t>> new_blobs;
+  auto store_blob = [&](const std::string &hash, const OutputFile &output_file) {
+    std::string tmp_blob_path = wcl::join_paths(tmp_job_dir, hash);
+
+    std::string source = output_file.source;
+    if (wcl::is_relative(source)) {
+      source = wcl::join_paths(add_request.client_cwd, source);
+    }
+
+    // Blobs are never written once stored so they're kept read only. The
+    // execute bits follow the first output stored with this content. With
+    // the hardlink-readonly policy an output whose mode matches can then be
+    // hard linked to the blob rather than copied.
+    copy_or_reflink(source.c_str(), tmp_blob_path.c_str(), (output_file.mode & 0555) | 0444);
+
+    // The blob is accounted by what it really takes up in the cache
+    struct stat buf;
+    if (stat(tmp_blob_path.c_str(), &buf) < 0) {
+      wcl::log::error("stat(%s): %s", tmp_blob_path.c_str(), strerror(errno)).urgent()();
+      exit(1);
+    }
+    new_blobs.emplace_back(hash, buf.st_size);
+  };
 
-    if (wcl::is_relative(output_file.source)) {
-      output_file.source = wcl::join_paths(add_request.client_cwd, output_file.source);
+  // Copy the output files that aren't stored yet into the temp dir. Outputs
+  // that are already stored only need another reference. Eviction may collect
+  // one of those before the transaction below so they're checked again there.
+  std::unordered_set<std::string> seen_blobs;
+  std::vector<const OutputFile *> stored_outputs;
+  for (const auto &output_file : add_request.outputs) {
+    std::string hash = output_file.hash.to_hex();
+    if (!seen_blobs.insert(hash).second) continue;
+    if (impl->blobs.contains(hash)) {
+      stored_outputs.push_back(&output_file);
+      continue;
     }
+    store_blob(hash, output_file);
+  }
+
+  std::vector<std::pair<std::string, Hash256>> entries;
+  for (const auto &input_file : add_request.inputs) {
+    entries.emplace_back(input_file.path, input_file.hash);
+  }
+  std::string input_files = InputManifest::encode(std::move(entries));
 
-    copy_or_reflink(output_file.source.c_str(), blob_path.c_str());
+  entries.clear();
+  for (const auto &input_dir : add_request.directories) {
+    entries.emplace_back(input_dir.path, input_dir.hash);
   }
+  std::string input_dirs = InputManifest::encode(std::move(entries));
 
   // Start a transaction so that a job is never without its files.
   int64_t job_id;
   {
-    impl->transact.run([this, time, &add_request, &job_id]() {
+    impl->transact.run([&]() {
       job_id = impl->jobs.insert(add_request.cwd, add_request.command_line, add_request.environment,
                                  add_request.stdin_str, add_request.bloom, add_request.runner_hash,
                                  time);
@@ -1038,14 +1463,18 @@ void DaemonCache::add(const AddJobRequest &add_request) {
                                     add_request.status, add_request.runtime, add_request.cputime,
                                     add_request.mem, add_request.ibytes, add_request.obytes);
 
-      // Input Files
-      for (const auto &input_file : add_request.inputs) {
-        impl->input_files.insert(input_file.path, input_file.hash, job_id);
+      // Input Files and Dirs
+      impl->job_inputs.insert(job_id, input_files, input_dirs);
+
+      // Rarely a blob that was stored when we looked has been evicted since
+      for (const auto *output_file : stored_outputs) {
+        std::string hash = output_file->hash.to_hex();
+        if (!impl->blobs.contains(hash)) store_blob(hash, *output_file);
       }
 
-      // Input Dirs
-      for (const auto &input_dir : add_request.directories) {
-        impl->input_dirs.insert(input_dir.path, input_dir.hash, job_id);
+      // Blobs have to exist before the output files that reference them
+      for (const auto &blob : new_blobs) {
+        impl->blobs.insert(blob.first, blob.second);
       }
 
       // Output Files
@@ -1063,7 +1492,7 @@ void DaemonCache::add(const AddJobRequest &add_request) {
         impl->output_symlinks.insert(output_symlink.path, output_symlink.value, job_id);
       }
 
-      // We commit the database without having moved the job directory.
+      // We commit the database without having moved the new blobs.
       // On *read* you have to be aware that the database can be in
       // this kind of faulty state where the database is populated but
       // file system is *not* populated. In such a case we interpret that
@@ -1072,14 +1501,16 @@ void DaemonCache::add(const AddJobRequest &add_request) {
     });
   }
 
-  // Finally we make sure the group directory exits and then
-  // atomically rename the temp job into place which completes
+  // Finally we make sure the blob group directories exist and then
+  // atomically rename the new blobs into place which completes
   // the insertion. At that point reads should succeed.
-  uint8_t job_group = job_id & 0xFF;
-  std::string job_group_dir = wcl::to_hex<uint8_t>(&job_group);
-  mkdir_no_fail(job_group_dir.c_str());
-  std::string job_dir = wcl::join_paths(job_group_dir, std::to_string(job_id));
-  rename_no_fail(tmp_job_dir.c_str(), job_dir.c_str());
+  for (const auto &blob : new_blobs) {
+    std::string tmp_blob_path = wcl::join_paths(tmp_job_dir, blob.first);
+    std::string final_blob_path = blob_path(blob.first);
+    mkdir_no_fail(wcl::join_paths("blobs", blob.first.substr(0, 2)).c_str());
+    rename_no_fail(tmp_blob_path.c_str(), final_blob_path.c_str());
+  }
+  rmdir_no_fail(tmp_job_dir.c_str());
 
   impl->policy->write(job_id);
 }
@@ -1099,7 +1530,7 @@ void DaemonCache::handle_new_client() {
   // we want to be edge triggered. With edge trigger comes the responsibility
   // that we must do all reads/writes we're capable of
   poll.add(accept_fd, EPOLLIN | EPOLLOUT | EPOLLET);
-  message_parsers.insert({accept_fd, MessageParser(accept_fd, 10)});
+  clients.emplace(accept_fd, DaemonClient(accept_fd, next_generation++));
   wcl::log::info("new client connected: %d", accept_fd)();
 }
 
@@ -1108,9 +1539,10 @@ void DaemonCache::close_client(int client_fd) {
   // We use edge-triggered, read+write+close events for each client
   poll.remove(client_fd);
   close(client_fd);
-  message_parsers.erase(client_fd);
-  message_senders.erase(client_fd);
-  if (message_parsers.empty()) {
+  // Reads still with the workers are dropped when they finish since
+  // the generation of whoever next gets this fd won't match.
+  clients.erase(client_fd);
+  if (clients.empty()) {
     if (getenv("WAKE_SHARED_CACHE_FAST_CLOSE")) {
       exit_now = true;
     }
@@ -1119,8 +1551,8 @@ void DaemonCache::close_client(int client_fd) {
 }
 
 void DaemonCache::handle_write(int client_fd) {
-  auto it = message_senders.find(client_fd);
-  if (it == message_senders.end()) {
+  auto it = clients.find(client_fd);
+  if (it == clients.end() || it->second.senders.empty()) {
     wcl::log::info("handle_write(%d): avliable for write but we have nothing to write for it",
                    client_fd)();
     // Unlike with reading, the client is likely to be ready for us to write
@@ -1129,35 +1561,72 @@ void DaemonCache::handle_write(int client_fd) {
     return;
   }
 
-  MessageSender &sender = *&it->second;
-  MessageSenderState state = sender.send();
+  auto &senders = it->second.senders;
+  while (!senders.empty()) {
+    MessageSenderState state = senders.front().send();
 
-  // This client might be deadlocked, do us both
-  // a favor and kill this connection
-  if (state == MessageSenderState::Timeout) {
-    wcl::log::error("client_fd = %d timed out on write", client_fd)();
-    close_client(client_fd);
-    return;
-  }
+    // This client might be deadlocked, do us both
+    // a favor and kill this connection
+    if (state == MessageSenderState::Timeout) {
+      wcl::log::error("client_fd = %d timed out on write", client_fd)();
+      close_client(client_fd);
+      return;
+    }
 
-  // If we have an error on write, close this client.
-  if (state == MessageSenderState::StopFail) {
-    wcl::log::error("write(%d): %s", client_fd, strerror(errno)).urgent()();
-    close_client(client_fd);
-    return;
-  }
+    // If we have an error on write, close this client.
+    if (state == MessageSenderState::StopFail) {
+      wcl::log::error("write(%d): %s", client_fd, strerror(errno)).urgent()();
+      close_client(client_fd);
+      return;
+    }
 
-  // We need to wait a bit before we try again
-  if (state == MessageSenderState::Continue) {
-    wcl::log::info("handle_write(%d): Continuing write later", client_fd)();
-    return;
+    // We need to wait a bit before we try again
+    if (state == MessageSenderState::Continue) {
+      wcl::log::info("handle_write(%d): Continuing write later", client_fd)();
+      return;
+    }
+
+    // The client keeps its connection for its next request
+    senders.pop_front();
   }
+}
 
-  // Once we've finished sending the message to the client,
-  // close the connection.
-  if (state == MessageSenderState::StopSuccess) {
-    wcl::log::info("handle_write(%d): All done writing, closing client", client_fd)();
-    close_client(client_fd);
+void DaemonCache::handle_read_done() {
+  for (auto &result : workers->pop_results()) {
+    // Updating the database is left to us so that writes stay serialized.
+    // By now any add that was in flight when the worker failed to link the
+    // blob has finished, so if it's still missing the job is corrupt.
+    if (!result.missing_blob.empty()) {
+      if (access(result.missing_blob.c_str(), F_OK) != 0) {
+        remove_corrupt_job(result.job_id);
+      }
+    } else if (result.job_id != -1) {
+      impl->policy->read(result.job_id);
+    }
+
+    // The client may have disconnected while the read was with a worker
+    int client_fd = result.client_fd;
+    auto it = clients.find(client_fd);
+    if (it == clients.end() || it->second.generation != result.generation) {
+      wcl::log::info("Dropping response to request %lu from a closed client",
+                     (unsigned long)result.request_id)();
+      continue;
+    }
+
+    // Enqueue the writer so that it will be handled as needed, if it takes us longer than
+    // 10 seconds to send this message, this client is being annoying and we should close
+    // them.
+    wcl::log::info("Queueing response for %d", client_fd)();
+    auto &senders = it->second.senders;
+    senders.emplace_back(std::move(result.response), client_fd, 10);
+
+    // The client was likely already ready for reading so we won't receive an edge-triggered
+    // notification that we can write to it unless we first fill the kernel buffer up. So
+    // we need to do as much writing as we can right now.
+    if (senders.size() == 1) {
+      wcl::log::info("Kicking off first write for %d", client_fd)();
+      handle_write(client_fd);
+    }
   }
 }
 
@@ -1168,17 +1637,61 @@ void DaemonCache::handle_read_msg(int client_fd) {
   MessageParserState state;
   std::vector<std::string> msgs;
 
-  auto it = message_parsers.find(client_fd);
-  if (it == message_parsers.end()) {
-    wcl::log::error("unreachable: message_parsers out of sync with poll. client_fd = %d", client_fd)
+  auto it = clients.find(client_fd);
+  if (it == clients.end()) {
+    wcl::log::error("unreachable: clients out of sync with poll. client_fd = %d", client_fd)
         .urgent()();
     exit(1);
   }
 
-  state = it->second.read_messages(msgs);
+  state = it->second.parser.read_messages(msgs);
+  uint64_t generation = it->second.generation;
+
+  // Matching and copying out the outputs happens on a worker, the
+  // response is sent from handle_read_done.
+  auto dispatch = [this, client_fd, generation](ReadRequest &&request) {
+    wcl::log::info("Dispatching %zu reads for %d", request.reads.size(), client_fd)();
+    request.client_fd = client_fd;
+    request.generation = generation;
+    workers->push(std::move(request));
+  };
 
   wcl::log::info("DaemonCache::handle_msg(): received %zu messages", msgs.size())();
   for (const auto &msg : msgs) {
+    if (is_binary_message(msg)) {
+      BinaryReader in(msg);
+      ReadRequest request;
+      request.binary = true;
+      if (!in.failed() && in.method() == BinaryMethod::ReadBatch) {
+        size_t count = in.read_count();
+        for (size_t i = 0; i < count && !in.failed(); ++i) {
+          uint64_t id = in.read_varint();
+          request.reads.emplace_back(id, FindJobRequest(in));
+        }
+        if (!in.failed()) {
+          dispatch(std::move(request));
+          continue;
+        }
+      }
+      uint64_t id = in.read_varint();
+      if (!in.failed() && in.method() == BinaryMethod::Read) {
+        request.reads.emplace_back(id, FindJobRequest(in));
+        if (!in.failed()) {
+          dispatch(std::move(request));
+          continue;
+        }
+      }
+      if (!in.failed() && in.method() == BinaryMethod::Add) {
+        AddJobRequest req(in);
+        if (!in.failed()) {
+          add(req);
+          continue;
+        }
+      }
+      wcl::log::error("DaemonCache::handle_msg(): failed to decode client request").urgent()();
+      exit(1);
+    }
+
     JAST json;
     std::stringstream parseErrors;
     if (!JAST::parse(msg, parseErrors, json)) {
@@ -1187,58 +1700,40 @@ void DaemonCache::handle_read_msg(int client_fd) {
     }
 
     if (json.get("method").value == "cache/read") {
-      FindJobRequest req(json.get("params"));
-      FindJobResponse res = read(req);
-      auto iter = message_senders.find(client_fd);
-      if (iter != message_senders.end()) {
-        // This means that there was already an incomplete message waiting
-        // to be sent. This is an error and must mean the client sent
-        // us two read messages without waiting on a response back from
-        // the first one. Let's get rid of this faulty client.
-        wcl::log::error(
-            "Tried to write a new message before another had completed. closing client_fd = %d",
-            client_fd)();
-        close_client(client_fd);
-        return;
-      }
-
-      // Convert the json to a string with a null terminator
-      std::stringstream ss;
-      ss << res.to_json();
-      ss << '\0';
-
-      // Enqueue the writer so that it will be handled as needed, if it takes us longer than
-      // 10 seconds to send this message, this client is being annoying and we should close
-      // them.
-      wcl::log::info("Adding %d to message_senders queue", client_fd)();
-      MessageSender sender(ss.str(), client_fd, 10);
-      message_senders.emplace(client_fd, std::move(sender));
+      auto id = json.get("id").expect_integer();
+      ReadRequest request;
+      request.binary = false;
+      request.reads.emplace_back(id ? *id : 0, FindJobRequest(json.get("params")));
+      dispatch(std::move(request));
+    }
 
-      // The client was likely already ready for reading so we won't receive an edge-triggered
-      // notification that we can write to it unless we first fill the kernel buffer up. So
-      // we need to do as much writing as we can right now.
-      wcl::log::info("Kicking off first write for %d", client_fd)();
-      handle_write(client_fd);
+    if (json.get("method").value == "cache/read_batch") {
+      ReadRequest request;
+      request.binary = false;
+      for (const auto &read : json.get("params").children) {
+        auto id = read.second.get("id").expect_integer();
+        request.reads.emplace_back(id ? *id : 0, FindJobRequest(read.second.get("params")));
+      }
+      dispatch(std::move(request));
     }
 
     if (json.get("method").value == "cache/add") {
       AddJobRequest req(json.get("params"));
       add(req);
-      close_client(client_fd);
     }
   }
 
+  // The client has gone away, most likely because wake exited
+  if (state == MessageParserState::StopSuccess) {
+    close_client(client_fd);
+    return;
+  }
+
   // If there's an error just fail.
   if (state == MessageParserState::StopFail) {
     wcl::log::error("read(%d): %s", client_fd, strerror(errno)).urgent()();
     exit(1);
   }
-
-  if (state == MessageParserState::Timeout) {
-    wcl::log::error("read(%d): timed out, closing client", client_fd)();
-    close_client(client_fd);
-    return;
-  }
 }
 
 }  // namespace job_cache
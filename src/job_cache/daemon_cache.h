@@ -23,6 +23,7 @@
 #include <util/poll.h>
 #include <wcl/xoshiro_256.h>
 
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -36,11 +37,25 @@
 namespace job_cache {
 
 struct CacheDbImpl;
+struct ReadWorkers;
+
+// A connected wake process. Clients keep their connection for as long as
+// they run and send every request over it, so many of their reads may be
+// with the workers at once. Responses are sent in the order reads finish.
+struct DaemonClient {
+  MessageParser parser;
+  std::deque<MessageSender> senders;
+  // fds are reused so results are matched to their client by generation
+  uint64_t generation;
+
+  DaemonClient(int fd, uint64_t generation) : parser(fd), generation(generation) {}
+};
 
 class DaemonCache {
  private:
   wcl::xoshiro_256 rng;
   std::unique_ptr<CacheDbImpl> impl;  // pimpl
+  std::unique_ptr<ReadWorkers> workers;
   int evict_stdin;
   int evict_stdout;
   int evict_pid;
@@ -48,11 +63,10 @@ class DaemonCache {
   std::string key;
   int listen_socket_fd;
   EPoll poll;
-  std::unordered_map<int, MessageParser> message_parsers;
-  std::unordered_map<int, MessageSender> message_senders;
+  std::unordered_map<int, DaemonClient> clients;
+  uint64_t next_generation = 0;
   bool exit_now = false;
 
-  FindJobResponse read(const FindJobRequest &find_request);
   void add(const AddJobRequest &add_request);
   void remove_corrupt_job(int64_t job_id);
   void close_client(int client_fd);
@@ -60,6 +74,7 @@ class DaemonCache {
   void handle_new_client();
   void handle_read_msg(int fd);
   void handle_write(int fd);
+  void handle_read_done();
 
  public:
   ~DaemonCache();
@@ -67,7 +82,12 @@ class DaemonCache {
   DaemonCache() = delete;
   DaemonCache(const DaemonCache &) = delete;
 
-  DaemonCache(std::string dir, std::string bulk_logging_dir, EvictionConfig config);
+  // cache/read requests are served by `worker_threads` threads while
+  // everything that writes to the database stays on the calling thread.
+  // The threads are shared by every client, so the client that launches
+  // the daemon picks how many there are.
+  DaemonCache(std::string dir, std::string bulk_logging_dir, EvictionConfig config,
+              size_t worker_threads);
 
   int run();
 };
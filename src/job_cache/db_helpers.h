@@ -70,7 +70,9 @@ class Database {
       exit(1);
     }
   }
-  Database(const std::string &cache_dir) {
+  // A read only connection neither creates the database nor applies the schema
+  // so the database must already have been opened by a writable connection.
+  Database(const std::string &cache_dir, bool read_only = false) {
     // We want to keep a sql file that has proper syntax highlighting
     // around instead of embeding the schema. In order to acomplish this
     // we use C++11 raw strings and the preprocessor. Unfortuently
@@ -93,8 +95,8 @@ class Database {
     mkdir_no_fail(cache_dir.c_str());
 
     std::string db_path = wcl::join_paths(cache_dir, "/cache.db");
-    if (sqlite3_open_v2(db_path.c_str(), &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
-                        nullptr) != SQLITE_OK) {
+    int flags = read_only ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+    if (sqlite3_open_v2(db_path.c_str(), &db, flags, nullptr) != SQLITE_OK) {
       wcl::log::error("error: %s", sqlite3_errmsg(db)).urgent()();
       exit(1);
     }
@@ -105,6 +107,8 @@ class Database {
       exit(1);
     }
 
+    if (read_only) return;
+
     char *fail = nullptr;
 
     int ret = sqlite3_exec(db, cache_schema, nullptr, nullptr, &fail);
@@ -200,6 +204,16 @@ class PreparedStatement {
     }
   }
 
+  void bind_blob(int64_t index, const void *data, size_t size) {
+    int ret = sqlite3_bind_blob(query_stmt, index, data, size, SQLITE_TRANSIENT);
+    if (ret != SQLITE_OK) {
+      wcl::log::error("%s: sqlite3_bind_blob(%ld, <%lu bytes>): %s", why.c_str(), index, size,
+                      sqlite3_errmsg(sqlite3_db_handle(query_stmt)))
+          .urgent()();
+      exit(1);
+    }
+  }
+
   int64_t read_integer(int64_t index) { return sqlite3_column_int64(query_stmt, index); }
 
   double read_double(int64_t index) { return sqlite3_column_double(query_stmt, index); }
@@ -210,6 +224,13 @@ class PreparedStatement {
     return std::string(str, size);
   }
 
+  // The returned pointer is only valid until the next step or reset
+  const void *read_blob(int64_t index, size_t *size) {
+    const void *blob = sqlite3_column_blob(query_stmt, index);
+    *size = sqlite3_column_bytes(query_stmt, index);
+    return blob;
+  }
+
   void reset() {
     int ret;
 
@@ -268,4 +289,29 @@ class Transaction {
   }
 };
 
+// Like Transaction but only takes a read lock so that it can be used
+// from a read only connection alongside the writer.
+class ReadTransaction {
+ private:
+  PreparedStatement begin_txn_query;
+  PreparedStatement commit_txn_query;
+
+ public:
+  static constexpr const char *sql_begin_txn = "begin deferred transaction";
+  static constexpr const char *sql_commit_txn = "commit transaction";
+
+  ReadTransaction(std::shared_ptr<job_cache::Database> db)
+      : begin_txn_query(db, sql_begin_txn), commit_txn_query(db, sql_commit_txn) {
+    begin_txn_query.set_why("Could not begin a read transaction");
+    commit_txn_query.set_why("Could not commit a read transaction");
+  }
+
+  template <class F>
+  void run(F f) {
+    begin_txn_query.step();
+    f();
+    commit_txn_query.step();
+  }
+};
+
 }  // namespace job_cache
@@ -28,13 +28,16 @@
 #include <wcl/xoshiro_256.h>
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <iostream>
 #include <memory>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "blob_store.h"
 #include "db_helpers.h"
 #include "eviction_command.h"
 #include "job_cache_impl_common.h"
@@ -44,7 +47,9 @@ namespace job_cache {
 
 struct TTLEvictionPolicyImpl {
   std::string cache_dir;
+  wcl::xoshiro_256 rng;
   job_cache::Transaction transact;
+  job_cache::BlobStore blobs;
   std::thread cleaning_thread;
   job_cache::PreparedStatement jobs_older_than;
   job_cache::PreparedStatement remove_jobs_older_than;
@@ -57,12 +62,15 @@ struct TTLEvictionPolicyImpl {
 
   TTLEvictionPolicyImpl(std::string dir, std::shared_ptr<job_cache::Database> db)
       : cache_dir(dir),
+        rng(wcl::xoshiro_256::get_rng_seed()),
         transact(db),
+        blobs(db),
         jobs_older_than(db, jobs_older_than_query),
         remove_jobs_older_than(db, remove_jobs_older_than_query) {}
 
   void cleanup(int64_t seconds_to_live) {
     std::vector<std::pair<int64_t, std::string>> jobs_to_remove;
+    std::vector<std::string> dead_blobs;
     // Compute the deadline, after which we collect everything
     int64_t deadline = current_time_microseconds() - seconds_to_live * 1000000ll;
 
@@ -74,7 +82,7 @@ struct TTLEvictionPolicyImpl {
     // once safely.
     if (cleaning_thread.joinable()) cleaning_thread.detach();
 
-    transact.run([this, &jobs_to_remove, deadline]() {
+    transact.run([this, &jobs_to_remove, &dead_blobs, deadline]() {
       auto reset = wcl::make_defer([this]() { jobs_older_than.reset(); });
       jobs_older_than.bind_integer(1, deadline);
       // First find the use time that we want to remove from
@@ -92,205 +100,229 @@ struct TTLEvictionPolicyImpl {
         auto reset = wcl::make_defer([this]() { remove_jobs_older_than.reset(); });
         remove_jobs_older_than.bind_integer(1, deadline);
         remove_jobs_older_than.step();
-
-        // Launch the cleaning thread
-        cleaning_thread = std::thread(remove_backing_files, cache_dir, std::move(jobs_to_remove),
-                                      4 * std::thread::hardware_concurrency());
+        dead_blobs = blobs.collect();
       }
     });
+
+    if (jobs_to_remove.empty()) return;
+
+    // Move the blobs out of the way right away, then launch the cleaning thread
+    std::string stash_dir = wcl::join_paths(cache_dir, "tmp_evict_" + rng.unique_name());
+    stash_blobs(dead_blobs, stash_dir);
+    cleaning_thread = std::thread(remove_backing_files, std::move(jobs_to_remove), stash_dir,
+                                  4 * std::thread::hardware_concurrency());
   }
 };
 
+// LRU eviction has two halves. The daemon's thread records uses, which are
+// buffered in memory and written out in batches, and checks the total size
+// after each write. Once the cache grows past max_cache_size the cleaning
+// thread evicts the least recently used jobs on its own connection until it
+// is back under low_cache_size. It does so in small increments, each in its
+// own transaction, so the daemon is never locked out for long.
 struct LRUEvictionPolicyImpl {
+  // Limits on the work done by a single eviction transaction. An increment
+  // stops at whichever is reached first.
+  static constexpr size_t eviction_step_jobs = 256;
+  static constexpr uint64_t eviction_step_bytes = 64ull << 20;
+
+  // Uses are written out once this many are buffered or a second has passed
+  static constexpr size_t max_pending_uses = 1024;
+  static constexpr int64_t pending_use_microseconds = 1000000;
+
   std::string cache_dir;
-  job_cache::PreparedStatement update_size;
-  job_cache::PreparedStatement reset_size;
+  wcl::xoshiro_256 rng;
+  job_cache::PreparedStatement resync_size;
   job_cache::PreparedStatement get_size;
-  job_cache::PreparedStatement insert_last_use;
   job_cache::PreparedStatement set_last_use;
-  job_cache::PreparedStatement get_last_use;
-  job_cache::PreparedStatement does_job_exist;
-  job_cache::PreparedStatement find_least_recently_used;
-  job_cache::PreparedStatement remove_least_recently_used;
   job_cache::Transaction transact;
-  std::thread cleaning_thread;
 
-  // TODO: Right now we're using `obytes` as a proxy for the size of a job
-  //       but this is an over aproximation of the storage cost really.
+  std::unordered_map<int64_t, int64_t> pending_uses;  // job_id -> last use
+  int64_t last_flush = 0;
 
-  // Update size to account for new job. Also return the size
-  // so we can know if we should trigger a collection or not
-  static constexpr const char* update_size_query =
-      "update total_size set size = size + (select sum(o.obytes) "
-      "from jobs j, job_output_info o "
-      "where j.job_id = ? and j.job_id = o.job)";
+  std::thread cleaning_thread;
+  std::atomic<bool> evicting{false};
 
-  static constexpr const char* reset_size_query = "update total_size set size = ?";
+  // The total size is kept up to date by the blob triggers in schema.sql and
+  // counts every stored blob once. Caches from before the blob store counted
+  // `obytes` per job instead so we recompute it on startup.
+  static constexpr const char* resync_size_query =
+      "update total_size set size = (select ifnull(sum(size), 0) from blobs)";
 
   // Unconditionally returns the current total_size
   static constexpr const char* get_size_query = "select size from total_size";
 
-  // We need 3 qurries to do an upset because sqlite only added support in 2018
-  // and we still test against very old CI bots.
-  static constexpr const char* get_last_use_query = "select * from lru_stats where job_id = ?";
-  static constexpr const char* insert_last_use_query =
-      "insert into lru_stats (job_id, last_use) values (?, ?)";
+  // Older versions of sqlite don't have upserts but replacing the row works
+  // just as well. Jobs may have been evicted since their use was recorded.
   static constexpr const char* set_last_use_query =
-      "update lru_stats set last_use = ? where job_id = ?";
-  static constexpr const char* does_job_exist_query = "select * from jobs where job_id = ?";
+      "insert or replace into lru_stats (job_id, last_use) "
+      "select ?1, ?2 where exists (select 1 from jobs where job_id = ?1)";
 
-  // This is meant to be used as part of a transaction with remove_least_recently_used.
-  // It simply returns the job_ids in last use order.
+  // Walks lru_stats_order from the oldest use. Jobs without a use recorded
+  // yet are never candidates.
   static constexpr const char* find_least_recently_used_query =
-      "select l.last_use, o.obytes, j.job_id, j.commandline "
-      "from lru_stats l, jobs j, job_output_info o "
-      "where l.job_id = j.job_id and o.job = j.job_id "
-      "order by l.last_use";
+      "select l.job_id, j.commandline "
+      "from lru_stats l join jobs j on j.job_id = l.job_id "
+      "order by l.last_use limit ?";
 
-  // This query is meant to be used as part of a transaction with find_least_recently_used.
-  // It removes all jobs that have a last use time less than a certain amount.
-  static constexpr const char* remove_least_recently_used_query =
-      "delete from jobs where job_id in (select job_id from lru_stats where last_use <= ?)";
+  static constexpr const char* remove_job_query = "delete from jobs where job_id = ?";
 
   LRUEvictionPolicyImpl(std::string dir, std::shared_ptr<job_cache::Database> db)
       : cache_dir(dir),
-        update_size(db, update_size_query),
-        reset_size(db, reset_size_query),
+        rng(wcl::xoshiro_256::get_rng_seed()),
+        resync_size(db, resync_size_query),
         get_size(db, get_size_query),
-        insert_last_use(db, insert_last_use_query),
         set_last_use(db, set_last_use_query),
-        get_last_use(db, get_last_use_query),
-        does_job_exist(db, does_job_exist_query),
-        find_least_recently_used(db, find_least_recently_used_query),
-        remove_least_recently_used(db, remove_least_recently_used_query),
         transact(db) {
-    update_size.set_why("Could not update total size");
+    resync_size.set_why("Could not resync total size");
     get_size.set_why("Could not get total size");
-    insert_last_use.set_why("Could not insert new last use");
     set_last_use.set_why("Could not update last use");
-    get_last_use.set_why("Could not get last use");
-    find_least_recently_used.set_why("Could not find least recently used");
-    remove_least_recently_used.set_why("Could not remove least recently used");
-    reset_size.set_why("Could not reset size");
-  }
 
-  uint64_t add_job_size(uint64_t job_id) {
-    uint64_t out = 0;
-    transact.run([this, &out, job_id]() {
-      update_size.bind_integer(1, job_id);
-      update_size.step();
-      update_size.reset();
-      get_size.step();
-      out = get_size.read_integer(0);
-      get_size.reset();
+    transact.run([this]() {
+      resync_size.step();
+      resync_size.reset();
     });
-    return out;
   }
 
-  void mark_new_use(uint64_t job_id) {
-    timespec tp;
-    clock_gettime(CLOCK_REALTIME, &tp);
-    int64_t time = 1000000ll * int64_t(tp.tv_sec) + tp.tv_nsec / 1000;
-    // Older versions of sqlite don't have upserts so
-    // we have to do this junk.
-    transact.run([this, job_id, &time]() {
-      does_job_exist.bind_integer(1, job_id);
-      auto exists = does_job_exist.step();
-      does_job_exist.reset();
-      if (exists != SQLITE_ROW) return;
-      set_last_use.bind_integer(1, time);
-      set_last_use.bind_integer(2, job_id);
-      set_last_use.step();
-      set_last_use.reset();
-      get_last_use.bind_integer(1, job_id);
-      auto result = get_last_use.step();
-      get_last_use.reset();
-      // If there was already a result, we can safely assume it was set and return
-      if (result == SQLITE_ROW) return;
-
-      // Unless result is a row something awful has occured.
-      if (result != SQLITE_DONE) {
-        wcl::log::error("get_last_use result was unexpected: %d", result).urgent()();
-        exit(1);
-      }
+  // An eviction that's under way is finished before the daemon exits
+  ~LRUEvictionPolicyImpl() {
+    if (cleaning_thread.joinable()) cleaning_thread.join();
+    flush_uses();
+  }
 
-      insert_last_use.bind_integer(1, job_id);
-      insert_last_use.bind_integer(2, time);
-      insert_last_use.step();
-      insert_last_use.reset();
-    });
+  uint64_t current_size() {
+    get_size.step();
+    uint64_t out = get_size.read_integer(0);
+    get_size.reset();
+    return out;
   }
 
-  void cleanup(uint64_t current_size, uint64_t bytes_to_remove) {
-    std::vector<std::pair<int64_t, std::string>> jobs_to_remove;
-    transact.run([this, &jobs_to_remove, current_size, bytes_to_remove]() {
-      uint64_t last_use = 0;
-      uint64_t to_remove = bytes_to_remove;
-      uint64_t removed_so_far = 0;
+  void mark_new_use(int64_t job_id) {
+    pending_uses[job_id] = current_time_microseconds();
+    if (pending_uses.size() >= max_pending_uses) {
+      flush_uses();
+    } else {
+      flush_uses_if_due();
+    }
+  }
 
-      wcl::log::info("Cleaning up %lu bytes from %lu total bytes", bytes_to_remove, current_size)();
+  void flush_uses_if_due() {
+    if (current_time_microseconds() - last_flush >= pending_use_microseconds) flush_uses();
+  }
 
-      {
-        auto reset1 = wcl::make_defer([this]() { find_least_recently_used.reset(); });
+  void flush_uses() {
+    last_flush = current_time_microseconds();
+    if (pending_uses.empty()) return;
+    transact.run([this]() {
+      for (const auto& use : pending_uses) {
+        set_last_use.bind_integer(1, use.first);
+        set_last_use.bind_integer(2, use.second);
+        set_last_use.step();
+        set_last_use.reset();
+      }
+    });
+    pending_uses.clear();
+  }
 
-        // First find the use time that we want to remove from
-        while (find_least_recently_used.step() == SQLITE_ROW) {
-          // First see how many bytes removing this would net us
-          uint64_t obytes = find_least_recently_used.read_integer(1);
+  // Starts evicting on the cleaning thread unless it's already at it
+  void start_cleanup(uint64_t low_cache_size) {
+    if (evicting) return;
+    if (cleaning_thread.joinable()) cleaning_thread.join();
 
-          last_use = find_least_recently_used.read_integer(0);
+    // The cleaning thread only sees uses that have been written out
+    flush_uses();
+    evicting = true;
+    cleaning_thread = std::thread([this, low_cache_size]() {
+      cleanup(low_cache_size);
+      evicting = false;
+    });
+  }
 
-          int64_t job_id = find_least_recently_used.read_integer(2);
-          std::string cmd = find_least_recently_used.read_string(3);
+  // Runs on the cleaning thread with its own connection to the database
+  void cleanup(uint64_t target_size) {
+    auto db = std::make_shared<job_cache::Database>(cache_dir);
+    job_cache::PreparedStatement find_least_recently_used(db, find_least_recently_used_query);
+    job_cache::PreparedStatement remove_job(db, remove_job_query);
+    job_cache::PreparedStatement read_size(db, get_size_query);
+    job_cache::BlobStore blobs(db);
+    job_cache::Transaction transact(db);
+    find_least_recently_used.set_why("Could not find least recently used");
+    remove_job.set_why("Could not remove least recently used");
+    read_size.set_why("Could not get total size");
+
+    auto size_now = [&read_size]() {
+      read_size.step();
+      uint64_t out = read_size.read_integer(0);
+      read_size.reset();
+      return out;
+    };
+
+    uint64_t start_size = size_now();
+    wcl::log::info("Evicting down to %lu bytes from %lu total bytes", target_size, start_size)();
+
+    uint64_t size = start_size;
+    while (size > target_size) {
+      std::vector<std::pair<int64_t, std::string>> jobs_to_remove;
+      std::vector<std::string> dead_blobs;
+      std::string stash_dir = wcl::join_paths(cache_dir, "tmp_evict_" + rng.unique_name());
+
+      transact.run([&]() {
+        std::vector<std::pair<int64_t, std::string>> candidates;
+        {
+          auto reset = wcl::make_defer([&]() { find_least_recently_used.reset(); });
+          find_least_recently_used.bind_integer(1, eviction_step_jobs);
+          while (find_least_recently_used.step() == SQLITE_ROW) {
+            candidates.emplace_back(find_least_recently_used.read_integer(0),
+                                    find_least_recently_used.read_string(1));
+          }
+        }
+
+        // Jobs are removed one at a time because how many bytes removing a
+        // job frees depends on which of its blobs are still referenced by
+        // the jobs that remain.
+        uint64_t increment_start = size;
+        for (auto& candidate : candidates) {
+          if (size <= target_size || increment_start - size >= eviction_step_bytes) break;
 
           // The cmd uses null bytes to seperate parts of a command so, we
           // replace them with spaces to make it readable.
-          for (auto& ch : cmd) {
+          for (auto& ch : candidate.second) {
             if (ch == '\0') ch = ' ';
           }
 
-          jobs_to_remove.emplace_back(job_id, std::move(cmd));
-
-          removed_so_far += obytes;
+          remove_job.bind_integer(1, candidate.first);
+          remove_job.step();
+          remove_job.reset();
+          jobs_to_remove.emplace_back(std::move(candidate));
 
-          // If obytes is more than to_remove then we can break because
-          // this will put us over our bytes_to_remove.
-          if (obytes > to_remove) {
-            break;
+          for (auto& hash : blobs.collect()) {
+            dead_blobs.emplace_back(std::move(hash));
           }
-
-          // Otherwise mark these bytes and keep working.
-          to_remove -= obytes;
+          size = size_now();
         }
-      }
 
-      // Next actully remove those jobs from the database
-      // even though the files haven't been deleted yet.
-      // Note that just because we delete jobs from the database
-      // before we delete the files backing them doesn't mean that
-      // we can't see a race. It's perfectly valid for a read to
-      // occur before we do this transaction but for the reads of
-      // the backing files to occur *after* this transaction completes.
-      // Still, doing things in this order reduces the chance of a
-      // failed read occuring.
-      auto reset2 = wcl::make_defer([this]() {
-        remove_least_recently_used.reset();
-        reset_size.reset();
+        // Move the blobs out of the blob store before committing. Once this
+        // commits, DaemonCache::add may store the same content again and rename
+        // a new blob into the same path, which a later stash would take away.
+        // Until then add can't get the write lock, so nothing new is in the way.
+        // A crash before the commit leaves jobs whose blobs are gone, which
+        // reads detect and remove as corrupt.
+        if (!jobs_to_remove.empty()) stash_blobs(dead_blobs, stash_dir);
       });
-      remove_least_recently_used.bind_integer(1, last_use);
-      remove_least_recently_used.step();
-      reset_size.bind_integer(1, current_size - removed_so_far);
-      reset_size.step();
-    });
 
-    // Now we remove the threads in the background.
-    // NOTE: We don't wait for this to finish
-    // There might be an already running thread finishing up some cleaning.
-    // Instead of killing it we should join it before starting a new one.
-    if (cleaning_thread.joinable()) cleaning_thread.join();
-    // Launch the cleaning thread
-    cleaning_thread = std::thread(remove_backing_files, cache_dir, jobs_to_remove,
-                                  4 * std::thread::hardware_concurrency());
+      // Nothing left that can be evicted
+      if (jobs_to_remove.empty()) break;
+
+      // Note that just because we delete jobs from the database before we
+      // delete the files backing them doesn't mean that we can't see a race.
+      // It's perfectly valid for a read to occur before we do this transaction
+      // but for the reads of the backing files to occur *after* this completes.
+      // Such reads report the blob missing and are treated as misses.
+      remove_backing_files(std::move(jobs_to_remove), stash_dir,
+                           4 * std::thread::hardware_concurrency());
+    }
+
+    wcl::log::info("Evicted %lu bytes", start_size > size ? start_size - size : 0)();
   }
 };
 
@@ -335,6 +367,11 @@ static void garbage_collect_group(const std::unordered_set<int64_t> jobs, int64_
   auto group_dir = wcl::to_hex(&group_id);
   auto dir_res = wcl::directory_range::open(group_dir);
   if (!dir_res) {
+    // Only caches from before the blob store have job folders
+    if (dir_res.error() == ENOENT) {
+      return;
+    }
+
     // We can keep going even with this failure but we need to at least log it
     wcl::log::error("garbage collecting orphaned folders: wcl::directory_range::open(%s): %s",
                     group_dir.c_str(), strerror(dir_res.error()))();
@@ -398,25 +435,70 @@ static void garbage_collect_orphan_folders(std::shared_ptr<job_cache::Database>
   }
 }
 
+// Blobs are renamed into place only after the database references them and
+// renamed out of place after the database stops referencing them, so a crash
+// can leave a blob on disk that nothing will ever remove.
+static void garbage_collect_orphan_blobs(std::shared_ptr<job_cache::Database> db) {
+  constexpr const char* all_blobs_q = "select hash from blobs";
+  PreparedStatement all_blobs(db, all_blobs_q);
+  Transaction transact(db);
+  std::unordered_set<std::string> blobs;
+
+  transact.run([&all_blobs, &blobs]() {
+    while (all_blobs.step() == SQLITE_ROW) {
+      blobs.insert(all_blobs.read_string(0));
+    }
+  });
+
+  for (int group_id = 0; group_id <= 0xFF; ++group_id) {
+    group_id_t group = group_id;
+    std::string group_dir = wcl::join_paths("blobs", wcl::to_hex(&group));
+    auto dir_res = wcl::directory_range::open(group_dir);
+    if (!dir_res) {
+      if (dir_res.error() != ENOENT) {
+        wcl::log::error("garbage collecting orphaned blobs: wcl::directory_range::open(%s): %s",
+                        group_dir.c_str(), strerror(dir_res.error()))();
+      }
+      continue;
+    }
+
+    std::vector<std::string> to_remove;
+    for (const auto& entry : *dir_res) {
+      if (!entry) {
+        wcl::log::error("garbage collecting orphaned blobs: bad entry in %s: %s",
+                        group_dir.c_str(), strerror(entry.error()))();
+        continue;
+      }
+      if (entry->name == "." || entry->name == "..") continue;
+      if (blobs.count(entry->name)) continue;
+      to_remove.emplace_back(wcl::join_paths(group_dir, entry->name));
+    }
+
+    for (const auto& file : to_remove) {
+      wcl::log::info("found orphaned blob: %s", file.c_str())();
+      unlink(file.c_str());
+    }
+  }
+}
+
 void LRUEvictionPolicy::init(std::shared_ptr<job_cache::Database> db,
                              const std::string& cache_dir) {
   impl = std::make_unique<LRUEvictionPolicyImpl>(cache_dir, db);
   garbage_collect_orphan_folders(db);
+  garbage_collect_orphan_blobs(db);
 }
 
 void LRUEvictionPolicy::read(int job_id) { impl->mark_new_use(job_id); }
 
 void LRUEvictionPolicy::write(int job_id) {
   impl->mark_new_use(job_id);
-  uint64_t size = impl->add_job_size(job_id);
-  if (size > max_cache_size) {
-    // TODO: Techically this is racy because the size
-    //       can get out of sync. We should probably put
-    //       these in a transaction.
-    impl->cleanup(size, max_cache_size - low_cache_size);
+  if (impl->current_size() > max_cache_size) {
+    impl->start_cleanup(low_cache_size);
   }
 }
 
+void LRUEvictionPolicy::tick() { impl->flush_uses_if_due(); }
+
 LRUEvictionPolicy::LRUEvictionPolicy(uint64_t low, uint64_t max)
     : max_cache_size(max), low_cache_size(low) {
   wcl::log::info("Creating LRU eviction policy, max = %lu, low = %lu", max, low)();
@@ -429,6 +511,7 @@ void TTLEvictionPolicy::init(std::shared_ptr<job_cache::Database> db,
   impl = std::make_unique<TTLEvictionPolicyImpl>(cache_dir, db);
   impl->cleanup(seconds_to_live);
   garbage_collect_orphan_folders(db);
+  garbage_collect_orphan_blobs(db);
 }
 
 void TTLEvictionPolicy::read(int job_id) {}
@@ -33,6 +33,8 @@ struct EvictionPolicy {
   virtual void init(std::shared_ptr<job_cache::Database> db, const std::string& cache_dir) = 0;
   virtual void read(int id) = 0;
   virtual void write(int id) = 0;
+  // Called from the daemon's event loop at least every few seconds
+  virtual void tick() {}
   virtual ~EvictionPolicy() {}
 };
 
@@ -71,6 +73,8 @@ class LRUEvictionPolicy : public EvictionPolicy {
   virtual void read(int id) override;
 
   virtual void write(int id) override;
+
+  virtual void tick() override;
 };
 
 struct TTLEvictionPolicyImpl;
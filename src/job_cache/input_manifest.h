@@ -0,0 +1,107 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hash.h"
+
+namespace job_cache {
+
+// The input files (or dirs) of a job and their hashes packed into one blob
+// so that checking a candidate job is a single column read rather than a
+// query stepping over a row per input. Entries are sorted by path and since
+// neighbouring paths share long prefixes each one only stores what differs
+// from the previous path:
+//
+//   [varint shared prefix size] [varint suffix size] [suffix] [32 byte hash]
+class InputManifest {
+ private:
+  static void put_varint(std::string &out, uint64_t x) {
+    while (x >= 0x80) {
+      out += char(uint8_t(x) | 0x80);
+      x >>= 7;
+    }
+    out += char(x);
+  }
+
+  static bool get_varint(const uint8_t *&iter, const uint8_t *end, uint64_t &x) {
+    x = 0;
+    for (int shift = 0; shift < 64 && iter < end; shift += 7) {
+      uint8_t byte = *iter++;
+      x |= uint64_t(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+    return false;
+  }
+
+ public:
+  static std::string encode(std::vector<std::pair<std::string, Hash256>> entries) {
+    std::sort(entries.begin(), entries.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    std::string out;
+    const std::string *prev = nullptr;
+    for (const auto &entry : entries) {
+      const std::string &path = entry.first;
+      size_t shared = 0;
+      if (prev) {
+        size_t limit = std::min(prev->size(), path.size());
+        while (shared < limit && (*prev)[shared] == path[shared]) ++shared;
+      }
+      put_varint(out, shared);
+      put_varint(out, path.size() - shared);
+      out.append(path, shared, std::string::npos);
+      out.append(reinterpret_cast<const char *>(entry.second.data), sizeof(entry.second.data));
+      prev = &path;
+    }
+    return out;
+  }
+
+  // Calls f(path, hash) for every entry in order. Stops early and returns
+  // false if f does or if the manifest is malformed.
+  template <class F>
+  static bool for_each(const void *data, size_t size, F f) {
+    const uint8_t *iter = static_cast<const uint8_t *>(data);
+    const uint8_t *end = iter + size;
+    std::string path;
+    while (iter < end) {
+      uint64_t shared, suffix;
+      if (!get_varint(iter, end, shared) || !get_varint(iter, end, suffix)) return false;
+      if (shared > path.size() || suffix > uint64_t(end - iter)) return false;
+      path.resize(shared);
+      path.append(reinterpret_cast<const char *>(iter), suffix);
+      iter += suffix;
+
+      Hash256 hash;
+      if (uint64_t(end - iter) < sizeof(hash.data)) return false;
+      std::memcpy(hash.data, iter, sizeof(hash.data));
+      iter += sizeof(hash.data);
+
+      if (!f(path, hash)) return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace job_cache
@@ -33,7 +33,10 @@
 #include <wcl/xoshiro_256.h>
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <iterator>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -191,21 +194,27 @@ void Cache::launch_daemon() {
   // We are the daemon, launch the cache
   if (daemonize(cache_dir.c_str())) {
     std::string job_cache = wcl::make_canonical(find_execpath() + "/../bin/job-cache");
+    std::vector<std::string> args = {"job-cached", "--cache-dir", cache_dir, "--bulk-logging-dir",
+                                     bulk_logging_dir};
     switch (config.type) {
-      case EvictionPolicyType::LRU: {
-        std::string low_str = std::to_string(config.lru.low_size);
-        std::string max_str = std::to_string(config.lru.max_size);
-        execl(job_cache.c_str(), "job-cached", "--cache-dir", cache_dir.c_str(),
-              "--bulk-logging-dir", bulk_logging_dir.c_str(), "--eviction-type", "lru",
-              "--low-cache-size", low_str.c_str(), "--max-cache-size", max_str.c_str(), nullptr);
-      } break;
-      case EvictionPolicyType::TTL: {
-        std::string ttl = std::to_string(config.ttl.seconds_to_live);
-        execl(job_cache.c_str(), "job-cached", "--cache-dir", cache_dir.c_str(),
-              "--bulk-logging-dir", bulk_logging_dir.c_str(), "--eviction-type", "ttl",
-              "--seconds-to-live", ttl.c_str(), nullptr);
-      } break;
+      case EvictionPolicyType::LRU:
+        args.insert(args.end(), {"--eviction-type", "lru", "--low-cache-size",
+                                 std::to_string(config.lru.low_size), "--max-cache-size",
+                                 std::to_string(config.lru.max_size)});
+        break;
+      case EvictionPolicyType::TTL:
+        args.insert(args.end(), {"--eviction-type", "ttl", "--seconds-to-live",
+                                 std::to_string(config.ttl.seconds_to_live)});
+        break;
     }
+    if (worker_threads != 0) {
+      args.insert(args.end(), {"--worker-threads", std::to_string(worker_threads)});
+    }
+
+    std::vector<char *> argv;
+    for (auto &arg : args) argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+    execv(job_cache.c_str(), argv.data());
 
     wcl::log::error("exec(%s): %s", job_cache.c_str(), strerror(errno)).urgent()();
     exit(1);
@@ -263,13 +272,17 @@ static void mkdir_all(std::string acc, Iter begin, Iter end) {
   }
 }
 
-Cache::Cache(std::string dir, std::string bulk_dir, EvictionConfig cfg, TimeoutConfig tcfg,
-             bool miss) {
+Cache::Cache(std::string dir, std::string bulk_dir, EvictionConfig cfg, MaterializePolicy mat,
+             size_t workers, TimeoutConfig tcfg, bool miss)
+    : parser(-1) {
   cache_dir = dir;
   bulk_logging_dir = bulk_dir;
   miss_on_failure = miss;
   config = cfg;
+  materialize = mat;
+  worker_threads = workers;
   timeout_config = tcfg;
+  json_protocol = getenv("WAKE_SHARED_CACHE_JSON_PROTOCOL") != nullptr;
 
   auto fp_range = wcl::make_filepath_range_ref(cache_dir);
   mkdir_all(wcl::is_relative(cache_dir) ? "" : "/", fp_range.begin(), fp_range.end());
@@ -277,119 +290,325 @@ Cache::Cache(std::string dir, std::string bulk_dir, EvictionConfig cfg, TimeoutC
   launch_daemon();
 }
 
-wcl::result<FindJobResponse, FindJobError> Cache::read_impl(const FindJobRequest &find_request) {
-  JAST request(JSON_OBJECT);
-  request.add("method", "cache/read");
-  request.add("params", find_request.to_json());
-
-  // serialize the request, send it, deserialize the response, return it
-  auto socket_fd = backoff_try_connect(timeout_config.connect_retries);
-  if (!socket_fd) {
-    return wcl::result_error<FindJobResponse>(FindJobError::CouldNotConnect);
-  }
-  auto write_error =
-      sync_send_json_message(socket_fd->get(), request, timeout_config.message_timeout_seconds);
+static int misses_from_failure = 0;
 
-  if (write_error) {
-    return wcl::result_error<FindJobResponse>(FindJobError::FailedRequest);
+// Decodes a response from the daemon along with the id of the request it answers
+static wcl::optional<FindJobResponse> decode_response(const std::string &message, uint64_t &id) {
+  // The daemon answers in whichever encoding the request used
+  if (is_binary_message(message)) {
+    BinaryReader in(message);
+    if (in.failed() || in.method() != BinaryMethod::Response) return {};
+    id = in.read_varint();
+    FindJobResponse response(in);
+    if (in.failed()) return {};
+    return wcl::make_some<FindJobResponse>(std::move(response));
   }
 
-  // Read the message with a 10 second timeout.
-  auto messages_res = sync_read_message(socket_fd->get(), timeout_config.message_timeout_seconds);
+  JAST json;
+  std::stringstream parseErrors;
+  if (!JAST::parse(message, parseErrors, json)) return {};
+  auto json_id = json.get("id").expect_integer();
+  if (!json_id) return {};
+  id = *json_id;
+  return wcl::make_some<FindJobResponse>(json);
+}
 
-  if (!messages_res) {
-    if (messages_res.error() == SyncMessageReadError::Fail) {
-      wcl::log::error("Cache::read(): failed receiving message")();
-      return wcl::result_error<FindJobResponse>(FindJobError::FailedMessageReceive);
+// A lone read is sent as a plain read. Several are sent as one batch
+// which the daemon matches in a single transaction.
+std::string Cache::encode_reads(const std::vector<uint64_t> &ids) const {
+  if (json_protocol) {
+    JAST request(JSON_OBJECT);
+    if (ids.size() == 1) {
+      request.add("method", "cache/read");
+      request.add("id", int64_t(ids[0]));
+      request.add("params", in_flight.at(ids[0]).request.to_json());
+    } else {
+      JAST reads(JSON_ARRAY);
+      for (uint64_t id : ids) {
+        JAST read(JSON_OBJECT);
+        read.add("id", int64_t(id));
+        read.add("params", in_flight.at(id).request.to_json());
+        reads.add("", std::move(read));
+      }
+      request.add("method", "cache/read_batch");
+      request.add("params", std::move(reads));
     }
 
-    if (messages_res.error() == SyncMessageReadError::Timeout) {
-      wcl::log::error("Cache::read(): timed out reading from the cache daemon")();
-      return wcl::result_error<FindJobResponse>(FindJobError::Timeout);
-    }
+    std::stringstream s;
+    s << request;
+    s << '\0';
+    return s.str();
+  }
 
-    assert(false);
+  if (ids.size() == 1) {
+    BinaryWriter out(BinaryMethod::Read);
+    out.write_varint(ids[0]);
+    in_flight.at(ids[0]).request.to_binary(out);
+    return out.finish();
   }
 
-  std::vector<std::string> messages = std::move(*messages_res);
+  // The reads share the writer's path table so directories common to
+  // several jobs are only spelled out once.
+  BinaryWriter out(BinaryMethod::ReadBatch);
+  out.write_varint(ids.size());
+  for (uint64_t id : ids) {
+    out.write_varint(id);
+    in_flight.at(id).request.to_binary(out);
+  }
+  return out.finish();
+}
 
-  if (messages.size() == 0) {
-    wcl::log::error("Cache::read(): daemon exited without responding")();
-    return wcl::result_error<FindJobResponse>(FindJobError::NoResponse);
+bool Cache::send(const std::string &message) {
+  auto write_error =
+      sync_send_message(socket_fd.get(), message, timeout_config.message_timeout_seconds);
+  if (write_error) {
+    wcl::log::error("Cache::send(): failed to send request: %s", strerror(*write_error))();
+    return false;
   }
+  return true;
+}
 
-  if (messages.size() > 1) {
-    wcl::log::info("message.size() == %lu", messages.size())();
-    for (const auto &message : messages) {
-      wcl::log::info("message.size() = %lu, message = '%s'", message.size(), message.c_str())();
+bool Cache::send_reads(const std::vector<uint64_t> &ids) {
+  time_t deadline = time(nullptr) + timeout_config.message_timeout_seconds;
+  for (size_t i = 0; i < ids.size(); i += max_batch_size) {
+    std::vector<uint64_t> batch(ids.begin() + i,
+                                ids.begin() + std::min(ids.size(), i + max_batch_size));
+    auto shared = std::make_shared<Batch>(Batch{deadline});
+    for (uint64_t id : batch) {
+      auto &entry = in_flight.at(id);
+      entry.batch = shared;
+      entry.sent = true;
     }
-    wcl::log::error("Cache::read(): daemon responded with too many results")();
-    return wcl::result_error<FindJobResponse>(FindJobError::TooManyResponses);
+    if (!send(encode_reads(batch))) return false;
   }
+  return true;
+}
+
+// Connects to the daemon, launching it if needed, and sends every read
+// still waiting on a response. If the daemon can't be reached those
+// reads fail and false is returned.
+bool Cache::connect() {
+  while (true) {
+    auto start = std::chrono::steady_clock::now();
+    auto fd = backoff_try_connect(timeout_config.connect_retries);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    stats.connects++;
+    stats.microseconds += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    if (!fd) {
+      wcl::log::error("Cache::connect(): could not connect to the daemon")();
+      while (!in_flight.empty()) fail(in_flight.begin());
+      return false;
+    }
 
-  wcl::log::info("Cache::read(): message rx")();
+    socket_fd = std::move(*fd);
+    parser = MessageParser(socket_fd.get());
+    poll.add(socket_fd.get(), EPOLLIN);
 
-  JAST json;
-  std::stringstream parseErrors;
-  if (!JAST::parse(messages[0], parseErrors, json)) {
-    wcl::log::error("Cache::read(): failed to parse daemon response")();
-    return wcl::result_error<FindJobResponse>(FindJobError::FailedParseResponse);
+    // Queued reads go out with the rest
+    queued.clear();
+    std::vector<uint64_t> ids;
+    for (const auto &entry : in_flight) ids.push_back(entry.first);
+    if (send_reads(ids)) return true;
+
+    drop_connection();
+    if (in_flight.empty()) return false;
   }
+}
 
-  return wcl::result_value<FindJobError>(FindJobResponse(json));
+void Cache::disconnect() {
+  if (!socket_fd.valid()) return;
+  poll.remove(socket_fd.get());
+  wcl::unique_fd old_fd = std::move(socket_fd);
 }
 
-static int misses_from_failure = 0;
+// Closes a connection that broke. Each read that was waiting on it counts a
+// failed attempt and those out of attempts fail.
+void Cache::drop_connection() {
+  disconnect();
 
-FindJobResponse Cache::read(const FindJobRequest &find_request) {
-  if (misses_from_failure > timeout_config.max_misses_from_failure) {
-    return FindJobResponse(wcl::optional<MatchingJob>{});
+  for (auto it = in_flight.begin(); it != in_flight.end();) {
+    auto next = std::next(it);
+    retry(it);
+    it = next;
   }
 
-  wcl::log::info("Cache::read enter")();
-  auto defer = wcl::make_defer([]() { wcl::log::info("Cache::read exit")(); });
+  // Make sure the daemon is actually launched before the reads are retried
+  if (!in_flight.empty()) {
+    wcl::log::info("Ensuring daemon is alive by attempting to launch it")();
+    launch_daemon();
+  }
+}
 
-  wcl::xoshiro_256 rng(wcl::xoshiro_256::get_rng_seed());
-  useconds_t backoff = 1000;
+// Counts a failed attempt at a read that was sent. Returns false if the read
+// was given up on instead, either because it ran out of attempts or because
+// this invocation has already missed too often.
+bool Cache::retry(std::map<uint64_t, InFlight>::iterator it) {
+  if (it->second.sent && ++it->second.attempts > timeout_config.read_retries) {
+    fail(it);
+    return false;
+  }
+  if (miss_on_failure && misses_from_failure > timeout_config.max_misses_from_failure) {
+    wcl::log::warning(
+        "Cache::read(): reached maximum cache misses for this invocation. Triggering early "
+        "miss.")();
+    finish(it, FindJobResponse(wcl::optional<MatchingJob>{}));
+    return false;
+  }
+  return true;
+}
 
-  bool failed_on_connect = false;
-  for (int i = 0; i < timeout_config.read_retries; i++) {
-    auto response = read_impl(find_request);
-    if (response) {
-      wcl::log::info("Returning job response: cache_hit = %d", int(bool(response->match)))();
-      return *response;
+// Queues the reads that are past their deadline to be sent again. The
+// daemon may still answer the earlier request, in which case the later
+// answer is dropped.
+void Cache::expire_reads() {
+  time_t now = time(nullptr);
+  if (now == expiry_checked) return;
+  expiry_checked = now;
+
+  for (auto it = in_flight.begin(); it != in_flight.end();) {
+    auto next = std::next(it);
+    if (it->second.sent && now > it->second.batch->deadline) {
+      wcl::log::warning("Cache::step(): timed out waiting on read %llu",
+                        static_cast<unsigned long long>(it->first))();
+      uint64_t id = it->first;
+      if (retry(it)) {
+        in_flight.at(id).sent = false;
+        queued.push_back(id);
+      }
     }
+    it = next;
+  }
+}
+
+void Cache::finish(std::map<uint64_t, InFlight>::iterator it, FindJobResponse response) {
+  wcl::log::info("Returning job response: cache_hit = %d", int(bool(response.match)))();
+  it->second.read->response = wcl::some(std::move(response));
+  done.push_back(it->first);
+  if (!it->second.sent) {
+    queued.erase(std::remove(queued.begin(), queued.end(), it->first), queued.end());
+  }
+  in_flight.erase(it);
+}
+
+void Cache::fail(std::map<uint64_t, InFlight>::iterator it) {
+  wcl::log::error("Cache::read(): Failed to read from daemon cache.").urgent()();
 
-    failed_on_connect |= response.error() == FindJobError::CouldNotConnect;
+  if (!miss_on_failure) exit(1);
 
-    if (miss_on_failure && misses_from_failure > timeout_config.max_misses_from_failure) {
-      wcl::log::warning(
-          "Cache::read(): reached maximum cache misses for this invocation. Triggering early "
-          "miss.")();
-      return FindJobResponse(wcl::optional<MatchingJob>{});
+  misses_from_failure++;
+  finish(it, FindJobResponse(wcl::optional<MatchingJob>{}));
+}
+
+void Cache::flush() {
+  if (queued.empty()) return;
+
+  // Connecting sends every read in flight, the queued ones included
+  if (!socket_fd.valid()) {
+    connect();
+    return;
+  }
+
+  std::vector<uint64_t> ids;
+  ids.swap(queued);
+  if (!send_reads(ids)) {
+    drop_connection();
+    if (!in_flight.empty()) connect();
+  }
+}
+
+void Cache::step() {
+  flush();
+  if (!socket_fd.valid()) {
+    if (!in_flight.empty()) connect();
+    return;
+  }
+
+  std::vector<std::string> messages;
+  auto state = parser.read_messages(messages);
+
+  for (const auto &message : messages) {
+    uint64_t id = 0;
+    auto response = decode_response(message, id);
+    if (!response) {
+      wcl::log::error("Cache::step(): failed to decode daemon response")();
+      state = MessageParserState::StopFail;
+      break;
     }
+    // Responses to reads nobody is waiting on anymore are dropped
+    auto it = in_flight.find(id);
+    if (it == in_flight.end()) continue;
+    if (it->second.sent) {
+      it->second.batch->deadline = time(nullptr) + timeout_config.message_timeout_seconds;
+    }
+    finish(it, std::move(*response));
+  }
 
-    std::uniform_int_distribution<useconds_t> variance(0, backoff);
-    usleep(backoff + variance(rng));
-    backoff *= 2;
+  if (state == MessageParserState::Continue) {
+    expire_reads();
+    flush();
+    return;
+  }
 
-    // Make sure the daemon is actully launched
-    wcl::log::info("Ensuring daemon is alive by attempting to launch it")();
-    launch_daemon();
+  if (state == MessageParserState::StopSuccess) {
+    // The daemon closes our connection when it exits
+    wcl::log::info("Cache::step(): the daemon closed the connection")();
+  } else {
+    wcl::log::error("Cache::step(): read(%d): %s", socket_fd.get(), strerror(errno))();
   }
 
-  if (failed_on_connect) {
-    wcl::log::error("Cache::read(): at least one connect failure occured")();
+  drop_connection();
+  if (!in_flight.empty()) connect();
+}
+
+std::vector<uint64_t> Cache::take_done() {
+  std::vector<uint64_t> out;
+  out.swap(done);
+  return out;
+}
+
+std::unique_ptr<AsyncRead> Cache::read_async(FindJobRequest &&find_request) {
+  if (misses_from_failure > timeout_config.max_misses_from_failure) {
+    return std::make_unique<AsyncRead>(this, FindJobResponse(wcl::optional<MatchingJob>{}));
   }
 
-  wcl::log::error("Cache::read(): Failed to read from daemon cache.").urgent()();
+  // The daemon may have been launched by another client with another policy
+  find_request.materialize = materialize;
+  uint64_t id = next_id++;
+  auto read = std::make_unique<AsyncRead>(this, id);
+  in_flight.emplace(id, InFlight{std::move(find_request), nullptr, 1, false, read.get()});
+  queued.push_back(id);
+
+  if (queued.size() >= max_batch_size) flush();
+  return read;
+}
+
+FindJobResponse Cache::read(FindJobRequest &&find_request) {
+  wcl::log::info("Cache::read enter")();
+  auto defer = wcl::make_defer([]() { wcl::log::info("Cache::read exit")(); });
 
-  if (miss_on_failure) {
-    misses_from_failure++;
-    return FindJobResponse(wcl::optional<MatchingJob>{});
+  auto read = read_async(std::move(find_request));
+  flush();
+  while (!read->done()) {
+    // Wake up at least once a second so the read can time out
+    struct timespec timeout;
+    timeout.tv_sec = 1;
+    timeout.tv_nsec = 0;
+    poll.wait(&timeout, nullptr);
+    step();
   }
 
-  exit(1);
+  return read->get();
+}
+
+AsyncRead::AsyncRead(Cache *cache, FindJobResponse response)
+    : cache(cache), id_(0), response(wcl::some(std::move(response))) {}
+
+AsyncRead::~AsyncRead() {
+  if (response) return;
+  cache->in_flight.erase(id_);
+  auto &queued = cache->queued;
+  queued.erase(std::remove(queued.begin(), queued.end(), id_), queued.end());
 }
 
 void Cache::add(const AddJobRequest &add_request) {
@@ -398,19 +617,38 @@ void Cache::add(const AddJobRequest &add_request) {
   }
   wcl::log::info("Cache::add enter")();
   auto defer = wcl::make_defer([]() { wcl::log::info("Cache::add exit")(); });
-  // serialize the request, send it, deserialize the response, return it
-  JAST request(JSON_OBJECT);
-  request.add("method", "cache/add");
-  request.add("params", add_request.to_json());
-
-  // serialize the request and send it, we ignore an error
-  // if it occurs here and we keep moving.
-  auto socket_fd = backoff_try_connect(timeout_config.connect_retries);
-  if (!socket_fd) {
+
+  // The daemon doesn't answer adds but they still carry an id
+  uint64_t id = next_id++;
+  std::string request;
+  if (json_protocol) {
+    JAST json(JSON_OBJECT);
+    json.add("method", "cache/add");
+    json.add("id", int64_t(id));
+    json.add("params", add_request.to_json());
+
+    std::stringstream s;
+    s << json;
+    s << '\0';
+    request = s.str();
+  } else {
+    BinaryWriter out(BinaryMethod::Add);
+    out.write_varint(id);
+    add_request.to_binary(out);
+    request = out.finish();
+  }
+
+  // Send the request, we ignore an error if it occurs
+  // here and we keep moving.
+  step();
+  if (!socket_fd.valid() && !connect()) {
     wcl::log::error("Cache::add(): Failed to connect")();
     return;
   }
-  sync_send_json_message(socket_fd->get(), request, timeout_config.message_timeout_seconds);
+  if (!send(request)) {
+    drop_connection();
+    if (!in_flight.empty()) connect();
+  }
 }
 
 }  // namespace job_cache
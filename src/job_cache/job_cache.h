@@ -27,12 +27,17 @@
 #define _XOPEN_SOURCE 700
 #define _POSIX_C_SOURCE 200809L
 
+#include <util/poll.h>
 #include <wcl/optional.h>
 #include <wcl/result.h>
 #include <wcl/unique_fd.h>
 
+#include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "message_parser.h"
 #include "types.h"
 
 namespace job_cache {
@@ -91,29 +96,148 @@ struct TimeoutConfig {
   int message_timeout_seconds = 10;
 };
 
+class Cache;
+
+// A read whose response has not been received yet. Reads are queued until
+// Cache::flush() sends them to the daemon as one batch. Responses for every
+// read arrive on the Cache's one connection so the owner should then wait
+// for Cache::fd() to become readable and call Cache::step(), which hands
+// each response to its read. Cache::take_done() says which reads finished.
+// If the daemon goes away the read is sent again once the Cache has
+// reconnected.
+class AsyncRead {
+ private:
+  friend class Cache;
+  Cache *cache;
+  uint64_t id_;
+  wcl::optional<FindJobResponse> response;
+
+ public:
+  AsyncRead() = delete;
+  AsyncRead(const AsyncRead &) = delete;
+
+  AsyncRead(Cache *cache, uint64_t id) : cache(cache), id_(id) {}
+  AsyncRead(Cache *cache, FindJobResponse response);
+  ~AsyncRead();
+
+  // 0 for reads that were done without asking the daemon
+  uint64_t id() const { return id_; }
+  bool done() const { return bool(response); }
+
+  // Only valid once done() is true
+  const FindJobResponse &get() const { return *response; }
+};
+
+// Time spent connecting to the daemon, for --profile
+struct ConnectStats {
+  uint64_t connects = 0;
+  uint64_t microseconds = 0;
+};
+
 class Cache {
  private:
+  friend class AsyncRead;
+
   bool miss_on_failure = false;
+  // Requests are sent as binary frames unless WAKE_SHARED_CACHE_JSON_PROTOCOL
+  // is set. JSON is much slower for large requests but is easy to read.
+  bool json_protocol = false;
 
   // Daemon parameters
   std::string cache_dir;
   std::string bulk_logging_dir;
   EvictionConfig config;
+  MaterializePolicy materialize;  // sent along with every read
+  size_t worker_threads;  // 0 lets the daemon pick
   TimeoutConfig timeout_config;
 
+  // Every request this process makes shares one connection to the daemon.
+  // Requests carry an id that the daemon repeats in its response so that
+  // responses can arrive in any order. Reads are kept until answered so they
+  // can be sent again if the connection is lost, which should only happen
+  // when the daemon restarts. A read that goes unanswered for too long is
+  // sent again on its own and fails once it runs out of attempts; that
+  // doesn't drop the connection or the other reads. The connection is
+  // watched by `poll` whose fd doesn't change when we reconnect, which makes
+  // it easy to wait on.
+  //
+  // Reads are queued rather than sent straight away so that all the reads
+  // made between two flushes go to the daemon together, where they are
+  // matched in a single database transaction.
+  //
+  // The daemon answers the reads of a batch one after the other, copying or
+  // linking each hit's outputs before moving on, so a batch of large hits
+  // can take much longer than message_timeout_seconds as a whole. Each
+  // answer pushes back the deadline of the reads left in its batch, so a
+  // read only times out once its batch has stopped making progress.
+  struct Batch {
+    time_t deadline;
+  };
+  struct InFlight {
+    FindJobRequest request;
+    std::shared_ptr<Batch> batch;  // null until sent
+    int attempts;
+    bool sent;
+    AsyncRead *read;
+  };
+  wcl::unique_fd socket_fd;
+  MessageParser parser;
+  EPoll poll;
+  uint64_t next_id = 1;
+  std::map<uint64_t, InFlight> in_flight;
+  std::vector<uint64_t> queued;  // ids of reads not sent yet
+  std::vector<uint64_t> done;
+  time_t expiry_checked = 0;
+  ConnectStats stats;
+
   void launch_daemon();
   wcl::result<wcl::unique_fd, ConnectError> backoff_try_connect(int attempts);
-  wcl::result<FindJobResponse, FindJobError> read_impl(const FindJobRequest &find_request);
+  std::string encode_reads(const std::vector<uint64_t> &ids) const;
+
+  bool connect();
+  void disconnect();
+  void drop_connection();
+  bool send(const std::string &message);
+  bool send_reads(const std::vector<uint64_t> &ids);
+  void expire_reads();
+  bool retry(std::map<uint64_t, InFlight>::iterator it);
+  void finish(std::map<uint64_t, InFlight>::iterator it, FindJobResponse response);
+  void fail(std::map<uint64_t, InFlight>::iterator it);
 
  public:
   Cache() = delete;
   Cache(const Cache &) = delete;
 
-  Cache(std::string dir, std::string bulk_logging_dir, EvictionConfig config, TimeoutConfig tconfig,
-        bool miss);
+  Cache(std::string dir, std::string bulk_logging_dir, EvictionConfig config,
+        MaterializePolicy materialize, size_t worker_threads, TimeoutConfig tconfig, bool miss);
+
+  FindJobResponse read(FindJobRequest &&find_request);
 
-  FindJobResponse read(const FindJobRequest &find_request);
+  // Like read() but only queues the request, see flush(). The returned
+  // read may already be done, for instance if the cache has given up on
+  // the daemon for this invocation.
+  std::unique_ptr<AsyncRead> read_async(FindJobRequest &&find_request);
   void add(const AddJobRequest &add_request);
+
+  // Sends the queued reads, at most max_batch_size to a request. This
+  // also happens on its own once that many reads have been queued.
+  static constexpr size_t max_batch_size = 64;
+  void flush();
+
+  // Readable whenever the daemon has sent something. Unlike the
+  // connection itself this fd stays the same for the life of the Cache.
+  int fd() const { return poll.epfd; }
+
+  // Flushes, then reads whatever the daemon has sent so far without
+  // blocking, finishing the reads it answers. Also sends again the reads
+  // that have gone unanswered for too long, and reconnects if the
+  // connection broke.
+  void step();
+
+  // The ids of reads that finished since the last call
+  std::vector<uint64_t> take_done();
+
+  const ConnectStats &connect_stats() const { return stats; }
 };
 
 }  // namespace job_cache
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <future>
+#include <memory>
 #include <thread>
 
 #include "message_parser.h"
@@ -152,11 +153,19 @@ static void copy(int src_fd, int dst_fd) {
     wcl::log::error("fstat(src_fd = %d): %s", src_fd, strerror(errno)).urgent()();
     exit(1);
   }
-  if (copy_file_range(src_fd, nullptr, dst_fd, nullptr, buf.st_size, 0) < 0) {
-    wcl::log::error("copy_file_range(src_fd = %d, NULL, dst_fd = %d, size = %ld, 0): %s", src_fd,
-                    dst_fd, buf.st_size, strerror(errno))
-        .urgent()();
-    exit(1);
+  // copy_file_range may copy less than asked for, notably for large files
+  size_t size = buf.st_size;
+  while (size != 0) {
+    ssize_t written = copy_file_range(src_fd, nullptr, dst_fd, nullptr, size, 0);
+    if (written < 0) {
+      wcl::log::error("copy_file_range(src_fd = %d, NULL, dst_fd = %d, size = %ld, 0): %s",
+                      src_fd, dst_fd, buf.st_size, strerror(errno))
+          .urgent()();
+      exit(1);
+    }
+    // The file was truncated underneath us
+    if (written == 0) break;
+    size -= written;
   }
 }
 
@@ -191,15 +200,15 @@ static void copy(int src_fd, int dst_fd) {
           .urgent()();
       exit(1);
     }
-    idx = written;
+    // sendfile advances idx for us
     size -= written;
   } while (size != 0);
 }
 #endif
 
-#ifdef FICLONE
+using fd_pair = std::pair<wcl::unique_fd, wcl::unique_fd>;
 
-void copy_or_reflink(const char *src, const char *dst, mode_t mode, int extra_flags) {
+static fd_pair open_for_copy(const char *src, const char *dst, mode_t mode, int extra_flags) {
   auto src_fd = wcl::unique_fd::open(src, O_RDONLY);
   if (!src_fd) {
     wcl::log::error("open(%s): %s", src, strerror(src_fd.error())).urgent()();
@@ -210,90 +219,132 @@ void copy_or_reflink(const char *src, const char *dst, mode_t mode, int extra_fl
     wcl::log::error("open(%s): %s", dst, strerror(dst_fd.error())).urgent()();
     exit(1);
   }
+  return fd_pair(std::move(*src_fd), std::move(*dst_fd));
+}
+
+#ifdef FICLONE
 
-  if (ioctl(dst_fd->get(), FICLONE, src_fd->get()) < 0) {
+void copy_or_reflink(const char *src, const char *dst, mode_t mode, int extra_flags) {
+  auto fds = open_for_copy(src, dst, mode, extra_flags);
+  if (ioctl(fds.second.get(), FICLONE, fds.first.get()) < 0) {
     if (errno != EINVAL && errno != EOPNOTSUPP && errno != EXDEV) {
       wcl::log::error("ioctl(%s, FICLONE, %s): %s", dst, src, strerror(errno)).urgent()();
       exit(1);
     }
-    copy(src_fd->get(), dst_fd->get());
+    copy(fds.first.get(), fds.second.get());
   }
 }
 
 #else
 
 void copy_or_reflink(const char *src, const char *dst, mode_t mode, int extra_flags) {
-  auto src_fd = wcl::unique_fd::open(src, O_RDONLY);
-  if (!src_fd) {
-    wcl::log::error("open(%s): %s", src, strerror(src_fd.error())).urgent()();
+  auto fds = open_for_copy(src, dst, mode, extra_flags);
+  copy(fds.first.get(), fds.second.get());
+}
+
+#endif
+
+void copy_file(const char *src, const char *dst, mode_t mode, int extra_flags) {
+  auto fds = open_for_copy(src, dst, mode, extra_flags);
+  copy(fds.first.get(), fds.second.get());
+}
+
+bool try_hardlink_readonly(const char *src, const char *dst, mode_t mode) {
+  mode &= 07777;
+  if (mode & 0222) return false;
+
+  // Every link to a file shares its mode so src must already have the right one
+  struct stat buf;
+  if (stat(src, &buf) < 0) {
+    wcl::log::error("stat(%s): %s", src, strerror(errno)).urgent()();
     exit(1);
   }
-  auto dst_fd = wcl::unique_fd::open(dst, O_WRONLY | O_CREAT | extra_flags, mode);
-  if (!dst_fd) {
-    wcl::log::error("open(%s): %s", dst, strerror(dst_fd.error())).urgent()();
+  if ((buf.st_mode & 07777) != mode) return false;
+
+  if (link(src, dst) < 0) {
+    // Different filesystems, too many links, or links not allowed
+    if (errno == EXDEV || errno == EMLINK || errno == EPERM) return false;
+    wcl::log::error("link(%s, %s): %s", src, dst, strerror(errno)).urgent()();
     exit(1);
   }
+  return true;
+}
 
-  copy(src_fd->get(), dst_fd->get());
+std::string blob_path(const std::string &hash) {
+  return wcl::join_paths("blobs", hash.substr(0, 2), hash);
 }
 
-#endif
+void stash_blobs(const std::vector<std::string> &hashes, const std::string &stash_dir) {
+  mkdir_no_fail(stash_dir.c_str());
+  for (const auto &hash : hashes) {
+    std::string blob = blob_path(hash);
+    std::string stashed = wcl::join_paths(stash_dir, hash);
+    if (rename(blob.c_str(), stashed.c_str()) < 0 && errno != ENOENT) {
+      wcl::log::error("rename(%s, %s): %s", blob.c_str(), stashed.c_str(), strerror(errno))
+          .urgent()();
+      exit(1);
+    }
+  }
+}
 
-void remove_job_backing_files(const std::string &dir, int64_t job_id) {
-  uint8_t group_id = job_id & 0xFF;
-  std::string job_dir = wcl::join_paths(dir, wcl::to_hex(&group_id), std::to_string(job_id));
-  auto dir_range = wcl::directory_range::open(job_dir);
+static std::vector<std::string> list_stashed_blobs(const std::string &stash_dir) {
+  auto dir_range = wcl::directory_range::open(stash_dir);
   if (!dir_range) {
-    wcl::log::error("opendir(%s): %s", job_dir.c_str(), strerror(dir_range.error())).urgent()();
+    wcl::log::error("opendir(%s): %s", stash_dir.c_str(), strerror(dir_range.error())).urgent()();
     exit(1);
   }
 
-  wcl::log::info("Removing backing files of job with job_id = %ld at %s", job_id,
-                 job_dir.c_str())();
-
-  // loop over the directory now and delete any files as we go.
   std::vector<std::string> files_to_remove;
   for (const auto &entry : *dir_range) {
     if (!entry) {
-      wcl::log::error("readdir(%s): %s", job_dir.c_str(), strerror(entry.error())).urgent()();
+      wcl::log::error("readdir(%s): %s", stash_dir.c_str(), strerror(entry.error())).urgent()();
       exit(1);
     }
     if (entry->name == "." || entry->name == "..") continue;
     if (entry->type != wcl::file_type::regular) {
-      wcl::log::error("remove_backing_files(%s): found non-regular entry: %s", job_dir.c_str(),
+      wcl::log::error("remove_stashed_blobs(%s): found non-regular entry: %s", stash_dir.c_str(),
                       entry->name.c_str())
           .urgent()();
       exit(1);
     }
-    files_to_remove.push_back(wcl::join_paths(job_dir, entry->name));
+    files_to_remove.push_back(wcl::join_paths(stash_dir, entry->name));
   }
-  for (const auto &file : files_to_remove) {
+  return files_to_remove;
+}
+
+void remove_stashed_blobs(const std::string &stash_dir) {
+  for (const auto &file : list_stashed_blobs(stash_dir)) {
     unlink_no_fail(file.c_str());
   }
 
-  rmdir_no_fail(job_dir.c_str());
+  rmdir_no_fail(stash_dir.c_str());
 }
 
-void remove_backing_files(std::string dir, std::vector<std::pair<int64_t, std::string>> job_ids,
-                          size_t max_number_of_threads) {
+void remove_backing_files(std::vector<std::pair<int64_t, std::string>> job_ids,
+                          std::string stash_dir, size_t max_number_of_threads) {
+  for (const auto &job : job_ids) {
+    wcl::log::info("evicted job with cmd = %s", job.second.c_str())();
+  }
+
+  std::vector<std::string> files = list_stashed_blobs(stash_dir);
+
   // Calculate a good number of threads to use.
-  size_t actual_num_threads = std::min(max_number_of_threads, std::max(1UL, job_ids.size()));
+  size_t actual_num_threads = std::min(max_number_of_threads, std::max(1UL, files.size()));
 
   // Calculate how many removals will be done by each task
   size_t actual_removals_per_thread =
-      job_ids.size() / actual_num_threads + !!(job_ids.size() % actual_num_threads);
+      files.size() / actual_num_threads + !!(files.size() % actual_num_threads);
 
   // Kick off each task
   std::vector<std::future<void>> tasks;
-  auto iter = job_ids.begin();
-  auto end = job_ids.end();
+  auto iter = files.begin();
+  auto end = files.end();
   while (iter < end) {
     auto task_end = iter + actual_removals_per_thread;
-    tasks.emplace_back(std::async(std::launch::async, [&dir, iter, task_end, end]() {
+    tasks.emplace_back(std::async(std::launch::async, [iter, task_end, end]() {
       auto i = iter;
       for (; i < task_end && i < end; ++i) {
-        wcl::log::info("evicted job with cmd = %s", i->second.c_str())();
-        remove_job_backing_files(dir, i->first);
+        unlink_no_fail(i->c_str());
       }
     }));
     iter = task_end;
@@ -303,6 +354,8 @@ void remove_backing_files(std::string dir, std::vector<std::pair<int64_t, std::s
   for (auto &task : tasks) {
     task.wait();
   }
+
+  rmdir_no_fail(stash_dir.c_str());
 }
 
 namespace job_cache {
@@ -359,19 +412,17 @@ wcl::optional<wcl::posix_error_t> sync_send_json_message(int fd, const JAST &jso
   std::string json_str = s.str();
   json_str += '\0';
 
-  EPoll epoll;
-  epoll.add(fd, EPOLLOUT);
-  MessageSender sender(std::move(json_str), fd, timeout_seconds);
+  return sync_send_message(fd, std::move(json_str), timeout_seconds);
+}
 
+wcl::optional<wcl::posix_error_t> sync_send_message(int fd, std::string message,
+                                                    uint64_t timeout_seconds) {
+  MessageSender sender(std::move(message), fd, timeout_seconds);
+
+  // Requests normally fit in the socket buffer so only wait
+  // for the fd to become writable if the first write blocks.
+  std::unique_ptr<EPoll> epoll;
   while (true) {
-    // Timeout the epoll after 1 second so that
-    // we can uphold the timeout accuracy to within 1 second
-    struct timespec timeout;
-    timeout.tv_sec = 1;
-    timeout.tv_nsec = 0;
-    wcl::log::info("client: waiting for EPOLLOUT event on %d", fd)();
-    epoll.wait(&timeout, nullptr);
-    wcl::log::info("client: EPOLLOUT event on %d occured!", fd)();
     auto state = sender.send();
     if (state == MessageSenderState::Timeout) {
       wcl::log::error("client: write(%d): timed out", fd)();
@@ -384,6 +435,20 @@ wcl::optional<wcl::posix_error_t> sync_send_json_message(int fd, const JAST &jso
     if (state == MessageSenderState::StopSuccess) {
       return {};
     }
+
+    if (!epoll) {
+      epoll = std::make_unique<EPoll>();
+      epoll->add(fd, EPOLLOUT);
+    }
+
+    // Timeout the epoll after 1 second so that
+    // we can uphold the timeout accuracy to within 1 second
+    struct timespec timeout;
+    timeout.tv_sec = 1;
+    timeout.tv_nsec = 0;
+    wcl::log::info("client: waiting for EPOLLOUT event on %d", fd)();
+    epoll->wait(&timeout, nullptr);
+    wcl::log::info("client: EPOLLOUT event on %d occured!", fd)();
   }
 
   return {};
@@ -33,21 +33,38 @@ using group_id_t = uint8_t;
 
 int64_t current_time_microseconds();
 
-// This function removes all the baking files of a specific job.
-// While not technically unsafe to use on a job still in the databse
-// this should be avoided.
-void remove_job_backing_files(const std::string &dir, int64_t job_id);
+// Every output file is stored once by content at blobs/<first byte of hash>/<hash>
+// relative to the cache directory.
+std::string blob_path(const std::string &hash);
 
-// Like remove_backing_files(int64_t job_id) but removes many
-// in parallel.
+// Renames the given blobs out of the store into the new directory `stash_dir`.
+// Once stashed, a blob with the same hash can be stored again without racing
+// against the removal of the old one. Blobs that are already missing are skipped.
+void stash_blobs(const std::vector<std::string> &hashes, const std::string &stash_dir);
+
+// This function removes a directory of blobs created by stash_blobs.
+void remove_stashed_blobs(const std::string &stash_dir);
+
+// Like remove_stashed_blobs but removes many blobs in parallel
+// and logs the jobs they were evicted with.
 // NOTE: This should not be used from the wake process itself
 //       because it can spawn threads.
-void remove_backing_files(std::string dir, std::vector<std::pair<int64_t, std::string>> job_ids,
-                          size_t max_number_of_threads);
+void remove_backing_files(std::vector<std::pair<int64_t, std::string>> job_ids,
+                          std::string stash_dir, size_t max_number_of_threads);
 
 // Tries to reflink src to dst but copies if that fails.
 void copy_or_reflink(const char *src, const char *dst, mode_t mode = 0644, int extra_flags = 0);
 
+// Always makes a full copy of src at dst, even if a reflink is possible.
+void copy_file(const char *src, const char *dst, mode_t mode = 0644, int extra_flags = 0);
+
+// Hard links src to dst if the file at dst is meant to have `mode` and `mode`
+// has no write permissions. Since both names share one inode this requires
+// src to already have exactly that mode. Returns false without doing
+// anything if the link can't or shouldn't be made, including when src and dst
+// are on different filesystems, so that the caller can copy instead.
+bool try_hardlink_readonly(const char *src, const char *dst, mode_t mode);
+
 // These functions handle errors for us by calling log_fatal
 // if we get an error we don't like.
 void rename_no_fail(const char *old_path, const char *new_path);
@@ -74,4 +91,9 @@ wcl::result<std::vector<std::string>, SyncMessageReadError> sync_read_message(
 wcl::optional<wcl::posix_error_t> sync_send_json_message(int fd, const JAST &json,
                                                          uint64_t timeout_seconds);
 
+// Write an already framed message, either null terminated JSON or a binary
+// frame, to fd synchronously. Errors are reported like sync_send_json_message.
+wcl::optional<wcl::posix_error_t> sync_send_message(int fd, std::string message,
+                                                    uint64_t timeout_seconds);
+
 }  // namespace job_cache
\ No newline at end of file
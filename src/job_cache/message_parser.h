@@ -23,9 +23,12 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
+#include "binary.h"
+
 namespace job_cache {
 
 enum class MessageParserState { Continue, StopSuccess, StopFail, Timeout };
@@ -40,9 +43,16 @@ struct MessageParser {
   std::string message_buff = "";
   int fd;
   time_t deadline;
+  // Binary frames carry their size rather than being null terminated.
+  // While one is being read these track how much of it is left.
+  bool in_frame = false;
+  size_t frame_left = 0;
 
   MessageParser() = delete;
   MessageParser(int fd, uint64_t timeout) : fd(fd), deadline(time(nullptr) + timeout) {}
+  // For long lived connections that may sit idle. Deadlines for individual
+  // messages are then up to the owner.
+  explicit MessageParser(int fd) : fd(fd), deadline(std::numeric_limits<time_t>::max()) {}
 
   bool has_timed_out() const { return time(nullptr) > deadline; }
 
@@ -82,10 +92,33 @@ struct MessageParser {
         return MessageParserState::StopFail;
       }
 
-      // Now we split the data we've received up by null bytes
+      // Now we split the data we've received up by null bytes, or by
+      // the frame size for binary messages.
       uint8_t* iter = buffer;
       uint8_t* buffer_end = buffer + count;
       while (iter < buffer_end) {
+        if (!in_frame && message_buff.empty() && *iter == binary_frame_magic) {
+          in_frame = true;
+          frame_left = binary_frame_header_size;
+        }
+
+        if (in_frame) {
+          size_t take = std::min<size_t>(frame_left, buffer_end - iter);
+          message_buff.append(iter, iter + take);
+          iter += take;
+          frame_left -= take;
+          if (frame_left > 0) continue;
+          // Having just read the header we now know how big the body is
+          if (message_buff.size() == binary_frame_header_size) {
+            frame_left = binary_frame_size(message_buff);
+            if (frame_left > 0) continue;
+          }
+          messages.emplace_back(std::move(message_buff));
+          message_buff = "";
+          in_frame = false;
+          continue;
+        }
+
         auto end = std::find(iter, buffer_end, 0);
         message_buff.append(iter, end);
         if (end != buffer_end) {
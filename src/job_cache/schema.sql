@@ -12,15 +12,18 @@ begin immediate transaction;
 -- a special table of some kind. We use a bloom filter
 -- table. We have an index on (directory, commandline, environment,
 -- stdin) and from there we do a scan over our bloom_filters. Any
--- remaining matching jobs can be checked against the the input_files,
--- and input_dirs tables.
+-- remaining matching jobs are checked against their input manifests
+-- in the job_inputs table. The bloom_filter is a blob holding a
+-- BloomFilter (see bloom.h). Caches created when it was a 64-bit
+-- integer still declare the column as an integer, blobs are stored
+-- as is regardless. user_version tracks which format is in use.
 create table if not exists jobs(
   job_id       integer primary key autoincrement,
   directory    text    not null,
   commandline  blob    not null,
   environment  blob    not null,
   stdin        text    not null,
-  bloom_filter integer not null,
+  bloom_filter blob    not null,
   runner_hash  text    not null,
   create_time  integer not null);
 create index if not exists job on jobs(directory, commandline, environment, stdin, runner_hash);
@@ -43,7 +46,16 @@ create table if not exists job_output_info(
 
 -- We only record the input hashes, and not all visible files.
 -- The input file blobs are not stored on disk. Only their hash
--- is stored
+-- is stored. A job's input files and input dirs are each packed
+-- into a single InputManifest blob (see input_manifest.h) so that
+-- matching a job reads one row rather than a row per input.
+create table if not exists job_inputs(
+  job   job_id primary key not null references jobs(job_id) on delete cascade,
+  files blob               not null,
+  dirs  blob               not null);
+
+-- Caches used to store a row per input in these two tables instead.
+-- They are only read when upgrading such a cache to job_inputs.
 create table if not exists input_files(
   input_file_id integer primary key autoincrement,
   path          text    not null,
@@ -51,8 +63,8 @@ create table if not exists input_files(
   job           job_id  not null references jobs(job_id) on delete cascade);
 create index if not exists input_file_by_job on input_files(job);
 
--- We also need to know about directories that have been read
--- in some way. For instance if a file fails to be read in
+-- As well as the files we also need to know about directories that
+-- have been read in some way. For instance if a file fails to be read in
 -- a directory or if a readdir is performed. We only
 -- store a hash of a subset of the dirent information for
 -- a directory. Namely the name of each entry and its d_type.
@@ -68,8 +80,8 @@ create index if not exists input_dir_by_job on input_dirs(job);
 -- We don't record where a wake job writes an output file
 -- only where the file is placed within the sandbox. Each
 -- seperate sandbox will provide a distinct remapping of
--- these items. The blobs of these hashes will also
--- be stored on disk.
+-- these items. The blobs of these hashes are kept
+-- in the blob store below.
 create table if not exists output_files(
   output_file_id integer primary key autoincrement,
   path           text    not null,
@@ -104,6 +116,38 @@ create table if not exists total_size(
 
 insert into total_size (total_size_id, size) select 1, 0 where not exists (select * from total_size);
 
+-- The contents of output files are stored once per unique hash no
+-- matter how many jobs output them. Each blob records its size and
+-- how many output_files reference it. The triggers below keep the
+-- reference counts and the total size up to date, including when
+-- jobs are deleted and their output_files cascade. Blobs that are
+-- no longer referenced are deleted along with their backing files.
+create table if not exists blobs(
+  hash     text    primary key,
+  size     integer not null,
+  refcount integer not null);
+create index if not exists blob_by_refcount on blobs(refcount);
+
+create trigger if not exists blob_add_ref after insert on output_files
+begin
+  update blobs set refcount = refcount + 1 where hash = new.hash;
+end;
+
+create trigger if not exists blob_remove_ref after delete on output_files
+begin
+  update blobs set refcount = refcount - 1 where hash = old.hash;
+end;
+
+create trigger if not exists blob_add_size after insert on blobs
+begin
+  update total_size set size = size + new.size;
+end;
+
+create trigger if not exists blob_remove_size after delete on blobs
+begin
+  update total_size set size = size - old.size;
+end;
+
 -- We need to keep track of jobs as the come through so that
 -- have some idea of which ones to keep/not keep
 create table if not exists lru_stats(
@@ -59,6 +59,18 @@ JAST CachedOutputFile::to_json() const {
   return json;
 }
 
+CachedOutputFile::CachedOutputFile(BinaryReader &in) {
+  path = in.read_path();
+  hash = in.read_hash();
+  mode = in.read_varint();
+}
+
+void CachedOutputFile::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_hash(hash);
+  out.write_varint(mode);
+}
+
 CachedOutputSymlink::CachedOutputSymlink(const JAST &json) {
   path = json.get("path").value;
   value = json.get("value").value;
@@ -71,6 +83,16 @@ JAST CachedOutputSymlink::to_json() const {
   return json;
 }
 
+CachedOutputSymlink::CachedOutputSymlink(BinaryReader &in) {
+  path = in.read_path();
+  value = in.read_string();
+}
+
+void CachedOutputSymlink::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_string(value);
+}
+
 CachedOutputDir::CachedOutputDir(const JAST &json) {
   path = json.get("path").value;
   mode = std::stol(json.get("mode").value);
@@ -83,6 +105,16 @@ JAST CachedOutputDir::to_json() const {
   return json;
 }
 
+CachedOutputDir::CachedOutputDir(BinaryReader &in) {
+  path = in.read_path();
+  mode = in.read_varint();
+}
+
+void CachedOutputDir::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_varint(mode);
+}
+
 JobOutputInfo::JobOutputInfo(const JAST &json) {
   stdout_str = json.get("stdout").value;
   stderr_str = json.get("stderr").value;
@@ -107,6 +139,28 @@ JAST JobOutputInfo::to_json() const {
   return json;
 }
 
+JobOutputInfo::JobOutputInfo(BinaryReader &in) {
+  stdout_str = in.read_string();
+  stderr_str = in.read_string();
+  status = int64_t(in.read_varint());
+  runtime = in.read_double();
+  cputime = in.read_double();
+  mem = in.read_varint();
+  ibytes = in.read_varint();
+  obytes = in.read_varint();
+}
+
+void JobOutputInfo::to_binary(BinaryWriter &out) const {
+  out.write_string(stdout_str);
+  out.write_string(stderr_str);
+  out.write_varint(int64_t(status));
+  out.write_double(runtime);
+  out.write_double(cputime);
+  out.write_varint(mem);
+  out.write_varint(ibytes);
+  out.write_varint(obytes);
+}
+
 MatchingJob::MatchingJob(const JAST &json) {
   client_cwd = json.get("client_cwd").value;
   output_info = JobOutputInfo(json.get("output_info"));
@@ -221,6 +275,66 @@ JAST MatchingJob::to_json() const {
   return json;
 }
 
+// The writer has already made the paths client-relative
+MatchingJob::MatchingJob(BinaryReader &in) {
+  client_cwd = in.read_string();
+  output_info = JobOutputInfo(in);
+
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    output_files.emplace_back(in);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    output_dirs.emplace_back(in);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    output_symlinks.emplace_back(in);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    input_files.emplace_back(in.read_path());
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    input_dirs.emplace_back(in.read_path());
+  }
+}
+
+void MatchingJob::to_binary(BinaryWriter &out) const {
+  // Canonicalize matching jobs to use client-relative paths.
+  auto client_path = [this](const std::string &path) {
+    return wcl::is_absolute(path) ? wcl::relative_to(client_cwd, path) : path;
+  };
+
+  out.write_string(client_cwd);
+  output_info.to_binary(out);
+
+  out.write_varint(output_files.size());
+  for (auto output : output_files) {
+    output.path = client_path(output.path);
+    output.to_binary(out);
+  }
+
+  out.write_varint(output_dirs.size());
+  for (auto output : output_dirs) {
+    output.path = client_path(output.path);
+    output.to_binary(out);
+  }
+
+  out.write_varint(output_symlinks.size());
+  for (auto output : output_symlinks) {
+    output.path = client_path(output.path);
+    output.to_binary(out);
+  }
+
+  out.write_varint(input_files.size());
+  for (const auto &input : input_files) {
+    out.write_path(client_path(input));
+  }
+
+  out.write_varint(input_dirs.size());
+  for (const auto &input : input_dirs) {
+    out.write_path(client_path(input));
+  }
+}
+
 InputFile::InputFile(const JAST &json) {
   path = json.get("path").value;
   hash = Hash256::from_hex(json.get("hash").value);
@@ -233,6 +347,16 @@ JAST InputFile::to_json() const {
   return json;
 }
 
+InputFile::InputFile(BinaryReader &in) {
+  path = in.read_path();
+  hash = in.read_hash();
+}
+
+void InputFile::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_hash(hash);
+}
+
 InputDir::InputDir(const JAST &json) {
   path = json.get("path").value;
   hash = Hash256::from_hex(json.get("hash").value);
@@ -245,6 +369,16 @@ JAST InputDir::to_json() const {
   return json;
 }
 
+InputDir::InputDir(BinaryReader &in) {
+  path = in.read_path();
+  hash = in.read_hash();
+}
+
+void InputDir::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_hash(hash);
+}
+
 OutputFile::OutputFile(const JAST &json) {
   source = json.get("source").value;
   path = json.get("path").value;
@@ -261,6 +395,20 @@ JAST OutputFile::to_json() const {
   return json;
 }
 
+OutputFile::OutputFile(BinaryReader &in) {
+  source = in.read_path();
+  path = in.read_path();
+  hash = in.read_hash();
+  mode = in.read_varint();
+}
+
+void OutputFile::to_binary(BinaryWriter &out) const {
+  out.write_path(source);
+  out.write_path(path);
+  out.write_hash(hash);
+  out.write_varint(mode);
+}
+
 OutputDirectory::OutputDirectory(const JAST &json) {
   path = json.get("path").value;
   mode = std::stol(json.get("mode").value);
@@ -273,6 +421,16 @@ JAST OutputDirectory::to_json() const {
   return json;
 }
 
+OutputDirectory::OutputDirectory(BinaryReader &in) {
+  path = in.read_path();
+  mode = in.read_varint();
+}
+
+void OutputDirectory::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_varint(mode);
+}
+
 OutputSymlink::OutputSymlink(const JAST &json) {
   path = json.get("path").value;
   value = json.get("value").value;
@@ -285,6 +443,16 @@ JAST OutputSymlink::to_json() const {
   return json;
 }
 
+OutputSymlink::OutputSymlink(BinaryReader &in) {
+  path = in.read_path();
+  value = in.read_string();
+}
+
+void OutputSymlink::to_binary(BinaryWriter &out) const {
+  out.write_path(path);
+  out.write_string(value);
+}
+
 AddJobRequest AddJobRequest::from_implicit(const JAST &json) {
   AddJobRequest req;
   req.wakeroot = json.get("wakeroot").value;
@@ -559,6 +727,101 @@ JAST AddJobRequest::to_json() const {
   return json;
 }
 
+// The writer has already canonicalized every path
+AddJobRequest::AddJobRequest(BinaryReader &in) {
+  wakeroot = in.read_string();
+  cwd = in.read_string();
+  command_line = in.read_string();
+  environment = in.read_string();
+  stdin_str = in.read_string();
+  stdout_str = in.read_string();
+  stderr_str = in.read_string();
+  status = int64_t(in.read_varint());
+  runtime = in.read_double();
+  cputime = in.read_double();
+  mem = in.read_varint();
+  ibytes = in.read_varint();
+  obytes = in.read_varint();
+  client_cwd = in.read_string();
+  runner_hash = in.read_string();
+
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    inputs.emplace_back(in);
+    bloom.add_hash(inputs.back().hash);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    directories.emplace_back(in);
+    bloom.add_hash(directories.back().hash);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    outputs.emplace_back(in);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    output_dirs.emplace_back(in);
+  }
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    output_symlinks.emplace_back(in);
+  }
+}
+
+void AddJobRequest::to_binary(BinaryWriter &out) const {
+  out.write_string(wakeroot);
+  out.write_string(cwd);
+  out.write_string(command_line);
+  out.write_string(environment);
+  out.write_string(stdin_str);
+  out.write_string(stdout_str);
+  out.write_string(stderr_str);
+  out.write_varint(int64_t(status));
+  out.write_double(runtime);
+  out.write_double(cputime);
+  out.write_varint(mem);
+  out.write_varint(ibytes);
+  out.write_varint(obytes);
+  out.write_string(client_cwd);
+  out.write_string(runner_hash);
+
+  out.write_varint(inputs.size());
+  for (const auto &input : inputs) input.to_binary(out);
+  out.write_varint(directories.size());
+  for (const auto &input : directories) input.to_binary(out);
+  out.write_varint(outputs.size());
+  for (const auto &output : outputs) output.to_binary(out);
+  out.write_varint(output_dirs.size());
+  for (const auto &output : output_dirs) output.to_binary(out);
+  out.write_varint(output_symlinks.size());
+  for (const auto &output : output_symlinks) output.to_binary(out);
+}
+
+// Fills in the bloom filter and the directory hashes from `visible`
+static void hash_visible(FindJobRequest &req) {
+  for (const auto &input : req.visible) {
+    req.bloom.add_hash(input.second);
+  }
+
+  // Now accumulate the hashables in the directory.
+  std::unordered_map<std::string, std::string> dirs;
+  // NOTE: `visible` is already sorted because its an std::map.
+  // this means that we'll accumulate directories correctly.
+  for (const auto &input : req.visible) {
+    auto pair = wcl::parent_and_base(input.first);
+    if (!pair) continue;
+    std::string parent = std::move(pair->first);
+    std::string base = std::move(pair->second);
+    dirs[parent] += base;
+    dirs[parent] += ":";
+  }
+
+  // Now actually perform those hashes
+  // Jobs also record the directories they listed so those hashes have
+  // to be in the bloom filter as well.
+  for (auto dir : dirs) {
+    Hash256 hash = Hash256::blake2b(dir.second);
+    req.bloom.add_hash(hash);
+    req.dir_hashes[dir.first] = hash;
+  }
+}
+
 FindJobRequest::FindJobRequest(const JAST &find_job_json) {
   wakeroot = find_job_json.get("wakeroot").value;
   if (wcl::is_relative(wakeroot)) {
@@ -583,7 +846,11 @@ FindJobRequest::FindJobRequest(const JAST &find_job_json) {
     exit(1);
   }
 
-  // Read the input files, and compute the directory hashes as we go.
+  // Requests that don't name a policy get the default
+  auto policy = parse_materialize_policy(find_job_json.get("materialize").value);
+  if (policy) materialize = *policy;
+
+  // Read the input files, and compute the directory hashes after.
   for (const auto &input_file : find_job_json.get("input_files").children) {
     std::string path = input_file.second.get("path").value;
     // Canonicalize all input file paths to sandbox-absolute paths.
@@ -591,28 +858,9 @@ FindJobRequest::FindJobRequest(const JAST &find_job_json) {
     if (wcl::is_relative(path)) {
       path = wcl::join_paths(wakeroot, path);
     }
-    Hash256 hash = Hash256::from_hex(input_file.second.get("hash").value);
-    bloom.add_hash(hash);
-    visible[std::move(path)] = hash;
-  }
-
-  // Now accumulate the hashables in the directory.
-  std::unordered_map<std::string, std::string> dirs;
-  // NOTE: `visible` is already sorted because its an std::map.
-  // this means that we'll accumulate directories correctly.
-  for (const auto &input : visible) {
-    auto pair = wcl::parent_and_base(input.first);
-    if (!pair) continue;
-    std::string parent = std::move(pair->first);
-    std::string base = std::move(pair->second);
-    dirs[parent] += base;
-    dirs[parent] += ":";
-  }
-
-  // Now actually perform those hashes
-  for (auto dir : dirs) {
-    dir_hashes[dir.first] = Hash256::blake2b(dir.second);
+    visible[std::move(path)] = Hash256::from_hex(input_file.second.get("hash").value);
   }
+  hash_visible(*this);
 
   // When outputting files we need to map sandbox dirs to output dirs.
   // Collect those redirects here.
@@ -643,6 +891,7 @@ JAST FindJobRequest::to_json() const {
   json.add("environment", environment);
   json.add("stdin", stdin_str);
   json.add("client_cwd", client_cwd);
+  json.add("materialize", to_string(materialize));
   json.add("runner_hash", runner_hash);
 
   JAST input_files(JSON_ARRAY);
@@ -667,6 +916,59 @@ JAST FindJobRequest::to_json() const {
   return json;
 }
 
+FindJobRequest::FindJobRequest(BinaryReader &in) {
+  wakeroot = in.read_string();
+  cwd = in.read_string();
+  command_line = in.read_string();
+  environment = in.read_string();
+  stdin_str = in.read_string();
+  client_cwd = in.read_string();
+  auto policy = parse_materialize_policy(in.read_string());
+  if (policy) materialize = *policy;
+  runner_hash = in.read_string();
+
+  // The writer sends `visible` in order so every insert goes at the end
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    std::string path = in.read_path();
+    visible.emplace_hint(visible.end(), std::move(path), in.read_hash());
+  }
+  hash_visible(*this);
+
+  for (size_t i = 0, n = in.read_count(); i < n; ++i) {
+    std::string dir = in.read_string();
+    auto dir_range = wcl::make_filepath_range(dir);
+    dir_redirects.move_emplace(dir_range.begin(), dir_range.end(), in.read_string());
+  }
+}
+
+void FindJobRequest::to_binary(BinaryWriter &out) const {
+  out.write_string(wakeroot);
+  out.write_string(cwd);
+  out.write_string(command_line);
+  out.write_string(environment);
+  out.write_string(stdin_str);
+  out.write_string(client_cwd);
+  out.write_string(to_string(materialize));
+  out.write_string(runner_hash);
+
+  out.write_varint(visible.size());
+  for (const auto &input : visible) {
+    out.write_path(input.first);
+    out.write_hash(input.second);
+  }
+
+  std::vector<std::pair<std::string, std::string>> redirects;
+  dir_redirects.for_each(
+      [&redirects](const std::vector<std::string> &prefix, const std::string &value) {
+        redirects.emplace_back("/" + wcl::join('/', prefix.begin(), prefix.end()), value);
+      });
+  out.write_varint(redirects.size());
+  for (const auto &redirect : redirects) {
+    out.write_string(redirect.first);
+    out.write_string(redirect.second);
+  }
+}
+
 FindJobResponse::FindJobResponse(JAST json) {
   JAST found = json.get("found");
   if (found.kind != JSON_TRUE) {
@@ -689,4 +991,15 @@ JAST FindJobResponse::to_json() const {
   return json;
 }
 
+FindJobResponse::FindJobResponse(BinaryReader &in) {
+  if (in.read_bool()) {
+    match = wcl::make_some<MatchingJob>(in);
+  }
+}
+
+void FindJobResponse::to_binary(BinaryWriter &out) const {
+  out.write_bool(bool(match));
+  if (match) match->to_binary(out);
+}
+
 }  // namespace job_cache
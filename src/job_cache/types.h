@@ -22,17 +22,50 @@
 
 #include <json/json5.h>
 #include <sys/types.h>
+#include <wcl/optional.h>
 #include <wcl/trie.h>
 
 #include <map>
 #include <string>
 #include <unordered_map>
 
+#include "binary.h"
 #include "bloom.h"
 #include "hash.h"
 
 namespace job_cache {
 
+// How the daemon puts a cached output in place on a hit. Each read names
+// its own, so clients sharing a daemon can each pick one.
+//   Copy: always make a full copy of the data.
+//   Reflink: share the data with the cache if the filesystem supports
+//     it, otherwise copy. This is the default.
+//   HardlinkReadonly: outputs without any write permission are hard linked
+//     straight to the cache's copy, everything else is reflinked. Nothing is
+//     copied but the output *is* the cache's copy so it must not be made
+//     writable and modified in place.
+enum class MaterializePolicy { Copy, Reflink, HardlinkReadonly };
+
+inline const char *to_string(MaterializePolicy policy) {
+  switch (policy) {
+    case MaterializePolicy::Copy:
+      return "copy";
+    case MaterializePolicy::Reflink:
+      return "reflink";
+    case MaterializePolicy::HardlinkReadonly:
+      return "hardlink-readonly";
+  }
+  return "reflink";
+}
+
+inline wcl::optional<MaterializePolicy> parse_materialize_policy(const std::string &str) {
+  for (auto policy : {MaterializePolicy::Copy, MaterializePolicy::Reflink,
+                      MaterializePolicy::HardlinkReadonly}) {
+    if (str == to_string(policy)) return wcl::make_some<MaterializePolicy>(policy);
+  }
+  return {};
+}
+
 struct CachedOutputFile {
   std::string path;
   Hash256 hash;
@@ -41,6 +74,8 @@ struct CachedOutputFile {
   CachedOutputFile() = default;
   explicit CachedOutputFile(const JAST &json);
   JAST to_json() const;
+  explicit CachedOutputFile(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct CachedOutputSymlink {
@@ -50,6 +85,8 @@ struct CachedOutputSymlink {
   CachedOutputSymlink() = default;
   explicit CachedOutputSymlink(const JAST &json);
   JAST to_json() const;
+  explicit CachedOutputSymlink(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct CachedOutputDir {
@@ -59,6 +96,8 @@ struct CachedOutputDir {
   CachedOutputDir() = default;
   explicit CachedOutputDir(const JAST &json);
   JAST to_json() const;
+  explicit CachedOutputDir(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct JobOutputInfo {
@@ -71,6 +110,8 @@ struct JobOutputInfo {
   JobOutputInfo() = default;
   explicit JobOutputInfo(const JAST &json);
   JAST to_json() const;
+  explicit JobOutputInfo(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct MatchingJob {
@@ -85,6 +126,8 @@ struct MatchingJob {
   MatchingJob() = default;
   explicit MatchingJob(const JAST &json);
   JAST to_json() const;
+  explicit MatchingJob(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct FindJobRequest {
@@ -103,8 +146,9 @@ struct FindJobRequest {
   std::map<std::string, Hash256> visible;
   std::unordered_map<std::string, Hash256> dir_hashes;
 
-  // Property of the client, not the job
+  // Properties of the client, not the job
   std::string client_cwd;
+  MaterializePolicy materialize = MaterializePolicy::Reflink;
 
   FindJobRequest() = delete;
   FindJobRequest(const FindJobRequest &) = default;
@@ -112,6 +156,8 @@ struct FindJobRequest {
 
   explicit FindJobRequest(const JAST &json);
   JAST to_json() const;
+  explicit FindJobRequest(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct FindJobResponse {
@@ -126,6 +172,8 @@ struct FindJobResponse {
   // 'found' is determined implicitly based on if a MatchingJob is set and vice versa
   explicit FindJobResponse(JAST json);
   JAST to_json() const;
+  explicit FindJobResponse(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 // JSON parsing stuff
@@ -136,6 +184,8 @@ struct InputFile {
   InputFile() = default;
   explicit InputFile(const JAST &json);
   JAST to_json() const;
+  explicit InputFile(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct InputDir {
@@ -145,6 +195,8 @@ struct InputDir {
   InputDir() = default;
   explicit InputDir(const JAST &json);
   JAST to_json() const;
+  explicit InputDir(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct OutputFile {
@@ -156,6 +208,8 @@ struct OutputFile {
   OutputFile() = default;
   explicit OutputFile(const JAST &json);
   JAST to_json() const;
+  explicit OutputFile(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct OutputDirectory {
@@ -165,6 +219,8 @@ struct OutputDirectory {
   OutputDirectory() = default;
   explicit OutputDirectory(const JAST &json);
   JAST to_json() const;
+  explicit OutputDirectory(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct OutputSymlink {
@@ -174,6 +230,8 @@ struct OutputSymlink {
   OutputSymlink() = default;
   explicit OutputSymlink(const JAST &json);
   JAST to_json() const;
+  explicit OutputSymlink(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 };
 
 struct AddJobRequest {
@@ -199,14 +257,17 @@ struct AddJobRequest {
   double runtime, cputime;
   uint64_t mem, ibytes, obytes;
 
-  // Property of the client, not the job
+  // Properties of the client, not the job
   std::string client_cwd;
+  MaterializePolicy materialize = MaterializePolicy::Reflink;
 
   AddJobRequest(const AddJobRequest &) = default;
   AddJobRequest(AddJobRequest &&) = default;
 
   explicit AddJobRequest(const JAST &json);
   JAST to_json() const;
+  explicit AddJobRequest(BinaryReader &in);
+  void to_binary(BinaryWriter &out) const;
 
   static AddJobRequest from_implicit(const JAST &json);
 };
@@ -0,0 +1,24163 @@
+/* Generated by re2c 3.0 */
+#line 1 "src/json/jlexer.re"
+/*
+ * Copyright 2019 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Open Group Base Specifications Issue 7
+#define _XOPEN_SOURCE 700
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+
+#include "util/location.h"
+#include "lexint.h"
+#include "utf8.h"
+#include "json5.h"
+
+#line 34 "src/json/jlexer.re"
+
+
+#line 35 "src/json/jlexer.cpp"
+#define YYMAXFILL 12
+#line 36 "src/json/jlexer.re"
+
+static const size_t SIZE = 4 * 1024;
+
+#line 1 "/usr/share/re2c/stdlib/unicode_categories.re"
+#line 40 "/usr/share/re2c/stdlib/unicode_categories.re"
+
+#line 39 "src/json/jlexer.re"
+
+
+struct jinput_t {
+  unsigned char buf[SIZE + 1];
+  const unsigned char *lim;
+  const unsigned char *cur;
+  const unsigned char *mar;
+  const unsigned char *tok;
+  const unsigned char *sol;
+  
+#line 55 "src/json/jlexer.cpp"
+const unsigned char *yyt1;
+#line 48 "src/json/jlexer.re"
+
+  long offset;
+  int  row;
+  bool eof;
+
+  const char *filename;
+  FILE *const file;
+
+  jinput_t(const char *fn, FILE *f, int start = SIZE, int end = SIZE)
+   : buf(), lim(buf + end), cur(buf + start), mar(buf + start), tok(buf + start), sol(buf + start),
+     
+#line 69 "src/json/jlexer.cpp"
+yyt1(NULL)
+#line 58 "src/json/jlexer.re"
+,
+     offset(-start), row(1), eof(false), filename(fn), file(f) { }
+  jinput_t(const char *fn, const unsigned char *buf_, int end)
+   : buf(), lim(buf_ + end), cur(buf_), mar(buf_), tok(buf_), sol(buf_),
+     
+#line 77 "src/json/jlexer.cpp"
+yyt1(NULL)
+#line 62 "src/json/jlexer.re"
+,
+     offset(0), row(1), eof(false), filename(fn), file(0) { }
+
+  int __attribute__ ((noinline)) fill();
+
+  Coordinates coord() const { return Coordinates(row, 1 + cur - sol); }
+};
+
+#define SYM_LOCATION Location(in.filename, start, in.coord()-1)
+#define mkSym2(x, v) JSymbol(x, SYM_LOCATION, std::move(v))
+#define mkSym(x) JSymbol(x, SYM_LOCATION)
+
+int jinput_t::fill() {
+  if (eof) return 1;
+
+  const size_t used = lim - tok;
+  const size_t free = SIZE - used;
+
+  memmove(buf, tok, used);
+  const unsigned char *newlim = buf + used;
+  offset += free;
+
+  cur = newlim - (lim - cur);
+  mar = newlim - (lim - mar);
+  tok = newlim - (lim - tok);
+  sol = newlim - (lim - sol);
+  
+#line 107 "src/json/jlexer.cpp"
+if (yyt1) yyt1 = newlim - (lim - yyt1);
+#line 88 "src/json/jlexer.re"
+
+
+  lim = newlim;
+  if (file) lim += fread(buf + (lim - buf), 1, free, file);
+
+  eof = lim < buf + SIZE;
+  buf[lim - buf] = 0;
+
+  return 0;
+}
+
+static void lex_jcomment(jinput_t &in) {
+  unsigned const char *s = in.tok;
+  unsigned const char *e = in.cur;
+  const unsigned char *ignore;
+  (void)ignore;
+
+  while (s != e) {
+    
+#line 129 "src/json/jlexer.cpp"
+{
+	unsigned char yych;
+	yych = *s;
+	switch (yych) {
+		case '\n':
+		case '\r': goto yy3;
+		case 0xE2: goto yy4;
+		default: goto yy1;
+	}
+yy1:
+	++s;
+yy2:
+#line 119 "src/json/jlexer.re"
+	{ continue; }
+#line 144 "src/json/jlexer.cpp"
+yy3:
+	++s;
+#line 120 "src/json/jlexer.re"
+	{ ++in.row; in.sol = s; continue; }
+#line 149 "src/json/jlexer.cpp"
+yy4:
+	yych = *(ignore = ++s);
+	switch (yych) {
+		case 0x80: goto yy5;
+		default: goto yy2;
+	}
+yy5:
+	yych = *++s;
+	switch (yych) {
+		case 0xA8:
+		case 0xA9: goto yy3;
+		default: goto yy6;
+	}
+yy6:
+	s = ignore;
+	goto yy2;
+}
+#line 121 "src/json/jlexer.re"
+
+  }
+}
+
+static bool lex_jstr(JLexer &lex, std::string &out, unsigned char eos)
+{
+  jinput_t &in = *lex.engine.get();
+  std::string slice;
+
+  while (true) {
+    in.tok = in.cur;
+    
+#line 180 "src/json/jlexer.cpp"
+{
+	unsigned char yych;
+	unsigned int yyaccept = 0;
+yyFillLabel0:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+		case 0x01:
+		case 0x02:
+		case 0x03:
+		case 0x04:
+		case 0x05:
+		case 0x06:
+		case 0x07:
+		case 0x08:
+		case '\t':
+		case '\v':
+		case '\f':
+		case 0x0E:
+		case 0x0F:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+		case 0x18:
+		case 0x19:
+		case 0x1A:
+		case 0x1B:
+		case 0x1C:
+		case 0x1D:
+		case 0x1E:
+		case 0x1F:
+		case ' ':
+		case '!':
+		case '#':
+		case '$':
+		case '%':
+		case '&':
+		case '(':
+		case ')':
+		case '*':
+		case '+':
+		case ',':
+		case '-':
+		case '.':
+		case '/':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case ':':
+		case ';':
+		case '<':
+		case '=':
+		case '>':
+		case '?':
+		case '@':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '[':
+		case ']':
+		case '^':
+		case '_':
+		case '`':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case '{':
+		case '|':
+		case '}':
+		case '~':
+		case 0x7F:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel0;
+				goto yy71;
+			}
+			goto yy8;
+		case '"':
+		case '\'': goto yy11;
+		case '\\': goto yy12;
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF: goto yy14;
+		case 0xE0: goto yy15;
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEE:
+		case 0xEF: goto yy16;
+		case 0xF0: goto yy17;
+		case 0xF1:
+		case 0xF2:
+		case 0xF3: goto yy18;
+		case 0xF4: goto yy19;
+		default: goto yy9;
+	}
+yy8:
+	++in.cur;
+#line 237 "src/json/jlexer.re"
+	{ slice.append(in.tok, in.cur); continue; }
+#line 375 "src/json/jlexer.cpp"
+yy9:
+	++in.cur;
+yy10:
+#line 203 "src/json/jlexer.re"
+	{ return false; }
+#line 381 "src/json/jlexer.cpp"
+yy11:
+	++in.cur;
+#line 206 "src/json/jlexer.re"
+	{
+          if (in.cur[-1] == eos) {
+             break;
+          } else {
+             slice.push_back(in.cur[-1]);
+             continue;
+          }
+        }
+#line 393 "src/json/jlexer.cpp"
+yy12:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel1:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+		case 0x01:
+		case 0x02:
+		case 0x03:
+		case 0x04:
+		case 0x05:
+		case 0x06:
+		case 0x07:
+		case 0x08:
+		case '\t':
+		case '\v':
+		case '\f':
+		case 0x0E:
+		case 0x0F:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+		case 0x18:
+		case 0x19:
+		case 0x1A:
+		case 0x1B:
+		case 0x1C:
+		case 0x1D:
+		case 0x1E:
+		case 0x1F:
+		case ' ':
+		case '!':
+		case '#':
+		case '$':
+		case '%':
+		case '&':
+		case '(':
+		case ')':
+		case '*':
+		case '+':
+		case ',':
+		case '-':
+		case '.':
+		case '/':
+		case ':':
+		case ';':
+		case '<':
+		case '=':
+		case '>':
+		case '?':
+		case '@':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '[':
+		case ']':
+		case '^':
+		case '_':
+		case '`':
+		case 'a':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 's':
+		case 'w':
+		case 'y':
+		case 'z':
+		case '{':
+		case '|':
+		case '}':
+		case '~':
+		case 0x7F:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel1;
+				goto yy13;
+			}
+			goto yy20;
+		case '\n': goto yy21;
+		case '\r': goto yy23;
+		case '"': goto yy24;
+		case '\'': goto yy25;
+		case '0': goto yy26;
+		case '\\': goto yy28;
+		case 'b': goto yy29;
+		case 'f': goto yy30;
+		case 'n': goto yy31;
+		case 'r': goto yy32;
+		case 't': goto yy33;
+		case 'u': goto yy34;
+		case 'v': goto yy35;
+		case 'x': goto yy36;
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF: goto yy37;
+		case 0xE0: goto yy38;
+		case 0xE1:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEE:
+		case 0xEF: goto yy39;
+		case 0xE2: goto yy40;
+		case 0xF0: goto yy41;
+		case 0xF1:
+		case 0xF2:
+		case 0xF3: goto yy42;
+		case 0xF4: goto yy43;
+		default: goto yy13;
+	}
+yy13:
+#line 236 "src/json/jlexer.re"
+	{ return false; }
+#line 580 "src/json/jlexer.cpp"
+yy14:
+	++in.cur;
+yyFillLabel2:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy8;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel2;
+			}
+			goto yy10;
+	}
+yy15:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel3:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy44;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel3;
+			}
+			goto yy10;
+	}
+yy16:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel4:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy44;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel4;
+			}
+			goto yy10;
+	}
+yy17:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel5:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy45;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel5;
+			}
+			goto yy10;
+	}
+yy18:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel6:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy45;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel6;
+			}
+			goto yy10;
+	}
+yy19:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel7:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy45;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel7;
+			}
+			goto yy10;
+	}
+yy20:
+	++in.cur;
+#line 235 "src/json/jlexer.re"
+	{ slice.append(in.tok+1, in.cur);  continue; }
+#line 944 "src/json/jlexer.cpp"
+yy21:
+	++in.cur;
+yy22:
+#line 205 "src/json/jlexer.re"
+	{ continue; }
+#line 950 "src/json/jlexer.cpp"
+yy23:
+	++in.cur;
+yyFillLabel8:
+	yych = *in.cur;
+	switch (yych) {
+		case '\n': goto yy21;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel8;
+			}
+			goto yy22;
+	}
+yy24:
+	++in.cur;
+#line 233 "src/json/jlexer.re"
+	{ slice.push_back('"');  continue; }
+#line 967 "src/json/jlexer.cpp"
+yy25:
+	++in.cur;
+#line 232 "src/json/jlexer.re"
+	{ slice.push_back('\''); continue; }
+#line 972 "src/json/jlexer.cpp"
+yy26:
+	++in.cur;
+yyFillLabel9:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+		case 0x01:
+		case 0x02:
+		case 0x03:
+		case 0x04:
+		case 0x05:
+		case 0x06:
+		case 0x07:
+		case 0x08:
+		case '\t':
+		case '\n':
+		case '\v':
+		case '\f':
+		case '\r':
+		case 0x0E:
+		case 0x0F:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+		case 0x18:
+		case 0x19:
+		case 0x1A:
+		case 0x1B:
+		case 0x1C:
+		case 0x1D:
+		case 0x1E:
+		case 0x1F:
+		case ' ':
+		case '!':
+		case '"':
+		case '#':
+		case '$':
+		case '%':
+		case '&':
+		case '\'':
+		case '(':
+		case ')':
+		case '*':
+		case '+':
+		case ',':
+		case '-':
+		case '.':
+		case '/':
+		case ':':
+		case ';':
+		case '<':
+		case '=':
+		case '>':
+		case '?':
+		case '@':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '[':
+		case '\\':
+		case ']':
+		case '^':
+		case '_':
+		case '`':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case '{':
+		case '|':
+		case '}':
+		case '~':
+		case 0x7F:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel9;
+				goto yy27;
+			}
+			in.yyt1 = in.cur;
+			goto yy46;
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF:
+			in.yyt1 = in.cur;
+			goto yy47;
+		case 0xE0:
+			in.yyt1 = in.cur;
+			goto yy48;
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEE:
+		case 0xEF:
+			in.yyt1 = in.cur;
+			goto yy49;
+		case 0xF0:
+			in.yyt1 = in.cur;
+			goto yy50;
+		case 0xF1:
+		case 0xF2:
+		case 0xF3:
+			in.yyt1 = in.cur;
+			goto yy51;
+		case 0xF4:
+			in.yyt1 = in.cur;
+			goto yy52;
+		default: goto yy27;
+	}
+yy27:
+	in.cur = in.mar;
+	switch (yyaccept) {
+		case 0: goto yy13;
+		case 1: goto yy10;
+		default: goto yy63;
+	}
+yy28:
+	++in.cur;
+#line 234 "src/json/jlexer.re"
+	{ slice.push_back('\\'); continue; }
+#line 1178 "src/json/jlexer.cpp"
+yy29:
+	++in.cur;
+#line 226 "src/json/jlexer.re"
+	{ slice.push_back('\b'); continue; }
+#line 1183 "src/json/jlexer.cpp"
+yy30:
+	++in.cur;
+#line 230 "src/json/jlexer.re"
+	{ slice.push_back('\f'); continue; }
+#line 1188 "src/json/jlexer.cpp"
+yy31:
+	++in.cur;
+#line 228 "src/json/jlexer.re"
+	{ slice.push_back('\n'); continue; }
+#line 1193 "src/json/jlexer.cpp"
+yy32:
+	++in.cur;
+#line 231 "src/json/jlexer.re"
+	{ slice.push_back('\r'); continue; }
+#line 1198 "src/json/jlexer.cpp"
+yy33:
+	++in.cur;
+#line 227 "src/json/jlexer.re"
+	{ slice.push_back('\t'); continue; }
+#line 1203 "src/json/jlexer.cpp"
+yy34:
+	++in.cur;
+yyFillLabel10:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'e':
+		case 'f': goto yy53;
+		case 'D':
+		case 'd': goto yy54;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel10;
+			}
+			goto yy27;
+	}
+yy35:
+	++in.cur;
+#line 229 "src/json/jlexer.re"
+	{ slice.push_back('\v'); continue; }
+#line 1241 "src/json/jlexer.cpp"
+yy36:
+	++in.cur;
+yyFillLabel11:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy55;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel11;
+			}
+			goto yy27;
+	}
+yy37:
+	++in.cur;
+yyFillLabel12:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy20;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel12;
+			}
+			goto yy27;
+	}
+yy38:
+	++in.cur;
+yyFillLabel13:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy37;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel13;
+			}
+			goto yy27;
+	}
+yy39:
+	++in.cur;
+yyFillLabel14:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy37;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel14;
+			}
+			goto yy27;
+	}
+yy40:
+	++in.cur;
+yyFillLabel15:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy56;
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy37;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel15;
+			}
+			goto yy27;
+	}
+yy41:
+	++in.cur;
+yyFillLabel16:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy39;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel16;
+			}
+			goto yy27;
+	}
+yy42:
+	++in.cur;
+yyFillLabel17:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy39;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel17;
+			}
+			goto yy27;
+	}
+yy43:
+	++in.cur;
+yyFillLabel18:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy39;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel18;
+			}
+			goto yy27;
+	}
+yy44:
+	++in.cur;
+yyFillLabel19:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy8;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel19;
+			}
+			goto yy27;
+	}
+yy45:
+	++in.cur;
+yyFillLabel20:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy44;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel20;
+			}
+			goto yy27;
+	}
+yy46:
+	++in.cur;
+	in.cur = in.yyt1;
+#line 225 "src/json/jlexer.re"
+	{ slice.push_back('\0'); continue; }
+#line 1859 "src/json/jlexer.cpp"
+yy47:
+	++in.cur;
+yyFillLabel21:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy46;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel21;
+			}
+			goto yy27;
+	}
+yy48:
+	++in.cur;
+yyFillLabel22:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy47;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel22;
+			}
+			goto yy27;
+	}
+yy49:
+	++in.cur;
+yyFillLabel23:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy47;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel23;
+			}
+			goto yy27;
+	}
+yy50:
+	++in.cur;
+yyFillLabel24:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy49;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel24;
+			}
+			goto yy27;
+	}
+yy51:
+	++in.cur;
+yyFillLabel25:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy49;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel25;
+			}
+			goto yy27;
+	}
+yy52:
+	++in.cur;
+yyFillLabel26:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy49;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel26;
+			}
+			goto yy27;
+	}
+yy53:
+	++in.cur;
+yyFillLabel27:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy57;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel27;
+			}
+			goto yy27;
+	}
+yy54:
+	++in.cur;
+yyFillLabel28:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy57;
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'a':
+		case 'b': goto yy58;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel28;
+			}
+			goto yy27;
+	}
+yy55:
+	++in.cur;
+yyFillLabel29:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy59;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel29;
+			}
+			goto yy27;
+	}
+yy56:
+	++in.cur;
+yyFillLabel30:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy20;
+		case 0xA8:
+		case 0xA9: goto yy21;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel30;
+			}
+			goto yy27;
+	}
+yy57:
+	++in.cur;
+yyFillLabel31:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy60;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel31;
+			}
+			goto yy27;
+	}
+yy58:
+	++in.cur;
+yyFillLabel32:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy61;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel32;
+			}
+			goto yy27;
+	}
+yy59:
+	++in.cur;
+#line 224 "src/json/jlexer.re"
+	{ if (!push_utf8(slice, lex_hex(in.tok, in.cur))) return false; continue; }
+#line 2458 "src/json/jlexer.cpp"
+yy60:
+	++in.cur;
+yyFillLabel33:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy62;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel33;
+			}
+			goto yy27;
+	}
+yy61:
+	++in.cur;
+yyFillLabel34:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy64;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel34;
+			}
+			goto yy27;
+	}
+yy62:
+	++in.cur;
+yy63:
+#line 223 "src/json/jlexer.re"
+	{ if (!push_utf8(slice, lex_hex(in.tok, in.cur))) return false; continue; }
+#line 2530 "src/json/jlexer.cpp"
+yy64:
+	yyaccept = 2;
+	in.mar = ++in.cur;
+yyFillLabel35:
+	yych = *in.cur;
+	switch (yych) {
+		case '\\': goto yy65;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel35;
+			}
+			goto yy63;
+	}
+yy65:
+	++in.cur;
+yyFillLabel36:
+	yych = *in.cur;
+	switch (yych) {
+		case 'u': goto yy66;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel36;
+			}
+			goto yy27;
+	}
+yy66:
+	++in.cur;
+yyFillLabel37:
+	yych = *in.cur;
+	switch (yych) {
+		case 'D':
+		case 'd': goto yy67;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel37;
+			}
+			goto yy27;
+	}
+yy67:
+	++in.cur;
+yyFillLabel38:
+	yych = *in.cur;
+	switch (yych) {
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy68;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel38;
+			}
+			goto yy27;
+	}
+yy68:
+	++in.cur;
+yyFillLabel39:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy69;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel39;
+			}
+			goto yy27;
+	}
+yy69:
+	++in.cur;
+yyFillLabel40:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy70;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel40;
+			}
+			goto yy27;
+	}
+yy70:
+	++in.cur;
+#line 216 "src/json/jlexer.re"
+	{
+          uint32_t lo = lex_hex(in.tok,   in.tok+6);
+          uint32_t hi = lex_hex(in.tok+6, in.tok+12);
+          uint32_t x = ((lo & 0x3ff) << 10) + (hi & 0x3ff) + 0x10000;
+          if (!push_utf8(slice, x)) return false;
+          continue;
+        }
+#line 2664 "src/json/jlexer.cpp"
+yy71:
+#line 204 "src/json/jlexer.re"
+	{ return false; }
+#line 2668 "src/json/jlexer.cpp"
+}
+#line 238 "src/json/jlexer.re"
+
+  }
+
+  out = std::move(slice);
+  return true;
+}
+
+static JSymbol lex_json(JLexer &lex) {
+  jinput_t &in = *lex.engine.get();
+  Coordinates start;
+top:
+  start = in.coord();
+  in.tok = in.cur;
+
+  
+#line 2686 "src/json/jlexer.cpp"
+{
+	unsigned char yych;
+	unsigned int yyaccept = 0;
+yyFillLabel41:
+	yych = *in.cur;
+	switch (yych) {
+		case '\t':
+		case '\v':
+		case '\f':
+		case ' ': goto yy75;
+		case '\n':
+		case '\r': goto yy76;
+		case '"':
+		case '\'': goto yy77;
+		case '$':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy78;
+		case '+':
+		case '-': goto yy81;
+		case ',': goto yy82;
+		case '.': goto yy83;
+		case '/': goto yy84;
+		case '0': goto yy85;
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy87;
+		case ':': goto yy88;
+		case 'I': goto yy89;
+		case 'N': goto yy90;
+		case '[': goto yy91;
+		case '\\': goto yy92;
+		case ']': goto yy93;
+		case 'f': goto yy94;
+		case 'n': goto yy95;
+		case 't': goto yy96;
+		case '{': goto yy97;
+		case '}': goto yy98;
+		case 0xC2: goto yy99;
+		case 0xC3: goto yy100;
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xD0:
+		case 0xD1:
+		case 0xD3:
+		case 0xDA: goto yy101;
+		case 0xCB: goto yy102;
+		case 0xCD: goto yy103;
+		case 0xCE: goto yy104;
+		case 0xCF: goto yy105;
+		case 0xD2: goto yy106;
+		case 0xD4: goto yy107;
+		case 0xD5: goto yy108;
+		case 0xD6: goto yy109;
+		case 0xD7: goto yy110;
+		case 0xD8: goto yy111;
+		case 0xD9: goto yy112;
+		case 0xDB: goto yy113;
+		case 0xDC: goto yy114;
+		case 0xDD: goto yy115;
+		case 0xDE: goto yy116;
+		case 0xDF: goto yy117;
+		case 0xE0: goto yy118;
+		case 0xE1: goto yy119;
+		case 0xE2: goto yy120;
+		case 0xE3: goto yy121;
+		case 0xE4: goto yy122;
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xEB:
+		case 0xEC: goto yy123;
+		case 0xE9: goto yy124;
+		case 0xEA: goto yy125;
+		case 0xED: goto yy126;
+		case 0xEF: goto yy127;
+		case 0xF0: goto yy128;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel41;
+				goto yy537;
+			}
+			goto yy73;
+	}
+yy73:
+	++in.cur;
+yy74:
+#line 408 "src/json/jlexer.re"
+	{ return mkSym(JSON_ERROR); }
+#line 2833 "src/json/jlexer.cpp"
+yy75:
+	++in.cur;
+#line 416 "src/json/jlexer.re"
+	{ goto top; }
+#line 2838 "src/json/jlexer.cpp"
+yy76:
+	++in.cur;
+#line 417 "src/json/jlexer.re"
+	{ ++in.row; in.sol = in.cur; goto top; }
+#line 2843 "src/json/jlexer.cpp"
+yy77:
+	++in.cur;
+#line 478 "src/json/jlexer.re"
+	{
+        std::string out;
+        bool ok = lex_jstr(lex, out, in.cur[-1]);
+        return mkSym2(ok ? JSON_STR : JSON_ERROR, out);
+      }
+#line 2852 "src/json/jlexer.cpp"
+yy78:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel42:
+	yych = *in.cur;
+yy79:
+	switch (yych) {
+		case '$':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy78;
+		case '\\': goto yy129;
+		case 0xC2: goto yy131;
+		case 0xC3: goto yy132;
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCC:
+		case 0xD0:
+		case 0xD1:
+		case 0xD3:
+		case 0xDA: goto yy133;
+		case 0xCB: goto yy134;
+		case 0xCD: goto yy135;
+		case 0xCE: goto yy136;
+		case 0xCF: goto yy137;
+		case 0xD2: goto yy138;
+		case 0xD4: goto yy139;
+		case 0xD5: goto yy140;
+		case 0xD6: goto yy141;
+		case 0xD7: goto yy142;
+		case 0xD8: goto yy143;
+		case 0xD9: goto yy144;
+		case 0xDB: goto yy145;
+		case 0xDC: goto yy146;
+		case 0xDD: goto yy147;
+		case 0xDE: goto yy148;
+		case 0xDF: goto yy149;
+		case 0xE0: goto yy150;
+		case 0xE1: goto yy151;
+		case 0xE2: goto yy152;
+		case 0xE3: goto yy153;
+		case 0xE4: goto yy154;
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xEB:
+		case 0xEC: goto yy155;
+		case 0xE9: goto yy156;
+		case 0xEA: goto yy157;
+		case 0xED: goto yy158;
+		case 0xEF: goto yy159;
+		case 0xF0: goto yy160;
+		case 0xF3: goto yy161;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel42;
+			}
+			goto yy80;
+	}
+yy80:
+#line 469 "src/json/jlexer.re"
+	{
+        std::string value(in.tok, in.cur);
+        return mkSym2(JSON_ID, value);
+      }
+#line 2984 "src/json/jlexer.cpp"
+yy81:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel43:
+	yych = *in.cur;
+	switch (yych) {
+		case '.': goto yy162;
+		case '0': goto yy85;
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy87;
+		case 'I': goto yy163;
+		case 'N': goto yy164;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel43;
+			}
+			goto yy74;
+	}
+yy82:
+	++in.cur;
+#line 453 "src/json/jlexer.re"
+	{ return mkSym(JSON_COMMA);   }
+#line 3014 "src/json/jlexer.cpp"
+yy83:
+	++in.cur;
+yyFillLabel44:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy165;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel44;
+			}
+			goto yy74;
+	}
+yy84:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel45:
+	yych = *in.cur;
+	switch (yych) {
+		case '*': goto yy167;
+		case '/': goto yy168;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel45;
+			}
+			goto yy74;
+	}
+yy85:
+	yyaccept = 2;
+	in.mar = ++in.cur;
+yyFillLabel46:
+	yych = *in.cur;
+	switch (yych) {
+		case '.': goto yy165;
+		case 'E':
+		case 'e': goto yy170;
+		case 'X':
+		case 'x': goto yy171;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel46;
+			}
+			goto yy86;
+	}
+yy86:
+#line 430 "src/json/jlexer.re"
+	{
+        std::string value(in.tok[0] == '+' ? in.tok+1 : in.tok, in.cur);
+        return mkSym2(JSON_INTEGER, value);
+      }
+#line 3073 "src/json/jlexer.cpp"
+yy87:
+	yyaccept = 2;
+	in.mar = ++in.cur;
+yyFillLabel47:
+	yych = *in.cur;
+	switch (yych) {
+		case '.': goto yy165;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy87;
+		case 'E':
+		case 'e': goto yy170;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel47;
+			}
+			goto yy86;
+	}
+yy88:
+	++in.cur;
+#line 452 "src/json/jlexer.re"
+	{ return mkSym(JSON_COLON);   }
+#line 3103 "src/json/jlexer.cpp"
+yy89:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel48:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel48;
+			}
+			goto yy80;
+		case 'n': goto yy172;
+		default: goto yy79;
+	}
+yy90:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel49:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel49;
+			}
+			goto yy80;
+		case 'a': goto yy173;
+		default: goto yy79;
+	}
+yy91:
+	++in.cur;
+#line 450 "src/json/jlexer.re"
+	{ return mkSym(JSON_SOPEN);   }
+#line 3136 "src/json/jlexer.cpp"
+yy92:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel50:
+	yych = *in.cur;
+	switch (yych) {
+		case 'u': goto yy174;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel50;
+			}
+			goto yy74;
+	}
+yy93:
+	++in.cur;
+#line 451 "src/json/jlexer.re"
+	{ return mkSym(JSON_SCLOSE);  }
+#line 3154 "src/json/jlexer.cpp"
+yy94:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel51:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel51;
+			}
+			goto yy80;
+		case 'a': goto yy175;
+		default: goto yy79;
+	}
+yy95:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel52:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel52;
+			}
+			goto yy80;
+		case 'u': goto yy176;
+		default: goto yy79;
+	}
+yy96:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel53:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel53;
+			}
+			goto yy80;
+		case 'r': goto yy177;
+		default: goto yy79;
+	}
+yy97:
+	++in.cur;
+#line 448 "src/json/jlexer.re"
+	{ return mkSym(JSON_BOPEN);   }
+#line 3201 "src/json/jlexer.cpp"
+yy98:
+	++in.cur;
+#line 449 "src/json/jlexer.re"
+	{ return mkSym(JSON_BCLOSE);  }
+#line 3206 "src/json/jlexer.cpp"
+yy99:
+	++in.cur;
+yyFillLabel54:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0: goto yy75;
+		case 0xAA:
+		case 0xB5:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel54;
+			}
+			goto yy74;
+	}
+yy100:
+	++in.cur;
+yyFillLabel55:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel55;
+			}
+			goto yy74;
+	}
+yy101:
+	++in.cur;
+yyFillLabel56:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel56;
+			}
+			goto yy74;
+	}
+yy102:
+	++in.cur;
+yyFillLabel57:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xAC:
+		case 0xAE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel57;
+			}
+			goto yy74;
+	}
+yy103:
+	++in.cur;
+yyFillLabel58:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel58;
+			}
+			goto yy74;
+	}
+yy104:
+	++in.cur;
+yyFillLabel59:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x86:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel59;
+			}
+			goto yy74;
+	}
+yy105:
+	++in.cur;
+yyFillLabel60:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel60;
+			}
+			goto yy74;
+	}
+yy106:
+	++in.cur;
+yyFillLabel61:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel61;
+			}
+			goto yy74;
+	}
+yy107:
+	++in.cur;
+yyFillLabel62:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel62;
+			}
+			goto yy74;
+	}
+yy108:
+	++in.cur;
+yyFillLabel63:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x99:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel63;
+			}
+			goto yy74;
+	}
+yy109:
+	++in.cur;
+yyFillLabel64:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel64;
+			}
+			goto yy74;
+	}
+yy110:
+	++in.cur;
+yyFillLabel65:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel65;
+			}
+			goto yy74;
+	}
+yy111:
+	++in.cur;
+yyFillLabel66:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel66;
+			}
+			goto yy74;
+	}
+yy112:
+	++in.cur;
+yyFillLabel67:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel67;
+			}
+			goto yy74;
+	}
+yy113:
+	++in.cur;
+yyFillLabel68:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x95:
+		case 0xA5:
+		case 0xA6:
+		case 0xAE:
+		case 0xAF:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel68;
+			}
+			goto yy74;
+	}
+yy114:
+	++in.cur;
+yyFillLabel69:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel69;
+			}
+			goto yy74;
+	}
+yy115:
+	++in.cur;
+yyFillLabel70:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel70;
+			}
+			goto yy74;
+	}
+yy116:
+	++in.cur;
+yyFillLabel71:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel71;
+			}
+			goto yy74;
+	}
+yy117:
+	++in.cur;
+yyFillLabel72:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB4:
+		case 0xB5:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel72;
+			}
+			goto yy74;
+	}
+yy118:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel73:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0: goto yy178;
+		case 0xA1: goto yy179;
+		case 0xA2: goto yy180;
+		case 0xA4: goto yy181;
+		case 0xA5: goto yy182;
+		case 0xA6: goto yy183;
+		case 0xA7: goto yy184;
+		case 0xA8: goto yy185;
+		case 0xA9: goto yy186;
+		case 0xAA: goto yy187;
+		case 0xAB: goto yy188;
+		case 0xAC: goto yy189;
+		case 0xAD: goto yy190;
+		case 0xAE: goto yy191;
+		case 0xAF: goto yy192;
+		case 0xB0: goto yy193;
+		case 0xB1: goto yy194;
+		case 0xB2: goto yy195;
+		case 0xB3: goto yy196;
+		case 0xB4: goto yy197;
+		case 0xB5: goto yy198;
+		case 0xB6: goto yy199;
+		case 0xB7:
+		case 0xB9: goto yy200;
+		case 0xB8: goto yy201;
+		case 0xBA: goto yy202;
+		case 0xBB: goto yy203;
+		case 0xBC: goto yy204;
+		case 0xBD: goto yy205;
+		case 0xBE: goto yy206;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel73;
+			}
+			goto yy74;
+	}
+yy119:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel74:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy207;
+		case 0x81: goto yy208;
+		case 0x82: goto yy209;
+		case 0x83: goto yy210;
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB: goto yy133;
+		case 0x89: goto yy211;
+		case 0x8A: goto yy212;
+		case 0x8B: goto yy213;
+		case 0x8C: goto yy214;
+		case 0x8D: goto yy215;
+		case 0x8E: goto yy216;
+		case 0x8F: goto yy217;
+		case 0x90: goto yy218;
+		case 0x99: goto yy219;
+		case 0x9A: goto yy220;
+		case 0x9B: goto yy221;
+		case 0x9C: goto yy222;
+		case 0x9D: goto yy223;
+		case 0x9E: goto yy224;
+		case 0x9F: goto yy225;
+		case 0xA0: goto yy226;
+		case 0xA1: goto yy227;
+		case 0xA2: goto yy228;
+		case 0xA3: goto yy229;
+		case 0xA4: goto yy230;
+		case 0xA5: goto yy231;
+		case 0xA6: goto yy232;
+		case 0xA7: goto yy233;
+		case 0xA8: goto yy234;
+		case 0xA9: goto yy235;
+		case 0xAA: goto yy236;
+		case 0xAC: goto yy237;
+		case 0xAD: goto yy238;
+		case 0xAE: goto yy239;
+		case 0xAF: goto yy240;
+		case 0xB0: goto yy241;
+		case 0xB1: goto yy242;
+		case 0xB3: goto yy243;
+		case 0xBC: goto yy244;
+		case 0xBD: goto yy245;
+		case 0xBE: goto yy246;
+		case 0xBF: goto yy247;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel74;
+			}
+			goto yy74;
+	}
+yy120:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel75:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy248;
+		case 0x81: goto yy249;
+		case 0x82: goto yy250;
+		case 0x84: goto yy251;
+		case 0x85: goto yy252;
+		case 0x86: goto yy253;
+		case 0xB0: goto yy254;
+		case 0xB1: goto yy255;
+		case 0xB2: goto yy133;
+		case 0xB3: goto yy256;
+		case 0xB4: goto yy257;
+		case 0xB5: goto yy258;
+		case 0xB6: goto yy259;
+		case 0xB7: goto yy260;
+		case 0xB8: goto yy261;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel75;
+			}
+			goto yy74;
+	}
+yy121:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel76:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy262;
+		case 0x81: goto yy218;
+		case 0x82: goto yy263;
+		case 0x83: goto yy264;
+		case 0x84: goto yy265;
+		case 0x85:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0x86: goto yy266;
+		case 0x87: goto yy267;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel76;
+			}
+			goto yy74;
+	}
+yy122:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel77:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0xB6: goto yy229;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel77;
+			}
+			goto yy74;
+	}
+yy123:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel78:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel78;
+			}
+			goto yy74;
+	}
+yy124:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel79:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy133;
+		case 0xBF: goto yy268;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel79;
+			}
+			goto yy74;
+	}
+yy125:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel80:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x9D:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0x92: goto yy268;
+		case 0x93: goto yy269;
+		case 0x98: goto yy270;
+		case 0x99: goto yy271;
+		case 0x9A: goto yy272;
+		case 0x9B: goto yy273;
+		case 0x9C: goto yy274;
+		case 0x9E: goto yy275;
+		case 0x9F: goto yy276;
+		case 0xA0: goto yy277;
+		case 0xA1: goto yy224;
+		case 0xA2: goto yy278;
+		case 0xA3: goto yy279;
+		case 0xA4: goto yy280;
+		case 0xA5: goto yy281;
+		case 0xA6: goto yy282;
+		case 0xA7: goto yy283;
+		case 0xA8: goto yy284;
+		case 0xA9: goto yy285;
+		case 0xAA: goto yy286;
+		case 0xAB: goto yy287;
+		case 0xAC: goto yy288;
+		case 0xAD: goto yy289;
+		case 0xAF: goto yy290;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel80;
+			}
+			goto yy74;
+	}
+yy126:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel81:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D: goto yy133;
+		case 0x9E: goto yy291;
+		case 0x9F: goto yy292;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel81;
+			}
+			goto yy74;
+	}
+yy127:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel82:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xBA: goto yy133;
+		case 0xA9: goto yy293;
+		case 0xAB: goto yy294;
+		case 0xAC: goto yy295;
+		case 0xAD: goto yy296;
+		case 0xAE: goto yy148;
+		case 0xAF: goto yy297;
+		case 0xB4: goto yy298;
+		case 0xB5: goto yy146;
+		case 0xB6: goto yy299;
+		case 0xB7: goto yy300;
+		case 0xB9: goto yy301;
+		case 0xBB: goto yy302;
+		case 0xBC: goto yy303;
+		case 0xBD: goto yy304;
+		case 0xBE: goto yy305;
+		case 0xBF: goto yy306;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel82;
+			}
+			goto yy74;
+	}
+yy128:
+	yyaccept = 1;
+	in.mar = ++in.cur;
+yyFillLabel83:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90: goto yy307;
+		case 0x91: goto yy308;
+		case 0x92: goto yy309;
+		case 0x93: goto yy310;
+		case 0x96: goto yy311;
+		case 0x9B: goto yy312;
+		case 0x9D: goto yy313;
+		case 0x9E: goto yy314;
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9: goto yy155;
+		case 0xAA: goto yy315;
+		case 0xAB: goto yy316;
+		case 0xAF: goto yy317;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel83;
+			}
+			goto yy74;
+	}
+yy129:
+	++in.cur;
+yyFillLabel84:
+	yych = *in.cur;
+	switch (yych) {
+		case 'u': goto yy174;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel84;
+			}
+			goto yy130;
+	}
+yy130:
+	in.cur = in.mar;
+	switch (yyaccept) {
+		case 0: goto yy80;
+		case 1: goto yy74;
+		case 2: goto yy86;
+		case 3: goto yy166;
+		case 4: goto yy169;
+		case 5: goto yy419;
+		case 6: goto yy521;
+		case 7: goto yy523;
+		case 8: goto yy528;
+		default: goto yy535;
+	}
+yy131:
+	++in.cur;
+yyFillLabel85:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xAA:
+		case 0xB5:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel85;
+			}
+			goto yy130;
+	}
+yy132:
+	++in.cur;
+yyFillLabel86:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel86;
+			}
+			goto yy130;
+	}
+yy133:
+	++in.cur;
+yyFillLabel87:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel87;
+			}
+			goto yy130;
+	}
+yy134:
+	++in.cur;
+yyFillLabel88:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xAC:
+		case 0xAE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel88;
+			}
+			goto yy130;
+	}
+yy135:
+	++in.cur;
+yyFillLabel89:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel89;
+			}
+			goto yy130;
+	}
+yy136:
+	++in.cur;
+yyFillLabel90:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x86:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel90;
+			}
+			goto yy130;
+	}
+yy137:
+	++in.cur;
+yyFillLabel91:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel91;
+			}
+			goto yy130;
+	}
+yy138:
+	++in.cur;
+yyFillLabel92:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel92;
+			}
+			goto yy130;
+	}
+yy139:
+	++in.cur;
+yyFillLabel93:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel93;
+			}
+			goto yy130;
+	}
+yy140:
+	++in.cur;
+yyFillLabel94:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x99:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel94;
+			}
+			goto yy130;
+	}
+yy141:
+	++in.cur;
+yyFillLabel95:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel95;
+			}
+			goto yy130;
+	}
+yy142:
+	++in.cur;
+yyFillLabel96:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x84:
+		case 0x85:
+		case 0x87:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel96;
+			}
+			goto yy130;
+	}
+yy143:
+	++in.cur;
+yyFillLabel97:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel97;
+			}
+			goto yy130;
+	}
+yy144:
+	++in.cur;
+yyFillLabel98:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel98;
+			}
+			goto yy130;
+	}
+yy145:
+	++in.cur;
+yyFillLabel99:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel99;
+			}
+			goto yy130;
+	}
+yy146:
+	++in.cur;
+yyFillLabel100:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel100;
+			}
+			goto yy130;
+	}
+yy147:
+	++in.cur;
+yyFillLabel101:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel101;
+			}
+			goto yy130;
+	}
+yy148:
+	++in.cur;
+yyFillLabel102:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel102;
+			}
+			goto yy130;
+	}
+yy149:
+	++in.cur;
+yyFillLabel103:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel103;
+			}
+			goto yy130;
+	}
+yy150:
+	++in.cur;
+yyFillLabel104:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0: goto yy318;
+		case 0xA1: goto yy319;
+		case 0xA2: goto yy180;
+		case 0xA3: goto yy320;
+		case 0xA4: goto yy133;
+		case 0xA5: goto yy321;
+		case 0xA6: goto yy322;
+		case 0xA7: goto yy323;
+		case 0xA8: goto yy324;
+		case 0xA9: goto yy325;
+		case 0xAA: goto yy326;
+		case 0xAB: goto yy327;
+		case 0xAC: goto yy328;
+		case 0xAD: goto yy329;
+		case 0xAE: goto yy330;
+		case 0xAF: goto yy331;
+		case 0xB0: goto yy332;
+		case 0xB1: goto yy333;
+		case 0xB2: goto yy334;
+		case 0xB3: goto yy335;
+		case 0xB4: goto yy336;
+		case 0xB5: goto yy337;
+		case 0xB6: goto yy338;
+		case 0xB7: goto yy339;
+		case 0xB8: goto yy340;
+		case 0xB9: goto yy341;
+		case 0xBA: goto yy342;
+		case 0xBB: goto yy343;
+		case 0xBC: goto yy344;
+		case 0xBD: goto yy345;
+		case 0xBE: goto yy346;
+		case 0xBF: goto yy347;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel104;
+			}
+			goto yy130;
+	}
+yy151:
+	++in.cur;
+yyFillLabel105:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x9E:
+		case 0xAC:
+		case 0xAE:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB: goto yy133;
+		case 0x81: goto yy348;
+		case 0x82: goto yy272;
+		case 0x83: goto yy210;
+		case 0x89: goto yy211;
+		case 0x8A: goto yy212;
+		case 0x8B: goto yy213;
+		case 0x8C: goto yy214;
+		case 0x8D: goto yy349;
+		case 0x8E: goto yy216;
+		case 0x8F: goto yy217;
+		case 0x90: goto yy218;
+		case 0x99: goto yy219;
+		case 0x9A: goto yy350;
+		case 0x9B: goto yy221;
+		case 0x9C: goto yy351;
+		case 0x9D: goto yy352;
+		case 0x9F: goto yy353;
+		case 0xA0: goto yy354;
+		case 0xA1:
+		case 0xB0: goto yy227;
+		case 0xA2: goto yy355;
+		case 0xA3: goto yy229;
+		case 0xA4: goto yy356;
+		case 0xA5: goto yy357;
+		case 0xA6: goto yy358;
+		case 0xA7: goto yy359;
+		case 0xA8: goto yy360;
+		case 0xA9: goto yy361;
+		case 0xAA: goto yy362;
+		case 0xAD: goto yy363;
+		case 0xAF: goto yy224;
+		case 0xB1: goto yy364;
+		case 0xB3: goto yy365;
+		case 0xB7: goto yy366;
+		case 0xBC: goto yy244;
+		case 0xBD: goto yy245;
+		case 0xBE: goto yy246;
+		case 0xBF: goto yy247;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel105;
+			}
+			goto yy130;
+	}
+yy152:
+	++in.cur;
+yyFillLabel106:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy367;
+		case 0x81: goto yy368;
+		case 0x82: goto yy250;
+		case 0x83: goto yy369;
+		case 0x84: goto yy251;
+		case 0x85: goto yy252;
+		case 0x86: goto yy253;
+		case 0xB0: goto yy254;
+		case 0xB1: goto yy255;
+		case 0xB2: goto yy133;
+		case 0xB3: goto yy370;
+		case 0xB4: goto yy257;
+		case 0xB5: goto yy371;
+		case 0xB6: goto yy259;
+		case 0xB7: goto yy372;
+		case 0xB8: goto yy261;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel106;
+			}
+			goto yy130;
+	}
+yy153:
+	++in.cur;
+yyFillLabel107:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy373;
+		case 0x81: goto yy218;
+		case 0x82: goto yy374;
+		case 0x83: goto yy264;
+		case 0x84: goto yy265;
+		case 0x85:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0x86: goto yy266;
+		case 0x87: goto yy267;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel107;
+			}
+			goto yy130;
+	}
+yy154:
+	++in.cur;
+yyFillLabel108:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0xB6: goto yy229;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel108;
+			}
+			goto yy130;
+	}
+yy155:
+	++in.cur;
+yyFillLabel109:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel109;
+			}
+			goto yy130;
+	}
+yy156:
+	++in.cur;
+yyFillLabel110:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy133;
+		case 0xBF: goto yy268;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel110;
+			}
+			goto yy130;
+	}
+yy157:
+	++in.cur;
+yyFillLabel111:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x9D:
+		case 0xA2:
+		case 0xA6:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0x92: goto yy268;
+		case 0x93: goto yy269;
+		case 0x98: goto yy375;
+		case 0x99: goto yy376;
+		case 0x9A: goto yy377;
+		case 0x9B: goto yy148;
+		case 0x9C: goto yy274;
+		case 0x9E: goto yy275;
+		case 0x9F: goto yy276;
+		case 0xA0: goto yy378;
+		case 0xA1: goto yy224;
+		case 0xA3: goto yy379;
+		case 0xA4: goto yy293;
+		case 0xA5: goto yy380;
+		case 0xA7: goto yy381;
+		case 0xA8: goto yy382;
+		case 0xA9: goto yy383;
+		case 0xAB: goto yy384;
+		case 0xAC: goto yy288;
+		case 0xAD: goto yy289;
+		case 0xAF: goto yy385;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel111;
+			}
+			goto yy130;
+	}
+yy158:
+	++in.cur;
+yyFillLabel112:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D: goto yy133;
+		case 0x9E: goto yy291;
+		case 0x9F: goto yy292;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel112;
+			}
+			goto yy130;
+	}
+yy159:
+	++in.cur;
+yyFillLabel113:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xBA: goto yy133;
+		case 0xA9: goto yy293;
+		case 0xAB: goto yy294;
+		case 0xAC: goto yy386;
+		case 0xAD: goto yy296;
+		case 0xAE: goto yy148;
+		case 0xAF: goto yy297;
+		case 0xB4: goto yy298;
+		case 0xB5: goto yy146;
+		case 0xB6: goto yy299;
+		case 0xB7: goto yy300;
+		case 0xB8: goto yy387;
+		case 0xB9: goto yy388;
+		case 0xBB: goto yy389;
+		case 0xBC: goto yy390;
+		case 0xBD: goto yy304;
+		case 0xBE: goto yy305;
+		case 0xBF: goto yy306;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel113;
+			}
+			goto yy130;
+	}
+yy160:
+	++in.cur;
+yyFillLabel114:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90: goto yy391;
+		case 0x91: goto yy392;
+		case 0x92: goto yy309;
+		case 0x93: goto yy310;
+		case 0x96: goto yy393;
+		case 0x9B: goto yy394;
+		case 0x9D: goto yy395;
+		case 0x9E: goto yy396;
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9: goto yy155;
+		case 0xAA: goto yy315;
+		case 0xAB: goto yy316;
+		case 0xAF: goto yy317;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel114;
+			}
+			goto yy130;
+	}
+yy161:
+	++in.cur;
+yyFillLabel115:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0: goto yy397;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel115;
+			}
+			goto yy130;
+	}
+yy162:
+	++in.cur;
+yyFillLabel116:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy165;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel116;
+			}
+			goto yy130;
+	}
+yy163:
+	++in.cur;
+yyFillLabel117:
+	yych = *in.cur;
+	switch (yych) {
+		case 'n': goto yy398;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel117;
+			}
+			goto yy130;
+	}
+yy164:
+	++in.cur;
+yyFillLabel118:
+	yych = *in.cur;
+	switch (yych) {
+		case 'a': goto yy399;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel118;
+			}
+			goto yy130;
+	}
+yy165:
+	yyaccept = 3;
+	in.mar = ++in.cur;
+yyFillLabel119:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy165;
+		case 'E':
+		case 'e': goto yy170;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel119;
+			}
+			goto yy166;
+	}
+yy166:
+#line 434 "src/json/jlexer.re"
+	{
+        std::string value(in.tok[0] == '+' ? in.tok+1 : in.tok, in.cur);
+        return mkSym2(JSON_DOUBLE, value);
+      }
+#line 6697 "src/json/jlexer.cpp"
+yy167:
+	++in.cur;
+yyFillLabel120:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+		case 0x01:
+		case 0x02:
+		case 0x03:
+		case 0x04:
+		case 0x05:
+		case 0x06:
+		case 0x07:
+		case 0x08:
+		case '\t':
+		case '\n':
+		case '\v':
+		case '\f':
+		case '\r':
+		case 0x0E:
+		case 0x0F:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+		case 0x18:
+		case 0x19:
+		case 0x1A:
+		case 0x1B:
+		case 0x1C:
+		case 0x1D:
+		case 0x1E:
+		case 0x1F:
+		case ' ':
+		case '!':
+		case '"':
+		case '#':
+		case '$':
+		case '%':
+		case '&':
+		case '\'':
+		case '(':
+		case ')':
+		case '+':
+		case ',':
+		case '-':
+		case '.':
+		case '/':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case ':':
+		case ';':
+		case '<':
+		case '=':
+		case '>':
+		case '?':
+		case '@':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '[':
+		case '\\':
+		case ']':
+		case '^':
+		case '_':
+		case '`':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case '{':
+		case '|':
+		case '}':
+		case '~':
+		case 0x7F:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel120;
+				goto yy130;
+			}
+			goto yy167;
+		case '*': goto yy400;
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF: goto yy401;
+		case 0xE0: goto yy402;
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEE:
+		case 0xEF: goto yy403;
+		case 0xF0: goto yy404;
+		case 0xF1:
+		case 0xF2:
+		case 0xF3: goto yy405;
+		case 0xF4: goto yy406;
+		default: goto yy130;
+	}
+yy168:
+	yyaccept = 4;
+	in.mar = ++in.cur;
+yyFillLabel121:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+		case 0x01:
+		case 0x02:
+		case 0x03:
+		case 0x04:
+		case 0x05:
+		case 0x06:
+		case 0x07:
+		case 0x08:
+		case '\t':
+		case '\v':
+		case '\f':
+		case 0x0E:
+		case 0x0F:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+		case 0x18:
+		case 0x19:
+		case 0x1A:
+		case 0x1B:
+		case 0x1C:
+		case 0x1D:
+		case 0x1E:
+		case 0x1F:
+		case ' ':
+		case '!':
+		case '"':
+		case '#':
+		case '$':
+		case '%':
+		case '&':
+		case '\'':
+		case '(':
+		case ')':
+		case '*':
+		case '+':
+		case ',':
+		case '-':
+		case '.':
+		case '/':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case ':':
+		case ';':
+		case '<':
+		case '=':
+		case '>':
+		case '?':
+		case '@':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '[':
+		case '\\':
+		case ']':
+		case '^':
+		case '_':
+		case '`':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case '{':
+		case '|':
+		case '}':
+		case '~':
+		case 0x7F:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel121;
+				goto yy169;
+			}
+			goto yy168;
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF: goto yy407;
+		case 0xE0: goto yy408;
+		case 0xE1:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEE:
+		case 0xEF: goto yy409;
+		case 0xE2: goto yy410;
+		case 0xF0: goto yy411;
+		case 0xF1:
+		case 0xF2:
+		case 0xF3: goto yy412;
+		case 0xF4: goto yy413;
+		default: goto yy169;
+	}
+yy169:
+#line 418 "src/json/jlexer.re"
+	{
+        lex_jcomment(in);
+        goto top;
+      }
+#line 7085 "src/json/jlexer.cpp"
+yy170:
+	++in.cur;
+yyFillLabel122:
+	yych = *in.cur;
+	switch (yych) {
+		case '+':
+		case '-': goto yy414;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy415;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel122;
+			}
+			goto yy130;
+	}
+yy171:
+	++in.cur;
+yyFillLabel123:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy416;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel123;
+			}
+			goto yy130;
+	}
+yy172:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel124:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel124;
+			}
+			goto yy80;
+		case 'f': goto yy417;
+		default: goto yy79;
+	}
+yy173:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel125:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel125;
+			}
+			goto yy80;
+		case 'N': goto yy418;
+		default: goto yy79;
+	}
+yy174:
+	++in.cur;
+yyFillLabel126:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy420;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel126;
+			}
+			goto yy130;
+	}
+yy175:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel127:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel127;
+			}
+			goto yy80;
+		case 'l': goto yy421;
+		default: goto yy79;
+	}
+yy176:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel128:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel128;
+			}
+			goto yy80;
+		case 'l': goto yy422;
+		default: goto yy79;
+	}
+yy177:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel129:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel129;
+			}
+			goto yy80;
+		case 'u': goto yy423;
+		default: goto yy79;
+	}
+yy178:
+	++in.cur;
+yyFillLabel130:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x9A:
+		case 0xA4:
+		case 0xA8: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel130;
+			}
+			goto yy130;
+	}
+yy179:
+	++in.cur;
+yyFillLabel131:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel131;
+			}
+			goto yy130;
+	}
+yy180:
+	++in.cur;
+yyFillLabel132:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel132;
+			}
+			goto yy130;
+	}
+yy181:
+	++in.cur;
+yyFillLabel133:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel133;
+			}
+			goto yy130;
+	}
+yy182:
+	++in.cur;
+yyFillLabel134:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel134;
+			}
+			goto yy130;
+	}
+yy183:
+	++in.cur;
+yyFillLabel135:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8F:
+		case 0x90:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel135;
+			}
+			goto yy130;
+	}
+yy184:
+	++in.cur;
+yyFillLabel136:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8E:
+		case 0x9C:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xB0:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel136;
+			}
+			goto yy130;
+	}
+yy185:
+	++in.cur;
+yyFillLabel137:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8F:
+		case 0x90:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel137;
+			}
+			goto yy130;
+	}
+yy186:
+	++in.cur;
+yyFillLabel138:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9E:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel138;
+			}
+			goto yy130;
+	}
+yy187:
+	++in.cur;
+yyFillLabel139:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel139;
+			}
+			goto yy130;
+	}
+yy188:
+	++in.cur;
+yyFillLabel140:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0xA0:
+		case 0xA1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel140;
+			}
+			goto yy130;
+	}
+yy189:
+	++in.cur;
+yyFillLabel141:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8F:
+		case 0x90:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel141;
+			}
+			goto yy130;
+	}
+yy190:
+	++in.cur;
+yyFillLabel142:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x9C:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel142;
+			}
+			goto yy130;
+	}
+yy191:
+	++in.cur;
+yyFillLabel143:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x99:
+		case 0x9A:
+		case 0x9C:
+		case 0x9E:
+		case 0x9F:
+		case 0xA3:
+		case 0xA4:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel143;
+			}
+			goto yy130;
+	}
+yy192:
+	++in.cur;
+yyFillLabel144:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel144;
+			}
+			goto yy130;
+	}
+yy193:
+	++in.cur;
+yyFillLabel145:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel145;
+			}
+			goto yy130;
+	}
+yy194:
+	++in.cur;
+yyFillLabel146:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel146;
+			}
+			goto yy130;
+	}
+yy195:
+	++in.cur;
+yyFillLabel147:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel147;
+			}
+			goto yy130;
+	}
+yy196:
+	++in.cur;
+yyFillLabel148:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel148;
+			}
+			goto yy130;
+	}
+yy197:
+	++in.cur;
+yyFillLabel149:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel149;
+			}
+			goto yy130;
+	}
+yy198:
+	++in.cur;
+yyFillLabel150:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8E:
+		case 0xA0:
+		case 0xA1:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel150;
+			}
+			goto yy130;
+	}
+yy199:
+	++in.cur;
+yyFillLabel151:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel151;
+			}
+			goto yy130;
+	}
+yy200:
+	++in.cur;
+yyFillLabel152:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel152;
+			}
+			goto yy130;
+	}
+yy201:
+	++in.cur;
+yyFillLabel153:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel153;
+			}
+			goto yy130;
+	}
+yy202:
+	++in.cur;
+yyFillLabel154:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x84:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8D:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA5:
+		case 0xA7:
+		case 0xAA:
+		case 0xAB:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel154;
+			}
+			goto yy130;
+	}
+yy203:
+	++in.cur;
+yyFillLabel155:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel155;
+			}
+			goto yy130;
+	}
+yy204:
+	++in.cur;
+yyFillLabel156:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel156;
+			}
+			goto yy130;
+	}
+yy205:
+	++in.cur;
+yyFillLabel157:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel157;
+			}
+			goto yy130;
+	}
+yy206:
+	++in.cur;
+yyFillLabel158:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel158;
+			}
+			goto yy130;
+	}
+yy207:
+	++in.cur;
+yyFillLabel159:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel159;
+			}
+			goto yy130;
+	}
+yy208:
+	++in.cur;
+yyFillLabel160:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA1:
+		case 0xA5:
+		case 0xA6:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel160;
+			}
+			goto yy130;
+	}
+yy209:
+	++in.cur;
+yyFillLabel161:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x8E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel161;
+			}
+			goto yy130;
+	}
+yy210:
+	++in.cur;
+yyFillLabel162:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x87:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel162;
+			}
+			goto yy130;
+	}
+yy211:
+	++in.cur;
+yyFillLabel163:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel163;
+			}
+			goto yy130;
+	}
+yy212:
+	++in.cur;
+yyFillLabel164:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel164;
+			}
+			goto yy130;
+	}
+yy213:
+	++in.cur;
+yyFillLabel165:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel165;
+			}
+			goto yy130;
+	}
+yy214:
+	++in.cur;
+yyFillLabel166:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel166;
+			}
+			goto yy130;
+	}
+yy215:
+	++in.cur;
+yyFillLabel167:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel167;
+			}
+			goto yy130;
+	}
+yy216:
+	++in.cur;
+yyFillLabel168:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel168;
+			}
+			goto yy130;
+	}
+yy217:
+	++in.cur;
+yyFillLabel169:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel169;
+			}
+			goto yy130;
+	}
+yy218:
+	++in.cur;
+yyFillLabel170:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel170;
+			}
+			goto yy130;
+	}
+yy219:
+	++in.cur;
+yyFillLabel171:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel171;
+			}
+			goto yy130;
+	}
+yy220:
+	++in.cur;
+yyFillLabel172:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy75;
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel172;
+			}
+			goto yy130;
+	}
+yy221:
+	++in.cur;
+yyFillLabel173:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel173;
+			}
+			goto yy130;
+	}
+yy222:
+	++in.cur;
+yyFillLabel174:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel174;
+			}
+			goto yy130;
+	}
+yy223:
+	++in.cur;
+yyFillLabel175:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel175;
+			}
+			goto yy130;
+	}
+yy224:
+	++in.cur;
+yyFillLabel176:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel176;
+			}
+			goto yy130;
+	}
+yy225:
+	++in.cur;
+yyFillLabel177:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x97:
+		case 0x9C: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel177;
+			}
+			goto yy130;
+	}
+yy226:
+	++in.cur;
+yyFillLabel178:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel178;
+			}
+			goto yy130;
+	}
+yy227:
+	++in.cur;
+yyFillLabel179:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel179;
+			}
+			goto yy130;
+	}
+yy228:
+	++in.cur;
+yyFillLabel180:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel180;
+			}
+			goto yy130;
+	}
+yy229:
+	++in.cur;
+yyFillLabel181:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel181;
+			}
+			goto yy130;
+	}
+yy230:
+	++in.cur;
+yyFillLabel182:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel182;
+			}
+			goto yy130;
+	}
+yy231:
+	++in.cur;
+yyFillLabel183:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel183;
+			}
+			goto yy130;
+	}
+yy232:
+	++in.cur;
+yyFillLabel184:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel184;
+			}
+			goto yy130;
+	}
+yy233:
+	++in.cur;
+yyFillLabel185:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel185;
+			}
+			goto yy130;
+	}
+yy234:
+	++in.cur;
+yyFillLabel186:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel186;
+			}
+			goto yy130;
+	}
+yy235:
+	++in.cur;
+yyFillLabel187:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel187;
+			}
+			goto yy130;
+	}
+yy236:
+	++in.cur;
+yyFillLabel188:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA7: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel188;
+			}
+			goto yy130;
+	}
+yy237:
+	++in.cur;
+yyFillLabel189:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel189;
+			}
+			goto yy130;
+	}
+yy238:
+	++in.cur;
+yyFillLabel190:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel190;
+			}
+			goto yy130;
+	}
+yy239:
+	++in.cur;
+yyFillLabel191:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xAE:
+		case 0xAF:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel191;
+			}
+			goto yy130;
+	}
+yy240:
+	++in.cur;
+yyFillLabel192:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel192;
+			}
+			goto yy130;
+	}
+yy241:
+	++in.cur;
+yyFillLabel193:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel193;
+			}
+			goto yy130;
+	}
+yy242:
+	++in.cur;
+yyFillLabel194:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel194;
+			}
+			goto yy130;
+	}
+yy243:
+	++in.cur;
+yyFillLabel195:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB5:
+		case 0xB6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel195;
+			}
+			goto yy130;
+	}
+yy244:
+	++in.cur;
+yyFillLabel196:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel196;
+			}
+			goto yy130;
+	}
+yy245:
+	++in.cur;
+yyFillLabel197:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x99:
+		case 0x9B:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel197;
+			}
+			goto yy130;
+	}
+yy246:
+	++in.cur;
+yyFillLabel198:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel198;
+			}
+			goto yy130;
+	}
+yy247:
+	++in.cur;
+yyFillLabel199:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel199;
+			}
+			goto yy130;
+	}
+yy248:
+	++in.cur;
+yyFillLabel200:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0xA8:
+		case 0xA9:
+		case 0xAF: goto yy75;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel200;
+			}
+			goto yy130;
+	}
+yy249:
+	++in.cur;
+yyFillLabel201:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x9F: goto yy75;
+		case 0xB1:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel201;
+			}
+			goto yy130;
+	}
+yy250:
+	++in.cur;
+yyFillLabel202:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel202;
+			}
+			goto yy130;
+	}
+yy251:
+	++in.cur;
+yyFillLabel203:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x87:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x95:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA4:
+		case 0xA6:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel203;
+			}
+			goto yy130;
+	}
+yy252:
+	++in.cur;
+yyFillLabel204:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel204;
+			}
+			goto yy130;
+	}
+yy253:
+	++in.cur;
+yyFillLabel205:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel205;
+			}
+			goto yy130;
+	}
+yy254:
+	++in.cur;
+yyFillLabel206:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel206;
+			}
+			goto yy130;
+	}
+yy255:
+	++in.cur;
+yyFillLabel207:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel207;
+			}
+			goto yy130;
+	}
+yy256:
+	++in.cur;
+yyFillLabel208:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel208;
+			}
+			goto yy130;
+	}
+yy257:
+	++in.cur;
+yyFillLabel209:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA7:
+		case 0xAD:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel209;
+			}
+			goto yy130;
+	}
+yy258:
+	++in.cur;
+yyFillLabel210:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel210;
+			}
+			goto yy130;
+	}
+yy259:
+	++in.cur;
+yyFillLabel211:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel211;
+			}
+			goto yy130;
+	}
+yy260:
+	++in.cur;
+yyFillLabel212:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel212;
+			}
+			goto yy130;
+	}
+yy261:
+	++in.cur;
+yyFillLabel213:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel213;
+			}
+			goto yy130;
+	}
+yy262:
+	++in.cur;
+yyFillLabel214:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy75;
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel214;
+			}
+			goto yy130;
+	}
+yy263:
+	++in.cur;
+yyFillLabel215:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel215;
+			}
+			goto yy130;
+	}
+yy264:
+	++in.cur;
+yyFillLabel216:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel216;
+			}
+			goto yy130;
+	}
+yy265:
+	++in.cur;
+yyFillLabel217:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel217;
+			}
+			goto yy130;
+	}
+yy266:
+	++in.cur;
+yyFillLabel218:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel218;
+			}
+			goto yy130;
+	}
+yy267:
+	++in.cur;
+yyFillLabel219:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel219;
+			}
+			goto yy130;
+	}
+yy268:
+	++in.cur;
+yyFillLabel220:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel220;
+			}
+			goto yy130;
+	}
+yy269:
+	++in.cur;
+yyFillLabel221:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel221;
+			}
+			goto yy130;
+	}
+yy270:
+	++in.cur;
+yyFillLabel222:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xAA:
+		case 0xAB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel222;
+			}
+			goto yy130;
+	}
+yy271:
+	++in.cur;
+yyFillLabel223:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel223;
+			}
+			goto yy130;
+	}
+yy272:
+	++in.cur;
+yyFillLabel224:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel224;
+			}
+			goto yy130;
+	}
+yy273:
+	++in.cur;
+yyFillLabel225:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel225;
+			}
+			goto yy130;
+	}
+yy274:
+	++in.cur;
+yyFillLabel226:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel226;
+			}
+			goto yy130;
+	}
+yy275:
+	++in.cur;
+yyFillLabel227:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xB0:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel227;
+			}
+			goto yy130;
+	}
+yy276:
+	++in.cur;
+yyFillLabel228:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel228;
+			}
+			goto yy130;
+	}
+yy277:
+	++in.cur;
+yyFillLabel229:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel229;
+			}
+			goto yy130;
+	}
+yy278:
+	++in.cur;
+yyFillLabel230:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel230;
+			}
+			goto yy130;
+	}
+yy279:
+	++in.cur;
+yyFillLabel231:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel231;
+			}
+			goto yy130;
+	}
+yy280:
+	++in.cur;
+yyFillLabel232:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel232;
+			}
+			goto yy130;
+	}
+yy281:
+	++in.cur;
+yyFillLabel233:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel233;
+			}
+			goto yy130;
+	}
+yy282:
+	++in.cur;
+yyFillLabel234:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel234;
+			}
+			goto yy130;
+	}
+yy283:
+	++in.cur;
+yyFillLabel235:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel235;
+			}
+			goto yy130;
+	}
+yy284:
+	++in.cur;
+yyFillLabel236:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel236;
+			}
+			goto yy130;
+	}
+yy285:
+	++in.cur;
+yyFillLabel237:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xBA:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel237;
+			}
+			goto yy130;
+	}
+yy286:
+	++in.cur;
+yyFillLabel238:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB5:
+		case 0xB6:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel238;
+			}
+			goto yy130;
+	}
+yy287:
+	++in.cur;
+yyFillLabel239:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x82:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel239;
+			}
+			goto yy130;
+	}
+yy288:
+	++in.cur;
+yyFillLabel240:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel240;
+			}
+			goto yy130;
+	}
+yy289:
+	++in.cur;
+yyFillLabel241:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA4:
+		case 0xA5: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel241;
+			}
+			goto yy130;
+	}
+yy290:
+	++in.cur;
+yyFillLabel242:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel242;
+			}
+			goto yy130;
+	}
+yy291:
+	++in.cur;
+yyFillLabel243:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel243;
+			}
+			goto yy130;
+	}
+yy292:
+	++in.cur;
+yyFillLabel244:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel244;
+			}
+			goto yy130;
+	}
+yy293:
+	++in.cur;
+yyFillLabel245:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel245;
+			}
+			goto yy130;
+	}
+yy294:
+	++in.cur;
+yyFillLabel246:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel246;
+			}
+			goto yy130;
+	}
+yy295:
+	++in.cur;
+yyFillLabel247:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel247;
+			}
+			goto yy130;
+	}
+yy296:
+	++in.cur;
+yyFillLabel248:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel248;
+			}
+			goto yy130;
+	}
+yy297:
+	++in.cur;
+yyFillLabel249:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel249;
+			}
+			goto yy130;
+	}
+yy298:
+	++in.cur;
+yyFillLabel250:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel250;
+			}
+			goto yy130;
+	}
+yy299:
+	++in.cur;
+yyFillLabel251:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel251;
+			}
+			goto yy130;
+	}
+yy300:
+	++in.cur;
+yyFillLabel252:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel252;
+			}
+			goto yy130;
+	}
+yy301:
+	++in.cur;
+yyFillLabel253:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel253;
+			}
+			goto yy130;
+	}
+yy302:
+	++in.cur;
+yyFillLabel254:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		case 0xBF: goto yy75;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel254;
+			}
+			goto yy130;
+	}
+yy303:
+	++in.cur;
+yyFillLabel255:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel255;
+			}
+			goto yy130;
+	}
+yy304:
+	++in.cur;
+yyFillLabel256:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel256;
+			}
+			goto yy130;
+	}
+yy305:
+	++in.cur;
+yyFillLabel257:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel257;
+			}
+			goto yy130;
+	}
+yy306:
+	++in.cur;
+yyFillLabel258:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel258;
+			}
+			goto yy130;
+	}
+yy307:
+	++in.cur;
+yyFillLabel259:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy424;
+		case 0x81: goto yy425;
+		case 0x82:
+		case 0x90:
+		case 0x91:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0xB0: goto yy133;
+		case 0x83: goto yy426;
+		case 0x85: goto yy217;
+		case 0x8A: goto yy427;
+		case 0x8B: goto yy428;
+		case 0x8C: goto yy429;
+		case 0x8D: goto yy430;
+		case 0x8E: goto yy272;
+		case 0x8F: goto yy431;
+		case 0x92: goto yy432;
+		case 0x94: goto yy433;
+		case 0x95: goto yy241;
+		case 0x9C: goto yy382;
+		case 0x9D: goto yy434;
+		case 0xA0: goto yy435;
+		case 0xA1: goto yy436;
+		case 0xA2: goto yy230;
+		case 0xA4: goto yy437;
+		case 0xA6: goto yy438;
+		case 0xA8: goto yy439;
+		case 0xA9: goto yy440;
+		case 0xAA: goto yy441;
+		case 0xAB: goto yy442;
+		case 0xAC: goto yy229;
+		case 0xAD: goto yy443;
+		case 0xAE: goto yy444;
+		case 0xB1: goto yy253;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel259;
+			}
+			goto yy130;
+	}
+yy308:
+	++in.cur;
+yyFillLabel260:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy445;
+		case 0x82: goto yy446;
+		case 0x83: goto yy447;
+		case 0x84: goto yy448;
+		case 0x85: goto yy449;
+		case 0x86: goto yy450;
+		case 0x87: goto yy451;
+		case 0x88: goto yy452;
+		case 0x8A: goto yy267;
+		case 0x8B: goto yy230;
+		case 0x8C: goto yy189;
+		case 0x8D: goto yy453;
+		case 0x92:
+		case 0x98: goto yy273;
+		case 0x93: goto yy454;
+		case 0x96: goto yy455;
+		case 0x99: goto yy456;
+		case 0x9A: goto yy457;
+		case 0xA2: goto yy226;
+		case 0xA3: goto yy458;
+		case 0xAB: goto yy459;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel260;
+			}
+			goto yy130;
+	}
+yy309:
+	++in.cur;
+yyFillLabel261:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90: goto yy133;
+		case 0x8E: goto yy179;
+		case 0x91: goto yy455;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel261;
+			}
+			goto yy130;
+	}
+yy310:
+	++in.cur;
+yyFillLabel262:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy133;
+		case 0x90: goto yy455;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel262;
+			}
+			goto yy130;
+	}
+yy311:
+	++in.cur;
+yyFillLabel263:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xBC: goto yy133;
+		case 0xA8: goto yy459;
+		case 0xA9: goto yy230;
+		case 0xAB: goto yy460;
+		case 0xAC: goto yy273;
+		case 0xAD: goto yy461;
+		case 0xAE: goto yy462;
+		case 0xBD: goto yy463;
+		case 0xBE: goto yy464;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel263;
+			}
+			goto yy130;
+	}
+yy312:
+	++in.cur;
+yyFillLabel264:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy465;
+		case 0xB0: goto yy133;
+		case 0xB1: goto yy466;
+		case 0xB2: goto yy467;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel264;
+			}
+			goto yy130;
+	}
+yy313:
+	++in.cur;
+yyFillLabel265:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy133;
+		case 0x91: goto yy468;
+		case 0x92: goto yy469;
+		case 0x93: goto yy470;
+		case 0x94: goto yy471;
+		case 0x95: goto yy472;
+		case 0x9A: goto yy473;
+		case 0x9B: goto yy474;
+		case 0x9C: goto yy475;
+		case 0x9D: goto yy476;
+		case 0x9E: goto yy477;
+		case 0x9F: goto yy478;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel265;
+			}
+			goto yy130;
+	}
+yy314:
+	++in.cur;
+yyFillLabel266:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2: goto yy133;
+		case 0xA3: goto yy479;
+		case 0xB8: goto yy480;
+		case 0xB9: goto yy481;
+		case 0xBA: goto yy482;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel266;
+			}
+			goto yy130;
+	}
+yy315:
+	++in.cur;
+yyFillLabel267:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy133;
+		case 0x9B: goto yy483;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel267;
+			}
+			goto yy130;
+	}
+yy316:
+	++in.cur;
+yyFillLabel268:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F: goto yy133;
+		case 0x9C: goto yy217;
+		case 0xA0: goto yy432;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel268;
+			}
+			goto yy130;
+	}
+yy317:
+	++in.cur;
+yyFillLabel269:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7: goto yy133;
+		case 0xA8: goto yy432;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel269;
+			}
+			goto yy130;
+	}
+yy318:
+	++in.cur;
+yyFillLabel270:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel270;
+			}
+			goto yy130;
+	}
+yy319:
+	++in.cur;
+yyFillLabel271:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel271;
+			}
+			goto yy130;
+	}
+yy320:
+	++in.cur;
+yyFillLabel272:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel272;
+			}
+			goto yy130;
+	}
+yy321:
+	++in.cur;
+yyFillLabel273:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel273;
+			}
+			goto yy130;
+	}
+yy322:
+	++in.cur;
+yyFillLabel274:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8F:
+		case 0x90:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel274;
+			}
+			goto yy130;
+	}
+yy323:
+	++in.cur;
+yyFillLabel275:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x87:
+		case 0x88:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x97:
+		case 0x9C:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel275;
+			}
+			goto yy130;
+	}
+yy324:
+	++in.cur;
+yyFillLabel276:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8F:
+		case 0x90:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBC:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel276;
+			}
+			goto yy130;
+	}
+yy325:
+	++in.cur;
+yyFillLabel277:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x87:
+		case 0x88:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x91:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9E:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel277;
+			}
+			goto yy130;
+	}
+yy326:
+	++in.cur;
+yyFillLabel278:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel278;
+			}
+			goto yy130;
+	}
+yy327:
+	++in.cur;
+yyFillLabel279:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel279;
+			}
+			goto yy130;
+	}
+yy328:
+	++in.cur;
+yyFillLabel280:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8F:
+		case 0x90:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel280;
+			}
+			goto yy130;
+	}
+yy329:
+	++in.cur;
+yyFillLabel281:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x87:
+		case 0x88:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x96:
+		case 0x97:
+		case 0x9C:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel281;
+			}
+			goto yy130;
+	}
+yy330:
+	++in.cur;
+yyFillLabel282:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x99:
+		case 0x9A:
+		case 0x9C:
+		case 0x9E:
+		case 0x9F:
+		case 0xA3:
+		case 0xA4:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel282;
+			}
+			goto yy130;
+	}
+yy331:
+	++in.cur;
+yyFillLabel283:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x97:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel283;
+			}
+			goto yy130;
+	}
+yy332:
+	++in.cur;
+yyFillLabel284:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel284;
+			}
+			goto yy130;
+	}
+yy333:
+	++in.cur;
+yyFillLabel285:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel285;
+			}
+			goto yy130;
+	}
+yy334:
+	++in.cur;
+yyFillLabel286:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel286;
+			}
+			goto yy130;
+	}
+yy335:
+	++in.cur;
+yyFillLabel287:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x95:
+		case 0x96:
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel287;
+			}
+			goto yy130;
+	}
+yy336:
+	++in.cur;
+yyFillLabel288:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel288;
+			}
+			goto yy130;
+	}
+yy337:
+	++in.cur;
+yyFillLabel289:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x97:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel289;
+			}
+			goto yy130;
+	}
+yy338:
+	++in.cur;
+yyFillLabel290:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel290;
+			}
+			goto yy130;
+	}
+yy339:
+	++in.cur;
+yyFillLabel291:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x8A:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel291;
+			}
+			goto yy130;
+	}
+yy340:
+	++in.cur;
+yyFillLabel292:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel292;
+			}
+			goto yy130;
+	}
+yy341:
+	++in.cur;
+yyFillLabel293:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel293;
+			}
+			goto yy130;
+	}
+yy342:
+	++in.cur;
+yyFillLabel294:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x84:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8D:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA5:
+		case 0xA7:
+		case 0xAA:
+		case 0xAB:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel294;
+			}
+			goto yy130;
+	}
+yy343:
+	++in.cur;
+yyFillLabel295:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel295;
+			}
+			goto yy130;
+	}
+yy344:
+	++in.cur;
+yyFillLabel296:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xB5:
+		case 0xB7:
+		case 0xB9:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel296;
+			}
+			goto yy130;
+	}
+yy345:
+	++in.cur;
+yyFillLabel297:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel297;
+			}
+			goto yy130;
+	}
+yy346:
+	++in.cur;
+yyFillLabel298:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel298;
+			}
+			goto yy130;
+	}
+yy347:
+	++in.cur;
+yyFillLabel299:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x86: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel299;
+			}
+			goto yy130;
+	}
+yy348:
+	++in.cur;
+yyFillLabel300:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel300;
+			}
+			goto yy130;
+	}
+yy349:
+	++in.cur;
+yyFillLabel301:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel301;
+			}
+			goto yy130;
+	}
+yy350:
+	++in.cur;
+yyFillLabel302:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel302;
+			}
+			goto yy130;
+	}
+yy351:
+	++in.cur;
+yyFillLabel303:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel303;
+			}
+			goto yy130;
+	}
+yy352:
+	++in.cur;
+yyFillLabel304:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel304;
+			}
+			goto yy130;
+	}
+yy353:
+	++in.cur;
+yyFillLabel305:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x97:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel305;
+			}
+			goto yy130;
+	}
+yy354:
+	++in.cur;
+yyFillLabel306:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel306;
+			}
+			goto yy130;
+	}
+yy355:
+	++in.cur;
+yyFillLabel307:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel307;
+			}
+			goto yy130;
+	}
+yy356:
+	++in.cur;
+yyFillLabel308:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel308;
+			}
+			goto yy130;
+	}
+yy357:
+	++in.cur;
+yyFillLabel309:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel309;
+			}
+			goto yy130;
+	}
+yy358:
+	++in.cur;
+yyFillLabel310:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel310;
+			}
+			goto yy130;
+	}
+yy359:
+	++in.cur;
+yyFillLabel311:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel311;
+			}
+			goto yy130;
+	}
+yy360:
+	++in.cur;
+yyFillLabel312:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel312;
+			}
+			goto yy130;
+	}
+yy361:
+	++in.cur;
+yyFillLabel313:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel313;
+			}
+			goto yy130;
+	}
+yy362:
+	++in.cur;
+yyFillLabel314:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA7:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel314;
+			}
+			goto yy130;
+	}
+yy363:
+	++in.cur;
+yyFillLabel315:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel315;
+			}
+			goto yy130;
+	}
+yy364:
+	++in.cur;
+yyFillLabel316:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel316;
+			}
+			goto yy130;
+	}
+yy365:
+	++in.cur;
+yyFillLabel317:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel317;
+			}
+			goto yy130;
+	}
+yy366:
+	++in.cur;
+yyFillLabel318:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel318;
+			}
+			goto yy130;
+	}
+yy367:
+	++in.cur;
+yyFillLabel319:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8C:
+		case 0x8D:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel319;
+			}
+			goto yy130;
+	}
+yy368:
+	++in.cur;
+yyFillLabel320:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x94:
+		case 0xB1:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel320;
+			}
+			goto yy130;
+	}
+yy369:
+	++in.cur;
+yyFillLabel321:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0xA1:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel321;
+			}
+			goto yy130;
+	}
+yy370:
+	++in.cur;
+yyFillLabel322:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel322;
+			}
+			goto yy130;
+	}
+yy371:
+	++in.cur;
+yyFillLabel323:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xAF:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel323;
+			}
+			goto yy130;
+	}
+yy372:
+	++in.cur;
+yyFillLabel324:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel324;
+			}
+			goto yy130;
+	}
+yy373:
+	++in.cur;
+yyFillLabel325:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel325;
+			}
+			goto yy130;
+	}
+yy374:
+	++in.cur;
+yyFillLabel326:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x99:
+		case 0x9A:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel326;
+			}
+			goto yy130;
+	}
+yy375:
+	++in.cur;
+yyFillLabel327:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel327;
+			}
+			goto yy130;
+	}
+yy376:
+	++in.cur;
+yyFillLabel328:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel328;
+			}
+			goto yy130;
+	}
+yy377:
+	++in.cur;
+yyFillLabel329:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel329;
+			}
+			goto yy130;
+	}
+yy378:
+	++in.cur;
+yyFillLabel330:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel330;
+			}
+			goto yy130;
+	}
+yy379:
+	++in.cur;
+yyFillLabel331:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel331;
+			}
+			goto yy130;
+	}
+yy380:
+	++in.cur;
+yyFillLabel332:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel332;
+			}
+			goto yy130;
+	}
+yy381:
+	++in.cur;
+yyFillLabel333:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel333;
+			}
+			goto yy130;
+	}
+yy382:
+	++in.cur;
+yyFillLabel334:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel334;
+			}
+			goto yy130;
+	}
+yy383:
+	++in.cur;
+yyFillLabel335:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel335;
+			}
+			goto yy130;
+	}
+yy384:
+	++in.cur;
+yyFillLabel336:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel336;
+			}
+			goto yy130;
+	}
+yy385:
+	++in.cur;
+yyFillLabel337:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAC:
+		case 0xAD:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel337;
+			}
+			goto yy130;
+	}
+yy386:
+	++in.cur;
+yyFillLabel338:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel338;
+			}
+			goto yy130;
+	}
+yy387:
+	++in.cur;
+yyFillLabel339:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel339;
+			}
+			goto yy130;
+	}
+yy388:
+	++in.cur;
+yyFillLabel340:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel340;
+			}
+			goto yy130;
+	}
+yy389:
+	++in.cur;
+yyFillLabel341:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel341;
+			}
+			goto yy130;
+	}
+yy390:
+	++in.cur;
+yyFillLabel342:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel342;
+			}
+			goto yy130;
+	}
+yy391:
+	++in.cur;
+yyFillLabel343:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy424;
+		case 0x81: goto yy425;
+		case 0x82:
+		case 0x90:
+		case 0x91:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0xB0: goto yy133;
+		case 0x83: goto yy426;
+		case 0x85: goto yy217;
+		case 0x87: goto yy484;
+		case 0x8A: goto yy427;
+		case 0x8B: goto yy485;
+		case 0x8C: goto yy429;
+		case 0x8D: goto yy486;
+		case 0x8E: goto yy272;
+		case 0x8F: goto yy431;
+		case 0x92: goto yy487;
+		case 0x94: goto yy433;
+		case 0x95: goto yy241;
+		case 0x9C: goto yy382;
+		case 0x9D: goto yy434;
+		case 0xA0: goto yy435;
+		case 0xA1: goto yy436;
+		case 0xA2: goto yy230;
+		case 0xA4: goto yy437;
+		case 0xA6: goto yy438;
+		case 0xA8: goto yy488;
+		case 0xA9: goto yy440;
+		case 0xAA: goto yy441;
+		case 0xAB: goto yy489;
+		case 0xAC: goto yy229;
+		case 0xAD: goto yy443;
+		case 0xAE: goto yy444;
+		case 0xB1: goto yy253;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel343;
+			}
+			goto yy130;
+	}
+yy392:
+	++in.cur;
+yyFillLabel344:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x86:
+		case 0x92:
+		case 0x98: goto yy133;
+		case 0x81: goto yy490;
+		case 0x82: goto yy426;
+		case 0x83: goto yy491;
+		case 0x84: goto yy492;
+		case 0x85: goto yy493;
+		case 0x87: goto yy494;
+		case 0x88: goto yy495;
+		case 0x8A: goto yy267;
+		case 0x8B: goto yy496;
+		case 0x8C: goto yy328;
+		case 0x8D: goto yy497;
+		case 0x93: goto yy498;
+		case 0x96: goto yy499;
+		case 0x97: goto yy204;
+		case 0x99: goto yy500;
+		case 0x9A: goto yy227;
+		case 0x9B: goto yy501;
+		case 0xA2: goto yy226;
+		case 0xA3: goto yy502;
+		case 0xAB: goto yy459;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel344;
+			}
+			goto yy130;
+	}
+yy393:
+	++in.cur;
+yyFillLabel345:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xBC: goto yy133;
+		case 0xA8: goto yy459;
+		case 0xA9: goto yy503;
+		case 0xAB: goto yy231;
+		case 0xAC: goto yy382;
+		case 0xAD: goto yy504;
+		case 0xAE: goto yy462;
+		case 0xBD: goto yy505;
+		case 0xBE: goto yy506;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel345;
+			}
+			goto yy130;
+	}
+yy394:
+	++in.cur;
+yyFillLabel346:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy465;
+		case 0xB0: goto yy133;
+		case 0xB1: goto yy466;
+		case 0xB2: goto yy507;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel346;
+			}
+			goto yy130;
+	}
+yy395:
+	++in.cur;
+yyFillLabel347:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x85: goto yy508;
+		case 0x86: goto yy509;
+		case 0x89: goto yy510;
+		case 0x90:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy133;
+		case 0x91: goto yy468;
+		case 0x92: goto yy469;
+		case 0x93: goto yy470;
+		case 0x94: goto yy471;
+		case 0x95: goto yy472;
+		case 0x9A: goto yy473;
+		case 0x9B: goto yy474;
+		case 0x9C: goto yy475;
+		case 0x9D: goto yy476;
+		case 0x9E: goto yy477;
+		case 0x9F: goto yy511;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel347;
+			}
+			goto yy130;
+	}
+yy396:
+	++in.cur;
+yyFillLabel348:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2: goto yy133;
+		case 0xA3: goto yy512;
+		case 0xB8: goto yy480;
+		case 0xB9: goto yy481;
+		case 0xBA: goto yy482;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel348;
+			}
+			goto yy130;
+	}
+yy397:
+	++in.cur;
+yyFillLabel349:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x84:
+		case 0x85:
+		case 0x86: goto yy133;
+		case 0x87: goto yy273;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel349;
+			}
+			goto yy130;
+	}
+yy398:
+	++in.cur;
+yyFillLabel350:
+	yych = *in.cur;
+	switch (yych) {
+		case 'f': goto yy513;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel350;
+			}
+			goto yy130;
+	}
+yy399:
+	++in.cur;
+yyFillLabel351:
+	yych = *in.cur;
+	switch (yych) {
+		case 'N': goto yy514;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel351;
+			}
+			goto yy130;
+	}
+yy400:
+	++in.cur;
+yyFillLabel352:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+		case 0x01:
+		case 0x02:
+		case 0x03:
+		case 0x04:
+		case 0x05:
+		case 0x06:
+		case 0x07:
+		case 0x08:
+		case '\t':
+		case '\n':
+		case '\v':
+		case '\f':
+		case '\r':
+		case 0x0E:
+		case 0x0F:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+		case 0x14:
+		case 0x15:
+		case 0x16:
+		case 0x17:
+		case 0x18:
+		case 0x19:
+		case 0x1A:
+		case 0x1B:
+		case 0x1C:
+		case 0x1D:
+		case 0x1E:
+		case 0x1F:
+		case ' ':
+		case '!':
+		case '"':
+		case '#':
+		case '$':
+		case '%':
+		case '&':
+		case '\'':
+		case '(':
+		case ')':
+		case '+':
+		case ',':
+		case '-':
+		case '.':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case ':':
+		case ';':
+		case '<':
+		case '=':
+		case '>':
+		case '?':
+		case '@':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '[':
+		case '\\':
+		case ']':
+		case '^':
+		case '_':
+		case '`':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case '{':
+		case '|':
+		case '}':
+		case '~':
+		case 0x7F:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel352;
+				goto yy130;
+			}
+			goto yy167;
+		case '*': goto yy400;
+		case '/': goto yy515;
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF: goto yy401;
+		case 0xE0: goto yy402;
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEE:
+		case 0xEF: goto yy403;
+		case 0xF0: goto yy404;
+		case 0xF1:
+		case 0xF2:
+		case 0xF3: goto yy405;
+		case 0xF4: goto yy406;
+		default: goto yy130;
+	}
+yy401:
+	++in.cur;
+yyFillLabel353:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy167;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel353;
+			}
+			goto yy130;
+	}
+yy402:
+	++in.cur;
+yyFillLabel354:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy401;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel354;
+			}
+			goto yy130;
+	}
+yy403:
+	++in.cur;
+yyFillLabel355:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy401;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel355;
+			}
+			goto yy130;
+	}
+yy404:
+	++in.cur;
+yyFillLabel356:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy403;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel356;
+			}
+			goto yy130;
+	}
+yy405:
+	++in.cur;
+yyFillLabel357:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy403;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel357;
+			}
+			goto yy130;
+	}
+yy406:
+	++in.cur;
+yyFillLabel358:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy403;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel358;
+			}
+			goto yy130;
+	}
+yy407:
+	++in.cur;
+yyFillLabel359:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy168;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel359;
+			}
+			goto yy130;
+	}
+yy408:
+	++in.cur;
+yyFillLabel360:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy407;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel360;
+			}
+			goto yy130;
+	}
+yy409:
+	++in.cur;
+yyFillLabel361:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy407;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel361;
+			}
+			goto yy130;
+	}
+yy410:
+	++in.cur;
+yyFillLabel362:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80: goto yy516;
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy407;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel362;
+			}
+			goto yy130;
+	}
+yy411:
+	++in.cur;
+yyFillLabel363:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy409;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel363;
+			}
+			goto yy130;
+	}
+yy412:
+	++in.cur;
+yyFillLabel364:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy409;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel364;
+			}
+			goto yy130;
+	}
+yy413:
+	++in.cur;
+yyFillLabel365:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy409;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel365;
+			}
+			goto yy130;
+	}
+yy414:
+	++in.cur;
+yyFillLabel366:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy415;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel366;
+			}
+			goto yy130;
+	}
+yy415:
+	++in.cur;
+yyFillLabel367:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy415;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel367;
+			}
+			goto yy166;
+	}
+yy416:
+	++in.cur;
+yyFillLabel368:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy416;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel368;
+			}
+			goto yy86;
+	}
+yy417:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel369:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel369;
+			}
+			goto yy80;
+		case 'i': goto yy517;
+		default: goto yy79;
+	}
+yy418:
+	yyaccept = 5;
+	in.mar = ++in.cur;
+yyFillLabel370:
+	yych = *in.cur;
+	switch (yych) {
+		case '$':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '\\':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF:
+		case 0xE0:
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEF:
+		case 0xF0:
+		case 0xF3: goto yy79;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel370;
+			}
+			goto yy419;
+	}
+yy419:
+#line 442 "src/json/jlexer.re"
+	{
+        return mkSym(JSON_NAN);
+      }
+#line 19074 "src/json/jlexer.cpp"
+yy420:
+	++in.cur;
+yyFillLabel371:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy518;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel371;
+			}
+			goto yy130;
+	}
+yy421:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel372:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel372;
+			}
+			goto yy80;
+		case 's': goto yy519;
+		default: goto yy79;
+	}
+yy422:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel373:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel373;
+			}
+			goto yy80;
+		case 'l': goto yy520;
+		default: goto yy79;
+	}
+yy423:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel374:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel374;
+			}
+			goto yy80;
+		case 'e': goto yy522;
+		default: goto yy79;
+	}
+yy424:
+	++in.cur;
+yyFillLabel375:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBC:
+		case 0xBD:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel375;
+			}
+			goto yy130;
+	}
+yy425:
+	++in.cur;
+yyFillLabel376:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel376;
+			}
+			goto yy130;
+	}
+yy426:
+	++in.cur;
+yyFillLabel377:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel377;
+			}
+			goto yy130;
+	}
+yy427:
+	++in.cur;
+yyFillLabel378:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel378;
+			}
+			goto yy130;
+	}
+yy428:
+	++in.cur;
+yyFillLabel379:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel379;
+			}
+			goto yy130;
+	}
+yy429:
+	++in.cur;
+yyFillLabel380:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel380;
+			}
+			goto yy130;
+	}
+yy430:
+	++in.cur;
+yyFillLabel381:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel381;
+			}
+			goto yy130;
+	}
+yy431:
+	++in.cur;
+yyFillLabel382:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel382;
+			}
+			goto yy130;
+	}
+yy432:
+	++in.cur;
+yyFillLabel383:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel383;
+			}
+			goto yy130;
+	}
+yy433:
+	++in.cur;
+yyFillLabel384:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel384;
+			}
+			goto yy130;
+	}
+yy434:
+	++in.cur;
+yyFillLabel385:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel385;
+			}
+			goto yy130;
+	}
+yy435:
+	++in.cur;
+yyFillLabel386:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB7:
+		case 0xB8:
+		case 0xBC:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel386;
+			}
+			goto yy130;
+	}
+yy436:
+	++in.cur;
+yyFillLabel387:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel387;
+			}
+			goto yy130;
+	}
+yy437:
+	++in.cur;
+yyFillLabel388:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel388;
+			}
+			goto yy130;
+	}
+yy438:
+	++in.cur;
+yyFillLabel389:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel389;
+			}
+			goto yy130;
+	}
+yy439:
+	++in.cur;
+yyFillLabel390:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel390;
+			}
+			goto yy130;
+	}
+yy440:
+	++in.cur;
+yyFillLabel391:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel391;
+			}
+			goto yy130;
+	}
+yy441:
+	++in.cur;
+yyFillLabel392:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel392;
+			}
+			goto yy130;
+	}
+yy442:
+	++in.cur;
+yyFillLabel393:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel393;
+			}
+			goto yy130;
+	}
+yy443:
+	++in.cur;
+yyFillLabel394:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel394;
+			}
+			goto yy130;
+	}
+yy444:
+	++in.cur;
+yyFillLabel395:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel395;
+			}
+			goto yy130;
+	}
+yy445:
+	++in.cur;
+yyFillLabel396:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel396;
+			}
+			goto yy130;
+	}
+yy446:
+	++in.cur;
+yyFillLabel397:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel397;
+			}
+			goto yy130;
+	}
+yy447:
+	++in.cur;
+yyFillLabel398:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel398;
+			}
+			goto yy130;
+	}
+yy448:
+	++in.cur;
+yyFillLabel399:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel399;
+			}
+			goto yy130;
+	}
+yy449:
+	++in.cur;
+yyFillLabel400:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel400;
+			}
+			goto yy130;
+	}
+yy450:
+	++in.cur;
+yyFillLabel401:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel401;
+			}
+			goto yy130;
+	}
+yy451:
+	++in.cur;
+yyFillLabel402:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x9A: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel402;
+			}
+			goto yy130;
+	}
+yy452:
+	++in.cur;
+yyFillLabel403:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel403;
+			}
+			goto yy130;
+	}
+yy453:
+	++in.cur;
+yyFillLabel404:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel404;
+			}
+			goto yy130;
+	}
+yy454:
+	++in.cur;
+yyFillLabel405:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x84:
+		case 0x85:
+		case 0x87: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel405;
+			}
+			goto yy130;
+	}
+yy455:
+	++in.cur;
+yyFillLabel406:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel406;
+			}
+			goto yy130;
+	}
+yy456:
+	++in.cur;
+yyFillLabel407:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x84: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel407;
+			}
+			goto yy130;
+	}
+yy457:
+	++in.cur;
+yyFillLabel408:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel408;
+			}
+			goto yy130;
+	}
+yy458:
+	++in.cur;
+yyFillLabel409:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel409;
+			}
+			goto yy130;
+	}
+yy459:
+	++in.cur;
+yyFillLabel410:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel410;
+			}
+			goto yy130;
+	}
+yy460:
+	++in.cur;
+yyFillLabel411:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel411;
+			}
+			goto yy130;
+	}
+yy461:
+	++in.cur;
+yyFillLabel412:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel412;
+			}
+			goto yy130;
+	}
+yy462:
+	++in.cur;
+yyFillLabel413:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel413;
+			}
+			goto yy130;
+	}
+yy463:
+	++in.cur;
+yyFillLabel414:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x90: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel414;
+			}
+			goto yy130;
+	}
+yy464:
+	++in.cur;
+yyFillLabel415:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel415;
+			}
+			goto yy130;
+	}
+yy465:
+	++in.cur;
+yyFillLabel416:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel416;
+			}
+			goto yy130;
+	}
+yy466:
+	++in.cur;
+yyFillLabel417:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel417;
+			}
+			goto yy130;
+	}
+yy467:
+	++in.cur;
+yyFillLabel418:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel418;
+			}
+			goto yy130;
+	}
+yy468:
+	++in.cur;
+yyFillLabel419:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel419;
+			}
+			goto yy130;
+	}
+yy469:
+	++in.cur;
+yyFillLabel420:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9E:
+		case 0x9F:
+		case 0xA2:
+		case 0xA5:
+		case 0xA6:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBB:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel420;
+			}
+			goto yy130;
+	}
+yy470:
+	++in.cur;
+yyFillLabel421:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel421;
+			}
+			goto yy130;
+	}
+yy471:
+	++in.cur;
+yyFillLabel422:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel422;
+			}
+			goto yy130;
+	}
+yy472:
+	++in.cur;
+yyFillLabel423:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x86:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel423;
+			}
+			goto yy130;
+	}
+yy473:
+	++in.cur;
+yyFillLabel424:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel424;
+			}
+			goto yy130;
+	}
+yy474:
+	++in.cur;
+yyFillLabel425:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel425;
+			}
+			goto yy130;
+	}
+yy475:
+	++in.cur;
+yyFillLabel426:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel426;
+			}
+			goto yy130;
+	}
+yy476:
+	++in.cur;
+yyFillLabel427:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel427;
+			}
+			goto yy130;
+	}
+yy477:
+	++in.cur;
+yyFillLabel428:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel428;
+			}
+			goto yy130;
+	}
+yy478:
+	++in.cur;
+yyFillLabel429:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel429;
+			}
+			goto yy130;
+	}
+yy479:
+	++in.cur;
+yyFillLabel430:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel430;
+			}
+			goto yy130;
+	}
+yy480:
+	++in.cur;
+yyFillLabel431:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA1:
+		case 0xA2:
+		case 0xA4:
+		case 0xA7:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB9:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel431;
+			}
+			goto yy130;
+	}
+yy481:
+	++in.cur;
+yyFillLabel432:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x87:
+		case 0x89:
+		case 0x8B:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x91:
+		case 0x92:
+		case 0x94:
+		case 0x97:
+		case 0x99:
+		case 0x9B:
+		case 0x9D:
+		case 0x9F:
+		case 0xA1:
+		case 0xA2:
+		case 0xA4:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel432;
+			}
+			goto yy130;
+	}
+yy482:
+	++in.cur;
+yyFillLabel433:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel433;
+			}
+			goto yy130;
+	}
+yy483:
+	++in.cur;
+yyFillLabel434:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel434;
+			}
+			goto yy130;
+	}
+yy484:
+	++in.cur;
+yyFillLabel435:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xBD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel435;
+			}
+			goto yy130;
+	}
+yy485:
+	++in.cur;
+yyFillLabel436:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0xA0: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel436;
+			}
+			goto yy130;
+	}
+yy486:
+	++in.cur;
+yyFillLabel437:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel437;
+			}
+			goto yy130;
+	}
+yy487:
+	++in.cur;
+yyFillLabel438:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel438;
+			}
+			goto yy130;
+	}
+yy488:
+	++in.cur;
+yyFillLabel439:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x85:
+		case 0x86:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel439;
+			}
+			goto yy130;
+	}
+yy489:
+	++in.cur;
+yyFillLabel440:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel440;
+			}
+			goto yy130;
+	}
+yy490:
+	++in.cur;
+yyFillLabel441:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel441;
+			}
+			goto yy130;
+	}
+yy491:
+	++in.cur;
+yyFillLabel442:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel442;
+			}
+			goto yy130;
+	}
+yy492:
+	++in.cur;
+yyFillLabel443:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel443;
+			}
+			goto yy130;
+	}
+yy493:
+	++in.cur;
+yyFillLabel444:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB6: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel444;
+			}
+			goto yy130;
+	}
+yy494:
+	++in.cur;
+yyFillLabel445:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel445;
+			}
+			goto yy130;
+	}
+yy495:
+	++in.cur;
+yyFillLabel446:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel446;
+			}
+			goto yy130;
+	}
+yy496:
+	++in.cur;
+yyFillLabel447:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel447;
+			}
+			goto yy130;
+	}
+yy497:
+	++in.cur;
+yyFillLabel448:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x87:
+		case 0x88:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x97:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel448;
+			}
+			goto yy130;
+	}
+yy498:
+	++in.cur;
+yyFillLabel449:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x87:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel449;
+			}
+			goto yy130;
+	}
+yy499:
+	++in.cur;
+yyFillLabel450:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel450;
+			}
+			goto yy130;
+	}
+yy500:
+	++in.cur;
+yyFillLabel451:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x84:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel451;
+			}
+			goto yy130;
+	}
+yy501:
+	++in.cur;
+yyFillLabel452:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel452;
+			}
+			goto yy130;
+	}
+yy502:
+	++in.cur;
+yyFillLabel453:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel453;
+			}
+			goto yy130;
+	}
+yy503:
+	++in.cur;
+yyFillLabel454:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel454;
+			}
+			goto yy130;
+	}
+yy504:
+	++in.cur;
+yyFillLabel455:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel455;
+			}
+			goto yy130;
+	}
+yy505:
+	++in.cur;
+yyFillLabel456:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel456;
+			}
+			goto yy130;
+	}
+yy506:
+	++in.cur;
+yyFillLabel457:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel457;
+			}
+			goto yy130;
+	}
+yy507:
+	++in.cur;
+yyFillLabel458:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9D:
+		case 0x9E: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel458;
+			}
+			goto yy130;
+	}
+yy508:
+	++in.cur;
+yyFillLabel459:
+	yych = *in.cur;
+	switch (yych) {
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel459;
+			}
+			goto yy130;
+	}
+yy509:
+	++in.cur;
+yyFillLabel460:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel460;
+			}
+			goto yy130;
+	}
+yy510:
+	++in.cur;
+yyFillLabel461:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x82:
+		case 0x83:
+		case 0x84: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel461;
+			}
+			goto yy130;
+	}
+yy511:
+	++in.cur;
+yyFillLabel462:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xA8:
+		case 0xA9:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel462;
+			}
+			goto yy130;
+	}
+yy512:
+	++in.cur;
+yyFillLabel463:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96: goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel463;
+			}
+			goto yy130;
+	}
+yy513:
+	++in.cur;
+yyFillLabel464:
+	yych = *in.cur;
+	switch (yych) {
+		case 'i': goto yy524;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel464;
+			}
+			goto yy130;
+	}
+yy514:
+	++in.cur;
+	goto yy419;
+yy515:
+	++in.cur;
+	goto yy169;
+yy516:
+	++in.cur;
+yyFillLabel465:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x80:
+		case 0x81:
+		case 0x82:
+		case 0x83:
+		case 0x84:
+		case 0x85:
+		case 0x86:
+		case 0x87:
+		case 0x88:
+		case 0x89:
+		case 0x8A:
+		case 0x8B:
+		case 0x8C:
+		case 0x8D:
+		case 0x8E:
+		case 0x8F:
+		case 0x90:
+		case 0x91:
+		case 0x92:
+		case 0x93:
+		case 0x94:
+		case 0x95:
+		case 0x96:
+		case 0x97:
+		case 0x98:
+		case 0x99:
+		case 0x9A:
+		case 0x9B:
+		case 0x9C:
+		case 0x9D:
+		case 0x9E:
+		case 0x9F:
+		case 0xA0:
+		case 0xA1:
+		case 0xA2:
+		case 0xA3:
+		case 0xA4:
+		case 0xA5:
+		case 0xA6:
+		case 0xA7:
+		case 0xAA:
+		case 0xAB:
+		case 0xAC:
+		case 0xAD:
+		case 0xAE:
+		case 0xAF:
+		case 0xB0:
+		case 0xB1:
+		case 0xB2:
+		case 0xB3:
+		case 0xB4:
+		case 0xB5:
+		case 0xB6:
+		case 0xB7:
+		case 0xB8:
+		case 0xB9:
+		case 0xBA:
+		case 0xBB:
+		case 0xBC:
+		case 0xBD:
+		case 0xBE:
+		case 0xBF: goto yy168;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel465;
+			}
+			goto yy130;
+	}
+yy517:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel466:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel466;
+			}
+			goto yy80;
+		case 'n': goto yy525;
+		default: goto yy79;
+	}
+yy518:
+	++in.cur;
+yyFillLabel467:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy526;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel467;
+			}
+			goto yy130;
+	}
+yy519:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel468:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel468;
+			}
+			goto yy80;
+		case 'e': goto yy527;
+		default: goto yy79;
+	}
+yy520:
+	yyaccept = 6;
+	in.mar = ++in.cur;
+yyFillLabel469:
+	yych = *in.cur;
+	switch (yych) {
+		case '$':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '\\':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF:
+		case 0xE0:
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEF:
+		case 0xF0:
+		case 0xF3: goto yy79;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel469;
+			}
+			goto yy521;
+	}
+yy521:
+#line 459 "src/json/jlexer.re"
+	{ return mkSym(JSON_NULLVAL); }
+#line 23617 "src/json/jlexer.cpp"
+yy522:
+	yyaccept = 7;
+	in.mar = ++in.cur;
+yyFillLabel470:
+	yych = *in.cur;
+	switch (yych) {
+		case '$':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '\\':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF:
+		case 0xE0:
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEF:
+		case 0xF0:
+		case 0xF3: goto yy79;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel470;
+			}
+			goto yy523;
+	}
+yy523:
+#line 467 "src/json/jlexer.re"
+	{ return mkSym(JSON_TRUE);    }
+#line 23745 "src/json/jlexer.cpp"
+yy524:
+	++in.cur;
+yyFillLabel471:
+	yych = *in.cur;
+	switch (yych) {
+		case 'n': goto yy529;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel471;
+			}
+			goto yy130;
+	}
+yy525:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel472:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel472;
+			}
+			goto yy80;
+		case 'i': goto yy530;
+		default: goto yy79;
+	}
+yy526:
+	++in.cur;
+yyFillLabel473:
+	yych = *in.cur;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f': goto yy78;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel473;
+			}
+			goto yy130;
+	}
+yy527:
+	yyaccept = 8;
+	in.mar = ++in.cur;
+yyFillLabel474:
+	yych = *in.cur;
+	switch (yych) {
+		case '$':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '\\':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF:
+		case 0xE0:
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEF:
+		case 0xF0:
+		case 0xF3: goto yy79;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel474;
+			}
+			goto yy528;
+	}
+yy528:
+#line 466 "src/json/jlexer.re"
+	{ return mkSym(JSON_FALSE);   }
+#line 23932 "src/json/jlexer.cpp"
+yy529:
+	++in.cur;
+yyFillLabel475:
+	yych = *in.cur;
+	switch (yych) {
+		case 'i': goto yy531;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel475;
+			}
+			goto yy130;
+	}
+yy530:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel476:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel476;
+			}
+			goto yy80;
+		case 't': goto yy532;
+		default: goto yy79;
+	}
+yy531:
+	++in.cur;
+yyFillLabel477:
+	yych = *in.cur;
+	switch (yych) {
+		case 't': goto yy533;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel477;
+			}
+			goto yy130;
+	}
+yy532:
+	yyaccept = 0;
+	in.mar = ++in.cur;
+yyFillLabel478:
+	yych = *in.cur;
+	switch (yych) {
+		case 0x00:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel478;
+			}
+			goto yy80;
+		case 'y': goto yy534;
+		default: goto yy79;
+	}
+yy533:
+	++in.cur;
+yyFillLabel479:
+	yych = *in.cur;
+	switch (yych) {
+		case 'y': goto yy536;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel479;
+			}
+			goto yy130;
+	}
+yy534:
+	yyaccept = 9;
+	in.mar = ++in.cur;
+yyFillLabel480:
+	yych = *in.cur;
+	switch (yych) {
+		case '$':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '\\':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+		case 0xC2:
+		case 0xC3:
+		case 0xC4:
+		case 0xC5:
+		case 0xC6:
+		case 0xC7:
+		case 0xC8:
+		case 0xC9:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:
+		case 0xCD:
+		case 0xCE:
+		case 0xCF:
+		case 0xD0:
+		case 0xD1:
+		case 0xD2:
+		case 0xD3:
+		case 0xD4:
+		case 0xD5:
+		case 0xD6:
+		case 0xD7:
+		case 0xD8:
+		case 0xD9:
+		case 0xDA:
+		case 0xDB:
+		case 0xDC:
+		case 0xDD:
+		case 0xDE:
+		case 0xDF:
+		case 0xE0:
+		case 0xE1:
+		case 0xE2:
+		case 0xE3:
+		case 0xE4:
+		case 0xE5:
+		case 0xE6:
+		case 0xE7:
+		case 0xE8:
+		case 0xE9:
+		case 0xEA:
+		case 0xEB:
+		case 0xEC:
+		case 0xED:
+		case 0xEF:
+		case 0xF0:
+		case 0xF3: goto yy79;
+		default:
+			if (in.lim <= in.cur) {
+				if (in.fill() == 0) goto yyFillLabel480;
+			}
+			goto yy535;
+	}
+yy535:
+#line 438 "src/json/jlexer.re"
+	{
+        std::string value(in.tok[0]=='-'?"-":"+");
+        return mkSym2(JSON_INFINITY, value);
+      }
+#line 24127 "src/json/jlexer.cpp"
+yy536:
+	++in.cur;
+	goto yy535;
+yy537:
+#line 409 "src/json/jlexer.re"
+	{ return mkSym(JSON_END); }
+#line 24134 "src/json/jlexer.cpp"
+}
+#line 483 "src/json/jlexer.re"
+
+}
+
+JLexer::JLexer(const char *file)
+ : engine(new jinput_t(file, fopen(file, "r"))), next(JSON_ERROR, Location(file, Coordinates(), Coordinates())), fail(false)
+{
+  if (engine->file) consume();
+}
+
+JLexer::JLexer(const std::string &body)
+  : engine(new jinput_t("string", reinterpret_cast<const unsigned char *>(body.c_str()), body.size())), next(JSON_ERROR, LOCATION), fail(false)
+{
+  consume();
+}
+
+JLexer::JLexer(const char *body, size_t len)
+  : engine(new jinput_t("string", reinterpret_cast<const unsigned char *>(body), len)), next(JSON_ERROR, LOCATION), fail(false)
+{
+  consume();
+}
+
+JLexer::~JLexer() {
+  if (engine->file) fclose(engine->file);
+}
+
+void JLexer::consume() {
+  next = lex_json(*this);
+}
@@ -0,0 +1,642 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Open Group Base Specifications Issue 7
+#define _XOPEN_SOURCE 700
+#define _POSIX_C_SOURCE 200809L
+
+#include "ssa_cache.h"
+
+#include <assert.h>
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <re2/re2.h>
+#include <whereami/whereami.h>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "runtime/runtime.h"
+#include "runtime/value.h"
+#include "ssa.h"
+#include "types/datatype.h"
+#include "types/sums.h"
+#include "util/mkdir_parents.h"
+
+// Bump this whenever the file format or the meaning of a Term changes
+#define SSA_CACHE_MAGIC 0x3130617373656b77ULL  // "wkessa01"
+// Only this many entries (one per distinct command-line) are kept
+#define SSA_CACHE_ENTRIES 16
+
+// Term tags in the file
+#define TAG_RARG 0
+#define TAG_RLIT 1
+#define TAG_RAPP 2
+#define TAG_RPRIM 3
+#define TAG_RGET 4
+#define TAG_RDES 5
+#define TAG_RCON 6
+#define TAG_RFUN 7
+
+// Literal tags in the file
+#define LIT_STRING 0
+#define LIT_INTEGER 1
+#define LIT_DOUBLE 2
+#define LIT_REGEXP 3
+
+static CPPFile cppFile(__FILE__);
+
+// The runtime finds these sums by pointer, so loaded entries must replace them
+static std::shared_ptr<Sum> *specials[] = {&Boolean, &Order, &List, &Unit, &Pair, &Result, &JValue};
+
+SSACache::SSACache(const std::string &dir_) : dir(dir_) {}
+
+void SSACache::key(const std::string &str) {
+  Hash(str).push(codes);
+  codes.push_back(str.size());
+}
+
+void SSACache::key_file(const FileContent &file) {
+  key(std::string(file.filename()));
+  StringSegment ss = file.segment();
+  Hash(ss.start, ss.size()).push(codes);
+  codes.push_back(ss.size());
+}
+
+void SSACache::key_executable() {
+  int length = wai_getExecutablePath(nullptr, 0, nullptr);
+  std::string exe(length, 0);
+  wai_getExecutablePath(&exe[0], length, nullptr);
+  key(exe);
+
+  struct stat sbuf;
+  if (stat(exe.c_str(), &sbuf) == 0) {
+    codes.push_back(sbuf.st_size);
+    codes.push_back(sbuf.st_mtim.tv_sec);
+    codes.push_back(sbuf.st_mtim.tv_nsec);
+    codes.push_back(sbuf.st_ino);
+  }
+}
+
+std::string SSACache::path() {
+  Hash h(codes);
+  char name[40];
+  snprintf(name, sizeof(name), "%016llx%016llx.ssa", static_cast<unsigned long long>(h.data[0]),
+           static_cast<unsigned long long>(h.data[1]));
+  return dir + "/" + name;
+}
+
+void SSACache::remove() { unlink(path().c_str()); }
+
+
+struct SSASum {
+  std::vector<const Constructor *> members;  // nullptr if no Term uses the member
+  size_t special;                            // 1 + index into specials, or 0
+};
+
+struct SSAWriter {
+  std::string out;
+  std::vector<const FileContent *> files;
+  std::vector<SSASum> sums;
+  std::vector<const Value *> lits;
+  std::map<const FileContent *, size_t> file_index;
+  std::map<const Constructor *, size_t> sum_index;
+  std::map<const RootPointer<Value> *, size_t> lit_index;
+
+  void u64(uint64_t x) { out.append(reinterpret_cast<const char *>(&x), sizeof(x)); }
+  void str(const std::string &x) {
+    u64(x.size());
+    out.append(x);
+  }
+  void vec(const std::vector<size_t> &x) {
+    u64(x.size());
+    for (auto i : x) u64(i);
+  }
+
+  size_t file(const FileContent *content);
+  size_t sum(const Constructor *cons);
+  void special(size_t slot);
+  size_t lit(const RootPointer<Value> *value);
+  bool term(const Term *term);
+};
+
+size_t SSAWriter::file(const FileContent *content) {
+  auto it = file_index.insert(std::make_pair(content, files.size()));
+  if (it.second) files.push_back(content);
+  return it.first->second;
+}
+
+size_t SSAWriter::sum(const Constructor *cons) {
+  const Constructor *first = cons - cons->index;
+  auto it = sum_index.insert(std::make_pair(first, sums.size()));
+  if (it.second) sums.push_back(SSASum{{}, 0});
+  auto &members = sums[it.first->second].members;
+  if (members.size() <= static_cast<size_t>(cons->index)) members.resize(cons->index + 1, nullptr);
+  members[cons->index] = cons;
+  return it.first->second;
+}
+
+void SSAWriter::special(size_t slot) {
+  const std::shared_ptr<Sum> &sum = *specials[slot];
+  if (!sum || sum->members.empty()) return;
+  size_t index = 0;
+  for (auto &cons : sum->members) index = this->sum(&cons);
+  sums[index].special = slot + 1;
+}
+
+size_t SSAWriter::lit(const RootPointer<Value> *value) {
+  auto it = lit_index.insert(std::make_pair(value, lits.size()));
+  if (it.second) lits.push_back(value->get());
+  return it.first->second;
+}
+
+bool SSAWriter::term(const Term *term) {
+  const std::type_info &id = typeid(*term);
+  uint64_t tag;
+  if (id == typeid(RArg)) {
+    tag = TAG_RARG;
+  } else if (id == typeid(RLit)) {
+    tag = TAG_RLIT;
+  } else if (id == typeid(RApp)) {
+    tag = TAG_RAPP;
+  } else if (id == typeid(RPrim)) {
+    tag = TAG_RPRIM;
+  } else if (id == typeid(RGet)) {
+    tag = TAG_RGET;
+  } else if (id == typeid(RDes)) {
+    tag = TAG_RDES;
+  } else if (id == typeid(RCon)) {
+    tag = TAG_RCON;
+  } else if (id == typeid(RFun)) {
+    tag = TAG_RFUN;
+  } else {
+    return false;
+  }
+
+  u64(tag);
+  str(term->label);
+  u64(term->flags);
+
+  if (auto redux = dynamic_cast<const Redux *>(term)) vec(redux->args);
+
+  switch (tag) {
+    case TAG_RLIT: {
+      u64(lit(static_cast<const RLit *>(term)->value.get()));
+      break;
+    }
+    case TAG_RPRIM: {
+      auto prim = static_cast<const RPrim *>(term);
+      str(prim->name);
+      u64(prim->pflags);
+      break;
+    }
+    case TAG_RGET: {
+      u64(static_cast<const RGet *>(term)->index);
+      break;
+    }
+    case TAG_RCON: {
+      auto con = static_cast<const RCon *>(term);
+      if (con->kind.get() == &Constructor::array) {
+        u64(0);
+      } else {
+        u64(sum(con->kind.get()) + 1);
+        u64(con->kind->index);
+      }
+      break;
+    }
+    case TAG_RFUN: {
+      auto fun = static_cast<const RFun *>(term);
+      u64(file(fun->fragment.fcontent()));
+      u64(fun->fragment.startByte());
+      u64(fun->fragment.endByte());
+      u64(fun->hash.data[0]);
+      u64(fun->hash.data[1]);
+      u64(fun->output);
+      vec(fun->escapes);
+      u64(fun->terms.size());
+      for (auto &x : fun->terms)
+        if (!this->term(x.get())) return false;
+      break;
+    }
+  }
+
+  return true;
+}
+
+static void prune(const std::string &dir) {
+  DIR *d = opendir(dir.c_str());
+  if (!d) return;
+
+  std::vector<std::pair<struct timespec, std::string>> entries;
+  while (struct dirent *e = readdir(d)) {
+    std::string name = e->d_name;
+    if (name.size() < 4 || name.compare(name.size() - 4, 4, ".ssa") != 0) continue;
+    std::string path = dir + "/" + name;
+    struct stat sbuf;
+    if (stat(path.c_str(), &sbuf) == 0) entries.emplace_back(sbuf.st_mtim, std::move(path));
+  }
+  closedir(d);
+
+  if (entries.size() <= SSA_CACHE_ENTRIES) return;
+  std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+    if (a.first.tv_sec != b.first.tv_sec) return a.first.tv_sec > b.first.tv_sec;
+    return a.first.tv_nsec > b.first.tv_nsec;
+  });
+  for (size_t i = SSA_CACHE_ENTRIES; i < entries.size(); ++i) unlink(entries[i].second.c_str());
+}
+
+void SSACache::save(const Term *term, const std::vector<ExternalFile> &wakefiles,
+                    const std::string &type) {
+  SSAWriter tree;
+  // The runtime needs the special sums, even when no Term constructs them
+  for (size_t slot = 0; slot < sizeof(specials) / sizeof(specials[0]); ++slot) tree.special(slot);
+  if (!tree.term(term)) return;
+
+  std::map<const FileContent *, size_t> wake_index;
+  for (size_t i = 0; i < wakefiles.size(); ++i) wake_index[&wakefiles[i]] = i;
+
+  SSAWriter w;
+  w.u64(SSA_CACHE_MAGIC);
+  Hash key(codes);
+  w.u64(key.data[0]);
+  w.u64(key.data[1]);
+  w.str(type);
+
+  w.u64(tree.files.size());
+  for (auto content : tree.files) {
+    auto it = wake_index.find(content);
+    if (it != wake_index.end()) {
+      w.u64(it->second);
+    } else {
+      // Not a wake file (the command-line, or a CPPFile); keep a copy
+      StringSegment ss = content->segment();
+      w.u64(Term::invalid);
+      w.str(content->filename());
+      w.str(ss.start ? ss.str() : std::string());
+    }
+    w.vec(content->newlineOffsets());
+  }
+
+  w.u64(tree.sums.size());
+  for (auto &sum : tree.sums) {
+    w.u64(sum.special);
+    w.u64(sum.members.size());
+    // Unused constructors are kept as placeholders, so that indexes still match
+    for (auto cons : sum.members) {
+      w.str(cons ? cons->ast.name : std::string());
+      w.u64(cons ? cons->ast.args.size() : 0);
+    }
+  }
+
+  w.u64(tree.lits.size());
+  for (auto value : tree.lits) {
+    if (auto s = dynamic_cast<const String *>(value)) {
+      w.u64(LIT_STRING);
+      w.str(s->as_str());
+    } else if (auto i = dynamic_cast<const Integer *>(value)) {
+      w.u64(LIT_INTEGER);
+      w.str(i->str());
+    } else if (auto d = dynamic_cast<const Double *>(value)) {
+      char buf[40];
+      snprintf(buf, sizeof(buf), "%a", d->value);
+      w.u64(LIT_DOUBLE);
+      w.str(buf);
+    } else if (auto r = dynamic_cast<const RegExp *>(value)) {
+      w.u64(LIT_REGEXP);
+      w.str(r->exp->pattern());
+    } else {
+      return;
+    }
+  }
+
+  w.out.append(tree.out);
+  Hash check(w.out);
+  w.u64(check.data[0]);
+  w.u64(check.data[1]);
+
+  if (mkdir_with_parents(dir, 0775) != 0) return;
+
+  // Write the entry atomically, so that concurrent wake invocations never see a partial file
+  std::string tmp = dir + "/tmp.XXXXXX";
+  int fd = mkstemp(&tmp[0]);
+  if (fd == -1) return;
+
+  const char *buf = w.out.data();
+  size_t left = w.out.size();
+  while (left) {
+    ssize_t got = write(fd, buf, left);
+    if (got <= 0) {
+      if (got == -1 && errno == EINTR) continue;
+      break;
+    }
+    buf += got;
+    left -= got;
+  }
+
+  if (close(fd) != 0 || left != 0 || rename(tmp.c_str(), path().c_str()) != 0) {
+    unlink(tmp.c_str());
+    return;
+  }
+
+  prune(dir);
+}
+
+struct SSAReader {
+  const char *pos;
+  const char *end;
+  bool ok;
+
+  SSAReader(const std::string &in) : pos(in.data()), end(in.data() + in.size()), ok(true) {}
+
+  uint64_t u64() {
+    uint64_t x = 0;
+    if (end - pos < static_cast<ptrdiff_t>(sizeof(x))) {
+      ok = false;
+      pos = end;
+    } else {
+      memcpy(&x, pos, sizeof(x));
+      pos += sizeof(x);
+    }
+    return x;
+  }
+  std::string str() {
+    uint64_t len = u64();
+    if (static_cast<uint64_t>(end - pos) < len) {
+      ok = false;
+      pos = end;
+      return std::string();
+    }
+    std::string out(pos, len);
+    pos += len;
+    return out;
+  }
+  std::vector<size_t> vec() {
+    uint64_t len = u64();
+    std::vector<size_t> out;
+    if (static_cast<uint64_t>(end - pos) / sizeof(uint64_t) < len) {
+      ok = false;
+      pos = end;
+      return out;
+    }
+    out.reserve(len);
+    for (uint64_t i = 0; i < len; ++i) out.push_back(u64());
+    return out;
+  }
+};
+
+struct SSALoader {
+  SSAReader in;
+  std::vector<const FileContent *> files;
+  std::vector<std::shared_ptr<Sum>> sums;
+  std::vector<size_t> special;
+  std::vector<std::shared_ptr<RootPointer<Value>>> lits;
+  std::vector<RPrim *> &prims;
+
+  SSALoader(const std::string &in_, std::vector<RPrim *> &prims_) : in(in_), prims(prims_) {}
+
+  std::unique_ptr<Term> term(int depth);
+};
+
+std::unique_ptr<Term> SSALoader::term(int depth) {
+  // A corrupt file must not be able to exhaust the stack
+  if (depth > 10000) in.ok = false;
+
+  uint64_t tag = in.u64();
+  std::string label = in.str();
+  uint64_t flags = in.u64();
+  std::vector<size_t> args;
+  if (tag != TAG_RARG && tag != TAG_RLIT && tag != TAG_RFUN) args = in.vec();
+  if (!in.ok) return nullptr;
+
+  std::unique_ptr<Term> out;
+  switch (tag) {
+    case TAG_RARG: {
+      out.reset(new RArg(label.c_str()));
+      break;
+    }
+    case TAG_RLIT: {
+      uint64_t lit = in.u64();
+      if (lit >= lits.size()) return nullptr;
+      out.reset(new RLit(lits[lit], label.c_str()));
+      break;
+    }
+    case TAG_RAPP: {
+      if (args.size() < 2) return nullptr;
+      RApp *app = new RApp(0, 0, label.c_str());
+      app->args = std::move(args);
+      out.reset(app);
+      break;
+    }
+    case TAG_RPRIM: {
+      std::string name = in.str();
+      int pflags = in.u64();
+      RPrim *prim =
+          new RPrim(name.c_str(), nullptr, nullptr, pflags, std::move(args), label.c_str());
+      prims.push_back(prim);
+      out.reset(prim);
+      break;
+    }
+    case TAG_RGET: {
+      if (args.size() != 1) return nullptr;
+      out.reset(new RGet(in.u64(), args[0], label.c_str()));
+      break;
+    }
+    case TAG_RDES: {
+      out.reset(new RDes(std::move(args), label.c_str()));
+      break;
+    }
+    case TAG_RCON: {
+      uint64_t sum = in.u64();
+      std::shared_ptr<Constructor> kind;
+      if (sum == 0) {
+        kind = std::shared_ptr<Constructor>(std::make_shared<int>(0), &Constructor::array);
+      } else {
+        uint64_t index = in.u64();
+        if (sum > sums.size() || index >= sums[sum - 1]->members.size()) return nullptr;
+        kind = std::shared_ptr<Constructor>(sums[sum - 1], &sums[sum - 1]->members[index]);
+      }
+      out.reset(new RCon(std::move(kind), std::move(args), label.c_str()));
+      break;
+    }
+    case TAG_RFUN: {
+      uint64_t file = in.u64();
+      uint32_t start = in.u64();
+      uint32_t end = in.u64();
+      if (file >= files.size()) return nullptr;
+      RFun *fun = new RFun(FileFragment(files[file], start, end), label.c_str(), flags);
+      out.reset(fun);
+      fun->hash.data[0] = in.u64();
+      fun->hash.data[1] = in.u64();
+      fun->output = in.u64();
+      fun->escapes = in.vec();
+      uint64_t terms = in.u64();
+      for (uint64_t i = 0; in.ok && i < terms; ++i) {
+        auto x = term(depth + 1);
+        if (!x) return nullptr;
+        fun->terms.emplace_back(std::move(x));
+      }
+      break;
+    }
+    default: {
+      return nullptr;
+    }
+  }
+
+  out->flags = flags;
+  if (!in.ok) return nullptr;
+  return out;
+}
+
+std::unique_ptr<Term> SSACache::load(Runtime &runtime, std::vector<ExternalFile> &wakefiles,
+                                     std::string &type, const PrimMap &pmap) {
+  std::string name = path();
+  std::ifstream file(name, std::ios::in | std::ios::binary);
+  if (!file) return nullptr;
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  std::string content = buffer.str();
+
+  // The trailer catches truncated or corrupted entries
+  const size_t trailer = 2 * sizeof(uint64_t);
+  if (content.size() < trailer) return nullptr;
+  Hash check(content.data(), content.size() - trailer);
+  uint64_t expect[2];
+  memcpy(&expect[0], content.data() + content.size() - trailer, trailer);
+  if (check.data[0] != expect[0] || check.data[1] != expect[1]) return nullptr;
+  content.resize(content.size() - trailer);
+
+  std::vector<RPrim *> loaded;
+  SSALoader l(content, loaded);
+  SSAReader &in = l.in;
+
+  Hash key(codes);
+  if (in.u64() != SSA_CACHE_MAGIC) return nullptr;
+  if (in.u64() != key.data[0] || in.u64() != key.data[1]) return nullptr;
+  std::string desc = in.str();
+
+  uint64_t nfiles = in.u64();
+  for (uint64_t i = 0; in.ok && i < nfiles; ++i) {
+    uint64_t index = in.u64();
+    FileContent *content;
+    if (index == Term::invalid) {
+      std::string filename = in.str();
+      files.emplace_back(new StringFile(filename.c_str(), in.str()));
+      content = files.back().get();
+    } else if (index < wakefiles.size()) {
+      content = &wakefiles[index];
+    } else {
+      return nullptr;
+    }
+    // Without a lexer pass, Locations still need the line starts
+    std::vector<size_t> newlines = in.vec();
+    size_t size = content->segment().size();
+    if (!newlines.empty()) {
+      content->clearNewLines();
+      for (size_t j = 1; j < newlines.size(); ++j) {
+        if (newlines[j] > size) return nullptr;
+        content->addNewline(content->segment().start + newlines[j]);
+      }
+    }
+    l.files.push_back(content);
+  }
+
+  uint64_t nsums = in.u64();
+  for (uint64_t i = 0; in.ok && i < nsums; ++i) {
+    // Only the constructors matter to the runtime; the Sum itself is anonymous
+    auto sum = std::make_shared<Sum>(AST(FRAGMENT_CPP_LINE, ""));
+    uint64_t special = in.u64();
+    if (special > sizeof(specials) / sizeof(specials[0])) return nullptr;
+    l.special.push_back(special);
+    uint64_t members = in.u64();
+    for (uint64_t j = 0; in.ok && j < members; ++j) {
+      std::string cons = in.str();
+      uint64_t arity = in.u64();
+      if (arity > 0xffff) return nullptr;
+      std::vector<AST> args(arity, AST(FRAGMENT_CPP_LINE, "_"));
+      sum->addConstructor(AST(FRAGMENT_CPP_LINE, std::move(cons), std::move(args)));
+    }
+    l.sums.emplace_back(std::move(sum));
+  }
+
+  uint64_t nlits = in.u64();
+  for (uint64_t i = 0; in.ok && i < nlits; ++i) {
+    uint64_t tag = in.u64();
+    std::string value = in.str();
+    if (!in.ok) return nullptr;
+    switch (tag) {
+      case LIT_STRING:
+        l.lits.emplace_back(
+            std::make_shared<RootPointer<Value>>(String::literal(runtime.heap, value)));
+        break;
+      case LIT_INTEGER:
+        l.lits.emplace_back(
+            std::make_shared<RootPointer<Value>>(Integer::literal(runtime.heap, value)));
+        break;
+      case LIT_DOUBLE:
+        l.lits.emplace_back(
+            std::make_shared<RootPointer<Value>>(Double::literal(runtime.heap, value.c_str())));
+        break;
+      case LIT_REGEXP:
+        l.lits.emplace_back(
+            std::make_shared<RootPointer<Value>>(RegExp::literal(runtime.heap, value)));
+        break;
+      default:
+        return nullptr;
+    }
+  }
+
+  if (!in.ok) return nullptr;
+  std::unique_ptr<Term> out = l.term(0);
+  if (!out || in.pos != in.end || typeid(*out) != typeid(RFun)) return nullptr;
+
+  // This wake would not be able to run the entry, so it has to be recompiled
+  for (auto prim : loaded) {
+    auto it = pmap.find(prim->name);
+    if (it == pmap.end() || it->second.flags != prim->pflags) {
+      remove();
+      return nullptr;
+    }
+  }
+
+  // Only now that the entry is known to be good may it replace the special sums
+  for (size_t i = 0; i < l.sums.size(); ++i)
+    if (l.special[i]) *specials[l.special[i] - 1] = l.sums[i];
+  prims.insert(prims.end(), loaded.begin(), loaded.end());
+  type = std::move(desc);
+
+  // Keep recently used entries from being pruned
+  utimes(name.c_str(), nullptr);
+
+  return out;
+}
+
+void SSACache::link(const PrimMap &pmap) {
+  for (auto prim : prims) {
+    auto it = pmap.find(prim->name);
+    assert(it != pmap.end());
+    prim->fn = it->second.fn;
+    prim->data = it->second.data;
+  }
+  prims.clear();
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SSA_CACHE_H
+#define SSA_CACHE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types/primfn.h"
+#include "util/file.h"
+#include "util/hash.h"
+
+struct Term;
+struct RPrim;
+struct Runtime;
+
+// An on-disk cache of the scoped SSA for a workspace, which lets an unchanged
+// workspace skip parsing, type-checking and optimization entirely.
+// Entries are named by a hash of everything which determines the SSA.
+struct SSACache {
+  SSACache(const std::string &dir_);
+
+  // Everything which determines the SSA must be added to the key before load/save
+  void key(const std::string &str);
+  void key_file(const FileContent &file);  // name and contents
+  void key_executable();                   // dev builds of wake can share a VERSION
+
+  // Returns nullptr on a miss. The Terms point into 'wakefiles', which must outlive them.
+  // An entry using a primitive which 'pmap' lacks, or has with other flags, is removed and
+  // misses; only the names and flags in 'pmap' are used. The primitives are not usable
+  // until link() is given the registration which will actually run them.
+  std::unique_ptr<Term> load(Runtime &runtime, std::vector<ExternalFile> &wakefiles,
+                             std::string &type, const PrimMap &pmap);
+  void link(const PrimMap &pmap);
+
+  // Write the SSA for the key; the SSA must have been through Term::scope
+  void save(const Term *term, const std::vector<ExternalFile> &wakefiles, const std::string &type);
+  // Forget the entry for the key
+  void remove();
+
+ private:
+  std::string dir;
+  std::vector<uint64_t> codes;
+  std::vector<std::unique_ptr<StringFile>> files;  // fragments of loaded Terms point here
+  std::vector<RPrim *> prims;                      // loaded, but not yet linked
+
+  std::string path();
+};
+
+#endif
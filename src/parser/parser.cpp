@@ -0,0 +1,4336 @@
+/* This file is automatically generated by Lemon from input grammar
+** source file "src/parser/parser.y". */
+/*
+** 2000-05-29
+**
+** The author disclaims copyright to this source code.  In place of
+** a legal notice, here is a blessing:
+**
+**    May you do good and not evil.
+**    May you find forgiveness for yourself and forgive others.
+**    May you share freely, never taking more than you give.
+**
+*************************************************************************
+** Driver template for the LEMON parser generator.
+**
+** The "lemon" program processes an LALR(1) input grammar file, then uses
+** this template to construct a parser.  The "lemon" program inserts text
+** at each "%%" line.  Also, any "P-a-r-s-e" identifer prefix (without the
+** interstitial "-" characters) contained in this template is changed into
+** the value of the %name directive from the grammar.  Otherwise, the content
+** of this template is copied straight through into the generate parser
+** source file.
+**
+** The following is the concatenation of all %include directives from the
+** input grammar file:
+*/
+/************ Begin %include sections from the grammar ************************/
+#line 31 "src/parser/parser.y"
+
+// Open Group Base Specifications Issue 7
+#define _XOPEN_SOURCE 700
+#define _POSIX_C_SOURCE 200809L
+
+#include <vector>
+#include <sstream>
+#include <string.h>
+
+#include "util/file.h"
+#include "util/diagnostic.h"
+#include "lexer.h"
+#include "syntax.h"
+#include "cst.h"
+
+#define add(t, ...) pinfo.cst->addNode((t), __VA_ARGS__)
+#define pop(x) pinfo.cst->delNodes(x)
+
+#define fail(sstream, token)                                                           \
+  do {                                                                                 \
+    std::stringstream sstr;                                                            \
+    sstr << "syntax error; " << sstream;                                               \
+    Location l = FileFragment(pinfo.fcontent, token).location();                       \
+    pinfo.reporter->reportError(l, sstr.str());                                        \
+  } while (0)
+#line 55 "src/parser/parser.c"
+/**************** End of %include directives **********************************/
+/* These constants specify the various numeric values for terminal symbols.
+***************** Begin token definitions *************************************/
+#ifndef TOKEN_WS
+#define TOKEN_WS                              1
+#define TOKEN_COMMENT                         2
+#define TOKEN_P_BOPEN                         3
+#define TOKEN_P_BCLOSE                        4
+#define TOKEN_P_SOPEN                         5
+#define TOKEN_P_SCLOSE                        6
+#define TOKEN_ID                              7
+#define TOKEN_NL                              8
+#define TOKEN_INDENT                          9
+#define TOKEN_DEDENT                         10
+#define TOKEN_KW_PACKAGE                     11
+#define TOKEN_KW_FROM                        12
+#define TOKEN_KW_IMPORT                      13
+#define TOKEN_P_HOLE                         14
+#define TOKEN_KW_EXPORT                      15
+#define TOKEN_KW_DEF                         16
+#define TOKEN_KW_TYPE                        17
+#define TOKEN_KW_TOPIC                       18
+#define TOKEN_KW_UNARY                       19
+#define TOKEN_KW_BINARY                      20
+#define TOKEN_P_EQUALS                       21
+#define TOKEN_OP_DOT                         22
+#define TOKEN_OP_QUANT                       23
+#define TOKEN_OP_EXP                         24
+#define TOKEN_OP_MULDIV                      25
+#define TOKEN_OP_ADDSUB                      26
+#define TOKEN_OP_COMPARE                     27
+#define TOKEN_OP_INEQUAL                     28
+#define TOKEN_OP_AND                         29
+#define TOKEN_OP_OR                          30
+#define TOKEN_OP_DOLLAR                      31
+#define TOKEN_OP_ASSIGN                      32
+#define TOKEN_OP_COMMA                       33
+#define TOKEN_KW_GLOBAL                      34
+#define TOKEN_P_ASCRIBE                      35
+#define TOKEN_KW_PUBLISH                     36
+#define TOKEN_KW_DATA                        37
+#define TOKEN_KW_TUPLE                       38
+#define TOKEN_KW_TARGET                      39
+#define TOKEN_P_BSLASH                       40
+#define TOKEN_P_POPEN                        41
+#define TOKEN_P_PCLOSE                       42
+#define TOKEN_STR_RAW                        43
+#define TOKEN_STR_SINGLE                     44
+#define TOKEN_STR_MID                        45
+#define TOKEN_STR_OPEN                       46
+#define TOKEN_STR_CLOSE                      47
+#define TOKEN_MSTR_CONTINUE                  48
+#define TOKEN_MSTR_BEGIN                     49
+#define TOKEN_MSTR_END                       50
+#define TOKEN_MSTR_PAUSE                     51
+#define TOKEN_MSTR_MID                       52
+#define TOKEN_MSTR_RESUME                    53
+#define TOKEN_LSTR_CONTINUE                  54
+#define TOKEN_LSTR_BEGIN                     55
+#define TOKEN_LSTR_END                       56
+#define TOKEN_LSTR_PAUSE                     57
+#define TOKEN_LSTR_MID                       58
+#define TOKEN_LSTR_RESUME                    59
+#define TOKEN_REG_SINGLE                     60
+#define TOKEN_REG_MID                        61
+#define TOKEN_REG_OPEN                       62
+#define TOKEN_REG_CLOSE                      63
+#define TOKEN_DOUBLE                         64
+#define TOKEN_INTEGER                        65
+#define TOKEN_KW_MACRO_HERE                  66
+#define TOKEN_KW_MACRO_LINE                  67
+#define TOKEN_KW_MACRO_FILE                  68
+#define TOKEN_KW_MACRO_BANG                  69
+#define TOKEN_KW_SUBSCRIBE                   70
+#define TOKEN_KW_PRIM                        71
+#define TOKEN_KW_MATCH                       72
+#define TOKEN_KW_IF                          73
+#define TOKEN_P_ARROW                        74
+#define TOKEN_KW_THEN                        75
+#define TOKEN_KW_ELSE                        76
+#define TOKEN_KW_REQUIRE                     77
+#endif
+/**************** End token definitions ***************************************/
+
+/* The next sections is a series of control #defines.
+** various aspects of the generated parser.
+**    YYCODETYPE         is the data type used to store the integer codes
+**                       that represent terminal and non-terminal symbols.
+**                       "unsigned char" is used if there are fewer than
+**                       256 symbols.  Larger types otherwise.
+**    YYNOCODE           is a number of type YYCODETYPE that is not used for
+**                       any terminal or nonterminal symbol.
+**    YYFALLBACK         If defined, this indicates that one or more tokens
+**                       (also known as: "terminal symbols") have fall-back
+**                       values which should be used if the original symbol
+**                       would not parse.  This permits keywords to sometimes
+**                       be used as identifiers, for example.
+**    YYACTIONTYPE       is the data type used for "action codes" - numbers
+**                       that indicate what to do in response to the next
+**                       token.
+**    ParseTOKENTYPE     is the data type used for minor type for terminal
+**                       symbols.  Background: A "minor type" is a semantic
+**                       value associated with a terminal or non-terminal
+**                       symbols.  For example, for an "ID" terminal symbol,
+**                       the minor type might be the name of the identifier.
+**                       Each non-terminal can have a different minor type.
+**                       Terminal symbols all have the same minor type, though.
+**                       This macros defines the minor type for terminal 
+**                       symbols.
+**    YYMINORTYPE        is the data type used for all minor types.
+**                       This is typically a union of many types, one of
+**                       which is ParseTOKENTYPE.  The entry in the union
+**                       for terminal symbols is called "yy0".
+**    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
+**                       zero the stack is dynamically sized using realloc()
+**    ParseARG_SDECL     A static variable declaration for the %extra_argument
+**    ParseARG_PDECL     A parameter declaration for the %extra_argument
+**    ParseARG_PARAM     Code to pass %extra_argument as a subroutine parameter
+**    ParseARG_STORE     Code to store %extra_argument into yypParser
+**    ParseARG_FETCH     Code to extract %extra_argument from yypParser
+**    ParseCTX_*         As ParseARG_ except for %extra_context
+**    YYERRORSYMBOL      is the code number of the error symbol.  If not
+**                       defined, then do no error processing.
+**    YYNSTATE           the combined number of states.
+**    YYNRULE            the number of rules in the grammar
+**    YYNTOKEN           Number of terminal symbols
+**    YY_MAX_SHIFT       Maximum value for shift actions
+**    YY_MIN_SHIFTREDUCE Minimum value for shift-reduce actions
+**    YY_MAX_SHIFTREDUCE Maximum value for shift-reduce actions
+**    YY_ERROR_ACTION    The yy_action[] code for syntax error
+**    YY_ACCEPT_ACTION   The yy_action[] code for accept
+**    YY_NO_ACTION       The yy_action[] code for no-op
+**    YY_MIN_REDUCE      Minimum value for reduce actions
+**    YY_MAX_REDUCE      Maximum value for reduce actions
+*/
+#ifndef INTERFACE
+# define INTERFACE 1
+#endif
+/************* Begin control #defines *****************************************/
+#define YYCODETYPE unsigned char
+#define YYNOCODE 174
+#define YYACTIONTYPE unsigned short int
+#define ParseTOKENTYPE StringSegment
+typedef union {
+  int yyinit;
+  ParseTOKENTYPE yy0;
+  size_t yy43;
+  int yy349;
+} YYMINORTYPE;
+#ifndef YYSTACKDEPTH
+#define YYSTACKDEPTH 0
+#endif
+#define ParseARG_SDECL ParseInfo pinfo;
+#define ParseARG_PDECL ,ParseInfo pinfo
+#define ParseARG_PARAM ,pinfo
+#define ParseARG_FETCH ParseInfo pinfo=yypParser->pinfo;
+#define ParseARG_STORE yypParser->pinfo=pinfo;
+#define ParseCTX_SDECL
+#define ParseCTX_PDECL
+#define ParseCTX_PARAM
+#define ParseCTX_FETCH
+#define ParseCTX_STORE
+#define YYERRORSYMBOL 78
+#define YYERRSYMDT yy349
+#define YYNSTATE             192
+#define YYNRULE              270
+#define YYNRULE_WITH_ACTION  270
+#define YYNTOKEN             78
+#define YY_MAX_SHIFT         191
+#define YY_MIN_SHIFTREDUCE   429
+#define YY_MAX_SHIFTREDUCE   698
+#define YY_ERROR_ACTION      699
+#define YY_ACCEPT_ACTION     700
+#define YY_NO_ACTION         701
+#define YY_MIN_REDUCE        702
+#define YY_MAX_REDUCE        971
+/************* End control #defines *******************************************/
+#define YY_NLOOKAHEAD ((int)(sizeof(yy_lookahead)/sizeof(yy_lookahead[0])))
+
+/* Define the yytestcase() macro to be a no-op if is not already defined
+** otherwise.
+**
+** Applications can choose to define yytestcase() in the %include section
+** to a macro that can assist in verifying code coverage.  For production
+** code the yytestcase() macro should be turned off.  But it is useful
+** for testing.
+*/
+#ifndef yytestcase
+# define yytestcase(X)
+#endif
+
+
+/* Next are the tables used to determine what action to take based on the
+** current state and lookahead token.  These tables are used to implement
+** functions that take a state number and lookahead value and return an
+** action integer.  
+**
+** Suppose the action integer is N.  Then the action is determined as
+** follows
+**
+**   0 <= N <= YY_MAX_SHIFT             Shift N.  That is, push the lookahead
+**                                      token onto the stack and goto state N.
+**
+**   N between YY_MIN_SHIFTREDUCE       Shift to an arbitrary state then
+**     and YY_MAX_SHIFTREDUCE           reduce by rule N-YY_MIN_SHIFTREDUCE.
+**
+**   N == YY_ERROR_ACTION               A syntax error has occurred.
+**
+**   N == YY_ACCEPT_ACTION              The parser accepts its input.
+**
+**   N == YY_NO_ACTION                  No such action.  Denotes unused
+**                                      slots in the yy_action[] table.
+**
+**   N between YY_MIN_REDUCE            Reduce by rule N-YY_MIN_REDUCE
+**     and YY_MAX_REDUCE
+**
+** The action table is constructed as a single large table named yy_action[].
+** Given state S and lookahead X, the action is computed as either:
+**
+**    (A)   N = yy_action[ yy_shift_ofst[S] + X ]
+**    (B)   N = yy_default[S]
+**
+** The (A) formula is preferred.  The B formula is used instead if
+** yy_lookahead[yy_shift_ofst[S]+X] is not equal to X.
+**
+** The formulas above are for computing the action when the lookahead is
+** a terminal symbol.  If the lookahead is a non-terminal (as occurs after
+** a reduce action) then the yy_reduce_ofst[] array is used in place of
+** the yy_shift_ofst[] array.
+**
+** The following are the tables generated in this section:
+**
+**  yy_action[]        A single table containing all actions.
+**  yy_lookahead[]     A table containing the lookahead for each entry in
+**                     yy_action.  Used to detect hash collisions.
+**  yy_shift_ofst[]    For each state, the offset into yy_action for
+**                     shifting terminals.
+**  yy_reduce_ofst[]   For each state, the offset into yy_action for
+**                     shifting non-terminals after a reduce.
+**  yy_default[]       Default action for each state.
+**
+*********** Begin parsing tables **********************************************/
+#define YY_ACTTAB_COUNT (5311)
+static const YYACTIONTYPE yy_action[] = {
+ /*     0 */   148,  114,  859,   34,  454,  731,  700,   81,  871,   33,
+ /*    10 */   454,   78,  730,  184,  883,   32,  107,   79,  730,  184,
+ /*    20 */    31,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*    30 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*    40 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*    50 */    42,  117,  849,  474,  929,  116,  152,  128,  859,   34,
+ /*    60 */    99,   11,  177,   89,  871,   33,   67,  859,   34,  455,
+ /*    70 */   883,   32,   23,  871,   33,  148,   31,  729,  184,  883,
+ /*    80 */    32,  112,   13,   12,    8,   31,  432,  483,  942,  937,
+ /*    90 */     5,   71,  447,  448,  449,  955,   62,  131,  802,   72,
+ /*   100 */    60,  814,  129,   57,  127,  812,   55,  126,  817,   53,
+ /*   110 */   125,  822,   52,  834,  124,   49,  120,  832,   47,  119,
+ /*   120 */   837,   46,  180,  118,  851,   42,  117,  849,  507,  929,
+ /*   130 */   116,   27,  128,  859,   34,  858,   34,  177,  113,  871,
+ /*   140 */    33,  871,   33,  144,  781,  883,   32,  883,   32,  454,
+ /*   150 */   148,   31,  191,   31,  440,  704,   80,  730,  184,   95,
+ /*   160 */   186,   97,  132,  941,  937,    5,  595,  865,  597,   35,
+ /*   170 */   955,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*   180 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*   190 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*   200 */    42,  117,  849,  509,  929,  116,  111,  128,  859,   34,
+ /*   210 */   607,  133,  177,  113,  871,   33,  130,  859,   34,  783,
+ /*   220 */   883,   32,  151,  871,   33,  105,   31,  619,  134,  883,
+ /*   230 */    32,  872,   36,  896,   38,   31,  884,   37,  936,  937,
+ /*   240 */     5,  652,   92,  432,  692,  955,   62,  131,  802,   72,
+ /*   250 */    60,  814,  129,   57,  127,  812,   55,  126,  817,   53,
+ /*   260 */   125,  822,   52,  834,  124,   49,  120,  832,   47,  119,
+ /*   270 */   837,   46,  180,  118,  851,   42,  117,  849,  155,  929,
+ /*   280 */   116,  172,  128,  859,   34,  108,  158,  932,  460,  871,
+ /*   290 */    33,  432,  477,   39,  654,  883,   32,  160,  626,  148,
+ /*   300 */   628,   31,  485,  461,  462,  463,  464,  465,  466,  467,
+ /*   310 */   468,  469,  470,  471,  472,   17,    2,  161,  943,  616,
+ /*   320 */    62,  131,  802,   72,   60,  814,  129,   57,  127,  812,
+ /*   330 */    55,  126,  817,   53,  125,  822,   52,  834,  124,   49,
+ /*   340 */   120,  832,   47,  119,  837,   46,  180,  118,  851,   42,
+ /*   350 */   117,  849,  164,  929,  116,  183,  128,  859,   34,  110,
+ /*   360 */   673,  177,  944,  871,   33,  615,    1,  621,  620,  883,
+ /*   370 */    32,  432,  438,  187,  168,   31,  170,   98,  447,  448,
+ /*   380 */   449,  432,  435,   74,  504,   77,  189,  167,  938,  185,
+ /*   390 */   188,  447,  448,  449,  956,   62,  131,  802,   72,   60,
+ /*   400 */   814,  129,   57,  127,  812,   55,  126,  817,   53,  125,
+ /*   410 */   822,   52,  834,  124,   49,  120,  832,   47,  119,  837,
+ /*   420 */    46,  180,  118,  851,   42,  117,  849,  520,  929,  116,
+ /*   430 */   514,  128,  859,   34,  502,  479,  935,  694,  871,   33,
+ /*   440 */    18,  491,   94,   19,  883,   32,  688,  102,  168,  169,
+ /*   450 */    31,   82,  106,  506,   20,  653,  451,  452,   15,   21,
+ /*   460 */   495,  167,   29,   65,  684,  641,  666,  171,  950,   62,
+ /*   470 */   131,  802,   72,   60,  814,  129,   57,  127,  812,   55,
+ /*   480 */   126,  817,   53,  125,  822,   52,  834,  124,   49,  120,
+ /*   490 */   832,   47,  119,  837,   46,  180,  118,  851,   42,  117,
+ /*   500 */   849,  174,  929,  116,   75,  128,  859,   34,  655,   16,
+ /*   510 */   935,  640,  871,   33,  182,   76,  584,    6,  883,   32,
+ /*   520 */   476,   30,   73,  156,   31,  579,   41,  574,   43,  567,
+ /*   530 */    45,   48,  562,  557,   50,  639,  911,  432,  552,  910,
+ /*   540 */   153,  100,  949,   51,   62,  131,  802,   72,   60,  814,
+ /*   550 */   129,   57,  127,  812,   55,  126,  817,   53,  125,  822,
+ /*   560 */    52,  834,  124,   49,  120,  832,   47,  119,  837,   46,
+ /*   570 */   180,  118,  851,   42,  117,  849,  547,  929,  116,   54,
+ /*   580 */   128,  859,   34,  542,  496,  932,   56,  871,   33,  537,
+ /*   590 */    58,  532,   59,  883,   32,  527,  770,  139,  145,   31,
+ /*   600 */   140,  141,   63,  176,  142,   62,  131,  802,   72,   60,
+ /*   610 */   814,  129,   57,  127,  812,   55,  126,  817,   53,  125,
+ /*   620 */   822,   52,  834,  124,   49,  120,  832,   47,  119,  837,
+ /*   630 */    46,  180,  118,  851,   42,  117,  849,  143,  929,  116,
+ /*   640 */   488,  128,  859,   34,  190,  486,  933,  484,  871,   33,
+ /*   650 */    64,  523,  521,  519,  883,   32,  517,   96,  515,  513,
+ /*   660 */    31,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*   670 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*   680 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*   690 */    42,  117,  849,  505,  929,  116,  503,  128,  859,   34,
+ /*   700 */   501,  494,  932,  492,  871,   33,  159,  490,  588,  681,
+ /*   710 */   883,   32,  680,  696,    7,  695,   31,  693,  691,  689,
+ /*   720 */   687,  149,   24,  101,  916,  685,  667,   62,  131,  802,
+ /*   730 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*   740 */    53,  125,  822,   52,  834,  124,   49,  120,  832,   47,
+ /*   750 */   119,  837,   46,  180,  118,  851,   42,  117,  849,   44,
+ /*   760 */   929,  116,  162,  128,  859,   34,   25,  482,  932,  480,
+ /*   770 */   871,   33,  478,   93,  103,  442,  883,   32,  441,  439,
+ /*   780 */   437,  436,   31,   62,  131,  802,   72,   60,  814,  129,
+ /*   790 */    57,  127,  812,   55,  126,  817,   53,  125,  822,   52,
+ /*   800 */   834,  124,   49,  120,  832,   47,  119,  837,   46,  180,
+ /*   810 */   118,  851,   42,  117,  849,  434,  929,  116,  165,  128,
+ /*   820 */   859,   34,  433,  701,  933,  701,  871,   33,  701,  701,
+ /*   830 */   104,  701,  883,   32,  701,  701,  701,  701,   31,   62,
+ /*   840 */   131,  802,   72,   60,  814,  129,   57,  127,  812,   55,
+ /*   850 */   126,  817,   53,  125,  822,   52,  834,  124,   49,  120,
+ /*   860 */   832,   47,  119,  837,   46,  180,  118,  851,   42,  117,
+ /*   870 */   849,  701,  929,  116,  175,  128,  859,   34,  701,  701,
+ /*   880 */   933,  701,  871,   33,  701,  701,  701,  701,  883,   32,
+ /*   890 */   701,  109,  701,  701,   31,   62,  131,  802,   72,   60,
+ /*   900 */   814,  129,   57,  127,  812,   55,  126,  817,   53,  125,
+ /*   910 */   822,   52,  834,  124,   49,  120,  832,   47,  119,  837,
+ /*   920 */    46,  180,  118,  851,   42,  117,  849,  701,  929,  116,
+ /*   930 */   498,  128,  859,   34,  701,  701,  932,  701,  871,   33,
+ /*   940 */   701,  701,  772,  701,  883,   32,  701,  701,  701,  701,
+ /*   950 */    31,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*   960 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*   970 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*   980 */    42,  117,  849,  701,  929,  116,  701,  128,  859,   34,
+ /*   990 */   701,  701,  933,  701,  871,   33,  701,  701,  701,  701,
+ /*  1000 */   883,   32,  701,   96,  701,  701,   31,   62,  131,  802,
+ /*  1010 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*  1020 */    53,  125,  822,   52,  834,  124,   49,  120,  832,   47,
+ /*  1030 */   119,  837,   46,  180,  118,  851,   42,  117,  849,  701,
+ /*  1040 */   929,  116,  701,  128,  859,   34,  701,  701,  932,  701,
+ /*  1050 */   871,   33,  701,  701,  701,  701,  883,   32,  701,  701,
+ /*  1060 */   701,  701,   31,  150,  701,  701,  701,  701,  701,  701,
+ /*  1070 */   915,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*  1080 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*  1090 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*  1100 */    42,  117,  849,  701,  929,  116,  701,  128,  859,   34,
+ /*  1110 */   701,  701,  935,  701,  871,   33,  701,  701,  701,  154,
+ /*  1120 */   883,   32,  701,  701,  701,  701,   31,   62,  131,  802,
+ /*  1130 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*  1140 */    53,  125,  822,   52,  834,  124,   49,  120,  832,   47,
+ /*  1150 */   119,  837,   46,  180,  118,  851,   42,  117,  849,  701,
+ /*  1160 */   929,  116,  701,  128,  859,   34,  701,  701,  935,  701,
+ /*  1170 */   871,   33,  701,  701,  701,  157,  883,   32,  701,  701,
+ /*  1180 */   701,  701,   31,   62,  131,  802,   72,   60,  814,  129,
+ /*  1190 */    57,  127,  812,   55,  126,  817,   53,  125,  822,   52,
+ /*  1200 */   834,  124,   49,  120,  832,   47,  119,  837,   46,  180,
+ /*  1210 */   118,  851,   42,  117,  849,  701,  929,  116,  701,  128,
+ /*  1220 */   859,   34,  701,  701,  935,  701,  871,   33,  701,  701,
+ /*  1230 */   163,  701,  883,   32,  701,  701,  701,  701,   31,   62,
+ /*  1240 */   131,  802,   72,   60,  814,  129,   57,  127,  812,   55,
+ /*  1250 */   126,  817,   53,  125,  822,   52,  834,  124,   49,  120,
+ /*  1260 */   832,   47,  119,  837,   46,  180,  118,  851,   42,  117,
+ /*  1270 */   849,  701,  929,  116,  701,  128,  859,   34,  701,  701,
+ /*  1280 */   933,  701,  871,   33,  701,  701,  701,  173,  883,   32,
+ /*  1290 */   701,  701,  701,  701,   31,   62,  131,  802,   72,   60,
+ /*  1300 */   814,  129,   57,  127,  812,   55,  126,  817,   53,  125,
+ /*  1310 */   822,   52,  834,  124,   49,  120,  832,   47,  119,  837,
+ /*  1320 */    46,  180,  118,  851,   42,  117,  849,  701,  929,  116,
+ /*  1330 */   701,  128,  859,   34,  701,  701,  935,  701,  871,   33,
+ /*  1340 */   701,  701,  701,  922,  883,   32,  701,  701,  701,  701,
+ /*  1350 */    31,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*  1360 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*  1370 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*  1380 */    42,  117,  849,  701,  929,  116,  701,  128,  859,   34,
+ /*  1390 */   701,  701,  935,  701,  871,   33,  701,  701,  701,  948,
+ /*  1400 */   883,   32,  701,  701,  701,  701,   31,   62,  131,  802,
+ /*  1410 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*  1420 */    53,  125,  822,   52,  834,  124,   49,  120,  832,   47,
+ /*  1430 */   119,  837,   46,  180,  118,  851,   42,  117,  849,  701,
+ /*  1440 */   929,  116,  701,  128,  859,   34,  701,  701,  935,  701,
+ /*  1450 */   871,   33,  701,  701,  701,  931,  883,   32,  701,  701,
+ /*  1460 */   701,  701,   31,   62,  131,  802,   72,   60,  814,  129,
+ /*  1470 */    57,  127,  812,   55,  126,  817,   53,  125,  822,   52,
+ /*  1480 */   834,  124,   49,  120,  832,   47,  119,  837,   46,  180,
+ /*  1490 */   118,  851,   42,  117,  849,  701,  929,  116,  701,  128,
+ /*  1500 */   859,   34,  701,  701,  935,  701,  871,   33,  701,  701,
+ /*  1510 */   701,  178,  883,   32,  701,  701,  701,  701,   31,   62,
+ /*  1520 */   131,  802,   72,   60,  814,  129,   57,  127,  812,   55,
+ /*  1530 */   126,  817,   53,  125,  822,   52,  834,  124,   49,  120,
+ /*  1540 */   832,   47,  119,  837,   46,  180,  118,  851,   42,  117,
+ /*  1550 */   849,  701,  929,  116,  701,  128,  859,   34,  701,  701,
+ /*  1560 */   935,  701,  871,   33,  701,  701,  701,  179,  883,   32,
+ /*  1570 */   701,  701,  701,  701,   31,   62,  131,  802,   72,   60,
+ /*  1580 */   814,  129,   57,  127,  812,   55,  126,  817,   53,  125,
+ /*  1590 */   822,   52,  834,  124,   49,  120,  832,   47,  119,  837,
+ /*  1600 */    46,  180,  118,  851,   42,  117,  849,  701,  929,  116,
+ /*  1610 */   701,  128,  859,   34,  701,  701,  935,  701,  871,   33,
+ /*  1620 */   701,  701,  701,  917,  883,   32,  701,  701,  701,  701,
+ /*  1630 */    31,   62,  131,  802,   72,   60,  814,  129,   57,  127,
+ /*  1640 */   812,   55,  126,  817,   53,  125,  822,   52,  834,  124,
+ /*  1650 */    49,  120,  832,   47,  119,  837,   46,  180,  118,  851,
+ /*  1660 */    42,  117,  849,  701,  929,  116,  701,  128,  859,   34,
+ /*  1670 */   701,  701,  935,  701,  871,   33,  701,  701,  701,  166,
+ /*  1680 */   883,   32,  701,  701,  701,  701,   31,   62,  131,  802,
+ /*  1690 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*  1700 */    53,  125,  822,   52,  834,  124,   49,  120,  832,   47,
+ /*  1710 */   119,  837,   46,  180,  118,  851,   42,  117,  849,  701,
+ /*  1720 */   929,  116,  701,  128,  859,   34,  701,  701,  935,  701,
+ /*  1730 */   871,   33,  701,  701,  181,  701,  883,   32,  701,  701,
+ /*  1740 */   701,  701,   31,   62,  131,  802,   72,   60,  814,  129,
+ /*  1750 */    57,  127,  812,   55,  126,  817,   53,  125,  822,   52,
+ /*  1760 */   834,  124,   49,  120,  832,   47,  119,  837,   46,  180,
+ /*  1770 */   118,  851,   42,  117,  849,  701,  929,  116,  701,  128,
+ /*  1780 */   859,   34,  701,  701,  933,  701,  871,   33,  701,  701,
+ /*  1790 */   784,  701,  883,   32,  701,  701,  701,  701,   31,   62,
+ /*  1800 */   131,  802,   72,   60,  814,  129,   57,  127,  812,   55,
+ /*  1810 */   126,  817,   53,  125,  822,   52,  834,  124,   49,  120,
+ /*  1820 */   832,   47,  119,  837,   46,  180,  118,  851,   42,  117,
+ /*  1830 */   849,  701,  929,  116,  701,  128,  859,   34,  701,  701,
+ /*  1840 */   933,  701,  871,   33,  701,  701,  701,  701,  883,   32,
+ /*  1850 */   701,  701,  701,  701,   31,   62,  131,  802,   72,   60,
+ /*  1860 */   814,  129,   57,  127,  812,   55,  126,  817,   53,  125,
+ /*  1870 */   822,   52,  834,  124,   49,  120,  832,   47,  119,  837,
+ /*  1880 */    46,  180,  118,  851,   42,  117,  849,  701,  929,  116,
+ /*  1890 */   701,  128,  859,   34,  701,  701,  897,  701,  871,   33,
+ /*  1900 */   701,  701,  701,  701,  883,   32,  701,  701,  701,  701,
+ /*  1910 */    31,   87,   62,  131,  802,   72,   60,  814,  129,   57,
+ /*  1920 */   127,  812,   55,  126,  817,   53,  125,  822,   52,  834,
+ /*  1930 */   124,   49,  120,  832,   47,  119,  837,   46,  180,  118,
+ /*  1940 */   851,   42,  117,  849,  701,  929,  116,  701,  128,  859,
+ /*  1950 */    34,  701,  701,  885,  701,  871,   33,  701,  701,  701,
+ /*  1960 */   701,  883,   32,   86,  701,  701,  701,   31,   62,  131,
+ /*  1970 */   802,   72,   60,  814,  129,   57,  127,  812,   55,  126,
+ /*  1980 */   817,   53,  125,  822,   52,  834,  124,   49,  120,  832,
+ /*  1990 */    47,  119,  837,   46,  180,  118,  851,   42,  117,  849,
+ /*  2000 */   701,  929,  116,  701,  128,  859,   34,  701,  701,  873,
+ /*  2010 */   701,  871,   33,   85,  701,  701,  701,  883,   32,  701,
+ /*  2020 */   701,  701,  701,   31,   62,  131,  802,   72,   60,  814,
+ /*  2030 */   129,   57,  127,  812,   55,  126,  817,   53,  125,  822,
+ /*  2040 */    52,  834,  124,   49,  120,  832,   47,  119,  837,   46,
+ /*  2050 */   180,  118,  851,   42,  117,  849,  701,  929,  116,  701,
+ /*  2060 */   128,  859,   34,   84,  701,  866,  701,  871,   33,  701,
+ /*  2070 */   701,  701,  701,  883,   32,  701,  701,  701,  701,   31,
+ /*  2080 */    62,  131,  802,   72,   60,  814,  129,   57,  127,  812,
+ /*  2090 */    55,  126,  817,   53,  125,  822,   52,  834,  124,   49,
+ /*  2100 */   120,  832,   47,  119,  837,   46,  180,  118,  851,   42,
+ /*  2110 */   117,  849,  701,  929,  116,  701,  128,  859,   34,  701,
+ /*  2120 */   701,  867,  701,  871,   33,  701,  701,  701,  701,  883,
+ /*  2130 */    32,  701,  701,  701,  701,   31,   62,  131,  802,   72,
+ /*  2140 */    60,  814,  129,   57,  127,  812,   55,  126,  817,   53,
+ /*  2150 */   125,  822,   52,  834,  124,   49,  120,  832,   47,  119,
+ /*  2160 */   837,   46,  180,  118,  851,   42,  117,  849,  701,  929,
+ /*  2170 */   116,  701,  128,  859,   34,  701,  701,  874,  701,  871,
+ /*  2180 */    33,  701,  701,  701,  701,  883,   32,  701,  701,  701,
+ /*  2190 */   701,   31,   62,  131,  802,   72,   60,  814,  129,   57,
+ /*  2200 */   127,  812,   55,  126,  817,   53,  125,  822,   52,  834,
+ /*  2210 */   124,   49,  120,  832,   47,  119,  837,   46,  180,  118,
+ /*  2220 */   851,   42,  117,  849,  701,  929,  116,  701,  128,  859,
+ /*  2230 */    34,  701,  701,  886,  701,  871,   33,  701,  701,  701,
+ /*  2240 */   701,  883,   32,  701,  701,  701,  701,   31,   62,  131,
+ /*  2250 */   802,   72,   60,  814,  129,   57,  127,  812,   55,  126,
+ /*  2260 */   817,   53,  125,  822,   52,  834,  124,   49,  120,  832,
+ /*  2270 */    47,  119,  837,   46,  180,  118,  851,   42,  117,  849,
+ /*  2280 */   701,  929,  116,  701,  128,  859,   34,  701,  701,  898,
+ /*  2290 */   701,  871,   33,  701,  701,  701,  701,  883,   32,  701,
+ /*  2300 */   701,  701,  701,   31,   62,  131,  802,   72,   60,  814,
+ /*  2310 */   129,   57,  127,  812,   55,  126,  817,   53,  125,  822,
+ /*  2320 */    52,  834,  124,   49,  120,  832,   47,  119,  837,   46,
+ /*  2330 */   180,  118,  851,   42,  117,  849,  701,  929,  116,  701,
+ /*  2340 */   128,  859,   34,  701,  701,  147,  701,  871,   33,  701,
+ /*  2350 */   701,  701,  701,  883,   32,  701,  701,  701,  701,   31,
+ /*  2360 */    62,  131,  802,   72,   60,  814,  129,   57,  127,  812,
+ /*  2370 */    55,  126,  817,   53,  125,  822,   52,  834,  124,   49,
+ /*  2380 */   120,  832,   47,  119,  837,   46,  180,  118,  851,   42,
+ /*  2390 */   117,  849,  701,  929,  116,  701,  128,  859,   34,  701,
+ /*  2400 */   701,  930,  701,  871,   33,  701,  701,  701,  701,  883,
+ /*  2410 */    32,  701,  701,  701,  701,   31,   62,  131,  802,   72,
+ /*  2420 */    60,  814,  129,   57,  127,  812,   55,  126,  817,   53,
+ /*  2430 */   125,  822,   52,  834,  124,   49,  120,  832,   47,  119,
+ /*  2440 */   837,   46,  180,  118,  851,   42,  117,  849,  701,  853,
+ /*  2450 */   116,  701,  128,  859,   34,  701,  701,  701,  701,  871,
+ /*  2460 */    33,  701,  701,  701,  701,  883,   32,  701,  701,  701,
+ /*  2470 */   701,   31,   62,  131,  802,   72,   60,  814,  129,   57,
+ /*  2480 */   127,  812,   55,  126,  817,   53,  125,  822,   52,  834,
+ /*  2490 */   124,   49,  120,  832,   47,  119,  837,   46,  180,  118,
+ /*  2500 */   851,   42,  701,  850,   73,  121,  859,   34,  128,  859,
+ /*  2510 */    34,  701,  871,   33,  616,  871,   33,  701,  883,   32,
+ /*  2520 */   701,  883,   32,  701,   31,  701,  701,   31,   62,  131,
+ /*  2530 */   802,   72,   60,  814,  129,   57,  127,  812,   55,  126,
+ /*  2540 */   817,   53,  125,  822,   52,  834,  124,   49,  120,  832,
+ /*  2550 */    47,  119,  837,   46,  180,  118,  851,   42,  701,  848,
+ /*  2560 */   615,  701,  617,  618,  128,  859,   34,  701,  701,  701,
+ /*  2570 */   701,  871,   33,  604,  701,  701,  701,  883,   32,  701,
+ /*  2580 */   701,  701,  701,   31,   62,  131,  802,   72,   60,  814,
+ /*  2590 */   129,   57,  127,  812,   55,  126,  817,   53,  125,  822,
+ /*  2600 */    52,  834,  124,   49,  120,  832,   47,  119,  837,   46,
+ /*  2610 */   180,  118,  845,  603,  701,  609,  608,  701,  701,  701,
+ /*  2620 */   128,  859,   34,  701,  701,  701,  701,  871,   33,  604,
+ /*  2630 */   701,  701,  701,  883,   32,  701,   66,  701,  701,   31,
+ /*  2640 */    62,  131,  802,   72,   60,  814,  129,   57,  127,  812,
+ /*  2650 */    55,  126,  817,   53,  125,  822,   52,  834,  124,   49,
+ /*  2660 */   120,  832,   47,  119,  837,   46,  841,  118,  701,  603,
+ /*  2670 */   701,  605,  606,  115,  859,   34,  128,  859,   34,  701,
+ /*  2680 */   871,   33,  701,  871,   33,  701,  883,   32,  701,  883,
+ /*  2690 */    32,  587,   31,  135,  701,   31,   88,  701,  589,  146,
+ /*  2700 */    14,  701,  921,  924,  701,  701,  701,  527,  532,  537,
+ /*  2710 */   542,  547,  552,  557,  562,  567,  574,  701,  701,  701,
+ /*  2720 */   701,  701,  701,  701,   69,   28,  701,  590,  591,  701,
+ /*  2730 */   596,  701,  701,  137,  701,  701,  701,  701,  701,  136,
+ /*  2740 */   701,  701,  701,  701,  622,  701,  627,  701,  629,  630,
+ /*  2750 */   631,  632,  633,  634,  123,  122,   70,   26,  701,  701,
+ /*  2760 */   701,    4,   62,  131,  802,   72,   60,  814,  129,   57,
+ /*  2770 */   127,  812,   55,  126,  817,   53,  125,  822,   52,  834,
+ /*  2780 */   124,   49,  120,  832,   47,  119,  837,   46,  701,  843,
+ /*  2790 */   701,  701,  701,  701,  701,  701,  701,  701,  128,  859,
+ /*  2800 */    34,  701,  701,  701,  701,  871,   33,  587,  169,  701,
+ /*  2810 */   701,  883,   32,  701,  589,  701,  701,   31,  701,  701,
+ /*  2820 */   701,  701,  701,  527,  532,  537,  542,  547,  552,  557,
+ /*  2830 */   562,  567,  574,  701,  701,  701,  701,  701,  701,  701,
+ /*  2840 */    69,   28,  701,  590,  591,  701,  596,  702,  701,  137,
+ /*  2850 */   701,  701,  701,  701,  701,  136,  138,  701,   91,   90,
+ /*  2860 */   622,  701,  627,  701,  629,  630,  631,  632,  633,  634,
+ /*  2870 */   123,  122,   70,   26,  701,  701,    6,  587,  679,    3,
+ /*  2880 */   701,  474,  701,   83,  589,  701,  701,  701,  701,  701,
+ /*  2890 */   701,  701,  701,  527,  532,  537,  542,  547,  552,  557,
+ /*  2900 */   562,  567,  574,  701,  701,  701,  701,  701,  701,  701,
+ /*  2910 */    69,   28,  701,  590,  591,  701,  596,  701,  701,  137,
+ /*  2920 */   701,  701,  701,  701,  701,  136,  701,  701,  701,  701,
+ /*  2930 */   622,  701,  627,  701,  629,  630,  631,  632,  633,  634,
+ /*  2940 */   123,  122,   70,   26,  587,  487,    3,  701,  701,  701,
+ /*  2950 */   701,  589,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  2960 */   527,  532,  537,  542,  547,  552,  557,  562,  567,  574,
+ /*  2970 */   701,  701,  701,  701,  701,  701,  701,   69,   28,  701,
+ /*  2980 */   590,  591,  701,  596,  701,  701,  137,  701,  701,  701,
+ /*  2990 */   701,  701,  136,  701,  701,  701,  701,  622,  701,  627,
+ /*  3000 */   701,  629,  630,  631,  632,  633,  634,  123,  122,   70,
+ /*  3010 */    26,  587,  522,    3,  701,  701,  701,  701,  589,  701,
+ /*  3020 */   701,  701,  701,  701,  701,  701,  701,  527,  532,  537,
+ /*  3030 */   542,  547,  552,  557,  562,  567,  574,  701,  701,  701,
+ /*  3040 */   701,  701,  701,  701,   69,   28,  701,  590,  591,  701,
+ /*  3050 */   596,  701,  701,  137,  701,  701,  701,  701,  701,  136,
+ /*  3060 */   701,  701,  701,  701,  622,  701,  627,  701,  629,  630,
+ /*  3070 */   631,  632,  633,  634,  123,  122,   70,   26,  587,  516,
+ /*  3080 */     3,  701,  701,  701,  701,  589,  701,  701,  701,  701,
+ /*  3090 */   701,  701,  701,  701,  527,  532,  537,  542,  547,  552,
+ /*  3100 */   557,  562,  567,  574,  701,  701,  701,  701,  701,  701,
+ /*  3110 */   701,   69,   28,  701,  590,  591,  701,  596,  701,  701,
+ /*  3120 */   137,  701,  701,  701,  701,  701,  136,  701,  701,  701,
+ /*  3130 */   701,  622,  701,  627,  701,  629,  630,  631,  632,  633,
+ /*  3140 */   634,  123,  122,   70,   26,  587,  493,    9,  701,  701,
+ /*  3150 */   701,  701,  589,  701,  701,  701,  701,  701,  701,  701,
+ /*  3160 */   701,  527,  532,  537,  542,  547,  552,  557,  562,  567,
+ /*  3170 */   574,  701,  701,  701,  701,  701,  701,  701,   69,   28,
+ /*  3180 */   701,  590,  591,  701,  596,  701,  701,  137,  701,  701,
+ /*  3190 */   701,  701,  701,  136,  701,  701,  701,  701,  622,  701,
+ /*  3200 */   627,  701,  629,  630,  631,  632,  633,  634,  123,  122,
+ /*  3210 */    70,   26,  587,  690,    3,  701,  701,  701,  701,  589,
+ /*  3220 */   701,  701,  701,  701,  701,  701,  701,  701,  527,  532,
+ /*  3230 */   537,  542,  547,  552,  557,  562,  567,  574,  701,  701,
+ /*  3240 */   701,  701,  701,  701,  701,   69,   28,  701,  590,  591,
+ /*  3250 */   701,  596,  701,  701,  137,  701,  701,  701,  701,  701,
+ /*  3260 */   136,  701,  701,  701,  701,  622,  701,  627,  701,  629,
+ /*  3270 */   630,  631,  632,  633,  634,  123,  122,   70,   26,  587,
+ /*  3280 */   518,  701,  701,  701,  701,  701,  589,  701,  701,  701,
+ /*  3290 */   701,  701,  701,  701,  701,  527,  532,  537,  542,  547,
+ /*  3300 */   552,  557,  562,  567,  574,  701,  701,  701,  701,  701,
+ /*  3310 */   701,  701,   69,   28,  701,  590,  591,  701,  596,  701,
+ /*  3320 */   701,  137,  701,  701,  701,  701,  701,  136,  701,  701,
+ /*  3330 */   701,  701,  622,  701,  627,  701,  629,  630,  631,  632,
+ /*  3340 */   633,  634,  123,  122,   70,   26,  587,  512,  701,  701,
+ /*  3350 */   701,  701,  701,  589,  701,  701,  701,  701,  701,  701,
+ /*  3360 */   701,  701,  527,  532,  537,  542,  547,  552,  557,  562,
+ /*  3370 */   567,  574,  701,  701,  701,  701,  701,  701,  701,   69,
+ /*  3380 */    28,  701,  590,  591,  701,  596,  701,  701,  137,  701,
+ /*  3390 */   701,  701,  701,  701,  136,  701,  701,  701,  701,  622,
+ /*  3400 */   701,  627,  701,  629,  630,  631,  632,  633,  634,  123,
+ /*  3410 */   122,   70,   26,  587,  500,  701,  701,  701,  701,  701,
+ /*  3420 */   589,  701,  701,  701,  701,  701,  701,  701,  701,  527,
+ /*  3430 */   532,  537,  542,  547,  552,  557,  562,  567,  574,  701,
+ /*  3440 */   701,  701,  701,  701,  701,  701,   69,   28,  701,  590,
+ /*  3450 */   591,  701,  596,  701,  701,  137,  701,  701,  701,  701,
+ /*  3460 */   701,  136,  701,  701,  701,  701,  622,  701,  627,  701,
+ /*  3470 */   629,  630,  631,  632,  633,  634,  123,  122,   70,   26,
+ /*  3480 */   587,  489,  701,  701,  701,  701,  701,  589,  701,  701,
+ /*  3490 */   701,  701,  701,  701,  701,  701,  527,  532,  537,  542,
+ /*  3500 */   547,  552,  557,  562,  567,  574,  701,  701,  701,  701,
+ /*  3510 */   701,  701,  701,   69,   28,  701,  590,  591,  701,  596,
+ /*  3520 */   701,  701,  137,  701,  701,  701,  701,  701,  136,  701,
+ /*  3530 */   701,  701,  701,  622,  701,  627,  701,  629,  630,  631,
+ /*  3540 */   632,  633,  634,  123,  122,   70,   26,  587,  686,  701,
+ /*  3550 */   701,  701,  701,  701,  589,  701,  701,  701,  701,  701,
+ /*  3560 */   701,  701,  701,  527,  532,  537,  542,  547,  552,  557,
+ /*  3570 */   562,  567,  574,  701,  701,  701,  701,  701,  701,  701,
+ /*  3580 */    69,   28,  701,  590,  591,  701,  596,  701,  701,  137,
+ /*  3590 */   701,  701,  701,  701,  701,  136,  701,  701,  701,  701,
+ /*  3600 */   622,  701,  627,  701,  629,  630,  631,  632,  633,  634,
+ /*  3610 */   123,  122,   70,   26,  587,  701,    3,  701,  701,  701,
+ /*  3620 */   701,  589,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  3630 */   527,  532,  537,  542,  547,  552,  557,  562,  567,  574,
+ /*  3640 */   701,  701,  701,  701,  701,  701,  701,   69,   28,  701,
+ /*  3650 */   590,  591,  701,  596,  701,  701,  137,  701,  701,  701,
+ /*  3660 */   701,  701,  136,  701,  701,  701,  701,  622,  701,  627,
+ /*  3670 */   701,  629,  630,  631,  632,  633,  634,  123,  122,   70,
+ /*  3680 */    26,  587,  481,  701,  701,  701,  701,  701,  589,  701,
+ /*  3690 */   701,  701,  701,  701,  701,  701,  701,  527,  532,  537,
+ /*  3700 */   542,  547,  552,  557,  562,  567,  574,  701,  701,  701,
+ /*  3710 */   701,  701,  701,  701,   69,   28,  701,  590,  591,  701,
+ /*  3720 */   596,  701,  701,  137,  701,  701,  701,  701,  701,  136,
+ /*  3730 */   701,  701,  701,  701,  622,  701,  627,  701,  629,  630,
+ /*  3740 */   631,  632,  633,  634,  123,  122,   70,   26,   62,  131,
+ /*  3750 */   802,   72,   60,  814,  129,   57,  127,  812,   55,  126,
+ /*  3760 */   817,   53,  125,  822,   52,  834,  124,   49,  120,  832,
+ /*  3770 */    47,  701,  838,  701,  701,  701,  701,  701,  701,  701,
+ /*  3780 */   701,  701,  701,  701,  128,  859,   34,  701,  701,  701,
+ /*  3790 */   701,  871,   33,  701,  701,  701,  701,  883,   32,  701,
+ /*  3800 */   701,  701,  701,   31,   62,  131,  802,   72,   60,  814,
+ /*  3810 */   129,   57,  127,  812,   55,  126,  817,   53,  125,  822,
+ /*  3820 */    52,  834,  124,   49,  120,  832,   47,  701,  836,  701,
+ /*  3830 */   701,  701,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  3840 */   128,  859,   34,  701,  701,  701,  701,  871,   33,  587,
+ /*  3850 */   701,  701,  701,  883,   32,  701,  589,  701,  701,   31,
+ /*  3860 */   701,  701,  701,  701,  701,  527,  532,  537,  542,  547,
+ /*  3870 */   552,  557,  562,  567,  574,  701,  701,  701,  701,  701,
+ /*  3880 */   701,  701,   69,   28,  701,  590,  591,  701,  596,  701,
+ /*  3890 */   701,  137,  701,  701,  701,  701,  701,  136,  701,  701,
+ /*  3900 */   701,  701,  622,  701,  627,  701,  629,  630,  631,  632,
+ /*  3910 */   633,  634,  123,  122,   70,   26,  587,  701,  701,  701,
+ /*  3920 */   701,  701,  701,  589,  701,  701,  701,  701,  701,  701,
+ /*  3930 */   701,  701,  527,  532,  537,  542,  547,  552,  557,  562,
+ /*  3940 */   567,  574,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  3950 */    28,  701,  590,  591,  701,  596,  701,  701,  137,  701,
+ /*  3960 */   701,  701,  701,  701,  136,  701,  701,  701,  701,  622,
+ /*  3970 */   701,  627,  701,  629,  630,  631,  632,  633,  634,  123,
+ /*  3980 */   122,   70,   62,  131,  802,   72,   60,  814,  129,   57,
+ /*  3990 */   127,  812,   55,  126,  817,   53,  125,  822,   52,  834,
+ /*  4000 */   124,   49,  701,  833,  701,  701,  701,  701,  701,  701,
+ /*  4010 */   701,  701,  701,  701,  701,  701,  701,  701,  128,  859,
+ /*  4020 */    34,  701,  701,  701,  701,  871,   33,  701,  701,  701,
+ /*  4030 */   701,  883,   32,  701,  701,  701,  701,   31,   62,  131,
+ /*  4040 */   802,   72,   60,  814,  129,   57,  127,  812,   55,  126,
+ /*  4050 */   817,   53,  125,  822,   52,  834,  124,   49,  701,  831,
+ /*  4060 */   701,  701,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  4070 */   701,  701,  701,  701,  128,  859,   34,  701,  701,  701,
+ /*  4080 */   701,  871,   33,  587,  701,  701,  701,  883,   32,  701,
+ /*  4090 */   589,  701,  701,   31,  701,  701,  701,  701,  701,  527,
+ /*  4100 */   532,  537,  542,  547,  552,  557,  562,  567,  701,  701,
+ /*  4110 */   701,  701,  701,  701,  701,  701,  701,   28,  701,  590,
+ /*  4120 */   591,  701,  596,  701,  701,  137,  701,  701,  701,  701,
+ /*  4130 */   701,  136,  701,  701,  701,  701,  622,  701,  627,  701,
+ /*  4140 */   629,  630,  631,  632,  633,  634,  123,  122,   70,  587,
+ /*  4150 */   701,  701,  701,  701,  701,  701,  589,  701,  701,  701,
+ /*  4160 */   701,  701,  701,  701,  701,  527,  532,  537,  542,  547,
+ /*  4170 */   552,  557,  562,  701,  701,  701,  701,  701,  701,  701,
+ /*  4180 */   701,  701,  701,   28,  701,  590,  591,  701,  596,  701,
+ /*  4190 */   701,  137,  701,  701,  701,  701,  701,  136,  701,  701,
+ /*  4200 */   798,   68,  622,  701,  627,  701,  629,  630,  631,  632,
+ /*  4210 */   633,  634,  123,  122,   70,  701,  701,   62,  131,  802,
+ /*  4220 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*  4230 */    53,  125,  822,   52,  826,  124,  701,  701,  115,  859,
+ /*  4240 */    34,  701,  701,  701,  701,  871,   33,  701,  701,  701,
+ /*  4250 */   701,  883,   32,  128,  859,   34,  701,   31,  701,  701,
+ /*  4260 */   871,   33,  587,  701,  701,  701,  883,   32,  924,  589,
+ /*  4270 */   701,  701,   31,  701,  701,  701,  701,  701,  527,  532,
+ /*  4280 */   537,  542,  547,  552,  557,  701,  701,  701,  701,  701,
+ /*  4290 */   701,  701,  701,  701,  701,  701,   28,  701,  590,  591,
+ /*  4300 */   701,  596,  701,  701,  137,  701,  701,  701,  701,  701,
+ /*  4310 */   136,  701,  701,  701,  701,  622,  701,  627,   66,  629,
+ /*  4320 */   630,  631,  632,  633,  634,  123,  122,   70,   62,  131,
+ /*  4330 */   802,   72,   60,  814,  129,   57,  127,  812,   55,  126,
+ /*  4340 */   817,   53,  125,  822,   52,  701,  828,  701,  701,  701,
+ /*  4350 */   701,  701,  701,  701,  701,  115,  859,   34,  701,  701,
+ /*  4360 */   701,  701,  871,   33,  128,  859,   34,  701,  883,   32,
+ /*  4370 */   701,  871,   33,  587,   31,  701,  701,  883,   32,  701,
+ /*  4380 */   589,  701,  701,   31,  920,  924,  701,  701,  701,  527,
+ /*  4390 */   532,  537,  542,  547,  552,  701,  701,  701,  701,  701,
+ /*  4400 */   701,  701,  701,  701,  701,  701,  701,   28,  701,  590,
+ /*  4410 */   591,  701,  596,  701,  701,  137,  701,  701,  701,  701,
+ /*  4420 */   701,  136,  701,  701,  701,  701,  622,  701,  627,  701,
+ /*  4430 */   629,  630,  631,  632,  633,  634,  123,  122,   70,  587,
+ /*  4440 */   701,  701,  701,  701,  701,  701,  589,  701,  701,  701,
+ /*  4450 */   701,  701,  701,  701,  701,  527,  532,  537,  542,  547,
+ /*  4460 */   701,  701,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  4470 */   701,  701,  701,   28,  701,  590,  591,  701,  596,  701,
+ /*  4480 */   701,  137,  701,  701,  701,  701,  701,  136,  701,  701,
+ /*  4490 */   701,  701,  622,  701,  627,  701,  629,  630,  631,  632,
+ /*  4500 */   633,  634,  123,  122,   70,  701,  701,   62,  131,  802,
+ /*  4510 */    72,   60,  814,  129,   57,  127,  812,   55,  126,  817,
+ /*  4520 */    53,  701,  823,  701,  701,  701,  701,  701,  115,  859,
+ /*  4530 */    34,  701,  701,  701,  701,  871,   33,  701,  701,  701,
+ /*  4540 */   701,  883,   32,  128,  859,   34,  701,   31,  701,  701,
+ /*  4550 */   871,   33,  701,  701,  701,  701,  883,   32,  923,  701,
+ /*  4560 */   701,  701,   31,  701,  701,  701,  701,  701,  701,  701,
+ /*  4570 */   701,  701,  701,   62,  131,  802,   72,   60,  814,  129,
+ /*  4580 */    57,  127,  812,   55,  126,  817,   53,  701,  821,  701,
+ /*  4590 */   701,  701,  701,  701,  701,  701,  587,  701,  701,  701,
+ /*  4600 */   701,  701,  701,  589,  701,  701,  701,  701,  701,  128,
+ /*  4610 */   859,   34,  527,  532,  537,  542,  871,   33,  701,  701,
+ /*  4620 */   701,  701,  883,   32,  701,  701,  701,  701,   31,  701,
+ /*  4630 */    28,  701,  590,  591,  701,  596,  701,  701,  137,  701,
+ /*  4640 */   701,  701,  701,  701,  136,  701,  701,  701,  701,  622,
+ /*  4650 */   701,  627,  701,  629,  630,  631,  632,  633,  634,  123,
+ /*  4660 */   122,   70,  587,  701,  701,  701,  460,  697,  701,  589,
+ /*  4670 */   701,  701,  701,  701,  701,  701,  701,  701,  527,  532,
+ /*  4680 */   537,  461,  462,  463,  464,  465,  466,  467,  468,  469,
+ /*  4690 */   470,  471,  472,  701,  701,  701,   28,  701,  590,  591,
+ /*  4700 */   701,  596,  701,  701,  137,  701,  701,  701,  701,  701,
+ /*  4710 */   136,  701,  701,  701,  701,  622,  701,  627,  701,  629,
+ /*  4720 */   630,  631,  632,  633,  634,  123,  122,   70,  587,  701,
+ /*  4730 */   701,  460,  445,  701,  701,  589,  701,  701,  701,  701,
+ /*  4740 */   701,  701,  701,  701,  527,  532,  461,  462,  463,  464,
+ /*  4750 */   465,  466,  467,  468,  469,  470,  471,  472,  701,  701,
+ /*  4760 */   701,  701,   28,  701,  590,  591,  701,  596,  701,  701,
+ /*  4770 */   137,  701,  701,  701,  701,  701,  136,  701,  701,  701,
+ /*  4780 */   701,  622,  701,  627,  701,  629,  630,  631,  632,  633,
+ /*  4790 */   634,  123,  122,   70,  701,  701,   62,  131,  802,   72,
+ /*  4800 */    60,  814,  129,   57,  127,  812,   55,  701,  818,  701,
+ /*  4810 */   701,  701,  701,  701,  701,  701,  701,   62,  131,  802,
+ /*  4820 */    72,   60,  814,  129,   57,  127,  812,   55,  701,  816,
+ /*  4830 */   701,  701,  128,  859,   34,  701,  701,  701,  701,  871,
+ /*  4840 */    33,  587,  701,  701,  701,  883,   32,  701,  589,  701,
+ /*  4850 */   701,   31,  701,  128,  859,   34,  701,  527,  701,  701,
+ /*  4860 */   871,   33,  701,  701,  701,  701,  883,   32,  701,  701,
+ /*  4870 */   701,  701,   31,  701,  587,   28,  701,  590,  591,  701,
+ /*  4880 */   596,  589,  701,  137,  701,  701,  701,  701,  652,  136,
+ /*  4890 */   701,  701,  701,  701,  622,  701,  627,  701,  629,  630,
+ /*  4900 */   631,  632,  633,  634,  123,  122,   70,  701,   28,  701,
+ /*  4910 */   590,  591,  701,  596,  701,  701,  137,   62,  131,  802,
+ /*  4920 */    72,   60,  136,  808,  701,  701,  701,  622,  701,  627,
+ /*  4930 */   701,  629,  630,  631,  632,  633,  634,  587,  701,   10,
+ /*  4940 */    39,  654,  701,  701,  589,  701,  701,  701,  701,  701,
+ /*  4950 */   701,  701,  584,  128,  859,   34,  115,  859,   34,  701,
+ /*  4960 */   871,   33,  701,  871,   33,  701,  883,   32,  701,  883,
+ /*  4970 */    32,   28,   31,  590,  591,   31,  596,  701,  701,  137,
+ /*  4980 */   701,  701,  701,  701,   22,  136,  923,  701,  701,  701,
+ /*  4990 */   622,  701,  627,  701,  629,  630,  631,  632,  633,  634,
+ /*  5000 */    62,  131,  802,   72,   60,  814,  129,   57,  701,  813,
+ /*  5010 */    62,  131,  802,   72,   60,  814,  129,   57,  701,  811,
+ /*  5020 */   701,  701,  701,  701,  701,  701,  701,  587,  701,   61,
+ /*  5030 */   701,  701,  701,  701,  589,  701,  128,  859,   34,  701,
+ /*  5040 */   701,  701,  701,  871,   33,  701,  128,  859,   34,  883,
+ /*  5050 */    32,  701,  701,  871,   33,   31,  701,  701,  701,  883,
+ /*  5060 */    32,   28,  701,  590,  591,   31,  596,  587,  701,  137,
+ /*  5070 */   701,  701,  701,  701,  589,  136,  701,  701,  701,  701,
+ /*  5080 */   622,  701,  627,  701,  629,  630,  631,  632,  633,  634,
+ /*  5090 */   701,  701,  701,  701,   62,  131,  802,   72,   60,  806,
+ /*  5100 */   129,   28,  701,  590,  591,  701,  596,  701,  701,  137,
+ /*  5110 */   701,  701,  701,  701,  701,  136,  701,  701,  701,  701,
+ /*  5120 */   622,  701,  627,  701,  629,  630,  631,  632,  633,  634,
+ /*  5130 */   128,  859,   34,  701,  701,  460,  443,  871,   33,  701,
+ /*  5140 */   701,  701,  701,  883,   32,  701,  701,  701,  701,   31,
+ /*  5150 */   461,  462,  463,  464,  465,  466,  467,  468,  469,  470,
+ /*  5160 */   471,  472,  460,  698,  701,  701,  701,  701,  701,  701,
+ /*  5170 */   701,  701,  701,  701,  701,  701,  701,  461,  462,  463,
+ /*  5180 */   464,  465,  466,  467,  468,  469,  470,  471,  472,  460,
+ /*  5190 */   446,  701,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  5200 */   701,  701,  701,  701,  461,  462,  463,  464,  465,  466,
+ /*  5210 */   467,  468,  469,  470,  471,  472,  460,  444,  701,  701,
+ /*  5220 */    62,  701,  803,   72,   62,  701,  801,   72,  701,  701,
+ /*  5230 */   701,  461,  462,  463,  464,  465,  466,  467,  468,  469,
+ /*  5240 */   470,  471,  472,  701,  701,  701,  701,  701,  701,  701,
+ /*  5250 */   701,  701,  701,  701,  701,  701,  128,  859,   34,  701,
+ /*  5260 */   128,  859,   34,  871,   33,  701,  701,  871,   33,  883,
+ /*  5270 */    32,  701,  701,  883,   32,   31,  701,  701,  701,   31,
+ /*  5280 */   115,  859,   34,  701,  701,  701,  701,  871,   33,  701,
+ /*  5290 */   701,  701,  701,  883,   32,  701,  701,  701,  701,   31,
+ /*  5300 */   701,  701,  701,  701,  701,  701,  701,  701,  701,  701,
+ /*  5310 */    40,
+};
+static const YYCODETYPE yy_lookahead[] = {
+ /*     0 */    78,  135,  136,  137,   78,   87,   79,   80,  142,  143,
+ /*    10 */    78,   85,   86,   87,  148,  149,   83,   85,   86,   87,
+ /*    20 */   154,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*    30 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*    40 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*    50 */   128,  129,  130,   34,  132,  133,   78,  135,  136,  137,
+ /*    60 */    82,   16,  140,   18,  142,  143,  135,  136,  137,   78,
+ /*    70 */   148,  149,   21,  142,  143,   78,  154,   86,   87,  148,
+ /*    80 */   149,   83,   37,   38,   39,  154,    7,    8,  166,  167,
+ /*    90 */   168,  160,   16,   17,   18,  173,   99,  100,  101,  102,
+ /*   100 */   103,  104,  105,  106,  107,  108,  109,  110,  111,  112,
+ /*   110 */   113,  114,  115,  116,  117,  118,  119,  120,  121,  122,
+ /*   120 */   123,  124,  125,  126,  127,  128,  129,  130,   78,  132,
+ /*   130 */   133,  163,  135,  136,  137,  136,  137,  140,   88,  142,
+ /*   140 */   143,  142,  143,   93,   94,  148,  149,  148,  149,   78,
+ /*   150 */    78,  154,   78,  154,    8,   81,   85,   86,   87,   13,
+ /*   160 */    78,   15,   88,  166,  167,  168,   45,  139,   47,  141,
+ /*   170 */   173,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*   180 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*   190 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*   200 */   128,  129,  130,   78,  132,  133,   83,  135,  136,  137,
+ /*   210 */    52,   53,  140,   88,  142,  143,  135,  136,  137,   94,
+ /*   220 */   148,  149,   78,  142,  143,   78,  154,   58,   59,  148,
+ /*   230 */   149,  145,  146,  156,  157,  154,  151,  152,  166,  167,
+ /*   240 */   168,   21,   95,    7,    8,  173,   99,  100,  101,  102,
+ /*   250 */   103,  104,  105,  106,  107,  108,  109,  110,  111,  112,
+ /*   260 */   113,  114,  115,  116,  117,  118,  119,  120,  121,  122,
+ /*   270 */   123,  124,  125,  126,  127,  128,  129,  130,   78,  132,
+ /*   280 */   133,   78,  135,  136,  137,   82,   78,  140,    7,  142,
+ /*   290 */   143,    7,    8,   73,   74,  148,  149,   78,   61,   78,
+ /*   300 */    63,  154,    8,   22,   23,   24,   25,   26,   27,   28,
+ /*   310 */    29,   30,   31,   32,   33,   21,  169,   78,  171,    8,
+ /*   320 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*   330 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*   340 */   119,  120,  121,  122,  123,  124,  125,  126,  127,  128,
+ /*   350 */   129,  130,   78,  132,  133,   78,  135,  136,  137,   82,
+ /*   360 */    78,  140,  171,  142,  143,   54,  171,   56,   57,  148,
+ /*   370 */   149,    7,    8,   78,   78,  154,   14,   82,   16,   17,
+ /*   380 */    18,    7,    8,   84,    8,    9,   78,   91,  167,   14,
+ /*   390 */    82,   16,   17,   18,  173,   99,  100,  101,  102,  103,
+ /*   400 */   104,  105,  106,  107,  108,  109,  110,  111,  112,  113,
+ /*   410 */   114,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+ /*   420 */   124,  125,  126,  127,  128,  129,  130,    8,  132,  133,
+ /*   430 */     8,  135,  136,  137,    8,    8,  140,    8,  142,  143,
+ /*   440 */    21,    8,   13,   21,  148,  149,    8,   21,   78,    8,
+ /*   450 */   154,    8,  170,   10,   21,   21,   19,   20,    8,   21,
+ /*   460 */    10,   91,   35,    8,    8,   10,   10,   78,  172,   99,
+ /*   470 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
+ /*   480 */   110,  111,  112,  113,  114,  115,  116,  117,  118,  119,
+ /*   490 */   120,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*   500 */   130,   78,  132,  133,   84,  135,  136,  137,   74,    8,
+ /*   510 */   140,   10,  142,  143,   78,   84,   22,   76,  148,  149,
+ /*   520 */    15,   89,  134,   78,  154,   33,  131,   32,  128,   31,
+ /*   530 */   124,  121,   30,   29,  118,   44,  158,    7,   28,   82,
+ /*   540 */    95,   96,  172,  115,   99,  100,  101,  102,  103,  104,
+ /*   550 */   105,  106,  107,  108,  109,  110,  111,  112,  113,  114,
+ /*   560 */   115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
+ /*   570 */   125,  126,  127,  128,  129,  130,   27,  132,  133,  112,
+ /*   580 */   135,  136,  137,   26,   78,  140,  109,  142,  143,   25,
+ /*   590 */   106,   24,  103,  148,  149,   23,   90,   89,   92,  154,
+ /*   600 */   147,  153,   99,   78,  153,   99,  100,  101,  102,  103,
+ /*   610 */   104,  105,  106,  107,  108,  109,  110,  111,  112,  113,
+ /*   620 */   114,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+ /*   630 */   124,  125,  126,  127,  128,  129,  130,  147,  132,  133,
+ /*   640 */     8,  135,  136,  137,   78,    8,  140,    8,  142,  143,
+ /*   650 */    40,    8,    8,    8,  148,  149,    8,   95,    8,    8,
+ /*   660 */   154,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*   670 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*   680 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*   690 */   128,  129,  130,    8,  132,  133,    8,  135,  136,  137,
+ /*   700 */     8,    8,  140,    8,  142,  143,   78,    8,   42,    8,
+ /*   710 */   148,  149,    8,    8,   76,    8,  154,    8,    8,    8,
+ /*   720 */     8,  159,   76,   95,  162,   10,   10,   99,  100,  101,
+ /*   730 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*   740 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+ /*   750 */   122,  123,  124,  125,  126,  127,  128,  129,  130,   35,
+ /*   760 */   132,  133,   78,  135,  136,  137,   75,    8,  140,    8,
+ /*   770 */   142,  143,    8,   21,   90,    8,  148,  149,    8,    8,
+ /*   780 */     8,    8,  154,   99,  100,  101,  102,  103,  104,  105,
+ /*   790 */   106,  107,  108,  109,  110,  111,  112,  113,  114,  115,
+ /*   800 */   116,  117,  118,  119,  120,  121,  122,  123,  124,  125,
+ /*   810 */   126,  127,  128,  129,  130,   10,  132,  133,   78,  135,
+ /*   820 */   136,  137,    8,  174,  140,  174,  142,  143,  174,  174,
+ /*   830 */    90,  174,  148,  149,  174,  174,  174,  174,  154,   99,
+ /*   840 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
+ /*   850 */   110,  111,  112,  113,  114,  115,  116,  117,  118,  119,
+ /*   860 */   120,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*   870 */   130,  174,  132,  133,   78,  135,  136,  137,  174,  174,
+ /*   880 */   140,  174,  142,  143,  174,  174,  174,  174,  148,  149,
+ /*   890 */   174,   95,  174,  174,  154,   99,  100,  101,  102,  103,
+ /*   900 */   104,  105,  106,  107,  108,  109,  110,  111,  112,  113,
+ /*   910 */   114,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+ /*   920 */   124,  125,  126,  127,  128,  129,  130,  174,  132,  133,
+ /*   930 */    78,  135,  136,  137,  174,  174,  140,  174,  142,  143,
+ /*   940 */   174,  174,   90,  174,  148,  149,  174,  174,  174,  174,
+ /*   950 */   154,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*   960 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*   970 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*   980 */   128,  129,  130,  174,  132,  133,  174,  135,  136,  137,
+ /*   990 */   174,  174,  140,  174,  142,  143,  174,  174,  174,  174,
+ /*  1000 */   148,  149,  174,   95,  174,  174,  154,   99,  100,  101,
+ /*  1010 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*  1020 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+ /*  1030 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  174,
+ /*  1040 */   132,  133,  174,  135,  136,  137,  174,  174,  140,  174,
+ /*  1050 */   142,  143,  174,  174,  174,  174,  148,  149,  174,  174,
+ /*  1060 */   174,  174,  154,   91,  174,  174,  174,  174,  174,  174,
+ /*  1070 */   162,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*  1080 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*  1090 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*  1100 */   128,  129,  130,  174,  132,  133,  174,  135,  136,  137,
+ /*  1110 */   174,  174,  140,  174,  142,  143,  174,  174,  174,   91,
+ /*  1120 */   148,  149,  174,  174,  174,  174,  154,   99,  100,  101,
+ /*  1130 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*  1140 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+ /*  1150 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  174,
+ /*  1160 */   132,  133,  174,  135,  136,  137,  174,  174,  140,  174,
+ /*  1170 */   142,  143,  174,  174,  174,   91,  148,  149,  174,  174,
+ /*  1180 */   174,  174,  154,   99,  100,  101,  102,  103,  104,  105,
+ /*  1190 */   106,  107,  108,  109,  110,  111,  112,  113,  114,  115,
+ /*  1200 */   116,  117,  118,  119,  120,  121,  122,  123,  124,  125,
+ /*  1210 */   126,  127,  128,  129,  130,  174,  132,  133,  174,  135,
+ /*  1220 */   136,  137,  174,  174,  140,  174,  142,  143,  174,  174,
+ /*  1230 */    90,  174,  148,  149,  174,  174,  174,  174,  154,   99,
+ /*  1240 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
+ /*  1250 */   110,  111,  112,  113,  114,  115,  116,  117,  118,  119,
+ /*  1260 */   120,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*  1270 */   130,  174,  132,  133,  174,  135,  136,  137,  174,  174,
+ /*  1280 */   140,  174,  142,  143,  174,  174,  174,   91,  148,  149,
+ /*  1290 */   174,  174,  174,  174,  154,   99,  100,  101,  102,  103,
+ /*  1300 */   104,  105,  106,  107,  108,  109,  110,  111,  112,  113,
+ /*  1310 */   114,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+ /*  1320 */   124,  125,  126,  127,  128,  129,  130,  174,  132,  133,
+ /*  1330 */   174,  135,  136,  137,  174,  174,  140,  174,  142,  143,
+ /*  1340 */   174,  174,  174,   91,  148,  149,  174,  174,  174,  174,
+ /*  1350 */   154,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*  1360 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*  1370 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*  1380 */   128,  129,  130,  174,  132,  133,  174,  135,  136,  137,
+ /*  1390 */   174,  174,  140,  174,  142,  143,  174,  174,  174,   91,
+ /*  1400 */   148,  149,  174,  174,  174,  174,  154,   99,  100,  101,
+ /*  1410 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*  1420 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+ /*  1430 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  174,
+ /*  1440 */   132,  133,  174,  135,  136,  137,  174,  174,  140,  174,
+ /*  1450 */   142,  143,  174,  174,  174,   91,  148,  149,  174,  174,
+ /*  1460 */   174,  174,  154,   99,  100,  101,  102,  103,  104,  105,
+ /*  1470 */   106,  107,  108,  109,  110,  111,  112,  113,  114,  115,
+ /*  1480 */   116,  117,  118,  119,  120,  121,  122,  123,  124,  125,
+ /*  1490 */   126,  127,  128,  129,  130,  174,  132,  133,  174,  135,
+ /*  1500 */   136,  137,  174,  174,  140,  174,  142,  143,  174,  174,
+ /*  1510 */   174,   91,  148,  149,  174,  174,  174,  174,  154,   99,
+ /*  1520 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
+ /*  1530 */   110,  111,  112,  113,  114,  115,  116,  117,  118,  119,
+ /*  1540 */   120,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*  1550 */   130,  174,  132,  133,  174,  135,  136,  137,  174,  174,
+ /*  1560 */   140,  174,  142,  143,  174,  174,  174,   91,  148,  149,
+ /*  1570 */   174,  174,  174,  174,  154,   99,  100,  101,  102,  103,
+ /*  1580 */   104,  105,  106,  107,  108,  109,  110,  111,  112,  113,
+ /*  1590 */   114,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+ /*  1600 */   124,  125,  126,  127,  128,  129,  130,  174,  132,  133,
+ /*  1610 */   174,  135,  136,  137,  174,  174,  140,  174,  142,  143,
+ /*  1620 */   174,  174,  174,   91,  148,  149,  174,  174,  174,  174,
+ /*  1630 */   154,   99,  100,  101,  102,  103,  104,  105,  106,  107,
+ /*  1640 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*  1650 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*  1660 */   128,  129,  130,  174,  132,  133,  174,  135,  136,  137,
+ /*  1670 */   174,  174,  140,  174,  142,  143,  174,  174,  174,   91,
+ /*  1680 */   148,  149,  174,  174,  174,  174,  154,   99,  100,  101,
+ /*  1690 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*  1700 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+ /*  1710 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  174,
+ /*  1720 */   132,  133,  174,  135,  136,  137,  174,  174,  140,  174,
+ /*  1730 */   142,  143,  174,  174,   90,  174,  148,  149,  174,  174,
+ /*  1740 */   174,  174,  154,   99,  100,  101,  102,  103,  104,  105,
+ /*  1750 */   106,  107,  108,  109,  110,  111,  112,  113,  114,  115,
+ /*  1760 */   116,  117,  118,  119,  120,  121,  122,  123,  124,  125,
+ /*  1770 */   126,  127,  128,  129,  130,  174,  132,  133,  174,  135,
+ /*  1780 */   136,  137,  174,  174,  140,  174,  142,  143,  174,  174,
+ /*  1790 */    90,  174,  148,  149,  174,  174,  174,  174,  154,   99,
+ /*  1800 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
+ /*  1810 */   110,  111,  112,  113,  114,  115,  116,  117,  118,  119,
+ /*  1820 */   120,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*  1830 */   130,  174,  132,  133,  174,  135,  136,  137,  174,  174,
+ /*  1840 */   140,  174,  142,  143,  174,  174,  174,  174,  148,  149,
+ /*  1850 */   174,  174,  174,  174,  154,   99,  100,  101,  102,  103,
+ /*  1860 */   104,  105,  106,  107,  108,  109,  110,  111,  112,  113,
+ /*  1870 */   114,  115,  116,  117,  118,  119,  120,  121,  122,  123,
+ /*  1880 */   124,  125,  126,  127,  128,  129,  130,  174,  132,  133,
+ /*  1890 */   174,  135,  136,  137,  174,  174,  140,  174,  142,  143,
+ /*  1900 */   174,  174,  174,  174,  148,  149,  174,  174,  174,  174,
+ /*  1910 */   154,  155,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  1920 */   107,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  1930 */   117,  118,  119,  120,  121,  122,  123,  124,  125,  126,
+ /*  1940 */   127,  128,  129,  130,  174,  132,  133,  174,  135,  136,
+ /*  1950 */   137,  174,  174,  140,  174,  142,  143,  174,  174,  174,
+ /*  1960 */   174,  148,  149,  150,  174,  174,  174,  154,   99,  100,
+ /*  1970 */   101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+ /*  1980 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  1990 */   121,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  2000 */   174,  132,  133,  174,  135,  136,  137,  174,  174,  140,
+ /*  2010 */   174,  142,  143,  144,  174,  174,  174,  148,  149,  174,
+ /*  2020 */   174,  174,  174,  154,   99,  100,  101,  102,  103,  104,
+ /*  2030 */   105,  106,  107,  108,  109,  110,  111,  112,  113,  114,
+ /*  2040 */   115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
+ /*  2050 */   125,  126,  127,  128,  129,  130,  174,  132,  133,  174,
+ /*  2060 */   135,  136,  137,  138,  174,  140,  174,  142,  143,  174,
+ /*  2070 */   174,  174,  174,  148,  149,  174,  174,  174,  174,  154,
+ /*  2080 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*  2090 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  2100 */   119,  120,  121,  122,  123,  124,  125,  126,  127,  128,
+ /*  2110 */   129,  130,  174,  132,  133,  174,  135,  136,  137,  174,
+ /*  2120 */   174,  140,  174,  142,  143,  174,  174,  174,  174,  148,
+ /*  2130 */   149,  174,  174,  174,  174,  154,   99,  100,  101,  102,
+ /*  2140 */   103,  104,  105,  106,  107,  108,  109,  110,  111,  112,
+ /*  2150 */   113,  114,  115,  116,  117,  118,  119,  120,  121,  122,
+ /*  2160 */   123,  124,  125,  126,  127,  128,  129,  130,  174,  132,
+ /*  2170 */   133,  174,  135,  136,  137,  174,  174,  140,  174,  142,
+ /*  2180 */   143,  174,  174,  174,  174,  148,  149,  174,  174,  174,
+ /*  2190 */   174,  154,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  2200 */   107,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  2210 */   117,  118,  119,  120,  121,  122,  123,  124,  125,  126,
+ /*  2220 */   127,  128,  129,  130,  174,  132,  133,  174,  135,  136,
+ /*  2230 */   137,  174,  174,  140,  174,  142,  143,  174,  174,  174,
+ /*  2240 */   174,  148,  149,  174,  174,  174,  174,  154,   99,  100,
+ /*  2250 */   101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+ /*  2260 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  2270 */   121,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  2280 */   174,  132,  133,  174,  135,  136,  137,  174,  174,  140,
+ /*  2290 */   174,  142,  143,  174,  174,  174,  174,  148,  149,  174,
+ /*  2300 */   174,  174,  174,  154,   99,  100,  101,  102,  103,  104,
+ /*  2310 */   105,  106,  107,  108,  109,  110,  111,  112,  113,  114,
+ /*  2320 */   115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
+ /*  2330 */   125,  126,  127,  128,  129,  130,  174,  132,  133,  174,
+ /*  2340 */   135,  136,  137,  174,  174,  140,  174,  142,  143,  174,
+ /*  2350 */   174,  174,  174,  148,  149,  174,  174,  174,  174,  154,
+ /*  2360 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*  2370 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  2380 */   119,  120,  121,  122,  123,  124,  125,  126,  127,  128,
+ /*  2390 */   129,  130,  174,  132,  133,  174,  135,  136,  137,  174,
+ /*  2400 */   174,  140,  174,  142,  143,  174,  174,  174,  174,  148,
+ /*  2410 */   149,  174,  174,  174,  174,  154,   99,  100,  101,  102,
+ /*  2420 */   103,  104,  105,  106,  107,  108,  109,  110,  111,  112,
+ /*  2430 */   113,  114,  115,  116,  117,  118,  119,  120,  121,  122,
+ /*  2440 */   123,  124,  125,  126,  127,  128,  129,  130,  174,  132,
+ /*  2450 */   133,  174,  135,  136,  137,  174,  174,  174,  174,  142,
+ /*  2460 */   143,  174,  174,  174,  174,  148,  149,  174,  174,  174,
+ /*  2470 */   174,  154,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  2480 */   107,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  2490 */   117,  118,  119,  120,  121,  122,  123,  124,  125,  126,
+ /*  2500 */   127,  128,  174,  130,  134,  135,  136,  137,  135,  136,
+ /*  2510 */   137,  174,  142,  143,    8,  142,  143,  174,  148,  149,
+ /*  2520 */   174,  148,  149,  174,  154,  174,  174,  154,   99,  100,
+ /*  2530 */   101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+ /*  2540 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  2550 */   121,  122,  123,  124,  125,  126,  127,  128,  174,  130,
+ /*  2560 */    54,  174,   56,   57,  135,  136,  137,  174,  174,  174,
+ /*  2570 */   174,  142,  143,    8,  174,  174,  174,  148,  149,  174,
+ /*  2580 */   174,  174,  174,  154,   99,  100,  101,  102,  103,  104,
+ /*  2590 */   105,  106,  107,  108,  109,  110,  111,  112,  113,  114,
+ /*  2600 */   115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
+ /*  2610 */   125,  126,  127,   48,  174,   50,   51,  174,  174,  174,
+ /*  2620 */   135,  136,  137,  174,  174,  174,  174,  142,  143,    8,
+ /*  2630 */   174,  174,  174,  148,  149,  174,   98,  174,  174,  154,
+ /*  2640 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*  2650 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  2660 */   119,  120,  121,  122,  123,  124,  125,  126,  174,   48,
+ /*  2670 */   174,   50,   51,  135,  136,  137,  135,  136,  137,  174,
+ /*  2680 */   142,  143,  174,  142,  143,  174,  148,  149,  174,  148,
+ /*  2690 */   149,    7,  154,    9,  174,  154,   12,  174,   14,  161,
+ /*  2700 */    16,  174,  164,  165,  174,  174,  174,   23,   24,   25,
+ /*  2710 */    26,   27,   28,   29,   30,   31,   32,  174,  174,  174,
+ /*  2720 */   174,  174,  174,  174,   40,   41,  174,   43,   44,  174,
+ /*  2730 */    46,  174,  174,   49,  174,  174,  174,  174,  174,   55,
+ /*  2740 */   174,  174,  174,  174,   60,  174,   62,  174,   64,   65,
+ /*  2750 */    66,   67,   68,   69,   70,   71,   72,   73,  174,  174,
+ /*  2760 */   174,   77,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  2770 */   107,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  2780 */   117,  118,  119,  120,  121,  122,  123,  124,  174,  126,
+ /*  2790 */   174,  174,  174,  174,  174,  174,  174,  174,  135,  136,
+ /*  2800 */   137,  174,  174,  174,  174,  142,  143,    7,    8,  174,
+ /*  2810 */   174,  148,  149,  174,   14,  174,  174,  154,  174,  174,
+ /*  2820 */   174,  174,  174,   23,   24,   25,   26,   27,   28,   29,
+ /*  2830 */    30,   31,   32,  174,  174,  174,  174,  174,  174,  174,
+ /*  2840 */    40,   41,  174,   43,   44,  174,   46,    0,  174,   49,
+ /*  2850 */   174,  174,  174,  174,  174,   55,    9,  174,   11,   12,
+ /*  2860 */    60,  174,   62,  174,   64,   65,   66,   67,   68,   69,
+ /*  2870 */    70,   71,   72,   73,  174,  174,   76,    7,    8,    9,
+ /*  2880 */   174,   34,  174,   36,   14,  174,  174,  174,  174,  174,
+ /*  2890 */   174,  174,  174,   23,   24,   25,   26,   27,   28,   29,
+ /*  2900 */    30,   31,   32,  174,  174,  174,  174,  174,  174,  174,
+ /*  2910 */    40,   41,  174,   43,   44,  174,   46,  174,  174,   49,
+ /*  2920 */   174,  174,  174,  174,  174,   55,  174,  174,  174,  174,
+ /*  2930 */    60,  174,   62,  174,   64,   65,   66,   67,   68,   69,
+ /*  2940 */    70,   71,   72,   73,    7,    8,    9,  174,  174,  174,
+ /*  2950 */   174,   14,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  2960 */    23,   24,   25,   26,   27,   28,   29,   30,   31,   32,
+ /*  2970 */   174,  174,  174,  174,  174,  174,  174,   40,   41,  174,
+ /*  2980 */    43,   44,  174,   46,  174,  174,   49,  174,  174,  174,
+ /*  2990 */   174,  174,   55,  174,  174,  174,  174,   60,  174,   62,
+ /*  3000 */   174,   64,   65,   66,   67,   68,   69,   70,   71,   72,
+ /*  3010 */    73,    7,    8,    9,  174,  174,  174,  174,   14,  174,
+ /*  3020 */   174,  174,  174,  174,  174,  174,  174,   23,   24,   25,
+ /*  3030 */    26,   27,   28,   29,   30,   31,   32,  174,  174,  174,
+ /*  3040 */   174,  174,  174,  174,   40,   41,  174,   43,   44,  174,
+ /*  3050 */    46,  174,  174,   49,  174,  174,  174,  174,  174,   55,
+ /*  3060 */   174,  174,  174,  174,   60,  174,   62,  174,   64,   65,
+ /*  3070 */    66,   67,   68,   69,   70,   71,   72,   73,    7,    8,
+ /*  3080 */     9,  174,  174,  174,  174,   14,  174,  174,  174,  174,
+ /*  3090 */   174,  174,  174,  174,   23,   24,   25,   26,   27,   28,
+ /*  3100 */    29,   30,   31,   32,  174,  174,  174,  174,  174,  174,
+ /*  3110 */   174,   40,   41,  174,   43,   44,  174,   46,  174,  174,
+ /*  3120 */    49,  174,  174,  174,  174,  174,   55,  174,  174,  174,
+ /*  3130 */   174,   60,  174,   62,  174,   64,   65,   66,   67,   68,
+ /*  3140 */    69,   70,   71,   72,   73,    7,    8,    9,  174,  174,
+ /*  3150 */   174,  174,   14,  174,  174,  174,  174,  174,  174,  174,
+ /*  3160 */   174,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+ /*  3170 */    32,  174,  174,  174,  174,  174,  174,  174,   40,   41,
+ /*  3180 */   174,   43,   44,  174,   46,  174,  174,   49,  174,  174,
+ /*  3190 */   174,  174,  174,   55,  174,  174,  174,  174,   60,  174,
+ /*  3200 */    62,  174,   64,   65,   66,   67,   68,   69,   70,   71,
+ /*  3210 */    72,   73,    7,    8,    9,  174,  174,  174,  174,   14,
+ /*  3220 */   174,  174,  174,  174,  174,  174,  174,  174,   23,   24,
+ /*  3230 */    25,   26,   27,   28,   29,   30,   31,   32,  174,  174,
+ /*  3240 */   174,  174,  174,  174,  174,   40,   41,  174,   43,   44,
+ /*  3250 */   174,   46,  174,  174,   49,  174,  174,  174,  174,  174,
+ /*  3260 */    55,  174,  174,  174,  174,   60,  174,   62,  174,   64,
+ /*  3270 */    65,   66,   67,   68,   69,   70,   71,   72,   73,    7,
+ /*  3280 */     8,  174,  174,  174,  174,  174,   14,  174,  174,  174,
+ /*  3290 */   174,  174,  174,  174,  174,   23,   24,   25,   26,   27,
+ /*  3300 */    28,   29,   30,   31,   32,  174,  174,  174,  174,  174,
+ /*  3310 */   174,  174,   40,   41,  174,   43,   44,  174,   46,  174,
+ /*  3320 */   174,   49,  174,  174,  174,  174,  174,   55,  174,  174,
+ /*  3330 */   174,  174,   60,  174,   62,  174,   64,   65,   66,   67,
+ /*  3340 */    68,   69,   70,   71,   72,   73,    7,    8,  174,  174,
+ /*  3350 */   174,  174,  174,   14,  174,  174,  174,  174,  174,  174,
+ /*  3360 */   174,  174,   23,   24,   25,   26,   27,   28,   29,   30,
+ /*  3370 */    31,   32,  174,  174,  174,  174,  174,  174,  174,   40,
+ /*  3380 */    41,  174,   43,   44,  174,   46,  174,  174,   49,  174,
+ /*  3390 */   174,  174,  174,  174,   55,  174,  174,  174,  174,   60,
+ /*  3400 */   174,   62,  174,   64,   65,   66,   67,   68,   69,   70,
+ /*  3410 */    71,   72,   73,    7,    8,  174,  174,  174,  174,  174,
+ /*  3420 */    14,  174,  174,  174,  174,  174,  174,  174,  174,   23,
+ /*  3430 */    24,   25,   26,   27,   28,   29,   30,   31,   32,  174,
+ /*  3440 */   174,  174,  174,  174,  174,  174,   40,   41,  174,   43,
+ /*  3450 */    44,  174,   46,  174,  174,   49,  174,  174,  174,  174,
+ /*  3460 */   174,   55,  174,  174,  174,  174,   60,  174,   62,  174,
+ /*  3470 */    64,   65,   66,   67,   68,   69,   70,   71,   72,   73,
+ /*  3480 */     7,    8,  174,  174,  174,  174,  174,   14,  174,  174,
+ /*  3490 */   174,  174,  174,  174,  174,  174,   23,   24,   25,   26,
+ /*  3500 */    27,   28,   29,   30,   31,   32,  174,  174,  174,  174,
+ /*  3510 */   174,  174,  174,   40,   41,  174,   43,   44,  174,   46,
+ /*  3520 */   174,  174,   49,  174,  174,  174,  174,  174,   55,  174,
+ /*  3530 */   174,  174,  174,   60,  174,   62,  174,   64,   65,   66,
+ /*  3540 */    67,   68,   69,   70,   71,   72,   73,    7,    8,  174,
+ /*  3550 */   174,  174,  174,  174,   14,  174,  174,  174,  174,  174,
+ /*  3560 */   174,  174,  174,   23,   24,   25,   26,   27,   28,   29,
+ /*  3570 */    30,   31,   32,  174,  174,  174,  174,  174,  174,  174,
+ /*  3580 */    40,   41,  174,   43,   44,  174,   46,  174,  174,   49,
+ /*  3590 */   174,  174,  174,  174,  174,   55,  174,  174,  174,  174,
+ /*  3600 */    60,  174,   62,  174,   64,   65,   66,   67,   68,   69,
+ /*  3610 */    70,   71,   72,   73,    7,  174,    9,  174,  174,  174,
+ /*  3620 */   174,   14,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  3630 */    23,   24,   25,   26,   27,   28,   29,   30,   31,   32,
+ /*  3640 */   174,  174,  174,  174,  174,  174,  174,   40,   41,  174,
+ /*  3650 */    43,   44,  174,   46,  174,  174,   49,  174,  174,  174,
+ /*  3660 */   174,  174,   55,  174,  174,  174,  174,   60,  174,   62,
+ /*  3670 */   174,   64,   65,   66,   67,   68,   69,   70,   71,   72,
+ /*  3680 */    73,    7,    8,  174,  174,  174,  174,  174,   14,  174,
+ /*  3690 */   174,  174,  174,  174,  174,  174,  174,   23,   24,   25,
+ /*  3700 */    26,   27,   28,   29,   30,   31,   32,  174,  174,  174,
+ /*  3710 */   174,  174,  174,  174,   40,   41,  174,   43,   44,  174,
+ /*  3720 */    46,  174,  174,   49,  174,  174,  174,  174,  174,   55,
+ /*  3730 */   174,  174,  174,  174,   60,  174,   62,  174,   64,   65,
+ /*  3740 */    66,   67,   68,   69,   70,   71,   72,   73,   99,  100,
+ /*  3750 */   101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+ /*  3760 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  3770 */   121,  174,  123,  174,  174,  174,  174,  174,  174,  174,
+ /*  3780 */   174,  174,  174,  174,  135,  136,  137,  174,  174,  174,
+ /*  3790 */   174,  142,  143,  174,  174,  174,  174,  148,  149,  174,
+ /*  3800 */   174,  174,  174,  154,   99,  100,  101,  102,  103,  104,
+ /*  3810 */   105,  106,  107,  108,  109,  110,  111,  112,  113,  114,
+ /*  3820 */   115,  116,  117,  118,  119,  120,  121,  174,  123,  174,
+ /*  3830 */   174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  3840 */   135,  136,  137,  174,  174,  174,  174,  142,  143,    7,
+ /*  3850 */   174,  174,  174,  148,  149,  174,   14,  174,  174,  154,
+ /*  3860 */   174,  174,  174,  174,  174,   23,   24,   25,   26,   27,
+ /*  3870 */    28,   29,   30,   31,   32,  174,  174,  174,  174,  174,
+ /*  3880 */   174,  174,   40,   41,  174,   43,   44,  174,   46,  174,
+ /*  3890 */   174,   49,  174,  174,  174,  174,  174,   55,  174,  174,
+ /*  3900 */   174,  174,   60,  174,   62,  174,   64,   65,   66,   67,
+ /*  3910 */    68,   69,   70,   71,   72,   73,    7,  174,  174,  174,
+ /*  3920 */   174,  174,  174,   14,  174,  174,  174,  174,  174,  174,
+ /*  3930 */   174,  174,   23,   24,   25,   26,   27,   28,   29,   30,
+ /*  3940 */    31,   32,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  3950 */    41,  174,   43,   44,  174,   46,  174,  174,   49,  174,
+ /*  3960 */   174,  174,  174,  174,   55,  174,  174,  174,  174,   60,
+ /*  3970 */   174,   62,  174,   64,   65,   66,   67,   68,   69,   70,
+ /*  3980 */    71,   72,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  3990 */   107,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  4000 */   117,  118,  174,  120,  174,  174,  174,  174,  174,  174,
+ /*  4010 */   174,  174,  174,  174,  174,  174,  174,  174,  135,  136,
+ /*  4020 */   137,  174,  174,  174,  174,  142,  143,  174,  174,  174,
+ /*  4030 */   174,  148,  149,  174,  174,  174,  174,  154,   99,  100,
+ /*  4040 */   101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+ /*  4050 */   111,  112,  113,  114,  115,  116,  117,  118,  174,  120,
+ /*  4060 */   174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  4070 */   174,  174,  174,  174,  135,  136,  137,  174,  174,  174,
+ /*  4080 */   174,  142,  143,    7,  174,  174,  174,  148,  149,  174,
+ /*  4090 */    14,  174,  174,  154,  174,  174,  174,  174,  174,   23,
+ /*  4100 */    24,   25,   26,   27,   28,   29,   30,   31,  174,  174,
+ /*  4110 */   174,  174,  174,  174,  174,  174,  174,   41,  174,   43,
+ /*  4120 */    44,  174,   46,  174,  174,   49,  174,  174,  174,  174,
+ /*  4130 */   174,   55,  174,  174,  174,  174,   60,  174,   62,  174,
+ /*  4140 */    64,   65,   66,   67,   68,   69,   70,   71,   72,    7,
+ /*  4150 */   174,  174,  174,  174,  174,  174,   14,  174,  174,  174,
+ /*  4160 */   174,  174,  174,  174,  174,   23,   24,   25,   26,   27,
+ /*  4170 */    28,   29,   30,  174,  174,  174,  174,  174,  174,  174,
+ /*  4180 */   174,  174,  174,   41,  174,   43,   44,  174,   46,  174,
+ /*  4190 */   174,   49,  174,  174,  174,  174,  174,   55,  174,  174,
+ /*  4200 */    97,   98,   60,  174,   62,  174,   64,   65,   66,   67,
+ /*  4210 */    68,   69,   70,   71,   72,  174,  174,   99,  100,  101,
+ /*  4220 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*  4230 */   112,  113,  114,  115,  116,  117,  174,  174,  135,  136,
+ /*  4240 */   137,  174,  174,  174,  174,  142,  143,  174,  174,  174,
+ /*  4250 */   174,  148,  149,  135,  136,  137,  174,  154,  174,  174,
+ /*  4260 */   142,  143,    7,  174,  174,  174,  148,  149,  165,   14,
+ /*  4270 */   174,  174,  154,  174,  174,  174,  174,  174,   23,   24,
+ /*  4280 */    25,   26,   27,   28,   29,  174,  174,  174,  174,  174,
+ /*  4290 */   174,  174,  174,  174,  174,  174,   41,  174,   43,   44,
+ /*  4300 */   174,   46,  174,  174,   49,  174,  174,  174,  174,  174,
+ /*  4310 */    55,  174,  174,  174,  174,   60,  174,   62,   98,   64,
+ /*  4320 */    65,   66,   67,   68,   69,   70,   71,   72,   99,  100,
+ /*  4330 */   101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+ /*  4340 */   111,  112,  113,  114,  115,  174,  117,  174,  174,  174,
+ /*  4350 */   174,  174,  174,  174,  174,  135,  136,  137,  174,  174,
+ /*  4360 */   174,  174,  142,  143,  135,  136,  137,  174,  148,  149,
+ /*  4370 */   174,  142,  143,    7,  154,  174,  174,  148,  149,  174,
+ /*  4380 */    14,  174,  174,  154,  164,  165,  174,  174,  174,   23,
+ /*  4390 */    24,   25,   26,   27,   28,  174,  174,  174,  174,  174,
+ /*  4400 */   174,  174,  174,  174,  174,  174,  174,   41,  174,   43,
+ /*  4410 */    44,  174,   46,  174,  174,   49,  174,  174,  174,  174,
+ /*  4420 */   174,   55,  174,  174,  174,  174,   60,  174,   62,  174,
+ /*  4430 */    64,   65,   66,   67,   68,   69,   70,   71,   72,    7,
+ /*  4440 */   174,  174,  174,  174,  174,  174,   14,  174,  174,  174,
+ /*  4450 */   174,  174,  174,  174,  174,   23,   24,   25,   26,   27,
+ /*  4460 */   174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  4470 */   174,  174,  174,   41,  174,   43,   44,  174,   46,  174,
+ /*  4480 */   174,   49,  174,  174,  174,  174,  174,   55,  174,  174,
+ /*  4490 */   174,  174,   60,  174,   62,  174,   64,   65,   66,   67,
+ /*  4500 */    68,   69,   70,   71,   72,  174,  174,   99,  100,  101,
+ /*  4510 */   102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+ /*  4520 */   112,  174,  114,  174,  174,  174,  174,  174,  135,  136,
+ /*  4530 */   137,  174,  174,  174,  174,  142,  143,  174,  174,  174,
+ /*  4540 */   174,  148,  149,  135,  136,  137,  174,  154,  174,  174,
+ /*  4550 */   142,  143,  174,  174,  174,  174,  148,  149,  165,  174,
+ /*  4560 */   174,  174,  154,  174,  174,  174,  174,  174,  174,  174,
+ /*  4570 */   174,  174,  174,   99,  100,  101,  102,  103,  104,  105,
+ /*  4580 */   106,  107,  108,  109,  110,  111,  112,  174,  114,  174,
+ /*  4590 */   174,  174,  174,  174,  174,  174,    7,  174,  174,  174,
+ /*  4600 */   174,  174,  174,   14,  174,  174,  174,  174,  174,  135,
+ /*  4610 */   136,  137,   23,   24,   25,   26,  142,  143,  174,  174,
+ /*  4620 */   174,  174,  148,  149,  174,  174,  174,  174,  154,  174,
+ /*  4630 */    41,  174,   43,   44,  174,   46,  174,  174,   49,  174,
+ /*  4640 */   174,  174,  174,  174,   55,  174,  174,  174,  174,   60,
+ /*  4650 */   174,   62,  174,   64,   65,   66,   67,   68,   69,   70,
+ /*  4660 */    71,   72,    7,  174,  174,  174,    7,    8,  174,   14,
+ /*  4670 */   174,  174,  174,  174,  174,  174,  174,  174,   23,   24,
+ /*  4680 */    25,   22,   23,   24,   25,   26,   27,   28,   29,   30,
+ /*  4690 */    31,   32,   33,  174,  174,  174,   41,  174,   43,   44,
+ /*  4700 */   174,   46,  174,  174,   49,  174,  174,  174,  174,  174,
+ /*  4710 */    55,  174,  174,  174,  174,   60,  174,   62,  174,   64,
+ /*  4720 */    65,   66,   67,   68,   69,   70,   71,   72,    7,  174,
+ /*  4730 */   174,    7,    8,  174,  174,   14,  174,  174,  174,  174,
+ /*  4740 */   174,  174,  174,  174,   23,   24,   22,   23,   24,   25,
+ /*  4750 */    26,   27,   28,   29,   30,   31,   32,   33,  174,  174,
+ /*  4760 */   174,  174,   41,  174,   43,   44,  174,   46,  174,  174,
+ /*  4770 */    49,  174,  174,  174,  174,  174,   55,  174,  174,  174,
+ /*  4780 */   174,   60,  174,   62,  174,   64,   65,   66,   67,   68,
+ /*  4790 */    69,   70,   71,   72,  174,  174,   99,  100,  101,  102,
+ /*  4800 */   103,  104,  105,  106,  107,  108,  109,  174,  111,  174,
+ /*  4810 */   174,  174,  174,  174,  174,  174,  174,   99,  100,  101,
+ /*  4820 */   102,  103,  104,  105,  106,  107,  108,  109,  174,  111,
+ /*  4830 */   174,  174,  135,  136,  137,  174,  174,  174,  174,  142,
+ /*  4840 */   143,    7,  174,  174,  174,  148,  149,  174,   14,  174,
+ /*  4850 */   174,  154,  174,  135,  136,  137,  174,   23,  174,  174,
+ /*  4860 */   142,  143,  174,  174,  174,  174,  148,  149,  174,  174,
+ /*  4870 */   174,  174,  154,  174,    7,   41,  174,   43,   44,  174,
+ /*  4880 */    46,   14,  174,   49,  174,  174,  174,  174,   21,   55,
+ /*  4890 */   174,  174,  174,  174,   60,  174,   62,  174,   64,   65,
+ /*  4900 */    66,   67,   68,   69,   70,   71,   72,  174,   41,  174,
+ /*  4910 */    43,   44,  174,   46,  174,  174,   49,   99,  100,  101,
+ /*  4920 */   102,  103,   55,  105,  174,  174,  174,   60,  174,   62,
+ /*  4930 */   174,   64,   65,   66,   67,   68,   69,    7,  174,    9,
+ /*  4940 */    73,   74,  174,  174,   14,  174,  174,  174,  174,  174,
+ /*  4950 */   174,  174,   22,  135,  136,  137,  135,  136,  137,  174,
+ /*  4960 */   142,  143,  174,  142,  143,  174,  148,  149,  174,  148,
+ /*  4970 */   149,   41,  154,   43,   44,  154,   46,  174,  174,   49,
+ /*  4980 */   174,  174,  174,  174,  163,   55,  165,  174,  174,  174,
+ /*  4990 */    60,  174,   62,  174,   64,   65,   66,   67,   68,   69,
+ /*  5000 */    99,  100,  101,  102,  103,  104,  105,  106,  174,  108,
+ /*  5010 */    99,  100,  101,  102,  103,  104,  105,  106,  174,  108,
+ /*  5020 */   174,  174,  174,  174,  174,  174,  174,    7,  174,    9,
+ /*  5030 */   174,  174,  174,  174,   14,  174,  135,  136,  137,  174,
+ /*  5040 */   174,  174,  174,  142,  143,  174,  135,  136,  137,  148,
+ /*  5050 */   149,  174,  174,  142,  143,  154,  174,  174,  174,  148,
+ /*  5060 */   149,   41,  174,   43,   44,  154,   46,    7,  174,   49,
+ /*  5070 */   174,  174,  174,  174,   14,   55,  174,  174,  174,  174,
+ /*  5080 */    60,  174,   62,  174,   64,   65,   66,   67,   68,   69,
+ /*  5090 */   174,  174,  174,  174,   99,  100,  101,  102,  103,  104,
+ /*  5100 */   105,   41,  174,   43,   44,  174,   46,  174,  174,   49,
+ /*  5110 */   174,  174,  174,  174,  174,   55,  174,  174,  174,  174,
+ /*  5120 */    60,  174,   62,  174,   64,   65,   66,   67,   68,   69,
+ /*  5130 */   135,  136,  137,  174,  174,    7,    8,  142,  143,  174,
+ /*  5140 */   174,  174,  174,  148,  149,  174,  174,  174,  174,  154,
+ /*  5150 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+ /*  5160 */    32,   33,    7,    8,  174,  174,  174,  174,  174,  174,
+ /*  5170 */   174,  174,  174,  174,  174,  174,  174,   22,   23,   24,
+ /*  5180 */    25,   26,   27,   28,   29,   30,   31,   32,   33,    7,
+ /*  5190 */     8,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  5200 */   174,  174,  174,  174,   22,   23,   24,   25,   26,   27,
+ /*  5210 */    28,   29,   30,   31,   32,   33,    7,    8,  174,  174,
+ /*  5220 */    99,  174,  101,  102,   99,  174,  101,  102,  174,  174,
+ /*  5230 */   174,   22,   23,   24,   25,   26,   27,   28,   29,   30,
+ /*  5240 */    31,   32,   33,  174,  174,  174,  174,  174,  174,  174,
+ /*  5250 */   174,  174,  174,  174,  174,  174,  135,  136,  137,  174,
+ /*  5260 */   135,  136,  137,  142,  143,  174,  174,  142,  143,  148,
+ /*  5270 */   149,  174,  174,  148,  149,  154,  174,  174,  174,  154,
+ /*  5280 */   135,  136,  137,  174,  174,  174,  174,  142,  143,  174,
+ /*  5290 */   174,  174,  174,  148,  149,  174,  174,  174,  174,  154,
+ /*  5300 */   174,  174,  174,  174,  174,  174,  174,  174,  174,  174,
+ /*  5310 */   165,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5320 */    78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5330 */    78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5340 */    78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5350 */    78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5360 */    78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5370 */    78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+ /*  5380 */    78,   78,   78,   78,   78,   78,   78,   78,   78,
+};
+#define YY_SHIFT_COUNT    (191)
+#define YY_SHIFT_MIN      (0)
+#define YY_SHIFT_MAX      (5209)
+static const unsigned short int yy_shift_ofst[] = {
+ /*     0 */  5311, 2684, 2684, 2684, 2800, 2684, 2870, 2870, 3272, 3842,
+ /*    10 */  3842, 3339, 3406, 3473, 3540, 3842, 3842, 2937, 3004, 3071,
+ /*    20 */  3138, 3205, 3607, 3607, 3607, 3607, 3607, 3607, 3607, 3674,
+ /*    30 */  3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
+ /*    40 */  3842, 3909, 3909, 3909, 4076, 4076, 4076, 4142, 4142, 4255,
+ /*    50 */  4255, 4366, 4366, 4432, 4432, 4589, 4589, 4655, 4655, 4721,
+ /*    60 */  4721, 5060, 4834, 4834, 5060, 5060, 4867, 4930, 5060, 5060,
+ /*    70 */  5060, 5020, 5060, 5060, 4659, 4724, 5128,   19, 5155, 5182,
+ /*    80 */  5209, 2847,   19,   79,  121,  158,  169,  237,  236,  284,
+ /*    90 */   364,  374,   51,  281,  362,  375,  220,   76,  146,  294,
+ /*   100 */   419,  422,  376,  426,  433,  441,  441,  437,  429,  438,
+ /*   110 */   427,  437,  437,  505,  494,  494,  492,  495,  498,  502,
+ /*   120 */   504,  494,  491,  530,  510,  549,  557,  564,  494,  567,
+ /*   130 */   494,  572,  505, 5311, 5311, 5311, 5311, 5311, 5311,   45,
+ /*   140 */  2565,  311, 2506, 2621,  443,  450,  455,  434,  456,  501,
+ /*   150 */   632,  637,  639,  610,  643,  644,  645,  648,  650,  651,
+ /*   160 */   685,  688,  692,  693,  695,  699,  666,  701,  704,  638,
+ /*   170 */   705,  707,  709,  710,  711,  712,  715,  716,  646,  691,
+ /*   180 */   724,  759,  761,  764,  752,  767,  770,  771,  772,  773,
+ /*   190 */   805,  814,
+};
+#define YY_REDUCE_COUNT (138)
+#define YY_REDUCE_MIN   (-134)
+#define YY_REDUCE_MAX   (5145)
+static const short yy_reduce_ofst[] = {
+ /*     0 */   -73,  -78,   -3,   72,  147,  221,  296,  370,  445,  506,
+ /*    10 */   562,  628,  684,  740,  796,  852,  908,  972, 1028, 1084,
+ /*    20 */  1140, 1196, 1252, 1308, 1364, 1420, 1476, 1532, 1588, 1644,
+ /*    30 */  1700, 1756, 1813, 1869, 1925, 1981, 2037, 2093, 2149, 2205,
+ /*    40 */  2261, 2317, 2373, 2429, 2485, 2541, 2663, 3649, 3705, 3883,
+ /*    50 */  3939, 4118, 4229, 4408, 4474, 4697, 4718, 4901, 4911, 4995,
+ /*    60 */  4818, 2538, 5121, 5125, 4103, 4220, 4821, 2370, 4393, 5145,
+ /*    70 */   -69, -134,   81,   -1,  -74,  -68,   71,   50,   -9,   -9,
+ /*    80 */    -9,   74,  125,  -22,   28,   86,   85,   77,  203,  277,
+ /*    90 */   295,  308,  282,  -82,  -67,   -2,  -32,  123,   82,  144,
+ /*   100 */   200,  208,  219,  239,  274,  191,  195,  299,  389,  423,
+ /*   110 */   436,  420,  431,  432,  388,  388,  395,  400,  406,  410,
+ /*   120 */   416,  388,  378,  457,  428,  467,  477,  484,  388,  489,
+ /*   130 */   388,  503,  508,  453,  448,  525,  451,  490,  566,
+};
+static const YYACTIONTYPE yy_default[] = {
+ /*     0 */   703,  699,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*    10 */   699,  699,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*    20 */   699,  699,  699,  947,  699,  699,  699,  699,  699,  699,
+ /*    30 */   699,  699,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*    40 */   699,  856,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*    50 */   699,  699,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*    60 */   699,  699,  699,  699,  699,  699,  699,  699,  799,  699,
+ /*    70 */   699,  699,  804,  699,  699,  699,  699,  746,  699,  699,
+ /*    80 */   699,  746,  746,  699,  699,  699,  699,  699,  699,  699,
+ /*    90 */   699,  699,  945,  699,  723,  723,  699,  723,  699,  699,
+ /*   100 */   699,  699,  699,  699,  699,  699,  699,  726,  699,  699,
+ /*   110 */   699,  726,  726,  748,  919,  934,  854,  855,  842,  844,
+ /*   120 */   839,  918,  699,  699,  827,  829,  824,  819,  909,  807,
+ /*   130 */   908,  809,  748,  875,  887,  699,  887,  875,  699,  699,
+ /*   140 */   699,  699,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*   150 */   699,  699,  699,  797,  699,  699,  699,  699,  699,  699,
+ /*   160 */   699,  699,  699,  699,  699,  699,  699,  699,  699,  951,
+ /*   170 */   699,  699,  699,  699,  699,  699,  699,  699,  699,  699,
+ /*   180 */   846,  699,  699,  699,  732,  699,  699,  699,  699,  699,
+ /*   190 */   699,  699,
+};
+/********** End of lemon-generated parsing tables *****************************/
+
+/* The next table maps tokens (terminal symbols) into fallback tokens.  
+** If a construct like the following:
+** 
+**      %fallback ID X Y Z.
+**
+** appears in the grammar, then ID becomes a fallback token for X, Y,
+** and Z.  Whenever one of the tokens X, Y, or Z is input to the parser
+** but it does not parse, the type of the token is changed to ID and
+** the parse is retried before an error is thrown.
+**
+** This feature can be used, for example, to cause some keywords in a language
+** to revert to identifiers if they keyword does not apply in the context where
+** it appears.
+*/
+#ifdef YYFALLBACK
+static const YYCODETYPE yyFallback[] = {
+};
+#endif /* YYFALLBACK */
+
+/* The following structure represents a single element of the
+** parser's stack.  Information stored includes:
+**
+**   +  The state number for the parser at this level of the stack.
+**
+**   +  The value of the token stored at this level of the stack.
+**      (In other words, the "major" token.)
+**
+**   +  The semantic value stored at this level of the stack.  This is
+**      the information used by the action routines in the grammar.
+**      It is sometimes called the "minor" token.
+**
+** After the "shift" half of a SHIFTREDUCE action, the stateno field
+** actually contains the reduce action for the second half of the
+** SHIFTREDUCE.
+*/
+struct yyStackEntry {
+  YYACTIONTYPE stateno;  /* The state-number, or reduce action in SHIFTREDUCE */
+  YYCODETYPE major;      /* The major token value.  This is the code
+                         ** number for the token at this stack level */
+  YYMINORTYPE minor;     /* The user-supplied minor token value.  This
+                         ** is the value of the token  */
+};
+typedef struct yyStackEntry yyStackEntry;
+
+/* The state of the parser is completely contained in an instance of
+** the following structure */
+struct yyParser {
+  yyStackEntry *yytos;          /* Pointer to top element of the stack */
+#ifdef YYTRACKMAXSTACKDEPTH
+  int yyhwm;                    /* High-water mark of the stack */
+#endif
+#ifndef YYNOERRORRECOVERY
+  int yyerrcnt;                 /* Shifts left before out of the error */
+#endif
+  ParseARG_SDECL                /* A place to hold %extra_argument */
+  ParseCTX_SDECL                /* A place to hold %extra_context */
+#if YYSTACKDEPTH<=0
+  int yystksz;                  /* Current side of the stack */
+  yyStackEntry *yystack;        /* The parser's stack */
+  yyStackEntry yystk0;          /* First stack entry */
+#else
+  yyStackEntry yystack[YYSTACKDEPTH];  /* The parser's stack */
+  yyStackEntry *yystackEnd;            /* Last entry in the stack */
+#endif
+};
+typedef struct yyParser yyParser;
+
+#ifndef NDEBUG
+#include <stdio.h>
+#include <assert.h>
+static FILE *yyTraceFILE = 0;
+static char *yyTracePrompt = 0;
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* 
+** Turn parser tracing on by giving a stream to which to write the trace
+** and a prompt to preface each trace message.  Tracing is turned off
+** by making either argument NULL 
+**
+** Inputs:
+** <ul>
+** <li> A FILE* to which trace output should be written.
+**      If NULL, then tracing is turned off.
+** <li> A prefix string written at the beginning of every
+**      line of trace output.  If NULL, then tracing is
+**      turned off.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+void ParseTrace(FILE *TraceFILE, char *zTracePrompt){
+  yyTraceFILE = TraceFILE;
+  yyTracePrompt = zTracePrompt;
+  if( yyTraceFILE==0 ) yyTracePrompt = 0;
+  else if( yyTracePrompt==0 ) yyTraceFILE = 0;
+}
+#endif /* NDEBUG */
+
+#if defined(YYCOVERAGE) || !defined(NDEBUG)
+/* For tracing shifts, the names of all terminals and nonterminals
+** are required.  The following table supplies these names */
+static const char *const yyTokenName[] = { 
+  /*    0 */ "$",
+  /*    1 */ "WS",
+  /*    2 */ "COMMENT",
+  /*    3 */ "P_BOPEN",
+  /*    4 */ "P_BCLOSE",
+  /*    5 */ "P_SOPEN",
+  /*    6 */ "P_SCLOSE",
+  /*    7 */ "ID",
+  /*    8 */ "NL",
+  /*    9 */ "INDENT",
+  /*   10 */ "DEDENT",
+  /*   11 */ "KW_PACKAGE",
+  /*   12 */ "KW_FROM",
+  /*   13 */ "KW_IMPORT",
+  /*   14 */ "P_HOLE",
+  /*   15 */ "KW_EXPORT",
+  /*   16 */ "KW_DEF",
+  /*   17 */ "KW_TYPE",
+  /*   18 */ "KW_TOPIC",
+  /*   19 */ "KW_UNARY",
+  /*   20 */ "KW_BINARY",
+  /*   21 */ "P_EQUALS",
+  /*   22 */ "OP_DOT",
+  /*   23 */ "OP_QUANT",
+  /*   24 */ "OP_EXP",
+  /*   25 */ "OP_MULDIV",
+  /*   26 */ "OP_ADDSUB",
+  /*   27 */ "OP_COMPARE",
+  /*   28 */ "OP_INEQUAL",
+  /*   29 */ "OP_AND",
+  /*   30 */ "OP_OR",
+  /*   31 */ "OP_DOLLAR",
+  /*   32 */ "OP_ASSIGN",
+  /*   33 */ "OP_COMMA",
+  /*   34 */ "KW_GLOBAL",
+  /*   35 */ "P_ASCRIBE",
+  /*   36 */ "KW_PUBLISH",
+  /*   37 */ "KW_DATA",
+  /*   38 */ "KW_TUPLE",
+  /*   39 */ "KW_TARGET",
+  /*   40 */ "P_BSLASH",
+  /*   41 */ "P_POPEN",
+  /*   42 */ "P_PCLOSE",
+  /*   43 */ "STR_RAW",
+  /*   44 */ "STR_SINGLE",
+  /*   45 */ "STR_MID",
+  /*   46 */ "STR_OPEN",
+  /*   47 */ "STR_CLOSE",
+  /*   48 */ "MSTR_CONTINUE",
+  /*   49 */ "MSTR_BEGIN",
+  /*   50 */ "MSTR_END",
+  /*   51 */ "MSTR_PAUSE",
+  /*   52 */ "MSTR_MID",
+  /*   53 */ "MSTR_RESUME",
+  /*   54 */ "LSTR_CONTINUE",
+  /*   55 */ "LSTR_BEGIN",
+  /*   56 */ "LSTR_END",
+  /*   57 */ "LSTR_PAUSE",
+  /*   58 */ "LSTR_MID",
+  /*   59 */ "LSTR_RESUME",
+  /*   60 */ "REG_SINGLE",
+  /*   61 */ "REG_MID",
+  /*   62 */ "REG_OPEN",
+  /*   63 */ "REG_CLOSE",
+  /*   64 */ "DOUBLE",
+  /*   65 */ "INTEGER",
+  /*   66 */ "KW_MACRO_HERE",
+  /*   67 */ "KW_MACRO_LINE",
+  /*   68 */ "KW_MACRO_FILE",
+  /*   69 */ "KW_MACRO_BANG",
+  /*   70 */ "KW_SUBSCRIBE",
+  /*   71 */ "KW_PRIM",
+  /*   72 */ "KW_MATCH",
+  /*   73 */ "KW_IF",
+  /*   74 */ "P_ARROW",
+  /*   75 */ "KW_THEN",
+  /*   76 */ "KW_ELSE",
+  /*   77 */ "KW_REQUIRE",
+  /*   78 */ "error",
+  /*   79 */ "start",
+  /*   80 */ "top",
+  /*   81 */ "topdef",
+  /*   82 */ "id",
+  /*   83 */ "kind",
+  /*   84 */ "arity",
+  /*   85 */ "idopeqs",
+  /*   86 */ "idopeq",
+  /*   87 */ "idop",
+  /*   88 */ "global",
+  /*   89 */ "export",
+  /*   90 */ "type",
+  /*   91 */ "block_opt",
+  /*   92 */ "data_elts",
+  /*   93 */ "tuple_elts",
+  /*   94 */ "tuple_elt",
+  /*   95 */ "pattern",
+  /*   96 */ "target_pattern",
+  /*   97 */ "target_args",
+  /*   98 */ "pattern_terms",
+  /*   99 */ "expression_op_quant",
+  /*  100 */ "expression_binary_quant",
+  /*  101 */ "expression_unary_quant",
+  /*  102 */ "expression_binary_app",
+  /*  103 */ "expression_op_exp",
+  /*  104 */ "expression_binary_exp",
+  /*  105 */ "expression_unary_exp",
+  /*  106 */ "expression_op_muldiv",
+  /*  107 */ "expression_binary_muldiv",
+  /*  108 */ "expression_unary_muldiv",
+  /*  109 */ "expression_op_addsub",
+  /*  110 */ "expression_binary_addsub",
+  /*  111 */ "expression_unary_addsub",
+  /*  112 */ "expression_op_compare",
+  /*  113 */ "expression_binary_compare",
+  /*  114 */ "expression_unary_compare",
+  /*  115 */ "expression_op_inequal",
+  /*  116 */ "expression_binary_inequal",
+  /*  117 */ "expression_unary_inequal",
+  /*  118 */ "expression_op_and",
+  /*  119 */ "expression_binary_and",
+  /*  120 */ "expression_unary_and",
+  /*  121 */ "expression_op_or",
+  /*  122 */ "expression_binary_or",
+  /*  123 */ "expression_unary_or",
+  /*  124 */ "expression_op_dollar",
+  /*  125 */ "expression_binary_dollar",
+  /*  126 */ "expression_unary_dollar",
+  /*  127 */ "expression_binary_ascribe",
+  /*  128 */ "expression_op_assign",
+  /*  129 */ "expression_binary_assign",
+  /*  130 */ "expression_unary_assign",
+  /*  131 */ "expression_op_comma",
+  /*  132 */ "expression_binary_comma",
+  /*  133 */ "expression_unary_comma",
+  /*  134 */ "op_dot",
+  /*  135 */ "expression_term",
+  /*  136 */ "expression_nodot",
+  /*  137 */ "str_open",
+  /*  138 */ "interpolated_string",
+  /*  139 */ "str_close",
+  /*  140 */ "expression",
+  /*  141 */ "str_mid",
+  /*  142 */ "mstr_single",
+  /*  143 */ "mstr_open",
+  /*  144 */ "interpolated_mstring",
+  /*  145 */ "mstr_close",
+  /*  146 */ "mstr_mid",
+  /*  147 */ "mstr_cont",
+  /*  148 */ "lstr_single",
+  /*  149 */ "lstr_open",
+  /*  150 */ "interpolated_lstring",
+  /*  151 */ "lstr_close",
+  /*  152 */ "lstr_mid",
+  /*  153 */ "lstr_cont",
+  /*  154 */ "reg_open",
+  /*  155 */ "interpolated_regexp",
+  /*  156 */ "reg_close",
+  /*  157 */ "reg_mid",
+  /*  158 */ "prim_literal",
+  /*  159 */ "match1_cases",
+  /*  160 */ "match_terms",
+  /*  161 */ "matchx_cases",
+  /*  162 */ "match1_case",
+  /*  163 */ "guard",
+  /*  164 */ "matchx_case",
+  /*  165 */ "pattern_term",
+  /*  166 */ "block",
+  /*  167 */ "body",
+  /*  168 */ "blockdefs",
+  /*  169 */ "reqbad",
+  /*  170 */ "reqbody",
+  /*  171 */ "reqelse",
+  /*  172 */ "reqelsebody",
+  /*  173 */ "blockdef",
+};
+#endif /* defined(YYCOVERAGE) || !defined(NDEBUG) */
+
+#ifndef NDEBUG
+/* For tracing reduce actions, the names of all rules are required.
+*/
+static const char *const yyRuleName[] = {
+ /*   0 */ "start ::= top",
+ /*   1 */ "top ::=",
+ /*   2 */ "top ::= top topdef",
+ /*   3 */ "id ::= ID",
+ /*   4 */ "topdef ::= error NL",
+ /*   5 */ "topdef ::= INDENT error DEDENT",
+ /*   6 */ "topdef ::= KW_PACKAGE NL",
+ /*   7 */ "topdef ::= KW_PACKAGE error NL",
+ /*   8 */ "topdef ::= KW_PACKAGE id NL",
+ /*   9 */ "topdef ::= KW_FROM NL",
+ /*  10 */ "topdef ::= KW_FROM error NL",
+ /*  11 */ "topdef ::= KW_FROM id NL",
+ /*  12 */ "topdef ::= KW_FROM id error NL",
+ /*  13 */ "topdef ::= KW_FROM id KW_IMPORT P_HOLE NL",
+ /*  14 */ "topdef ::= KW_FROM id KW_IMPORT kind arity NL",
+ /*  15 */ "topdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL",
+ /*  16 */ "topdef ::= KW_FROM id KW_EXPORT kind arity NL",
+ /*  17 */ "topdef ::= KW_FROM id KW_EXPORT kind arity idopeqs NL",
+ /*  18 */ "kind ::= KW_DEF",
+ /*  19 */ "kind ::= KW_TYPE",
+ /*  20 */ "kind ::= KW_TOPIC",
+ /*  21 */ "kind ::=",
+ /*  22 */ "arity ::= KW_UNARY",
+ /*  23 */ "arity ::= KW_BINARY",
+ /*  24 */ "arity ::=",
+ /*  25 */ "idopeqs ::= error",
+ /*  26 */ "idopeqs ::= idopeqs error",
+ /*  27 */ "idopeqs ::= idopeqs idopeq",
+ /*  28 */ "idopeqs ::= idopeq",
+ /*  29 */ "idopeq ::= idop P_EQUALS idop",
+ /*  30 */ "idopeq ::= idop",
+ /*  31 */ "idop ::= ID",
+ /*  32 */ "idop ::= OP_DOT",
+ /*  33 */ "idop ::= OP_QUANT",
+ /*  34 */ "idop ::= OP_EXP",
+ /*  35 */ "idop ::= OP_MULDIV",
+ /*  36 */ "idop ::= OP_ADDSUB",
+ /*  37 */ "idop ::= OP_COMPARE",
+ /*  38 */ "idop ::= OP_INEQUAL",
+ /*  39 */ "idop ::= OP_AND",
+ /*  40 */ "idop ::= OP_OR",
+ /*  41 */ "idop ::= OP_DOLLAR",
+ /*  42 */ "idop ::= OP_ASSIGN",
+ /*  43 */ "idop ::= OP_COMMA",
+ /*  44 */ "global ::=",
+ /*  45 */ "global ::= KW_GLOBAL",
+ /*  46 */ "export ::=",
+ /*  47 */ "export ::= KW_EXPORT",
+ /*  48 */ "topdef ::= global export KW_TOPIC NL",
+ /*  49 */ "topdef ::= global export KW_TOPIC error NL",
+ /*  50 */ "topdef ::= global export KW_TOPIC id NL",
+ /*  51 */ "topdef ::= global export KW_TOPIC id error NL",
+ /*  52 */ "topdef ::= global export KW_TOPIC id P_ASCRIBE NL",
+ /*  53 */ "topdef ::= global export KW_TOPIC id P_ASCRIBE type NL",
+ /*  54 */ "topdef ::= KW_PUBLISH NL",
+ /*  55 */ "topdef ::= KW_PUBLISH error NL",
+ /*  56 */ "topdef ::= KW_PUBLISH id NL",
+ /*  57 */ "topdef ::= KW_PUBLISH id error NL",
+ /*  58 */ "topdef ::= KW_PUBLISH id P_EQUALS NL",
+ /*  59 */ "topdef ::= KW_PUBLISH id P_EQUALS block_opt NL",
+ /*  60 */ "topdef ::= global export KW_DATA NL",
+ /*  61 */ "topdef ::= global export KW_DATA error NL",
+ /*  62 */ "topdef ::= global export KW_DATA type NL",
+ /*  63 */ "topdef ::= global export KW_DATA type error NL",
+ /*  64 */ "topdef ::= global export KW_DATA type P_EQUALS NL",
+ /*  65 */ "topdef ::= global export KW_DATA type P_EQUALS type NL",
+ /*  66 */ "topdef ::= global export KW_DATA type P_EQUALS INDENT data_elts DEDENT",
+ /*  67 */ "data_elts ::= error",
+ /*  68 */ "data_elts ::= type",
+ /*  69 */ "data_elts ::= data_elts NL error",
+ /*  70 */ "data_elts ::= data_elts NL type",
+ /*  71 */ "topdef ::= global export KW_TUPLE NL",
+ /*  72 */ "topdef ::= global export KW_TUPLE error NL",
+ /*  73 */ "topdef ::= global export KW_TUPLE type NL",
+ /*  74 */ "topdef ::= global export KW_TUPLE type error NL",
+ /*  75 */ "topdef ::= global export KW_TUPLE type P_EQUALS NL",
+ /*  76 */ "topdef ::= global export KW_TUPLE type P_EQUALS error NL",
+ /*  77 */ "topdef ::= global export KW_TUPLE type P_EQUALS INDENT tuple_elts DEDENT",
+ /*  78 */ "tuple_elts ::= error",
+ /*  79 */ "tuple_elts ::= tuple_elt",
+ /*  80 */ "tuple_elts ::= tuple_elts NL error",
+ /*  81 */ "tuple_elts ::= tuple_elts NL tuple_elt",
+ /*  82 */ "tuple_elt ::= global export type",
+ /*  83 */ "topdef ::= global export KW_DEF NL",
+ /*  84 */ "topdef ::= global export KW_DEF error NL",
+ /*  85 */ "topdef ::= global export KW_DEF pattern NL",
+ /*  86 */ "topdef ::= global export KW_DEF pattern error NL",
+ /*  87 */ "topdef ::= global export KW_DEF pattern P_EQUALS NL",
+ /*  88 */ "topdef ::= global export KW_DEF pattern P_EQUALS block_opt NL",
+ /*  89 */ "topdef ::= global export KW_TARGET NL",
+ /*  90 */ "topdef ::= global export KW_TARGET error NL",
+ /*  91 */ "topdef ::= global export KW_TARGET target_pattern NL",
+ /*  92 */ "topdef ::= global export KW_TARGET target_pattern error NL",
+ /*  93 */ "topdef ::= global export KW_TARGET target_pattern P_EQUALS NL",
+ /*  94 */ "topdef ::= global export KW_TARGET target_pattern P_EQUALS block_opt NL",
+ /*  95 */ "target_pattern ::= pattern",
+ /*  96 */ "target_pattern ::= pattern P_BSLASH target_args",
+ /*  97 */ "target_args ::= pattern_terms",
+ /*  98 */ "expression_op_quant ::= OP_QUANT",
+ /*  99 */ "expression_binary_quant ::= expression_binary_quant expression_op_quant expression_unary_quant",
+ /* 100 */ "expression_binary_quant ::= expression_unary_quant",
+ /* 101 */ "expression_unary_quant ::= expression_op_quant expression_unary_quant",
+ /* 102 */ "expression_unary_quant ::= expression_binary_app",
+ /* 103 */ "expression_op_exp ::= OP_EXP",
+ /* 104 */ "expression_binary_exp ::= expression_unary_exp expression_op_exp expression_binary_exp",
+ /* 105 */ "expression_binary_exp ::= expression_unary_exp",
+ /* 106 */ "expression_unary_exp ::= expression_op_exp expression_unary_exp",
+ /* 107 */ "expression_unary_exp ::= expression_binary_quant",
+ /* 108 */ "expression_op_muldiv ::= OP_MULDIV",
+ /* 109 */ "expression_binary_muldiv ::= expression_binary_muldiv expression_op_muldiv expression_unary_muldiv",
+ /* 110 */ "expression_binary_muldiv ::= expression_unary_muldiv",
+ /* 111 */ "expression_unary_muldiv ::= expression_op_muldiv expression_unary_muldiv",
+ /* 112 */ "expression_unary_muldiv ::= expression_binary_exp",
+ /* 113 */ "expression_op_addsub ::= OP_ADDSUB",
+ /* 114 */ "expression_binary_addsub ::= expression_binary_addsub expression_op_addsub expression_unary_addsub",
+ /* 115 */ "expression_binary_addsub ::= expression_unary_addsub",
+ /* 116 */ "expression_unary_addsub ::= expression_op_addsub expression_unary_addsub",
+ /* 117 */ "expression_unary_addsub ::= expression_binary_muldiv",
+ /* 118 */ "expression_op_compare ::= OP_COMPARE",
+ /* 119 */ "expression_binary_compare ::= expression_binary_compare expression_op_compare expression_unary_compare",
+ /* 120 */ "expression_binary_compare ::= expression_unary_compare",
+ /* 121 */ "expression_unary_compare ::= expression_op_compare expression_unary_compare",
+ /* 122 */ "expression_unary_compare ::= expression_binary_addsub",
+ /* 123 */ "expression_op_inequal ::= OP_INEQUAL",
+ /* 124 */ "expression_binary_inequal ::= expression_unary_inequal expression_op_inequal expression_binary_inequal",
+ /* 125 */ "expression_binary_inequal ::= expression_unary_inequal",
+ /* 126 */ "expression_unary_inequal ::= expression_op_inequal expression_unary_inequal",
+ /* 127 */ "expression_unary_inequal ::= expression_binary_compare",
+ /* 128 */ "expression_op_and ::= OP_AND",
+ /* 129 */ "expression_binary_and ::= expression_binary_and expression_op_and expression_unary_and",
+ /* 130 */ "expression_binary_and ::= expression_unary_and",
+ /* 131 */ "expression_unary_and ::= expression_op_and expression_unary_and",
+ /* 132 */ "expression_unary_and ::= expression_binary_inequal",
+ /* 133 */ "expression_op_or ::= OP_OR",
+ /* 134 */ "expression_binary_or ::= expression_binary_or expression_op_or expression_unary_or",
+ /* 135 */ "expression_binary_or ::= expression_unary_or",
+ /* 136 */ "expression_unary_or ::= expression_op_or expression_unary_or",
+ /* 137 */ "expression_unary_or ::= expression_binary_and",
+ /* 138 */ "expression_op_dollar ::= OP_DOLLAR",
+ /* 139 */ "expression_binary_dollar ::= expression_unary_dollar expression_op_dollar expression_binary_dollar",
+ /* 140 */ "expression_binary_dollar ::= expression_unary_dollar",
+ /* 141 */ "expression_unary_dollar ::= expression_op_dollar expression_unary_dollar",
+ /* 142 */ "expression_unary_dollar ::= expression_binary_or",
+ /* 143 */ "expression_binary_ascribe ::= expression_binary_dollar P_ASCRIBE expression_binary_ascribe",
+ /* 144 */ "expression_binary_ascribe ::= expression_binary_dollar",
+ /* 145 */ "expression_op_assign ::= OP_ASSIGN",
+ /* 146 */ "expression_binary_assign ::= expression_binary_assign expression_op_assign expression_unary_assign",
+ /* 147 */ "expression_binary_assign ::= expression_unary_assign",
+ /* 148 */ "expression_unary_assign ::= expression_op_assign expression_unary_assign",
+ /* 149 */ "expression_unary_assign ::= expression_binary_ascribe",
+ /* 150 */ "expression_op_comma ::= OP_COMMA",
+ /* 151 */ "expression_binary_comma ::= expression_unary_comma expression_op_comma expression_binary_comma",
+ /* 152 */ "expression_binary_comma ::= expression_unary_comma",
+ /* 153 */ "expression_unary_comma ::= expression_binary_assign",
+ /* 154 */ "expression_unary_comma ::= expression_unary_comma expression_op_comma",
+ /* 155 */ "op_dot ::= OP_DOT",
+ /* 156 */ "expression_term ::= expression_term op_dot expression_nodot",
+ /* 157 */ "expression_term ::= expression_nodot",
+ /* 158 */ "expression_nodot ::= ID",
+ /* 159 */ "expression_nodot ::= P_POPEN block_opt P_PCLOSE",
+ /* 160 */ "expression_nodot ::= P_HOLE",
+ /* 161 */ "expression_nodot ::= STR_RAW",
+ /* 162 */ "expression_nodot ::= STR_SINGLE",
+ /* 163 */ "expression_nodot ::= str_open interpolated_string str_close",
+ /* 164 */ "interpolated_string ::= expression",
+ /* 165 */ "interpolated_string ::= interpolated_string str_mid expression",
+ /* 166 */ "str_mid ::= STR_MID",
+ /* 167 */ "str_open ::= STR_OPEN",
+ /* 168 */ "str_close ::= STR_CLOSE",
+ /* 169 */ "expression_nodot ::= mstr_single",
+ /* 170 */ "expression_nodot ::= mstr_open interpolated_mstring mstr_close",
+ /* 171 */ "interpolated_mstring ::= expression",
+ /* 172 */ "interpolated_mstring ::= interpolated_mstring mstr_mid expression",
+ /* 173 */ "mstr_cont ::=",
+ /* 174 */ "mstr_cont ::= mstr_cont MSTR_CONTINUE",
+ /* 175 */ "mstr_cont ::= mstr_cont NL",
+ /* 176 */ "mstr_single ::= MSTR_BEGIN mstr_cont MSTR_END",
+ /* 177 */ "mstr_open ::= MSTR_BEGIN mstr_cont MSTR_PAUSE",
+ /* 178 */ "mstr_mid ::= MSTR_MID",
+ /* 179 */ "mstr_mid ::= MSTR_RESUME mstr_cont MSTR_PAUSE",
+ /* 180 */ "mstr_close ::= MSTR_RESUME mstr_cont MSTR_END",
+ /* 181 */ "expression_nodot ::= lstr_single",
+ /* 182 */ "expression_nodot ::= lstr_open interpolated_lstring lstr_close",
+ /* 183 */ "interpolated_lstring ::= expression",
+ /* 184 */ "interpolated_lstring ::= interpolated_lstring lstr_mid expression",
+ /* 185 */ "lstr_cont ::=",
+ /* 186 */ "lstr_cont ::= lstr_cont LSTR_CONTINUE",
+ /* 187 */ "lstr_cont ::= lstr_cont NL",
+ /* 188 */ "lstr_single ::= LSTR_BEGIN lstr_cont LSTR_END",
+ /* 189 */ "lstr_open ::= LSTR_BEGIN lstr_cont LSTR_PAUSE",
+ /* 190 */ "lstr_mid ::= LSTR_MID",
+ /* 191 */ "lstr_mid ::= LSTR_RESUME lstr_cont LSTR_PAUSE",
+ /* 192 */ "lstr_close ::= LSTR_RESUME lstr_cont LSTR_END",
+ /* 193 */ "expression_nodot ::= REG_SINGLE",
+ /* 194 */ "expression_nodot ::= reg_open interpolated_regexp reg_close",
+ /* 195 */ "interpolated_regexp ::= expression",
+ /* 196 */ "interpolated_regexp ::= interpolated_regexp reg_mid expression",
+ /* 197 */ "reg_mid ::= REG_MID",
+ /* 198 */ "reg_open ::= REG_OPEN",
+ /* 199 */ "reg_close ::= REG_CLOSE",
+ /* 200 */ "expression_nodot ::= DOUBLE",
+ /* 201 */ "expression_nodot ::= INTEGER",
+ /* 202 */ "expression_nodot ::= KW_MACRO_HERE",
+ /* 203 */ "expression_nodot ::= KW_MACRO_LINE",
+ /* 204 */ "expression_nodot ::= KW_MACRO_FILE",
+ /* 205 */ "expression_nodot ::= KW_MACRO_BANG",
+ /* 206 */ "expression_binary_app ::= expression_binary_app expression_term",
+ /* 207 */ "expression_binary_app ::= expression_term",
+ /* 208 */ "expression_binary_app ::= KW_SUBSCRIBE id",
+ /* 209 */ "expression_binary_app ::= KW_PRIM prim_literal",
+ /* 210 */ "prim_literal ::= STR_SINGLE",
+ /* 211 */ "expression_binary_app ::= KW_MATCH expression_term INDENT match1_cases DEDENT",
+ /* 212 */ "expression_binary_app ::= KW_MATCH match_terms INDENT matchx_cases DEDENT",
+ /* 213 */ "match1_cases ::= match1_cases NL match1_case",
+ /* 214 */ "match1_cases ::= match1_case",
+ /* 215 */ "match1_case ::= pattern guard block_opt",
+ /* 216 */ "match_terms ::= expression_term expression_term",
+ /* 217 */ "match_terms ::= match_terms expression_term",
+ /* 218 */ "matchx_cases ::= matchx_cases NL matchx_case",
+ /* 219 */ "matchx_cases ::= matchx_case",
+ /* 220 */ "matchx_case ::= pattern_terms guard block_opt",
+ /* 221 */ "pattern_terms ::= pattern_terms pattern_term",
+ /* 222 */ "pattern_terms ::= pattern_term",
+ /* 223 */ "guard ::= P_EQUALS",
+ /* 224 */ "guard ::= KW_IF expression P_EQUALS",
+ /* 225 */ "guard ::= P_ARROW",
+ /* 226 */ "guard ::= KW_IF expression P_ARROW",
+ /* 227 */ "expression ::= expression_binary_comma",
+ /* 228 */ "expression ::= P_BSLASH pattern_term expression",
+ /* 229 */ "expression ::= KW_IF block_opt KW_THEN block_opt KW_ELSE block_opt",
+ /* 230 */ "pattern ::= expression",
+ /* 231 */ "type ::= expression",
+ /* 232 */ "pattern_term ::= expression_term",
+ /* 233 */ "block_opt ::= expression",
+ /* 234 */ "block_opt ::= INDENT block",
+ /* 235 */ "block ::= body",
+ /* 236 */ "block ::= blockdefs body",
+ /* 237 */ "body ::= error DEDENT",
+ /* 238 */ "body ::= expression DEDENT",
+ /* 239 */ "body ::= KW_REQUIRE reqbad block",
+ /* 240 */ "body ::= KW_REQUIRE pattern reqbody reqelse block",
+ /* 241 */ "reqbad ::= reqelse",
+ /* 242 */ "reqbad ::= error reqelse",
+ /* 243 */ "reqbody ::=",
+ /* 244 */ "reqbody ::= error",
+ /* 245 */ "reqbody ::= P_EQUALS",
+ /* 246 */ "reqbody ::= P_EQUALS block_opt",
+ /* 247 */ "reqelse ::= NL KW_ELSE reqelsebody",
+ /* 248 */ "reqelse ::= KW_ELSE reqelsebody",
+ /* 249 */ "reqelse ::= NL",
+ /* 250 */ "reqelsebody ::= NL",
+ /* 251 */ "reqelsebody ::= error NL",
+ /* 252 */ "reqelsebody ::= block_opt NL",
+ /* 253 */ "blockdefs ::= blockdef",
+ /* 254 */ "blockdefs ::= blockdefs blockdef",
+ /* 255 */ "blockdef ::= error NL",
+ /* 256 */ "blockdef ::= INDENT error DEDENT",
+ /* 257 */ "blockdef ::= KW_DEF NL",
+ /* 258 */ "blockdef ::= KW_DEF error NL",
+ /* 259 */ "blockdef ::= KW_DEF pattern NL",
+ /* 260 */ "blockdef ::= KW_DEF pattern error NL",
+ /* 261 */ "blockdef ::= KW_DEF pattern P_EQUALS NL",
+ /* 262 */ "blockdef ::= KW_DEF pattern P_EQUALS block_opt NL",
+ /* 263 */ "blockdef ::= KW_FROM NL",
+ /* 264 */ "blockdef ::= KW_FROM error NL",
+ /* 265 */ "blockdef ::= KW_FROM id NL",
+ /* 266 */ "blockdef ::= KW_FROM id error NL",
+ /* 267 */ "blockdef ::= KW_FROM id KW_IMPORT P_HOLE NL",
+ /* 268 */ "blockdef ::= KW_FROM id KW_IMPORT kind arity NL",
+ /* 269 */ "blockdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL",
+};
+#endif /* NDEBUG */
+
+
+#if YYSTACKDEPTH<=0
+/*
+** Try to increase the size of the parser stack.  Return the number
+** of errors.  Return 0 on success.
+*/
+static int yyGrowStack(yyParser *p){
+  int newSize;
+  int idx;
+  yyStackEntry *pNew;
+
+  newSize = p->yystksz*2 + 100;
+  idx = p->yytos ? (int)(p->yytos - p->yystack) : 0;
+  if( p->yystack==&p->yystk0 ){
+    pNew = (yyStackEntry *)malloc(newSize*sizeof(pNew[0]));
+    if( pNew ) pNew[0] = p->yystk0;
+  }else{
+    pNew = (yyStackEntry *)realloc(p->yystack, newSize*sizeof(pNew[0]));
+  }
+  if( pNew ){
+    p->yystack = pNew;
+    p->yytos = &p->yystack[idx];
+#ifndef NDEBUG
+    if( yyTraceFILE ){
+      fprintf(yyTraceFILE,"%sStack grows from %d to %d entries.\n",
+              yyTracePrompt, p->yystksz, newSize);
+    }
+#endif
+    p->yystksz = newSize;
+  }
+  return pNew==0; 
+}
+#endif
+
+/* Datatype of the argument to the memory allocated passed as the
+** second argument to ParseAlloc() below.  This can be changed by
+** putting an appropriate #define in the %include section of the input
+** grammar.
+*/
+#ifndef YYMALLOCARGTYPE
+# define YYMALLOCARGTYPE size_t
+#endif
+
+/* Initialize a new parser that has already been allocated.
+*/
+void ParseInit(void *yypRawParser ParseCTX_PDECL){
+  yyParser *yypParser = (yyParser*)yypRawParser;
+  ParseCTX_STORE
+#ifdef YYTRACKMAXSTACKDEPTH
+  yypParser->yyhwm = 0;
+#endif
+#if YYSTACKDEPTH<=0
+  yypParser->yytos = NULL;
+  yypParser->yystack = NULL;
+  yypParser->yystksz = 0;
+  if( yyGrowStack(yypParser) ){
+    yypParser->yystack = &yypParser->yystk0;
+    yypParser->yystksz = 1;
+  }
+#endif
+#ifndef YYNOERRORRECOVERY
+  yypParser->yyerrcnt = -1;
+#endif
+  yypParser->yytos = yypParser->yystack;
+  yypParser->yystack[0].stateno = 0;
+  yypParser->yystack[0].major = 0;
+#if YYSTACKDEPTH>0
+  yypParser->yystackEnd = &yypParser->yystack[YYSTACKDEPTH-1];
+#endif
+}
+
+#ifndef Parse_ENGINEALWAYSONSTACK
+/* 
+** This function allocates a new parser.
+** The only argument is a pointer to a function which works like
+** malloc.
+**
+** Inputs:
+** A pointer to the function used to allocate memory.
+**
+** Outputs:
+** A pointer to a parser.  This pointer is used in subsequent calls
+** to Parse and ParseFree.
+*/
+void *ParseAlloc(void *(*mallocProc)(YYMALLOCARGTYPE) ParseCTX_PDECL){
+  yyParser *yypParser;
+  yypParser = (yyParser*)(*mallocProc)( (YYMALLOCARGTYPE)sizeof(yyParser) );
+  if( yypParser ){
+    ParseCTX_STORE
+    ParseInit(yypParser ParseCTX_PARAM);
+  }
+  return (void*)yypParser;
+}
+#endif /* Parse_ENGINEALWAYSONSTACK */
+
+
+/* The following function deletes the "minor type" or semantic value
+** associated with a symbol.  The symbol can be either a terminal
+** or nonterminal. "yymajor" is the symbol code, and "yypminor" is
+** a pointer to the value to be deleted.  The code used to do the 
+** deletions is derived from the %destructor and/or %token_destructor
+** directives of the input grammar.
+*/
+static void yy_destructor(
+  yyParser *yypParser,    /* The parser */
+  YYCODETYPE yymajor,     /* Type code for object to destroy */
+  YYMINORTYPE *yypminor   /* The object to be destroyed */
+){
+  ParseARG_FETCH
+  ParseCTX_FETCH
+  switch( yymajor ){
+    /* Here is inserted the actions which take place when a
+    ** terminal or non-terminal is destroyed.  This can happen
+    ** when the symbol is popped from the stack during a
+    ** reduce or during error processing or when a parser is 
+    ** being destroyed before it is finished parsing.
+    **
+    ** Note: during a reduce, the only symbols destroyed are those
+    ** which appear on the RHS of the rule, but which are *not* used
+    ** inside the C code.
+    */
+/********* Begin destructor definitions ***************************************/
+      /* Default NON-TERMINAL Destructor */
+    case 79: /* start */
+    case 80: /* top */
+    case 81: /* topdef */
+    case 82: /* id */
+    case 83: /* kind */
+    case 84: /* arity */
+    case 85: /* idopeqs */
+    case 86: /* idopeq */
+    case 87: /* idop */
+    case 88: /* global */
+    case 89: /* export */
+    case 90: /* type */
+    case 91: /* block_opt */
+    case 92: /* data_elts */
+    case 93: /* tuple_elts */
+    case 94: /* tuple_elt */
+    case 95: /* pattern */
+    case 96: /* target_pattern */
+    case 97: /* target_args */
+    case 98: /* pattern_terms */
+    case 99: /* expression_op_quant */
+    case 100: /* expression_binary_quant */
+    case 101: /* expression_unary_quant */
+    case 102: /* expression_binary_app */
+    case 103: /* expression_op_exp */
+    case 104: /* expression_binary_exp */
+    case 105: /* expression_unary_exp */
+    case 106: /* expression_op_muldiv */
+    case 107: /* expression_binary_muldiv */
+    case 108: /* expression_unary_muldiv */
+    case 109: /* expression_op_addsub */
+    case 110: /* expression_binary_addsub */
+    case 111: /* expression_unary_addsub */
+    case 112: /* expression_op_compare */
+    case 113: /* expression_binary_compare */
+    case 114: /* expression_unary_compare */
+    case 115: /* expression_op_inequal */
+    case 116: /* expression_binary_inequal */
+    case 117: /* expression_unary_inequal */
+    case 118: /* expression_op_and */
+    case 119: /* expression_binary_and */
+    case 120: /* expression_unary_and */
+    case 121: /* expression_op_or */
+    case 122: /* expression_binary_or */
+    case 123: /* expression_unary_or */
+    case 124: /* expression_op_dollar */
+    case 125: /* expression_binary_dollar */
+    case 126: /* expression_unary_dollar */
+    case 127: /* expression_binary_ascribe */
+    case 128: /* expression_op_assign */
+    case 129: /* expression_binary_assign */
+    case 130: /* expression_unary_assign */
+    case 131: /* expression_op_comma */
+    case 132: /* expression_binary_comma */
+    case 133: /* expression_unary_comma */
+    case 134: /* op_dot */
+    case 135: /* expression_term */
+    case 136: /* expression_nodot */
+    case 137: /* str_open */
+    case 138: /* interpolated_string */
+    case 139: /* str_close */
+    case 140: /* expression */
+    case 141: /* str_mid */
+    case 142: /* mstr_single */
+    case 143: /* mstr_open */
+    case 144: /* interpolated_mstring */
+    case 145: /* mstr_close */
+    case 146: /* mstr_mid */
+    case 147: /* mstr_cont */
+    case 148: /* lstr_single */
+    case 149: /* lstr_open */
+    case 150: /* interpolated_lstring */
+    case 151: /* lstr_close */
+    case 152: /* lstr_mid */
+    case 153: /* lstr_cont */
+    case 154: /* reg_open */
+    case 155: /* interpolated_regexp */
+    case 156: /* reg_close */
+    case 157: /* reg_mid */
+    case 158: /* prim_literal */
+    case 159: /* match1_cases */
+    case 160: /* match_terms */
+    case 161: /* matchx_cases */
+    case 162: /* match1_case */
+    case 163: /* guard */
+    case 164: /* matchx_case */
+    case 165: /* pattern_term */
+    case 166: /* block */
+    case 167: /* body */
+    case 168: /* blockdefs */
+    case 169: /* reqbad */
+    case 170: /* reqbody */
+    case 171: /* reqelse */
+    case 172: /* reqelsebody */
+    case 173: /* blockdef */
+{
+#line 25 "src/parser/parser.y"
+ pop((yypminor->yy43)); 
+#line 2220 "src/parser/parser.c"
+}
+      break;
+    case 78: /* error */
+{
+#line 26 "src/parser/parser.y"
+ 
+#line 2227 "src/parser/parser.c"
+}
+      break;
+/********* End destructor definitions *****************************************/
+    default:  break;   /* If no destructor action specified: do nothing */
+  }
+}
+
+/*
+** Pop the parser's stack once.
+**
+** If there is a destructor routine associated with the token which
+** is popped from the stack, then call it.
+*/
+static void yy_pop_parser_stack(yyParser *pParser){
+  yyStackEntry *yytos;
+  assert( pParser->yytos!=0 );
+  assert( pParser->yytos > pParser->yystack );
+  yytos = pParser->yytos--;
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sPopping %s\n",
+      yyTracePrompt,
+      yyTokenName[yytos->major]);
+  }
+#endif
+  yy_destructor(pParser, yytos->major, &yytos->minor);
+}
+
+/*
+** Clear all secondary memory allocations from the parser
+*/
+void ParseFinalize(void *p){
+  yyParser *pParser = (yyParser*)p;
+  while( pParser->yytos>pParser->yystack ) yy_pop_parser_stack(pParser);
+#if YYSTACKDEPTH<=0
+  if( pParser->yystack!=&pParser->yystk0 ) free(pParser->yystack);
+#endif
+}
+
+#ifndef Parse_ENGINEALWAYSONSTACK
+/* 
+** Deallocate and destroy a parser.  Destructors are called for
+** all stack elements before shutting the parser down.
+**
+** If the YYPARSEFREENEVERNULL macro exists (for example because it
+** is defined in a %include section of the input grammar) then it is
+** assumed that the input pointer is never NULL.
+*/
+void ParseFree(
+  void *p,                    /* The parser to be deleted */
+  void (*freeProc)(void*)     /* Function used to reclaim memory */
+){
+#ifndef YYPARSEFREENEVERNULL
+  if( p==0 ) return;
+#endif
+  ParseFinalize(p);
+  (*freeProc)(p);
+}
+#endif /* Parse_ENGINEALWAYSONSTACK */
+
+/*
+** Return the peak depth of the stack for a parser.
+*/
+#ifdef YYTRACKMAXSTACKDEPTH
+int ParseStackPeak(void *p){
+  yyParser *pParser = (yyParser*)p;
+  return pParser->yyhwm;
+}
+#endif
+
+/* This array of booleans keeps track of the parser statement
+** coverage.  The element yycoverage[X][Y] is set when the parser
+** is in state X and has a lookahead token Y.  In a well-tested
+** systems, every element of this matrix should end up being set.
+*/
+#if defined(YYCOVERAGE)
+static unsigned char yycoverage[YYNSTATE][YYNTOKEN];
+#endif
+
+/*
+** Write into out a description of every state/lookahead combination that
+**
+**   (1)  has not been used by the parser, and
+**   (2)  is not a syntax error.
+**
+** Return the number of missed state/lookahead combinations.
+*/
+#if defined(YYCOVERAGE)
+int ParseCoverage(FILE *out){
+  int stateno, iLookAhead, i;
+  int nMissed = 0;
+  for(stateno=0; stateno<YYNSTATE; stateno++){
+    i = yy_shift_ofst[stateno];
+    for(iLookAhead=0; iLookAhead<YYNTOKEN; iLookAhead++){
+      if( yy_lookahead[i+iLookAhead]!=iLookAhead ) continue;
+      if( yycoverage[stateno][iLookAhead]==0 ) nMissed++;
+      if( out ){
+        fprintf(out,"State %d lookahead %s %s\n", stateno,
+                yyTokenName[iLookAhead],
+                yycoverage[stateno][iLookAhead] ? "ok" : "missed");
+      }
+    }
+  }
+  return nMissed;
+}
+#endif
+
+/*
+** Find the appropriate action for a parser given the terminal
+** look-ahead token iLookAhead.
+*/
+static YYACTIONTYPE yy_find_shift_action(
+  YYCODETYPE iLookAhead,    /* The look-ahead token */
+  YYACTIONTYPE stateno      /* Current state number */
+){
+  int i;
+
+  if( stateno>YY_MAX_SHIFT ) return stateno;
+  assert( stateno <= YY_SHIFT_COUNT );
+#if defined(YYCOVERAGE)
+  yycoverage[stateno][iLookAhead] = 1;
+#endif
+  do{
+    i = yy_shift_ofst[stateno];
+    assert( i>=0 );
+    assert( i<=YY_ACTTAB_COUNT );
+    assert( i+YYNTOKEN<=(int)YY_NLOOKAHEAD );
+    assert( iLookAhead!=YYNOCODE );
+    assert( iLookAhead < YYNTOKEN );
+    i += iLookAhead;
+    assert( i<(int)YY_NLOOKAHEAD );
+    if( yy_lookahead[i]!=iLookAhead ){
+#ifdef YYFALLBACK
+      YYCODETYPE iFallback;            /* Fallback token */
+      assert( iLookAhead<sizeof(yyFallback)/sizeof(yyFallback[0]) );
+      iFallback = yyFallback[iLookAhead];
+      if( iFallback!=0 ){
+#ifndef NDEBUG
+        if( yyTraceFILE ){
+          fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n",
+             yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
+        }
+#endif
+        assert( yyFallback[iFallback]==0 ); /* Fallback loop must terminate */
+        iLookAhead = iFallback;
+        continue;
+      }
+#endif
+#ifdef YYWILDCARD
+      {
+        int j = i - iLookAhead + YYWILDCARD;
+        assert( j<(int)(sizeof(yy_lookahead)/sizeof(yy_lookahead[0])) );
+        if( yy_lookahead[j]==YYWILDCARD && iLookAhead>0 ){
+#ifndef NDEBUG
+          if( yyTraceFILE ){
+            fprintf(yyTraceFILE, "%sWILDCARD %s => %s\n",
+               yyTracePrompt, yyTokenName[iLookAhead],
+               yyTokenName[YYWILDCARD]);
+          }
+#endif /* NDEBUG */
+          return yy_action[j];
+        }
+      }
+#endif /* YYWILDCARD */
+      return yy_default[stateno];
+    }else{
+      assert( i>=0 && i<(int)(sizeof(yy_action)/sizeof(yy_action[0])) );
+      return yy_action[i];
+    }
+  }while(1);
+}
+
+/*
+** Find the appropriate action for a parser given the non-terminal
+** look-ahead token iLookAhead.
+*/
+static YYACTIONTYPE yy_find_reduce_action(
+  YYACTIONTYPE stateno,     /* Current state number */
+  YYCODETYPE iLookAhead     /* The look-ahead token */
+){
+  int i;
+#ifdef YYERRORSYMBOL
+  if( stateno>YY_REDUCE_COUNT ){
+    return yy_default[stateno];
+  }
+#else
+  assert( stateno<=YY_REDUCE_COUNT );
+#endif
+  i = yy_reduce_ofst[stateno];
+  assert( iLookAhead!=YYNOCODE );
+  i += iLookAhead;
+#ifdef YYERRORSYMBOL
+  if( i<0 || i>=YY_ACTTAB_COUNT || yy_lookahead[i]!=iLookAhead ){
+    return yy_default[stateno];
+  }
+#else
+  assert( i>=0 && i<YY_ACTTAB_COUNT );
+  assert( yy_lookahead[i]==iLookAhead );
+#endif
+  return yy_action[i];
+}
+
+/*
+** The following routine is called if the stack overflows.
+*/
+static void yyStackOverflow(yyParser *yypParser){
+   ParseARG_FETCH
+   ParseCTX_FETCH
+#ifndef NDEBUG
+   if( yyTraceFILE ){
+     fprintf(yyTraceFILE,"%sStack Overflow!\n",yyTracePrompt);
+   }
+#endif
+   while( yypParser->yytos>yypParser->yystack ) yy_pop_parser_stack(yypParser);
+   /* Here code is inserted which will execute if the parser
+   ** stack every overflows */
+/******** Begin %stack_overflow code ******************************************/
+/******** End %stack_overflow code ********************************************/
+   ParseARG_STORE /* Suppress warning about unused %extra_argument var */
+   ParseCTX_STORE
+}
+
+/*
+** Print tracing information for a SHIFT action
+*/
+#ifndef NDEBUG
+static void yyTraceShift(yyParser *yypParser, int yyNewState, const char *zTag){
+  if( yyTraceFILE ){
+    if( yyNewState<YYNSTATE ){
+      fprintf(yyTraceFILE,"%s%s '%s', go to state %d\n",
+         yyTracePrompt, zTag, yyTokenName[yypParser->yytos->major],
+         yyNewState);
+    }else{
+      fprintf(yyTraceFILE,"%s%s '%s', pending reduce %d\n",
+         yyTracePrompt, zTag, yyTokenName[yypParser->yytos->major],
+         yyNewState - YY_MIN_REDUCE);
+    }
+  }
+}
+#else
+# define yyTraceShift(X,Y,Z)
+#endif
+
+/*
+** Perform a shift action.
+*/
+static void yy_shift(
+  yyParser *yypParser,          /* The parser to be shifted */
+  YYACTIONTYPE yyNewState,      /* The new state to shift in */
+  YYCODETYPE yyMajor,           /* The major token to shift in */
+  ParseTOKENTYPE yyMinor        /* The minor token to shift in */
+){
+  yyStackEntry *yytos;
+  yypParser->yytos++;
+#ifdef YYTRACKMAXSTACKDEPTH
+  if( (int)(yypParser->yytos - yypParser->yystack)>yypParser->yyhwm ){
+    yypParser->yyhwm++;
+    assert( yypParser->yyhwm == (int)(yypParser->yytos - yypParser->yystack) );
+  }
+#endif
+#if YYSTACKDEPTH>0 
+  if( yypParser->yytos>yypParser->yystackEnd ){
+    yypParser->yytos--;
+    yyStackOverflow(yypParser);
+    return;
+  }
+#else
+  if( yypParser->yytos>=&yypParser->yystack[yypParser->yystksz] ){
+    if( yyGrowStack(yypParser) ){
+      yypParser->yytos--;
+      yyStackOverflow(yypParser);
+      return;
+    }
+  }
+#endif
+  if( yyNewState > YY_MAX_SHIFT ){
+    yyNewState += YY_MIN_REDUCE - YY_MIN_SHIFTREDUCE;
+  }
+  yytos = yypParser->yytos;
+  yytos->stateno = yyNewState;
+  yytos->major = yyMajor;
+  yytos->minor.yy0 = yyMinor;
+  yyTraceShift(yypParser, yyNewState, "Shift");
+}
+
+/* For rule J, yyRuleInfoLhs[J] contains the symbol on the left-hand side
+** of that rule */
+static const YYCODETYPE yyRuleInfoLhs[] = {
+    79,  /* (0) start ::= top */
+    80,  /* (1) top ::= */
+    80,  /* (2) top ::= top topdef */
+    82,  /* (3) id ::= ID */
+    81,  /* (4) topdef ::= error NL */
+    81,  /* (5) topdef ::= INDENT error DEDENT */
+    81,  /* (6) topdef ::= KW_PACKAGE NL */
+    81,  /* (7) topdef ::= KW_PACKAGE error NL */
+    81,  /* (8) topdef ::= KW_PACKAGE id NL */
+    81,  /* (9) topdef ::= KW_FROM NL */
+    81,  /* (10) topdef ::= KW_FROM error NL */
+    81,  /* (11) topdef ::= KW_FROM id NL */
+    81,  /* (12) topdef ::= KW_FROM id error NL */
+    81,  /* (13) topdef ::= KW_FROM id KW_IMPORT P_HOLE NL */
+    81,  /* (14) topdef ::= KW_FROM id KW_IMPORT kind arity NL */
+    81,  /* (15) topdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL */
+    81,  /* (16) topdef ::= KW_FROM id KW_EXPORT kind arity NL */
+    81,  /* (17) topdef ::= KW_FROM id KW_EXPORT kind arity idopeqs NL */
+    83,  /* (18) kind ::= KW_DEF */
+    83,  /* (19) kind ::= KW_TYPE */
+    83,  /* (20) kind ::= KW_TOPIC */
+    83,  /* (21) kind ::= */
+    84,  /* (22) arity ::= KW_UNARY */
+    84,  /* (23) arity ::= KW_BINARY */
+    84,  /* (24) arity ::= */
+    85,  /* (25) idopeqs ::= error */
+    85,  /* (26) idopeqs ::= idopeqs error */
+    85,  /* (27) idopeqs ::= idopeqs idopeq */
+    85,  /* (28) idopeqs ::= idopeq */
+    86,  /* (29) idopeq ::= idop P_EQUALS idop */
+    86,  /* (30) idopeq ::= idop */
+    87,  /* (31) idop ::= ID */
+    87,  /* (32) idop ::= OP_DOT */
+    87,  /* (33) idop ::= OP_QUANT */
+    87,  /* (34) idop ::= OP_EXP */
+    87,  /* (35) idop ::= OP_MULDIV */
+    87,  /* (36) idop ::= OP_ADDSUB */
+    87,  /* (37) idop ::= OP_COMPARE */
+    87,  /* (38) idop ::= OP_INEQUAL */
+    87,  /* (39) idop ::= OP_AND */
+    87,  /* (40) idop ::= OP_OR */
+    87,  /* (41) idop ::= OP_DOLLAR */
+    87,  /* (42) idop ::= OP_ASSIGN */
+    87,  /* (43) idop ::= OP_COMMA */
+    88,  /* (44) global ::= */
+    88,  /* (45) global ::= KW_GLOBAL */
+    89,  /* (46) export ::= */
+    89,  /* (47) export ::= KW_EXPORT */
+    81,  /* (48) topdef ::= global export KW_TOPIC NL */
+    81,  /* (49) topdef ::= global export KW_TOPIC error NL */
+    81,  /* (50) topdef ::= global export KW_TOPIC id NL */
+    81,  /* (51) topdef ::= global export KW_TOPIC id error NL */
+    81,  /* (52) topdef ::= global export KW_TOPIC id P_ASCRIBE NL */
+    81,  /* (53) topdef ::= global export KW_TOPIC id P_ASCRIBE type NL */
+    81,  /* (54) topdef ::= KW_PUBLISH NL */
+    81,  /* (55) topdef ::= KW_PUBLISH error NL */
+    81,  /* (56) topdef ::= KW_PUBLISH id NL */
+    81,  /* (57) topdef ::= KW_PUBLISH id error NL */
+    81,  /* (58) topdef ::= KW_PUBLISH id P_EQUALS NL */
+    81,  /* (59) topdef ::= KW_PUBLISH id P_EQUALS block_opt NL */
+    81,  /* (60) topdef ::= global export KW_DATA NL */
+    81,  /* (61) topdef ::= global export KW_DATA error NL */
+    81,  /* (62) topdef ::= global export KW_DATA type NL */
+    81,  /* (63) topdef ::= global export KW_DATA type error NL */
+    81,  /* (64) topdef ::= global export KW_DATA type P_EQUALS NL */
+    81,  /* (65) topdef ::= global export KW_DATA type P_EQUALS type NL */
+    81,  /* (66) topdef ::= global export KW_DATA type P_EQUALS INDENT data_elts DEDENT */
+    92,  /* (67) data_elts ::= error */
+    92,  /* (68) data_elts ::= type */
+    92,  /* (69) data_elts ::= data_elts NL error */
+    92,  /* (70) data_elts ::= data_elts NL type */
+    81,  /* (71) topdef ::= global export KW_TUPLE NL */
+    81,  /* (72) topdef ::= global export KW_TUPLE error NL */
+    81,  /* (73) topdef ::= global export KW_TUPLE type NL */
+    81,  /* (74) topdef ::= global export KW_TUPLE type error NL */
+    81,  /* (75) topdef ::= global export KW_TUPLE type P_EQUALS NL */
+    81,  /* (76) topdef ::= global export KW_TUPLE type P_EQUALS error NL */
+    81,  /* (77) topdef ::= global export KW_TUPLE type P_EQUALS INDENT tuple_elts DEDENT */
+    93,  /* (78) tuple_elts ::= error */
+    93,  /* (79) tuple_elts ::= tuple_elt */
+    93,  /* (80) tuple_elts ::= tuple_elts NL error */
+    93,  /* (81) tuple_elts ::= tuple_elts NL tuple_elt */
+    94,  /* (82) tuple_elt ::= global export type */
+    81,  /* (83) topdef ::= global export KW_DEF NL */
+    81,  /* (84) topdef ::= global export KW_DEF error NL */
+    81,  /* (85) topdef ::= global export KW_DEF pattern NL */
+    81,  /* (86) topdef ::= global export KW_DEF pattern error NL */
+    81,  /* (87) topdef ::= global export KW_DEF pattern P_EQUALS NL */
+    81,  /* (88) topdef ::= global export KW_DEF pattern P_EQUALS block_opt NL */
+    81,  /* (89) topdef ::= global export KW_TARGET NL */
+    81,  /* (90) topdef ::= global export KW_TARGET error NL */
+    81,  /* (91) topdef ::= global export KW_TARGET target_pattern NL */
+    81,  /* (92) topdef ::= global export KW_TARGET target_pattern error NL */
+    81,  /* (93) topdef ::= global export KW_TARGET target_pattern P_EQUALS NL */
+    81,  /* (94) topdef ::= global export KW_TARGET target_pattern P_EQUALS block_opt NL */
+    96,  /* (95) target_pattern ::= pattern */
+    96,  /* (96) target_pattern ::= pattern P_BSLASH target_args */
+    97,  /* (97) target_args ::= pattern_terms */
+    99,  /* (98) expression_op_quant ::= OP_QUANT */
+   100,  /* (99) expression_binary_quant ::= expression_binary_quant expression_op_quant expression_unary_quant */
+   100,  /* (100) expression_binary_quant ::= expression_unary_quant */
+   101,  /* (101) expression_unary_quant ::= expression_op_quant expression_unary_quant */
+   101,  /* (102) expression_unary_quant ::= expression_binary_app */
+   103,  /* (103) expression_op_exp ::= OP_EXP */
+   104,  /* (104) expression_binary_exp ::= expression_unary_exp expression_op_exp expression_binary_exp */
+   104,  /* (105) expression_binary_exp ::= expression_unary_exp */
+   105,  /* (106) expression_unary_exp ::= expression_op_exp expression_unary_exp */
+   105,  /* (107) expression_unary_exp ::= expression_binary_quant */
+   106,  /* (108) expression_op_muldiv ::= OP_MULDIV */
+   107,  /* (109) expression_binary_muldiv ::= expression_binary_muldiv expression_op_muldiv expression_unary_muldiv */
+   107,  /* (110) expression_binary_muldiv ::= expression_unary_muldiv */
+   108,  /* (111) expression_unary_muldiv ::= expression_op_muldiv expression_unary_muldiv */
+   108,  /* (112) expression_unary_muldiv ::= expression_binary_exp */
+   109,  /* (113) expression_op_addsub ::= OP_ADDSUB */
+   110,  /* (114) expression_binary_addsub ::= expression_binary_addsub expression_op_addsub expression_unary_addsub */
+   110,  /* (115) expression_binary_addsub ::= expression_unary_addsub */
+   111,  /* (116) expression_unary_addsub ::= expression_op_addsub expression_unary_addsub */
+   111,  /* (117) expression_unary_addsub ::= expression_binary_muldiv */
+   112,  /* (118) expression_op_compare ::= OP_COMPARE */
+   113,  /* (119) expression_binary_compare ::= expression_binary_compare expression_op_compare expression_unary_compare */
+   113,  /* (120) expression_binary_compare ::= expression_unary_compare */
+   114,  /* (121) expression_unary_compare ::= expression_op_compare expression_unary_compare */
+   114,  /* (122) expression_unary_compare ::= expression_binary_addsub */
+   115,  /* (123) expression_op_inequal ::= OP_INEQUAL */
+   116,  /* (124) expression_binary_inequal ::= expression_unary_inequal expression_op_inequal expression_binary_inequal */
+   116,  /* (125) expression_binary_inequal ::= expression_unary_inequal */
+   117,  /* (126) expression_unary_inequal ::= expression_op_inequal expression_unary_inequal */
+   117,  /* (127) expression_unary_inequal ::= expression_binary_compare */
+   118,  /* (128) expression_op_and ::= OP_AND */
+   119,  /* (129) expression_binary_and ::= expression_binary_and expression_op_and expression_unary_and */
+   119,  /* (130) expression_binary_and ::= expression_unary_and */
+   120,  /* (131) expression_unary_and ::= expression_op_and expression_unary_and */
+   120,  /* (132) expression_unary_and ::= expression_binary_inequal */
+   121,  /* (133) expression_op_or ::= OP_OR */
+   122,  /* (134) expression_binary_or ::= expression_binary_or expression_op_or expression_unary_or */
+   122,  /* (135) expression_binary_or ::= expression_unary_or */
+   123,  /* (136) expression_unary_or ::= expression_op_or expression_unary_or */
+   123,  /* (137) expression_unary_or ::= expression_binary_and */
+   124,  /* (138) expression_op_dollar ::= OP_DOLLAR */
+   125,  /* (139) expression_binary_dollar ::= expression_unary_dollar expression_op_dollar expression_binary_dollar */
+   125,  /* (140) expression_binary_dollar ::= expression_unary_dollar */
+   126,  /* (141) expression_unary_dollar ::= expression_op_dollar expression_unary_dollar */
+   126,  /* (142) expression_unary_dollar ::= expression_binary_or */
+   127,  /* (143) expression_binary_ascribe ::= expression_binary_dollar P_ASCRIBE expression_binary_ascribe */
+   127,  /* (144) expression_binary_ascribe ::= expression_binary_dollar */
+   128,  /* (145) expression_op_assign ::= OP_ASSIGN */
+   129,  /* (146) expression_binary_assign ::= expression_binary_assign expression_op_assign expression_unary_assign */
+   129,  /* (147) expression_binary_assign ::= expression_unary_assign */
+   130,  /* (148) expression_unary_assign ::= expression_op_assign expression_unary_assign */
+   130,  /* (149) expression_unary_assign ::= expression_binary_ascribe */
+   131,  /* (150) expression_op_comma ::= OP_COMMA */
+   132,  /* (151) expression_binary_comma ::= expression_unary_comma expression_op_comma expression_binary_comma */
+   132,  /* (152) expression_binary_comma ::= expression_unary_comma */
+   133,  /* (153) expression_unary_comma ::= expression_binary_assign */
+   133,  /* (154) expression_unary_comma ::= expression_unary_comma expression_op_comma */
+   134,  /* (155) op_dot ::= OP_DOT */
+   135,  /* (156) expression_term ::= expression_term op_dot expression_nodot */
+   135,  /* (157) expression_term ::= expression_nodot */
+   136,  /* (158) expression_nodot ::= ID */
+   136,  /* (159) expression_nodot ::= P_POPEN block_opt P_PCLOSE */
+   136,  /* (160) expression_nodot ::= P_HOLE */
+   136,  /* (161) expression_nodot ::= STR_RAW */
+   136,  /* (162) expression_nodot ::= STR_SINGLE */
+   136,  /* (163) expression_nodot ::= str_open interpolated_string str_close */
+   138,  /* (164) interpolated_string ::= expression */
+   138,  /* (165) interpolated_string ::= interpolated_string str_mid expression */
+   141,  /* (166) str_mid ::= STR_MID */
+   137,  /* (167) str_open ::= STR_OPEN */
+   139,  /* (168) str_close ::= STR_CLOSE */
+   136,  /* (169) expression_nodot ::= mstr_single */
+   136,  /* (170) expression_nodot ::= mstr_open interpolated_mstring mstr_close */
+   144,  /* (171) interpolated_mstring ::= expression */
+   144,  /* (172) interpolated_mstring ::= interpolated_mstring mstr_mid expression */
+   147,  /* (173) mstr_cont ::= */
+   147,  /* (174) mstr_cont ::= mstr_cont MSTR_CONTINUE */
+   147,  /* (175) mstr_cont ::= mstr_cont NL */
+   142,  /* (176) mstr_single ::= MSTR_BEGIN mstr_cont MSTR_END */
+   143,  /* (177) mstr_open ::= MSTR_BEGIN mstr_cont MSTR_PAUSE */
+   146,  /* (178) mstr_mid ::= MSTR_MID */
+   146,  /* (179) mstr_mid ::= MSTR_RESUME mstr_cont MSTR_PAUSE */
+   145,  /* (180) mstr_close ::= MSTR_RESUME mstr_cont MSTR_END */
+   136,  /* (181) expression_nodot ::= lstr_single */
+   136,  /* (182) expression_nodot ::= lstr_open interpolated_lstring lstr_close */
+   150,  /* (183) interpolated_lstring ::= expression */
+   150,  /* (184) interpolated_lstring ::= interpolated_lstring lstr_mid expression */
+   153,  /* (185) lstr_cont ::= */
+   153,  /* (186) lstr_cont ::= lstr_cont LSTR_CONTINUE */
+   153,  /* (187) lstr_cont ::= lstr_cont NL */
+   148,  /* (188) lstr_single ::= LSTR_BEGIN lstr_cont LSTR_END */
+   149,  /* (189) lstr_open ::= LSTR_BEGIN lstr_cont LSTR_PAUSE */
+   152,  /* (190) lstr_mid ::= LSTR_MID */
+   152,  /* (191) lstr_mid ::= LSTR_RESUME lstr_cont LSTR_PAUSE */
+   151,  /* (192) lstr_close ::= LSTR_RESUME lstr_cont LSTR_END */
+   136,  /* (193) expression_nodot ::= REG_SINGLE */
+   136,  /* (194) expression_nodot ::= reg_open interpolated_regexp reg_close */
+   155,  /* (195) interpolated_regexp ::= expression */
+   155,  /* (196) interpolated_regexp ::= interpolated_regexp reg_mid expression */
+   157,  /* (197) reg_mid ::= REG_MID */
+   154,  /* (198) reg_open ::= REG_OPEN */
+   156,  /* (199) reg_close ::= REG_CLOSE */
+   136,  /* (200) expression_nodot ::= DOUBLE */
+   136,  /* (201) expression_nodot ::= INTEGER */
+   136,  /* (202) expression_nodot ::= KW_MACRO_HERE */
+   136,  /* (203) expression_nodot ::= KW_MACRO_LINE */
+   136,  /* (204) expression_nodot ::= KW_MACRO_FILE */
+   136,  /* (205) expression_nodot ::= KW_MACRO_BANG */
+   102,  /* (206) expression_binary_app ::= expression_binary_app expression_term */
+   102,  /* (207) expression_binary_app ::= expression_term */
+   102,  /* (208) expression_binary_app ::= KW_SUBSCRIBE id */
+   102,  /* (209) expression_binary_app ::= KW_PRIM prim_literal */
+   158,  /* (210) prim_literal ::= STR_SINGLE */
+   102,  /* (211) expression_binary_app ::= KW_MATCH expression_term INDENT match1_cases DEDENT */
+   102,  /* (212) expression_binary_app ::= KW_MATCH match_terms INDENT matchx_cases DEDENT */
+   159,  /* (213) match1_cases ::= match1_cases NL match1_case */
+   159,  /* (214) match1_cases ::= match1_case */
+   162,  /* (215) match1_case ::= pattern guard block_opt */
+   160,  /* (216) match_terms ::= expression_term expression_term */
+   160,  /* (217) match_terms ::= match_terms expression_term */
+   161,  /* (218) matchx_cases ::= matchx_cases NL matchx_case */
+   161,  /* (219) matchx_cases ::= matchx_case */
+   164,  /* (220) matchx_case ::= pattern_terms guard block_opt */
+    98,  /* (221) pattern_terms ::= pattern_terms pattern_term */
+    98,  /* (222) pattern_terms ::= pattern_term */
+   163,  /* (223) guard ::= P_EQUALS */
+   163,  /* (224) guard ::= KW_IF expression P_EQUALS */
+   163,  /* (225) guard ::= P_ARROW */
+   163,  /* (226) guard ::= KW_IF expression P_ARROW */
+   140,  /* (227) expression ::= expression_binary_comma */
+   140,  /* (228) expression ::= P_BSLASH pattern_term expression */
+   140,  /* (229) expression ::= KW_IF block_opt KW_THEN block_opt KW_ELSE block_opt */
+    95,  /* (230) pattern ::= expression */
+    90,  /* (231) type ::= expression */
+   165,  /* (232) pattern_term ::= expression_term */
+    91,  /* (233) block_opt ::= expression */
+    91,  /* (234) block_opt ::= INDENT block */
+   166,  /* (235) block ::= body */
+   166,  /* (236) block ::= blockdefs body */
+   167,  /* (237) body ::= error DEDENT */
+   167,  /* (238) body ::= expression DEDENT */
+   167,  /* (239) body ::= KW_REQUIRE reqbad block */
+   167,  /* (240) body ::= KW_REQUIRE pattern reqbody reqelse block */
+   169,  /* (241) reqbad ::= reqelse */
+   169,  /* (242) reqbad ::= error reqelse */
+   170,  /* (243) reqbody ::= */
+   170,  /* (244) reqbody ::= error */
+   170,  /* (245) reqbody ::= P_EQUALS */
+   170,  /* (246) reqbody ::= P_EQUALS block_opt */
+   171,  /* (247) reqelse ::= NL KW_ELSE reqelsebody */
+   171,  /* (248) reqelse ::= KW_ELSE reqelsebody */
+   171,  /* (249) reqelse ::= NL */
+   172,  /* (250) reqelsebody ::= NL */
+   172,  /* (251) reqelsebody ::= error NL */
+   172,  /* (252) reqelsebody ::= block_opt NL */
+   168,  /* (253) blockdefs ::= blockdef */
+   168,  /* (254) blockdefs ::= blockdefs blockdef */
+   173,  /* (255) blockdef ::= error NL */
+   173,  /* (256) blockdef ::= INDENT error DEDENT */
+   173,  /* (257) blockdef ::= KW_DEF NL */
+   173,  /* (258) blockdef ::= KW_DEF error NL */
+   173,  /* (259) blockdef ::= KW_DEF pattern NL */
+   173,  /* (260) blockdef ::= KW_DEF pattern error NL */
+   173,  /* (261) blockdef ::= KW_DEF pattern P_EQUALS NL */
+   173,  /* (262) blockdef ::= KW_DEF pattern P_EQUALS block_opt NL */
+   173,  /* (263) blockdef ::= KW_FROM NL */
+   173,  /* (264) blockdef ::= KW_FROM error NL */
+   173,  /* (265) blockdef ::= KW_FROM id NL */
+   173,  /* (266) blockdef ::= KW_FROM id error NL */
+   173,  /* (267) blockdef ::= KW_FROM id KW_IMPORT P_HOLE NL */
+   173,  /* (268) blockdef ::= KW_FROM id KW_IMPORT kind arity NL */
+   173,  /* (269) blockdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL */
+};
+
+/* For rule J, yyRuleInfoNRhs[J] contains the negative of the number
+** of symbols on the right-hand side of that rule. */
+static const signed char yyRuleInfoNRhs[] = {
+   -1,  /* (0) start ::= top */
+    0,  /* (1) top ::= */
+   -2,  /* (2) top ::= top topdef */
+   -1,  /* (3) id ::= ID */
+   -2,  /* (4) topdef ::= error NL */
+   -3,  /* (5) topdef ::= INDENT error DEDENT */
+   -2,  /* (6) topdef ::= KW_PACKAGE NL */
+   -3,  /* (7) topdef ::= KW_PACKAGE error NL */
+   -3,  /* (8) topdef ::= KW_PACKAGE id NL */
+   -2,  /* (9) topdef ::= KW_FROM NL */
+   -3,  /* (10) topdef ::= KW_FROM error NL */
+   -3,  /* (11) topdef ::= KW_FROM id NL */
+   -4,  /* (12) topdef ::= KW_FROM id error NL */
+   -5,  /* (13) topdef ::= KW_FROM id KW_IMPORT P_HOLE NL */
+   -6,  /* (14) topdef ::= KW_FROM id KW_IMPORT kind arity NL */
+   -7,  /* (15) topdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL */
+   -6,  /* (16) topdef ::= KW_FROM id KW_EXPORT kind arity NL */
+   -7,  /* (17) topdef ::= KW_FROM id KW_EXPORT kind arity idopeqs NL */
+   -1,  /* (18) kind ::= KW_DEF */
+   -1,  /* (19) kind ::= KW_TYPE */
+   -1,  /* (20) kind ::= KW_TOPIC */
+    0,  /* (21) kind ::= */
+   -1,  /* (22) arity ::= KW_UNARY */
+   -1,  /* (23) arity ::= KW_BINARY */
+    0,  /* (24) arity ::= */
+   -1,  /* (25) idopeqs ::= error */
+   -2,  /* (26) idopeqs ::= idopeqs error */
+   -2,  /* (27) idopeqs ::= idopeqs idopeq */
+   -1,  /* (28) idopeqs ::= idopeq */
+   -3,  /* (29) idopeq ::= idop P_EQUALS idop */
+   -1,  /* (30) idopeq ::= idop */
+   -1,  /* (31) idop ::= ID */
+   -1,  /* (32) idop ::= OP_DOT */
+   -1,  /* (33) idop ::= OP_QUANT */
+   -1,  /* (34) idop ::= OP_EXP */
+   -1,  /* (35) idop ::= OP_MULDIV */
+   -1,  /* (36) idop ::= OP_ADDSUB */
+   -1,  /* (37) idop ::= OP_COMPARE */
+   -1,  /* (38) idop ::= OP_INEQUAL */
+   -1,  /* (39) idop ::= OP_AND */
+   -1,  /* (40) idop ::= OP_OR */
+   -1,  /* (41) idop ::= OP_DOLLAR */
+   -1,  /* (42) idop ::= OP_ASSIGN */
+   -1,  /* (43) idop ::= OP_COMMA */
+    0,  /* (44) global ::= */
+   -1,  /* (45) global ::= KW_GLOBAL */
+    0,  /* (46) export ::= */
+   -1,  /* (47) export ::= KW_EXPORT */
+   -4,  /* (48) topdef ::= global export KW_TOPIC NL */
+   -5,  /* (49) topdef ::= global export KW_TOPIC error NL */
+   -5,  /* (50) topdef ::= global export KW_TOPIC id NL */
+   -6,  /* (51) topdef ::= global export KW_TOPIC id error NL */
+   -6,  /* (52) topdef ::= global export KW_TOPIC id P_ASCRIBE NL */
+   -7,  /* (53) topdef ::= global export KW_TOPIC id P_ASCRIBE type NL */
+   -2,  /* (54) topdef ::= KW_PUBLISH NL */
+   -3,  /* (55) topdef ::= KW_PUBLISH error NL */
+   -3,  /* (56) topdef ::= KW_PUBLISH id NL */
+   -4,  /* (57) topdef ::= KW_PUBLISH id error NL */
+   -4,  /* (58) topdef ::= KW_PUBLISH id P_EQUALS NL */
+   -5,  /* (59) topdef ::= KW_PUBLISH id P_EQUALS block_opt NL */
+   -4,  /* (60) topdef ::= global export KW_DATA NL */
+   -5,  /* (61) topdef ::= global export KW_DATA error NL */
+   -5,  /* (62) topdef ::= global export KW_DATA type NL */
+   -6,  /* (63) topdef ::= global export KW_DATA type error NL */
+   -6,  /* (64) topdef ::= global export KW_DATA type P_EQUALS NL */
+   -7,  /* (65) topdef ::= global export KW_DATA type P_EQUALS type NL */
+   -8,  /* (66) topdef ::= global export KW_DATA type P_EQUALS INDENT data_elts DEDENT */
+   -1,  /* (67) data_elts ::= error */
+   -1,  /* (68) data_elts ::= type */
+   -3,  /* (69) data_elts ::= data_elts NL error */
+   -3,  /* (70) data_elts ::= data_elts NL type */
+   -4,  /* (71) topdef ::= global export KW_TUPLE NL */
+   -5,  /* (72) topdef ::= global export KW_TUPLE error NL */
+   -5,  /* (73) topdef ::= global export KW_TUPLE type NL */
+   -6,  /* (74) topdef ::= global export KW_TUPLE type error NL */
+   -6,  /* (75) topdef ::= global export KW_TUPLE type P_EQUALS NL */
+   -7,  /* (76) topdef ::= global export KW_TUPLE type P_EQUALS error NL */
+   -8,  /* (77) topdef ::= global export KW_TUPLE type P_EQUALS INDENT tuple_elts DEDENT */
+   -1,  /* (78) tuple_elts ::= error */
+   -1,  /* (79) tuple_elts ::= tuple_elt */
+   -3,  /* (80) tuple_elts ::= tuple_elts NL error */
+   -3,  /* (81) tuple_elts ::= tuple_elts NL tuple_elt */
+   -3,  /* (82) tuple_elt ::= global export type */
+   -4,  /* (83) topdef ::= global export KW_DEF NL */
+   -5,  /* (84) topdef ::= global export KW_DEF error NL */
+   -5,  /* (85) topdef ::= global export KW_DEF pattern NL */
+   -6,  /* (86) topdef ::= global export KW_DEF pattern error NL */
+   -6,  /* (87) topdef ::= global export KW_DEF pattern P_EQUALS NL */
+   -7,  /* (88) topdef ::= global export KW_DEF pattern P_EQUALS block_opt NL */
+   -4,  /* (89) topdef ::= global export KW_TARGET NL */
+   -5,  /* (90) topdef ::= global export KW_TARGET error NL */
+   -5,  /* (91) topdef ::= global export KW_TARGET target_pattern NL */
+   -6,  /* (92) topdef ::= global export KW_TARGET target_pattern error NL */
+   -6,  /* (93) topdef ::= global export KW_TARGET target_pattern P_EQUALS NL */
+   -7,  /* (94) topdef ::= global export KW_TARGET target_pattern P_EQUALS block_opt NL */
+   -1,  /* (95) target_pattern ::= pattern */
+   -3,  /* (96) target_pattern ::= pattern P_BSLASH target_args */
+   -1,  /* (97) target_args ::= pattern_terms */
+   -1,  /* (98) expression_op_quant ::= OP_QUANT */
+   -3,  /* (99) expression_binary_quant ::= expression_binary_quant expression_op_quant expression_unary_quant */
+   -1,  /* (100) expression_binary_quant ::= expression_unary_quant */
+   -2,  /* (101) expression_unary_quant ::= expression_op_quant expression_unary_quant */
+   -1,  /* (102) expression_unary_quant ::= expression_binary_app */
+   -1,  /* (103) expression_op_exp ::= OP_EXP */
+   -3,  /* (104) expression_binary_exp ::= expression_unary_exp expression_op_exp expression_binary_exp */
+   -1,  /* (105) expression_binary_exp ::= expression_unary_exp */
+   -2,  /* (106) expression_unary_exp ::= expression_op_exp expression_unary_exp */
+   -1,  /* (107) expression_unary_exp ::= expression_binary_quant */
+   -1,  /* (108) expression_op_muldiv ::= OP_MULDIV */
+   -3,  /* (109) expression_binary_muldiv ::= expression_binary_muldiv expression_op_muldiv expression_unary_muldiv */
+   -1,  /* (110) expression_binary_muldiv ::= expression_unary_muldiv */
+   -2,  /* (111) expression_unary_muldiv ::= expression_op_muldiv expression_unary_muldiv */
+   -1,  /* (112) expression_unary_muldiv ::= expression_binary_exp */
+   -1,  /* (113) expression_op_addsub ::= OP_ADDSUB */
+   -3,  /* (114) expression_binary_addsub ::= expression_binary_addsub expression_op_addsub expression_unary_addsub */
+   -1,  /* (115) expression_binary_addsub ::= expression_unary_addsub */
+   -2,  /* (116) expression_unary_addsub ::= expression_op_addsub expression_unary_addsub */
+   -1,  /* (117) expression_unary_addsub ::= expression_binary_muldiv */
+   -1,  /* (118) expression_op_compare ::= OP_COMPARE */
+   -3,  /* (119) expression_binary_compare ::= expression_binary_compare expression_op_compare expression_unary_compare */
+   -1,  /* (120) expression_binary_compare ::= expression_unary_compare */
+   -2,  /* (121) expression_unary_compare ::= expression_op_compare expression_unary_compare */
+   -1,  /* (122) expression_unary_compare ::= expression_binary_addsub */
+   -1,  /* (123) expression_op_inequal ::= OP_INEQUAL */
+   -3,  /* (124) expression_binary_inequal ::= expression_unary_inequal expression_op_inequal expression_binary_inequal */
+   -1,  /* (125) expression_binary_inequal ::= expression_unary_inequal */
+   -2,  /* (126) expression_unary_inequal ::= expression_op_inequal expression_unary_inequal */
+   -1,  /* (127) expression_unary_inequal ::= expression_binary_compare */
+   -1,  /* (128) expression_op_and ::= OP_AND */
+   -3,  /* (129) expression_binary_and ::= expression_binary_and expression_op_and expression_unary_and */
+   -1,  /* (130) expression_binary_and ::= expression_unary_and */
+   -2,  /* (131) expression_unary_and ::= expression_op_and expression_unary_and */
+   -1,  /* (132) expression_unary_and ::= expression_binary_inequal */
+   -1,  /* (133) expression_op_or ::= OP_OR */
+   -3,  /* (134) expression_binary_or ::= expression_binary_or expression_op_or expression_unary_or */
+   -1,  /* (135) expression_binary_or ::= expression_unary_or */
+   -2,  /* (136) expression_unary_or ::= expression_op_or expression_unary_or */
+   -1,  /* (137) expression_unary_or ::= expression_binary_and */
+   -1,  /* (138) expression_op_dollar ::= OP_DOLLAR */
+   -3,  /* (139) expression_binary_dollar ::= expression_unary_dollar expression_op_dollar expression_binary_dollar */
+   -1,  /* (140) expression_binary_dollar ::= expression_unary_dollar */
+   -2,  /* (141) expression_unary_dollar ::= expression_op_dollar expression_unary_dollar */
+   -1,  /* (142) expression_unary_dollar ::= expression_binary_or */
+   -3,  /* (143) expression_binary_ascribe ::= expression_binary_dollar P_ASCRIBE expression_binary_ascribe */
+   -1,  /* (144) expression_binary_ascribe ::= expression_binary_dollar */
+   -1,  /* (145) expression_op_assign ::= OP_ASSIGN */
+   -3,  /* (146) expression_binary_assign ::= expression_binary_assign expression_op_assign expression_unary_assign */
+   -1,  /* (147) expression_binary_assign ::= expression_unary_assign */
+   -2,  /* (148) expression_unary_assign ::= expression_op_assign expression_unary_assign */
+   -1,  /* (149) expression_unary_assign ::= expression_binary_ascribe */
+   -1,  /* (150) expression_op_comma ::= OP_COMMA */
+   -3,  /* (151) expression_binary_comma ::= expression_unary_comma expression_op_comma expression_binary_comma */
+   -1,  /* (152) expression_binary_comma ::= expression_unary_comma */
+   -1,  /* (153) expression_unary_comma ::= expression_binary_assign */
+   -2,  /* (154) expression_unary_comma ::= expression_unary_comma expression_op_comma */
+   -1,  /* (155) op_dot ::= OP_DOT */
+   -3,  /* (156) expression_term ::= expression_term op_dot expression_nodot */
+   -1,  /* (157) expression_term ::= expression_nodot */
+   -1,  /* (158) expression_nodot ::= ID */
+   -3,  /* (159) expression_nodot ::= P_POPEN block_opt P_PCLOSE */
+   -1,  /* (160) expression_nodot ::= P_HOLE */
+   -1,  /* (161) expression_nodot ::= STR_RAW */
+   -1,  /* (162) expression_nodot ::= STR_SINGLE */
+   -3,  /* (163) expression_nodot ::= str_open interpolated_string str_close */
+   -1,  /* (164) interpolated_string ::= expression */
+   -3,  /* (165) interpolated_string ::= interpolated_string str_mid expression */
+   -1,  /* (166) str_mid ::= STR_MID */
+   -1,  /* (167) str_open ::= STR_OPEN */
+   -1,  /* (168) str_close ::= STR_CLOSE */
+   -1,  /* (169) expression_nodot ::= mstr_single */
+   -3,  /* (170) expression_nodot ::= mstr_open interpolated_mstring mstr_close */
+   -1,  /* (171) interpolated_mstring ::= expression */
+   -3,  /* (172) interpolated_mstring ::= interpolated_mstring mstr_mid expression */
+    0,  /* (173) mstr_cont ::= */
+   -2,  /* (174) mstr_cont ::= mstr_cont MSTR_CONTINUE */
+   -2,  /* (175) mstr_cont ::= mstr_cont NL */
+   -3,  /* (176) mstr_single ::= MSTR_BEGIN mstr_cont MSTR_END */
+   -3,  /* (177) mstr_open ::= MSTR_BEGIN mstr_cont MSTR_PAUSE */
+   -1,  /* (178) mstr_mid ::= MSTR_MID */
+   -3,  /* (179) mstr_mid ::= MSTR_RESUME mstr_cont MSTR_PAUSE */
+   -3,  /* (180) mstr_close ::= MSTR_RESUME mstr_cont MSTR_END */
+   -1,  /* (181) expression_nodot ::= lstr_single */
+   -3,  /* (182) expression_nodot ::= lstr_open interpolated_lstring lstr_close */
+   -1,  /* (183) interpolated_lstring ::= expression */
+   -3,  /* (184) interpolated_lstring ::= interpolated_lstring lstr_mid expression */
+    0,  /* (185) lstr_cont ::= */
+   -2,  /* (186) lstr_cont ::= lstr_cont LSTR_CONTINUE */
+   -2,  /* (187) lstr_cont ::= lstr_cont NL */
+   -3,  /* (188) lstr_single ::= LSTR_BEGIN lstr_cont LSTR_END */
+   -3,  /* (189) lstr_open ::= LSTR_BEGIN lstr_cont LSTR_PAUSE */
+   -1,  /* (190) lstr_mid ::= LSTR_MID */
+   -3,  /* (191) lstr_mid ::= LSTR_RESUME lstr_cont LSTR_PAUSE */
+   -3,  /* (192) lstr_close ::= LSTR_RESUME lstr_cont LSTR_END */
+   -1,  /* (193) expression_nodot ::= REG_SINGLE */
+   -3,  /* (194) expression_nodot ::= reg_open interpolated_regexp reg_close */
+   -1,  /* (195) interpolated_regexp ::= expression */
+   -3,  /* (196) interpolated_regexp ::= interpolated_regexp reg_mid expression */
+   -1,  /* (197) reg_mid ::= REG_MID */
+   -1,  /* (198) reg_open ::= REG_OPEN */
+   -1,  /* (199) reg_close ::= REG_CLOSE */
+   -1,  /* (200) expression_nodot ::= DOUBLE */
+   -1,  /* (201) expression_nodot ::= INTEGER */
+   -1,  /* (202) expression_nodot ::= KW_MACRO_HERE */
+   -1,  /* (203) expression_nodot ::= KW_MACRO_LINE */
+   -1,  /* (204) expression_nodot ::= KW_MACRO_FILE */
+   -1,  /* (205) expression_nodot ::= KW_MACRO_BANG */
+   -2,  /* (206) expression_binary_app ::= expression_binary_app expression_term */
+   -1,  /* (207) expression_binary_app ::= expression_term */
+   -2,  /* (208) expression_binary_app ::= KW_SUBSCRIBE id */
+   -2,  /* (209) expression_binary_app ::= KW_PRIM prim_literal */
+   -1,  /* (210) prim_literal ::= STR_SINGLE */
+   -5,  /* (211) expression_binary_app ::= KW_MATCH expression_term INDENT match1_cases DEDENT */
+   -5,  /* (212) expression_binary_app ::= KW_MATCH match_terms INDENT matchx_cases DEDENT */
+   -3,  /* (213) match1_cases ::= match1_cases NL match1_case */
+   -1,  /* (214) match1_cases ::= match1_case */
+   -3,  /* (215) match1_case ::= pattern guard block_opt */
+   -2,  /* (216) match_terms ::= expression_term expression_term */
+   -2,  /* (217) match_terms ::= match_terms expression_term */
+   -3,  /* (218) matchx_cases ::= matchx_cases NL matchx_case */
+   -1,  /* (219) matchx_cases ::= matchx_case */
+   -3,  /* (220) matchx_case ::= pattern_terms guard block_opt */
+   -2,  /* (221) pattern_terms ::= pattern_terms pattern_term */
+   -1,  /* (222) pattern_terms ::= pattern_term */
+   -1,  /* (223) guard ::= P_EQUALS */
+   -3,  /* (224) guard ::= KW_IF expression P_EQUALS */
+   -1,  /* (225) guard ::= P_ARROW */
+   -3,  /* (226) guard ::= KW_IF expression P_ARROW */
+   -1,  /* (227) expression ::= expression_binary_comma */
+   -3,  /* (228) expression ::= P_BSLASH pattern_term expression */
+   -6,  /* (229) expression ::= KW_IF block_opt KW_THEN block_opt KW_ELSE block_opt */
+   -1,  /* (230) pattern ::= expression */
+   -1,  /* (231) type ::= expression */
+   -1,  /* (232) pattern_term ::= expression_term */
+   -1,  /* (233) block_opt ::= expression */
+   -2,  /* (234) block_opt ::= INDENT block */
+   -1,  /* (235) block ::= body */
+   -2,  /* (236) block ::= blockdefs body */
+   -2,  /* (237) body ::= error DEDENT */
+   -2,  /* (238) body ::= expression DEDENT */
+   -3,  /* (239) body ::= KW_REQUIRE reqbad block */
+   -5,  /* (240) body ::= KW_REQUIRE pattern reqbody reqelse block */
+   -1,  /* (241) reqbad ::= reqelse */
+   -2,  /* (242) reqbad ::= error reqelse */
+    0,  /* (243) reqbody ::= */
+   -1,  /* (244) reqbody ::= error */
+   -1,  /* (245) reqbody ::= P_EQUALS */
+   -2,  /* (246) reqbody ::= P_EQUALS block_opt */
+   -3,  /* (247) reqelse ::= NL KW_ELSE reqelsebody */
+   -2,  /* (248) reqelse ::= KW_ELSE reqelsebody */
+   -1,  /* (249) reqelse ::= NL */
+   -1,  /* (250) reqelsebody ::= NL */
+   -2,  /* (251) reqelsebody ::= error NL */
+   -2,  /* (252) reqelsebody ::= block_opt NL */
+   -1,  /* (253) blockdefs ::= blockdef */
+   -2,  /* (254) blockdefs ::= blockdefs blockdef */
+   -2,  /* (255) blockdef ::= error NL */
+   -3,  /* (256) blockdef ::= INDENT error DEDENT */
+   -2,  /* (257) blockdef ::= KW_DEF NL */
+   -3,  /* (258) blockdef ::= KW_DEF error NL */
+   -3,  /* (259) blockdef ::= KW_DEF pattern NL */
+   -4,  /* (260) blockdef ::= KW_DEF pattern error NL */
+   -4,  /* (261) blockdef ::= KW_DEF pattern P_EQUALS NL */
+   -5,  /* (262) blockdef ::= KW_DEF pattern P_EQUALS block_opt NL */
+   -2,  /* (263) blockdef ::= KW_FROM NL */
+   -3,  /* (264) blockdef ::= KW_FROM error NL */
+   -3,  /* (265) blockdef ::= KW_FROM id NL */
+   -4,  /* (266) blockdef ::= KW_FROM id error NL */
+   -5,  /* (267) blockdef ::= KW_FROM id KW_IMPORT P_HOLE NL */
+   -6,  /* (268) blockdef ::= KW_FROM id KW_IMPORT kind arity NL */
+   -7,  /* (269) blockdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL */
+};
+
+static void yy_accept(yyParser*);  /* Forward Declaration */
+
+/*
+** Perform a reduce action and the shift that must immediately
+** follow the reduce.
+**
+** The yyLookahead and yyLookaheadToken parameters provide reduce actions
+** access to the lookahead token (if any).  The yyLookahead will be YYNOCODE
+** if the lookahead token has already been consumed.  As this procedure is
+** only called from one place, optimizing compilers will in-line it, which
+** means that the extra parameters have no performance impact.
+*/
+static YYACTIONTYPE yy_reduce(
+  yyParser *yypParser,         /* The parser */
+  unsigned int yyruleno,       /* Number of the rule by which to reduce */
+  int yyLookahead,             /* Lookahead token, or YYNOCODE if none */
+  ParseTOKENTYPE yyLookaheadToken  /* Value of the lookahead token */
+  ParseCTX_PDECL                   /* %extra_context */
+){
+  int yygoto;                     /* The next state */
+  YYACTIONTYPE yyact;             /* The next action */
+  yyStackEntry *yymsp;            /* The top of the parser's stack */
+  int yysize;                     /* Amount to pop the stack */
+  ParseARG_FETCH
+  (void)yyLookahead;
+  (void)yyLookaheadToken;
+  yymsp = yypParser->yytos;
+
+  switch( yyruleno ){
+  /* Beginning here are the reduction cases.  A typical example
+  ** follows:
+  **   case 0:
+  **  #line <lineno> <grammarfile>
+  **     { ... }           // User supplied code
+  **  #line <lineno> <thisfile>
+  **     break;
+  */
+/********** Begin reduce actions **********************************************/
+        YYMINORTYPE yylhsminor;
+      case 0: /* start ::= top */
+#line 58 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TOP, yymsp[0].minor.yy43); }
+#line 3105 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 1: /* top ::= */
+#line 60 "src/parser/parser.y"
+{ yymsp[1].minor.yy43 = 0;   }
+#line 3111 "src/parser/parser.c"
+        break;
+      case 2: /* top ::= top topdef */
+      case 27: /* idopeqs ::= idopeqs idopeq */ yytestcase(yyruleno==27);
+      case 216: /* match_terms ::= expression_term expression_term */ yytestcase(yyruleno==216);
+      case 217: /* match_terms ::= match_terms expression_term */ yytestcase(yyruleno==217);
+      case 221: /* pattern_terms ::= pattern_terms pattern_term */ yytestcase(yyruleno==221);
+      case 254: /* blockdefs ::= blockdefs blockdef */ yytestcase(yyruleno==254);
+#line 61 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[-1].minor.yy43+yymsp[0].minor.yy43; }
+#line 3121 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 3: /* id ::= ID */
+      case 31: /* idop ::= ID */ yytestcase(yyruleno==31);
+      case 158: /* expression_nodot ::= ID */ yytestcase(yyruleno==158);
+#line 63 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ID, yymsp[0].minor.yy0); }
+#line 3129 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 4: /* topdef ::= error NL */
+      case 255: /* blockdef ::= error NL */ yytestcase(yyruleno==255);
+{  yy_destructor(yypParser,78,&yymsp[-1].minor);
+#line 65 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; }
+#line 3137 "src/parser/parser.c"
+}
+        break;
+      case 5: /* topdef ::= INDENT error DEDENT */
+      case 7: /* topdef ::= KW_PACKAGE error NL */ yytestcase(yyruleno==7);
+      case 10: /* topdef ::= KW_FROM error NL */ yytestcase(yyruleno==10);
+      case 55: /* topdef ::= KW_PUBLISH error NL */ yytestcase(yyruleno==55);
+      case 256: /* blockdef ::= INDENT error DEDENT */ yytestcase(yyruleno==256);
+      case 258: /* blockdef ::= KW_DEF error NL */ yytestcase(yyruleno==258);
+      case 264: /* blockdef ::= KW_FROM error NL */ yytestcase(yyruleno==264);
+#line 66 "src/parser/parser.y"
+{ yymsp[-2].minor.yy43 = 0; }
+#line 3149 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+        break;
+      case 6: /* topdef ::= KW_PACKAGE NL */
+#line 68 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; fail("keyword 'package' must be followed by a package name", yymsp[0].minor.yy0); }
+#line 3155 "src/parser/parser.c"
+        break;
+      case 8: /* topdef ::= KW_PACKAGE id NL */
+#line 70 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_PACKAGE, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3160 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 9: /* topdef ::= KW_FROM NL */
+      case 263: /* blockdef ::= KW_FROM NL */ yytestcase(yyruleno==263);
+#line 72 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; fail("keyword 'from' must be followed by a package name", yymsp[0].minor.yy0); }
+#line 3167 "src/parser/parser.c"
+        break;
+      case 11: /* topdef ::= KW_FROM id NL */
+#line 74 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_IMPORT, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43, yymsp[0].minor.yy0); fail("keyword 'from' must be followed by a package name and 'import' or 'export'", yymsp[0].minor.yy0); }
+#line 3172 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 12: /* topdef ::= KW_FROM id error NL */
+#line 75 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_IMPORT, yymsp[-3].minor.yy0, yymsp[-2].minor.yy43, yymsp[0].minor.yy0); }
+#line 3178 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 13: /* topdef ::= KW_FROM id KW_IMPORT P_HOLE NL */
+      case 267: /* blockdef ::= KW_FROM id KW_IMPORT P_HOLE NL */ yytestcase(yyruleno==267);
+#line 77 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1;           add(CST_IMPORT, yymsp[-4].minor.yy0, yymsp[-3].minor.yy43, yymsp[0].minor.yy0); }
+#line 3186 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 14: /* topdef ::= KW_FROM id KW_IMPORT kind arity NL */
+      case 268: /* blockdef ::= KW_FROM id KW_IMPORT kind arity NL */ yytestcase(yyruleno==268);
+#line 78 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; pop(yymsp[-2].minor.yy43+yymsp[-1].minor.yy43); add(CST_IMPORT, yymsp[-5].minor.yy0, yymsp[-4].minor.yy43, yymsp[0].minor.yy0); fail("package import must be followed by a list of identifiers or operators", yymsp[0].minor.yy0); }
+#line 3193 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 15: /* topdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL */
+      case 269: /* blockdef ::= KW_FROM id KW_IMPORT kind arity idopeqs NL */ yytestcase(yyruleno==269);
+#line 79 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_IMPORT, yymsp[-6].minor.yy0, yymsp[-5].minor.yy43+yymsp[-3].minor.yy43+yymsp[-2].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3200 "src/parser/parser.c"
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 16: /* topdef ::= KW_FROM id KW_EXPORT kind arity NL */
+#line 81 "src/parser/parser.y"
+{ yymsp[-5].minor.yy43 = 0; pop(yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[-4].minor.yy43); fail("package export must be followed by a list of identifiers or operators", yymsp[0].minor.yy0); }
+#line 3206 "src/parser/parser.c"
+        break;
+      case 17: /* topdef ::= KW_FROM id KW_EXPORT kind arity idopeqs NL */
+#line 82 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_EXPORT, yymsp[-6].minor.yy0, yymsp[-5].minor.yy43+yymsp[-3].minor.yy43+yymsp[-2].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3211 "src/parser/parser.c"
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 18: /* kind ::= KW_DEF */
+      case 19: /* kind ::= KW_TYPE */ yytestcase(yyruleno==19);
+      case 20: /* kind ::= KW_TOPIC */ yytestcase(yyruleno==20);
+#line 84 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_KIND, yymsp[0].minor.yy0); }
+#line 3219 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 21: /* kind ::= */
+      case 24: /* arity ::= */ yytestcase(yyruleno==24);
+      case 44: /* global ::= */ yytestcase(yyruleno==44);
+      case 46: /* export ::= */ yytestcase(yyruleno==46);
+      case 173: /* mstr_cont ::= */ yytestcase(yyruleno==173);
+      case 185: /* lstr_cont ::= */ yytestcase(yyruleno==185);
+#line 87 "src/parser/parser.y"
+{ yymsp[1].minor.yy43 = 0; }
+#line 3230 "src/parser/parser.c"
+        break;
+      case 22: /* arity ::= KW_UNARY */
+      case 23: /* arity ::= KW_BINARY */ yytestcase(yyruleno==23);
+#line 89 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ARITY, yymsp[0].minor.yy0); }
+#line 3236 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 25: /* idopeqs ::= error */
+      case 67: /* data_elts ::= error */ yytestcase(yyruleno==67);
+      case 78: /* tuple_elts ::= error */ yytestcase(yyruleno==78);
+{  yy_destructor(yypParser,78,&yymsp[0].minor);
+#line 93 "src/parser/parser.y"
+{ yymsp[0].minor.yy43 = 0;   }
+#line 3245 "src/parser/parser.c"
+}
+        break;
+      case 26: /* idopeqs ::= idopeqs error */
+#line 94 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[-1].minor.yy43;   }
+#line 3251 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[0].minor);
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 28: /* idopeqs ::= idopeq */
+      case 68: /* data_elts ::= type */ yytestcase(yyruleno==68);
+      case 79: /* tuple_elts ::= tuple_elt */ yytestcase(yyruleno==79);
+      case 95: /* target_pattern ::= pattern */ yytestcase(yyruleno==95);
+      case 214: /* match1_cases ::= match1_case */ yytestcase(yyruleno==214);
+      case 253: /* blockdefs ::= blockdef */ yytestcase(yyruleno==253);
+#line 96 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[0].minor.yy43;   }
+#line 3263 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 29: /* idopeq ::= idop P_EQUALS idop */
+#line 98 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_IDEQ, yymsp[-2].minor.yy43+yymsp[0].minor.yy43); }
+#line 3269 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 30: /* idopeq ::= idop */
+#line 99 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_IDEQ, yymsp[0].minor.yy43); }
+#line 3275 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 32: /* idop ::= OP_DOT */
+      case 33: /* idop ::= OP_QUANT */ yytestcase(yyruleno==33);
+      case 34: /* idop ::= OP_EXP */ yytestcase(yyruleno==34);
+      case 35: /* idop ::= OP_MULDIV */ yytestcase(yyruleno==35);
+      case 36: /* idop ::= OP_ADDSUB */ yytestcase(yyruleno==36);
+      case 37: /* idop ::= OP_COMPARE */ yytestcase(yyruleno==37);
+      case 38: /* idop ::= OP_INEQUAL */ yytestcase(yyruleno==38);
+      case 39: /* idop ::= OP_AND */ yytestcase(yyruleno==39);
+      case 40: /* idop ::= OP_OR */ yytestcase(yyruleno==40);
+      case 41: /* idop ::= OP_DOLLAR */ yytestcase(yyruleno==41);
+      case 42: /* idop ::= OP_ASSIGN */ yytestcase(yyruleno==42);
+      case 43: /* idop ::= OP_COMMA */ yytestcase(yyruleno==43);
+      case 98: /* expression_op_quant ::= OP_QUANT */ yytestcase(yyruleno==98);
+      case 103: /* expression_op_exp ::= OP_EXP */ yytestcase(yyruleno==103);
+      case 108: /* expression_op_muldiv ::= OP_MULDIV */ yytestcase(yyruleno==108);
+      case 113: /* expression_op_addsub ::= OP_ADDSUB */ yytestcase(yyruleno==113);
+      case 118: /* expression_op_compare ::= OP_COMPARE */ yytestcase(yyruleno==118);
+      case 123: /* expression_op_inequal ::= OP_INEQUAL */ yytestcase(yyruleno==123);
+      case 128: /* expression_op_and ::= OP_AND */ yytestcase(yyruleno==128);
+      case 133: /* expression_op_or ::= OP_OR */ yytestcase(yyruleno==133);
+      case 138: /* expression_op_dollar ::= OP_DOLLAR */ yytestcase(yyruleno==138);
+      case 145: /* expression_op_assign ::= OP_ASSIGN */ yytestcase(yyruleno==145);
+      case 150: /* expression_op_comma ::= OP_COMMA */ yytestcase(yyruleno==150);
+      case 155: /* op_dot ::= OP_DOT */ yytestcase(yyruleno==155);
+#line 102 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_OP, yymsp[0].minor.yy0); }
+#line 3304 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 45: /* global ::= KW_GLOBAL */
+#line 116 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_FLAG_GLOBAL, yymsp[0].minor.yy0); }
+#line 3310 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 47: /* export ::= KW_EXPORT */
+#line 118 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_FLAG_EXPORT, yymsp[0].minor.yy0); }
+#line 3316 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 48: /* topdef ::= global export KW_TOPIC NL */
+#line 120 "src/parser/parser.y"
+{ yylhsminor.yy43 = 0; pop(yymsp[-3].minor.yy43+yymsp[-2].minor.yy43); fail("keyword 'topic' must be followed by a topic name", yymsp[0].minor.yy0); }
+#line 3322 "src/parser/parser.c"
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 49: /* topdef ::= global export KW_TOPIC error NL */
+      case 61: /* topdef ::= global export KW_DATA error NL */ yytestcase(yyruleno==61);
+      case 72: /* topdef ::= global export KW_TUPLE error NL */ yytestcase(yyruleno==72);
+      case 84: /* topdef ::= global export KW_DEF error NL */ yytestcase(yyruleno==84);
+      case 90: /* topdef ::= global export KW_TARGET error NL */ yytestcase(yyruleno==90);
+#line 121 "src/parser/parser.y"
+{ yylhsminor.yy43 = 0; pop(yymsp[-4].minor.yy43+yymsp[-3].minor.yy43); }
+#line 3332 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 50: /* topdef ::= global export KW_TOPIC id NL */
+#line 122 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_TOPIC, yymsp[-2].minor.yy0, yymsp[-4].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43+1, yymsp[0].minor.yy0); fail("topics must be followed by an ': type'", yymsp[0].minor.yy0); }
+#line 3339 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 51: /* topdef ::= global export KW_TOPIC id error NL */
+#line 123 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_TOPIC, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); }
+#line 3345 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 52: /* topdef ::= global export KW_TOPIC id P_ASCRIBE NL */
+#line 124 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_TOPIC, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); fail("topics must be followed by an ': type'", yymsp[0].minor.yy0); }
+#line 3352 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 53: /* topdef ::= global export KW_TOPIC id P_ASCRIBE type NL */
+#line 125 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1;                    add(CST_TOPIC, yymsp[-4].minor.yy0, yymsp[-6].minor.yy43+yymsp[-5].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3358 "src/parser/parser.c"
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 54: /* topdef ::= KW_PUBLISH NL */
+#line 127 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; fail("keyword 'publish' must be followed by a topic name", yymsp[0].minor.yy0); }
+#line 3364 "src/parser/parser.c"
+        break;
+      case 56: /* topdef ::= KW_PUBLISH id NL */
+#line 129 "src/parser/parser.y"
+{ yymsp[-2].minor.yy43 = 0; pop(yymsp[-1].minor.yy43); fail("publishes must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3369 "src/parser/parser.c"
+        break;
+      case 57: /* topdef ::= KW_PUBLISH id error NL */
+#line 130 "src/parser/parser.y"
+{ yymsp[-3].minor.yy43 = 0; pop(yymsp[-2].minor.yy43); }
+#line 3374 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+        break;
+      case 58: /* topdef ::= KW_PUBLISH id P_EQUALS NL */
+#line 131 "src/parser/parser.y"
+{ yymsp[-3].minor.yy43 = 0; pop(yymsp[-2].minor.yy43); fail("publishes must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3380 "src/parser/parser.c"
+        break;
+      case 59: /* topdef ::= KW_PUBLISH id P_EQUALS block_opt NL */
+#line 132 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_PUBLISH, yymsp[-4].minor.yy0, yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3385 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 60: /* topdef ::= global export KW_DATA NL */
+#line 134 "src/parser/parser.y"
+{ yylhsminor.yy43 = 0; pop(yymsp[-3].minor.yy43+yymsp[-2].minor.yy43); fail("keyword 'data' must be followed by a type expression", yymsp[0].minor.yy0); }
+#line 3391 "src/parser/parser.c"
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 62: /* topdef ::= global export KW_DATA type NL */
+#line 136 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_DATA, yymsp[-2].minor.yy0, yymsp[-4].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); fail("data types must be followed by an '= constructor-cases+'", yymsp[0].minor.yy0); }
+#line 3397 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 63: /* topdef ::= global export KW_DATA type error NL */
+#line 137 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_DATA, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43, yymsp[0].minor.yy0); }
+#line 3403 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 64: /* topdef ::= global export KW_DATA type P_EQUALS NL */
+#line 138 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_DATA, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43, yymsp[0].minor.yy0); fail("data types must be followed by an '= constructor-cases+'", yymsp[0].minor.yy0); }
+#line 3410 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 65: /* topdef ::= global export KW_DATA type P_EQUALS type NL */
+#line 139 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_DATA, yymsp[-4].minor.yy0, yymsp[-6].minor.yy43+yymsp[-5].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3416 "src/parser/parser.c"
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 66: /* topdef ::= global export KW_DATA type P_EQUALS INDENT data_elts DEDENT */
+#line 140 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_DATA, yymsp[-5].minor.yy0, yymsp[-7].minor.yy43+yymsp[-6].minor.yy43+yymsp[-4].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3422 "src/parser/parser.c"
+  yymsp[-7].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 69: /* data_elts ::= data_elts NL error */
+      case 80: /* tuple_elts ::= tuple_elts NL error */ yytestcase(yyruleno==80);
+#line 144 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[-2].minor.yy43;   }
+#line 3429 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[0].minor);
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 70: /* data_elts ::= data_elts NL type */
+      case 81: /* tuple_elts ::= tuple_elts NL tuple_elt */ yytestcase(yyruleno==81);
+      case 96: /* target_pattern ::= pattern P_BSLASH target_args */ yytestcase(yyruleno==96);
+      case 213: /* match1_cases ::= match1_cases NL match1_case */ yytestcase(yyruleno==213);
+      case 218: /* matchx_cases ::= matchx_cases NL matchx_case */ yytestcase(yyruleno==218);
+#line 145 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[-2].minor.yy43+yymsp[0].minor.yy43; }
+#line 3440 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 71: /* topdef ::= global export KW_TUPLE NL */
+#line 147 "src/parser/parser.y"
+{ yylhsminor.yy43 = 0; pop(yymsp[-3].minor.yy43+yymsp[-2].minor.yy43); fail("keyword 'tuple' must be followed by a type expression", yymsp[0].minor.yy0); }
+#line 3446 "src/parser/parser.c"
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 73: /* topdef ::= global export KW_TUPLE type NL */
+#line 149 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TUPLE, yymsp[-2].minor.yy0, yymsp[-4].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); fail("tuple types must be followed by an '= member-definitions+'", yymsp[0].minor.yy0); }
+#line 3452 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 74: /* topdef ::= global export KW_TUPLE type error NL */
+#line 150 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TUPLE, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43, yymsp[0].minor.yy0); }
+#line 3458 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 75: /* topdef ::= global export KW_TUPLE type P_EQUALS NL */
+#line 151 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TUPLE, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43, yymsp[0].minor.yy0); fail("tuple types must be followed by an '= member-definitions+'", yymsp[0].minor.yy0); }
+#line 3465 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 76: /* topdef ::= global export KW_TUPLE type P_EQUALS error NL */
+#line 152 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TUPLE, yymsp[-4].minor.yy0, yymsp[-6].minor.yy43+yymsp[-5].minor.yy43+yymsp[-3].minor.yy43, yymsp[0].minor.yy0); }
+#line 3471 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 77: /* topdef ::= global export KW_TUPLE type P_EQUALS INDENT tuple_elts DEDENT */
+#line 153 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TUPLE, yymsp[-5].minor.yy0, yymsp[-7].minor.yy43+yymsp[-6].minor.yy43+yymsp[-4].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3478 "src/parser/parser.c"
+  yymsp[-7].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 82: /* tuple_elt ::= global export type */
+#line 160 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TUPLE_ELT, yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3484 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 83: /* topdef ::= global export KW_DEF NL */
+#line 162 "src/parser/parser.y"
+{ yylhsminor.yy43 = 0; pop(yymsp[-3].minor.yy43+yymsp[-2].minor.yy43); fail("keyword 'def' must be followed by a pattern", yymsp[0].minor.yy0); }
+#line 3490 "src/parser/parser.c"
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 85: /* topdef ::= global export KW_DEF pattern NL */
+#line 164 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_DEF, yymsp[-2].minor.yy0, yymsp[-4].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43+1, yymsp[0].minor.yy0); fail("definitions must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3496 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 86: /* topdef ::= global export KW_DEF pattern error NL */
+#line 165 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_DEF, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); }
+#line 3502 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 87: /* topdef ::= global export KW_DEF pattern P_EQUALS NL */
+#line 166 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_DEF, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); fail("definitions must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3509 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 88: /* topdef ::= global export KW_DEF pattern P_EQUALS block_opt NL */
+#line 167 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1;                    add(CST_DEF, yymsp[-4].minor.yy0, yymsp[-6].minor.yy43+yymsp[-5].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3515 "src/parser/parser.c"
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 89: /* topdef ::= global export KW_TARGET NL */
+#line 169 "src/parser/parser.y"
+{ yylhsminor.yy43 = 0; pop(yymsp[-3].minor.yy43+yymsp[-2].minor.yy43); fail("keyword 'target' must be followed by a pattern", yymsp[0].minor.yy0); }
+#line 3521 "src/parser/parser.c"
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 91: /* topdef ::= global export KW_TARGET target_pattern NL */
+#line 171 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_TARGET, yymsp[-2].minor.yy0, yymsp[-4].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43+1, yymsp[0].minor.yy0); fail("targets must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3527 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 92: /* topdef ::= global export KW_TARGET target_pattern error NL */
+#line 172 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_TARGET, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); }
+#line 3533 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 93: /* topdef ::= global export KW_TARGET target_pattern P_EQUALS NL */
+#line 173 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_TARGET, yymsp[-3].minor.yy0, yymsp[-5].minor.yy43+yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); fail("targets must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3540 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 94: /* topdef ::= global export KW_TARGET target_pattern P_EQUALS block_opt NL */
+#line 174 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TARGET, yymsp[-4].minor.yy0, yymsp[-6].minor.yy43+yymsp[-5].minor.yy43+yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3546 "src/parser/parser.c"
+  yymsp[-6].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 97: /* target_args ::= pattern_terms */
+#line 179 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_TARGET_ARGS, yymsp[0].minor.yy43); }
+#line 3552 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 99: /* expression_binary_quant ::= expression_binary_quant expression_op_quant expression_unary_quant */
+      case 104: /* expression_binary_exp ::= expression_unary_exp expression_op_exp expression_binary_exp */ yytestcase(yyruleno==104);
+      case 109: /* expression_binary_muldiv ::= expression_binary_muldiv expression_op_muldiv expression_unary_muldiv */ yytestcase(yyruleno==109);
+      case 114: /* expression_binary_addsub ::= expression_binary_addsub expression_op_addsub expression_unary_addsub */ yytestcase(yyruleno==114);
+      case 119: /* expression_binary_compare ::= expression_binary_compare expression_op_compare expression_unary_compare */ yytestcase(yyruleno==119);
+      case 124: /* expression_binary_inequal ::= expression_unary_inequal expression_op_inequal expression_binary_inequal */ yytestcase(yyruleno==124);
+      case 129: /* expression_binary_and ::= expression_binary_and expression_op_and expression_unary_and */ yytestcase(yyruleno==129);
+      case 134: /* expression_binary_or ::= expression_binary_or expression_op_or expression_unary_or */ yytestcase(yyruleno==134);
+      case 139: /* expression_binary_dollar ::= expression_unary_dollar expression_op_dollar expression_binary_dollar */ yytestcase(yyruleno==139);
+      case 146: /* expression_binary_assign ::= expression_binary_assign expression_op_assign expression_unary_assign */ yytestcase(yyruleno==146);
+      case 151: /* expression_binary_comma ::= expression_unary_comma expression_op_comma expression_binary_comma */ yytestcase(yyruleno==151);
+      case 156: /* expression_term ::= expression_term op_dot expression_nodot */ yytestcase(yyruleno==156);
+#line 190 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_BINARY, yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3569 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 100: /* expression_binary_quant ::= expression_unary_quant */
+      case 102: /* expression_unary_quant ::= expression_binary_app */ yytestcase(yyruleno==102);
+      case 105: /* expression_binary_exp ::= expression_unary_exp */ yytestcase(yyruleno==105);
+      case 107: /* expression_unary_exp ::= expression_binary_quant */ yytestcase(yyruleno==107);
+      case 110: /* expression_binary_muldiv ::= expression_unary_muldiv */ yytestcase(yyruleno==110);
+      case 112: /* expression_unary_muldiv ::= expression_binary_exp */ yytestcase(yyruleno==112);
+      case 115: /* expression_binary_addsub ::= expression_unary_addsub */ yytestcase(yyruleno==115);
+      case 117: /* expression_unary_addsub ::= expression_binary_muldiv */ yytestcase(yyruleno==117);
+      case 120: /* expression_binary_compare ::= expression_unary_compare */ yytestcase(yyruleno==120);
+      case 122: /* expression_unary_compare ::= expression_binary_addsub */ yytestcase(yyruleno==122);
+      case 125: /* expression_binary_inequal ::= expression_unary_inequal */ yytestcase(yyruleno==125);
+      case 127: /* expression_unary_inequal ::= expression_binary_compare */ yytestcase(yyruleno==127);
+      case 130: /* expression_binary_and ::= expression_unary_and */ yytestcase(yyruleno==130);
+      case 132: /* expression_unary_and ::= expression_binary_inequal */ yytestcase(yyruleno==132);
+      case 135: /* expression_binary_or ::= expression_unary_or */ yytestcase(yyruleno==135);
+      case 137: /* expression_unary_or ::= expression_binary_and */ yytestcase(yyruleno==137);
+      case 140: /* expression_binary_dollar ::= expression_unary_dollar */ yytestcase(yyruleno==140);
+      case 142: /* expression_unary_dollar ::= expression_binary_or */ yytestcase(yyruleno==142);
+      case 144: /* expression_binary_ascribe ::= expression_binary_dollar */ yytestcase(yyruleno==144);
+      case 147: /* expression_binary_assign ::= expression_unary_assign */ yytestcase(yyruleno==147);
+      case 149: /* expression_unary_assign ::= expression_binary_ascribe */ yytestcase(yyruleno==149);
+      case 152: /* expression_binary_comma ::= expression_unary_comma */ yytestcase(yyruleno==152);
+      case 153: /* expression_unary_comma ::= expression_binary_assign */ yytestcase(yyruleno==153);
+      case 157: /* expression_term ::= expression_nodot */ yytestcase(yyruleno==157);
+      case 164: /* interpolated_string ::= expression */ yytestcase(yyruleno==164);
+      case 169: /* expression_nodot ::= mstr_single */ yytestcase(yyruleno==169);
+      case 171: /* interpolated_mstring ::= expression */ yytestcase(yyruleno==171);
+      case 181: /* expression_nodot ::= lstr_single */ yytestcase(yyruleno==181);
+      case 183: /* interpolated_lstring ::= expression */ yytestcase(yyruleno==183);
+      case 195: /* interpolated_regexp ::= expression */ yytestcase(yyruleno==195);
+      case 207: /* expression_binary_app ::= expression_term */ yytestcase(yyruleno==207);
+      case 219: /* matchx_cases ::= matchx_case */ yytestcase(yyruleno==219);
+      case 222: /* pattern_terms ::= pattern_term */ yytestcase(yyruleno==222);
+      case 227: /* expression ::= expression_binary_comma */ yytestcase(yyruleno==227);
+      case 230: /* pattern ::= expression */ yytestcase(yyruleno==230);
+      case 231: /* type ::= expression */ yytestcase(yyruleno==231);
+      case 232: /* pattern_term ::= expression_term */ yytestcase(yyruleno==232);
+      case 233: /* block_opt ::= expression */ yytestcase(yyruleno==233);
+      case 235: /* block ::= body */ yytestcase(yyruleno==235);
+#line 191 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[0].minor.yy43; }
+#line 3613 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 101: /* expression_unary_quant ::= expression_op_quant expression_unary_quant */
+      case 106: /* expression_unary_exp ::= expression_op_exp expression_unary_exp */ yytestcase(yyruleno==106);
+      case 111: /* expression_unary_muldiv ::= expression_op_muldiv expression_unary_muldiv */ yytestcase(yyruleno==111);
+      case 116: /* expression_unary_addsub ::= expression_op_addsub expression_unary_addsub */ yytestcase(yyruleno==116);
+      case 121: /* expression_unary_compare ::= expression_op_compare expression_unary_compare */ yytestcase(yyruleno==121);
+      case 126: /* expression_unary_inequal ::= expression_op_inequal expression_unary_inequal */ yytestcase(yyruleno==126);
+      case 131: /* expression_unary_and ::= expression_op_and expression_unary_and */ yytestcase(yyruleno==131);
+      case 136: /* expression_unary_or ::= expression_op_or expression_unary_or */ yytestcase(yyruleno==136);
+      case 141: /* expression_unary_dollar ::= expression_op_dollar expression_unary_dollar */ yytestcase(yyruleno==141);
+      case 148: /* expression_unary_assign ::= expression_op_assign expression_unary_assign */ yytestcase(yyruleno==148);
+      case 154: /* expression_unary_comma ::= expression_unary_comma expression_op_comma */ yytestcase(yyruleno==154);
+#line 192 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_UNARY,  yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3629 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 143: /* expression_binary_ascribe ::= expression_binary_dollar P_ASCRIBE expression_binary_ascribe */
+#line 234 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ASCRIBE, yymsp[-2].minor.yy43+yymsp[0].minor.yy43); }
+#line 3635 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 159: /* expression_nodot ::= P_POPEN block_opt P_PCLOSE */
+#line 255 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_PAREN, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3641 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 160: /* expression_nodot ::= P_HOLE */
+#line 257 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_HOLE, yymsp[0].minor.yy0); }
+#line 3647 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 161: /* expression_nodot ::= STR_RAW */
+      case 162: /* expression_nodot ::= STR_SINGLE */ yytestcase(yyruleno==162);
+      case 166: /* str_mid ::= STR_MID */ yytestcase(yyruleno==166);
+      case 167: /* str_open ::= STR_OPEN */ yytestcase(yyruleno==167);
+      case 168: /* str_close ::= STR_CLOSE */ yytestcase(yyruleno==168);
+      case 193: /* expression_nodot ::= REG_SINGLE */ yytestcase(yyruleno==193);
+      case 197: /* reg_mid ::= REG_MID */ yytestcase(yyruleno==197);
+      case 198: /* reg_open ::= REG_OPEN */ yytestcase(yyruleno==198);
+      case 199: /* reg_close ::= REG_CLOSE */ yytestcase(yyruleno==199);
+      case 200: /* expression_nodot ::= DOUBLE */ yytestcase(yyruleno==200);
+      case 201: /* expression_nodot ::= INTEGER */ yytestcase(yyruleno==201);
+      case 202: /* expression_nodot ::= KW_MACRO_HERE */ yytestcase(yyruleno==202);
+      case 203: /* expression_nodot ::= KW_MACRO_LINE */ yytestcase(yyruleno==203);
+      case 204: /* expression_nodot ::= KW_MACRO_FILE */ yytestcase(yyruleno==204);
+      case 205: /* expression_nodot ::= KW_MACRO_BANG */ yytestcase(yyruleno==205);
+      case 210: /* prim_literal ::= STR_SINGLE */ yytestcase(yyruleno==210);
+#line 258 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_LITERAL, yymsp[0].minor.yy0); }
+#line 3668 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 163: /* expression_nodot ::= str_open interpolated_string str_close */
+      case 170: /* expression_nodot ::= mstr_open interpolated_mstring mstr_close */ yytestcase(yyruleno==170);
+      case 182: /* expression_nodot ::= lstr_open interpolated_lstring lstr_close */ yytestcase(yyruleno==182);
+      case 194: /* expression_nodot ::= reg_open interpolated_regexp reg_close */ yytestcase(yyruleno==194);
+#line 261 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_INTERPOLATE, yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3677 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 165: /* interpolated_string ::= interpolated_string str_mid expression */
+      case 172: /* interpolated_mstring ::= interpolated_mstring mstr_mid expression */ yytestcase(yyruleno==172);
+      case 184: /* interpolated_lstring ::= interpolated_lstring lstr_mid expression */ yytestcase(yyruleno==184);
+      case 196: /* interpolated_regexp ::= interpolated_regexp reg_mid expression */ yytestcase(yyruleno==196);
+#line 264 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[0].minor.yy43; }
+#line 3686 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 174: /* mstr_cont ::= mstr_cont MSTR_CONTINUE */
+      case 175: /* mstr_cont ::= mstr_cont NL */ yytestcase(yyruleno==175);
+{  yy_destructor(yypParser,147,&yymsp[-1].minor);
+#line 277 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; }
+#line 3694 "src/parser/parser.c"
+}
+        break;
+      case 176: /* mstr_single ::= MSTR_BEGIN mstr_cont MSTR_END */
+      case 177: /* mstr_open ::= MSTR_BEGIN mstr_cont MSTR_PAUSE */ yytestcase(yyruleno==177);
+      case 179: /* mstr_mid ::= MSTR_RESUME mstr_cont MSTR_PAUSE */ yytestcase(yyruleno==179);
+      case 180: /* mstr_close ::= MSTR_RESUME mstr_cont MSTR_END */ yytestcase(yyruleno==180);
+#line 280 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_LITERAL, yymsp[-2].minor.yy0, 0, yymsp[0].minor.yy0); }
+#line 3703 "src/parser/parser.c"
+  yy_destructor(yypParser,147,&yymsp[-1].minor);
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 178: /* mstr_mid ::= MSTR_MID */
+      case 190: /* lstr_mid ::= LSTR_MID */ yytestcase(yyruleno==190);
+#line 282 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_LITERAL, yymsp[0].minor.yy0);       }
+#line 3711 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 186: /* lstr_cont ::= lstr_cont LSTR_CONTINUE */
+      case 187: /* lstr_cont ::= lstr_cont NL */ yytestcase(yyruleno==187);
+{  yy_destructor(yypParser,153,&yymsp[-1].minor);
+#line 293 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; }
+#line 3719 "src/parser/parser.c"
+}
+        break;
+      case 188: /* lstr_single ::= LSTR_BEGIN lstr_cont LSTR_END */
+      case 189: /* lstr_open ::= LSTR_BEGIN lstr_cont LSTR_PAUSE */ yytestcase(yyruleno==189);
+      case 191: /* lstr_mid ::= LSTR_RESUME lstr_cont LSTR_PAUSE */ yytestcase(yyruleno==191);
+      case 192: /* lstr_close ::= LSTR_RESUME lstr_cont LSTR_END */ yytestcase(yyruleno==192);
+#line 296 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_LITERAL, yymsp[-2].minor.yy0, 0, yymsp[0].minor.yy0); }
+#line 3728 "src/parser/parser.c"
+  yy_destructor(yypParser,153,&yymsp[-1].minor);
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 206: /* expression_binary_app ::= expression_binary_app expression_term */
+#line 319 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_APP, yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3735 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 208: /* expression_binary_app ::= KW_SUBSCRIBE id */
+#line 322 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_SUBSCRIBE, yymsp[-1].minor.yy0, yymsp[0].minor.yy43); }
+#line 3741 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 209: /* expression_binary_app ::= KW_PRIM prim_literal */
+#line 324 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_PRIM, yymsp[-1].minor.yy0, yymsp[0].minor.yy43); }
+#line 3747 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 211: /* expression_binary_app ::= KW_MATCH expression_term INDENT match1_cases DEDENT */
+      case 212: /* expression_binary_app ::= KW_MATCH match_terms INDENT matchx_cases DEDENT */ yytestcase(yyruleno==212);
+#line 328 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_MATCH, yymsp[-4].minor.yy0, yymsp[-3].minor.yy43+yymsp[-1].minor.yy43); }
+#line 3754 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 215: /* match1_case ::= pattern guard block_opt */
+      case 220: /* matchx_case ::= pattern_terms guard block_opt */ yytestcase(yyruleno==220);
+#line 333 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_CASE, yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3761 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 223: /* guard ::= P_EQUALS */
+      case 225: /* guard ::= P_ARROW */ yytestcase(yyruleno==225);
+#line 345 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_GUARD, yymsp[0].minor.yy0); }
+#line 3768 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 224: /* guard ::= KW_IF expression P_EQUALS */
+      case 226: /* guard ::= KW_IF expression P_ARROW */ yytestcase(yyruleno==226);
+#line 346 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_GUARD, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3775 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 228: /* expression ::= P_BSLASH pattern_term expression */
+#line 352 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_LAMBDA, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3781 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 229: /* expression ::= KW_IF block_opt KW_THEN block_opt KW_ELSE block_opt */
+#line 354 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_IF, yymsp[-5].minor.yy0, yymsp[-4].minor.yy43+yymsp[-2].minor.yy43+yymsp[0].minor.yy43); }
+#line 3787 "src/parser/parser.c"
+  yymsp[-5].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 234: /* block_opt ::= INDENT block */
+      case 246: /* reqbody ::= P_EQUALS block_opt */ yytestcase(yyruleno==246);
+#line 361 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = yymsp[0].minor.yy43; }
+#line 3794 "src/parser/parser.c"
+        break;
+      case 236: /* block ::= blockdefs body */
+#line 364 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_BLOCK, yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3799 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 237: /* body ::= error DEDENT */
+      case 251: /* reqelsebody ::= error NL */ yytestcase(yyruleno==251);
+{  yy_destructor(yypParser,78,&yymsp[-1].minor);
+#line 366 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); }
+#line 3807 "src/parser/parser.c"
+}
+        break;
+      case 238: /* body ::= expression DEDENT */
+      case 252: /* reqelsebody ::= block_opt NL */ yytestcase(yyruleno==252);
+#line 367 "src/parser/parser.y"
+{ yylhsminor.yy43 = yymsp[-1].minor.yy43; }
+#line 3814 "src/parser/parser.c"
+  yymsp[-1].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 239: /* body ::= KW_REQUIRE reqbad block */
+#line 369 "src/parser/parser.y"
+{ yymsp[-2].minor.yy43 = yymsp[0].minor.yy43; }
+#line 3820 "src/parser/parser.c"
+  yy_destructor(yypParser,169,&yymsp[-1].minor);
+        break;
+      case 240: /* body ::= KW_REQUIRE pattern reqbody reqelse block */
+#line 370 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_REQUIRE, yymsp[-4].minor.yy0, yymsp[-3].minor.yy43+yymsp[-2].minor.yy43+yymsp[-1].minor.yy43+yymsp[0].minor.yy43); }
+#line 3826 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 241: /* reqbad ::= reqelse */
+{  yy_destructor(yypParser,171,&yymsp[0].minor);
+#line 373 "src/parser/parser.y"
+{ yymsp[0].minor.yy43 = 0; fail("keyword 'require' must be followed by a pattern", yyLookaheadToken); }
+#line 3833 "src/parser/parser.c"
+}
+        break;
+      case 242: /* reqbad ::= error reqelse */
+{  yy_destructor(yypParser,78,&yymsp[-1].minor);
+#line 374 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; }
+#line 3840 "src/parser/parser.c"
+  yy_destructor(yypParser,171,&yymsp[0].minor);
+}
+        break;
+      case 243: /* reqbody ::= */
+#line 376 "src/parser/parser.y"
+{ yymsp[1].minor.yy43 = 1; add(CST_ERROR, yyLookaheadToken); fail("requirements must be followed by an '= expression", yyLookaheadToken); }
+#line 3847 "src/parser/parser.c"
+        break;
+      case 244: /* reqbody ::= error */
+{  yy_destructor(yypParser,78,&yymsp[0].minor);
+#line 377 "src/parser/parser.y"
+{ yymsp[0].minor.yy43 = 1; add(CST_ERROR, yyLookaheadToken); }
+#line 3853 "src/parser/parser.c"
+}
+        break;
+      case 245: /* reqbody ::= P_EQUALS */
+#line 378 "src/parser/parser.y"
+{ yymsp[0].minor.yy43 = 1; add(CST_ERROR, yyLookaheadToken); fail("requirements must be followed by an '= expression", yyLookaheadToken); }
+#line 3859 "src/parser/parser.c"
+        break;
+      case 247: /* reqelse ::= NL KW_ELSE reqelsebody */
+#line 383 "src/parser/parser.y"
+{ yymsp[-2].minor.yy43 = 1; add(CST_REQ_ELSE, yymsp[0].minor.yy43); }
+#line 3864 "src/parser/parser.c"
+        break;
+      case 248: /* reqelse ::= KW_ELSE reqelsebody */
+#line 384 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 1; add(CST_REQ_ELSE, yymsp[0].minor.yy43); }
+#line 3869 "src/parser/parser.c"
+        break;
+      case 249: /* reqelse ::= NL */
+#line 385 "src/parser/parser.y"
+{ yymsp[0].minor.yy43 = 0; }
+#line 3874 "src/parser/parser.c"
+        break;
+      case 250: /* reqelsebody ::= NL */
+#line 387 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); fail("keyword 'else' must be followed by an expression", yymsp[0].minor.yy0); }
+#line 3879 "src/parser/parser.c"
+  yymsp[0].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 257: /* blockdef ::= KW_DEF NL */
+#line 397 "src/parser/parser.y"
+{ yymsp[-1].minor.yy43 = 0; fail("keyword 'def' must be followed by a pattern", yymsp[0].minor.yy0); }
+#line 3885 "src/parser/parser.c"
+        break;
+      case 259: /* blockdef ::= KW_DEF pattern NL */
+#line 399 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_DEF, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43+1, yymsp[0].minor.yy0); fail("definitions must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3890 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 260: /* blockdef ::= KW_DEF pattern error NL */
+#line 400 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_DEF, yymsp[-3].minor.yy0, yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); }
+#line 3896 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 261: /* blockdef ::= KW_DEF pattern P_EQUALS NL */
+#line 401 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1; add(CST_ERROR, yymsp[0].minor.yy0); add(CST_DEF, yymsp[-3].minor.yy0, yymsp[-2].minor.yy43+1, yymsp[0].minor.yy0); fail("definitions must be followed by an '= expression'", yymsp[0].minor.yy0); }
+#line 3903 "src/parser/parser.c"
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 262: /* blockdef ::= KW_DEF pattern P_EQUALS block_opt NL */
+#line 402 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1;                    add(CST_DEF, yymsp[-4].minor.yy0, yymsp[-3].minor.yy43+yymsp[-1].minor.yy43, yymsp[0].minor.yy0); }
+#line 3909 "src/parser/parser.c"
+  yymsp[-4].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 265: /* blockdef ::= KW_FROM id NL */
+#line 406 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1;           add(CST_IMPORT, yymsp[-2].minor.yy0, yymsp[-1].minor.yy43, yymsp[0].minor.yy0); fail("keyword 'from' must be followed by a package name and 'import'", yymsp[0].minor.yy0); }
+#line 3915 "src/parser/parser.c"
+  yymsp[-2].minor.yy43 = yylhsminor.yy43;
+        break;
+      case 266: /* blockdef ::= KW_FROM id error NL */
+#line 407 "src/parser/parser.y"
+{ yylhsminor.yy43 = 1;           add(CST_IMPORT, yymsp[-3].minor.yy0, yymsp[-2].minor.yy43, yymsp[0].minor.yy0); }
+#line 3921 "src/parser/parser.c"
+  yy_destructor(yypParser,78,&yymsp[-1].minor);
+  yymsp[-3].minor.yy43 = yylhsminor.yy43;
+        break;
+      default:
+        break;
+/********** End reduce actions ************************************************/
+  };
+  assert( yyruleno<sizeof(yyRuleInfoLhs)/sizeof(yyRuleInfoLhs[0]) );
+  yygoto = yyRuleInfoLhs[yyruleno];
+  yysize = yyRuleInfoNRhs[yyruleno];
+  yyact = yy_find_reduce_action(yymsp[yysize].stateno,(YYCODETYPE)yygoto);
+
+  /* There are no SHIFTREDUCE actions on nonterminals because the table
+  ** generator has simplified them to pure REDUCE actions. */
+  assert( !(yyact>YY_MAX_SHIFT && yyact<=YY_MAX_SHIFTREDUCE) );
+
+  /* It is not possible for a REDUCE to be followed by an error */
+  assert( yyact!=YY_ERROR_ACTION );
+
+  yymsp += yysize+1;
+  yypParser->yytos = yymsp;
+  yymsp->stateno = (YYACTIONTYPE)yyact;
+  yymsp->major = (YYCODETYPE)yygoto;
+  yyTraceShift(yypParser, yyact, "... then shift");
+  return yyact;
+}
+
+/*
+** The following code executes when the parse fails
+*/
+#ifndef YYNOERRORRECOVERY
+static void yy_parse_failed(
+  yyParser *yypParser           /* The parser */
+){
+  ParseARG_FETCH
+  ParseCTX_FETCH
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sFail!\n",yyTracePrompt);
+  }
+#endif
+  while( yypParser->yytos>yypParser->yystack ) yy_pop_parser_stack(yypParser);
+  /* Here code is inserted which will be executed whenever the
+  ** parser fails */
+/************ Begin %parse_failure code ***************************************/
+#line 484 "src/parser/parser.y"
+
+  StringSegment ti = pinfo.fcontent->segment();
+  pinfo.reporter->reportError(FileFragment(pinfo.fcontent, ti).location(), "Parser was unable to proceed");
+#line 3971 "src/parser/parser.c"
+/************ End %parse_failure code *****************************************/
+  ParseARG_STORE /* Suppress warning about unused %extra_argument variable */
+  ParseCTX_STORE
+}
+#endif /* YYNOERRORRECOVERY */
+
+/*
+** The following code executes when a syntax error first occurs.
+*/
+static void yy_syntax_error(
+  yyParser *yypParser,           /* The parser */
+  int yymajor,                   /* The major type of the error token */
+  ParseTOKENTYPE yyminor         /* The minor type of the error token */
+){
+  ParseARG_FETCH
+  ParseCTX_FETCH
+#define TOKEN yyminor
+/************ Begin %syntax_error code ****************************************/
+#line 457 "src/parser/parser.y"
+
+  const char *example = symbolExample(yymajor);
+  int example_len = strlen(example);
+  int token_len = yyminor.size();
+  std::stringstream ss, tokens;
+  ss << "syntax error; found ";
+  if (token_len > 0) ss << yyminor << ", ";
+  bool same =
+    token_len == example_len &&
+    memcmp(yyminor.start, example, example_len) == 0;
+  if (!same || token_len == 0) ss << "a " << example << ", ";
+  tokens << "but was expecting one of:\n";
+  int num = 0;
+  for (int i = 1; i < YYNTOKEN; ++i) {
+    if (ParseShifts(yypParser, i)) {
+      ++num;
+      tokens << "    " << symbolExample(i);
+    }
+  }
+  if (num) {
+    ss << tokens.rdbuf();
+  } else {
+    ss << "which is inappropriate here";
+  }
+  pinfo.reporter->reportError(FileFragment(pinfo.fcontent, yyminor).location(), ss.str());
+#line 4016 "src/parser/parser.c"
+/************ End %syntax_error code ******************************************/
+  ParseARG_STORE /* Suppress warning about unused %extra_argument variable */
+  ParseCTX_STORE
+}
+
+/*
+** The following is executed when the parser accepts
+*/
+static void yy_accept(
+  yyParser *yypParser           /* The parser */
+){
+  ParseARG_FETCH
+  ParseCTX_FETCH
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    fprintf(yyTraceFILE,"%sAccept!\n",yyTracePrompt);
+  }
+#endif
+#ifndef YYNOERRORRECOVERY
+  yypParser->yyerrcnt = -1;
+#endif
+  assert( yypParser->yytos==yypParser->yystack );
+  /* Here code is inserted which will be executed whenever the
+  ** parser accepts */
+/*********** Begin %parse_accept code *****************************************/
+/*********** End %parse_accept code *******************************************/
+  ParseARG_STORE /* Suppress warning about unused %extra_argument variable */
+  ParseCTX_STORE
+}
+
+/* The main parser program.
+** The first argument is a pointer to a structure obtained from
+** "ParseAlloc" which describes the current state of the parser.
+** The second argument is the major token number.  The third is
+** the minor token.  The fourth optional argument is whatever the
+** user wants (and specified in the grammar) and is available for
+** use by the action routines.
+**
+** Inputs:
+** <ul>
+** <li> A pointer to the parser (an opaque structure.)
+** <li> The major token number.
+** <li> The minor token number.
+** <li> An option argument of a grammar-specified type.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+void Parse(
+  void *yyp,                   /* The parser */
+  int yymajor,                 /* The major token code number */
+  ParseTOKENTYPE yyminor       /* The value for the token */
+  ParseARG_PDECL               /* Optional %extra_argument parameter */
+){
+  YYMINORTYPE yyminorunion;
+  YYACTIONTYPE yyact;   /* The parser action. */
+#if !defined(YYERRORSYMBOL) && !defined(YYNOERRORRECOVERY)
+  int yyendofinput;     /* True if we are at the end of input */
+#endif
+#ifdef YYERRORSYMBOL
+  int yyerrorhit = 0;   /* True if yymajor has invoked an error */
+#endif
+  yyParser *yypParser = (yyParser*)yyp;  /* The parser */
+  ParseCTX_FETCH
+  ParseARG_STORE
+
+  assert( yypParser->yytos!=0 );
+#if !defined(YYERRORSYMBOL) && !defined(YYNOERRORRECOVERY)
+  yyendofinput = (yymajor==0);
+#endif
+
+  yyact = yypParser->yytos->stateno;
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    if( yyact < YY_MIN_REDUCE ){
+      fprintf(yyTraceFILE,"%sInput '%s' in state %d\n",
+              yyTracePrompt,yyTokenName[yymajor],yyact);
+    }else{
+      fprintf(yyTraceFILE,"%sInput '%s' with pending reduce %d\n",
+              yyTracePrompt,yyTokenName[yymajor],yyact-YY_MIN_REDUCE);
+    }
+  }
+#endif
+
+  while(1){ /* Exit by "break" */
+    assert( yypParser->yytos>=yypParser->yystack );
+    assert( yyact==yypParser->yytos->stateno );
+    yyact = yy_find_shift_action((YYCODETYPE)yymajor,yyact);
+    if( yyact >= YY_MIN_REDUCE ){
+      unsigned int yyruleno = yyact - YY_MIN_REDUCE; /* Reduce by this rule */
+      assert( yyruleno<(int)(sizeof(yyRuleName)/sizeof(yyRuleName[0])) );
+#ifndef NDEBUG
+      if( yyTraceFILE ){
+        int yysize = yyRuleInfoNRhs[yyruleno];
+        if( yysize ){
+          fprintf(yyTraceFILE, "%sReduce %d [%s]%s, pop back to state %d.\n",
+            yyTracePrompt,
+            yyruleno, yyRuleName[yyruleno],
+            yyruleno<YYNRULE_WITH_ACTION ? "" : " without external action",
+            yypParser->yytos[yysize].stateno);
+        }else{
+          fprintf(yyTraceFILE, "%sReduce %d [%s]%s.\n",
+            yyTracePrompt, yyruleno, yyRuleName[yyruleno],
+            yyruleno<YYNRULE_WITH_ACTION ? "" : " without external action");
+        }
+      }
+#endif /* NDEBUG */
+
+      /* Check that the stack is large enough to grow by a single entry
+      ** if the RHS of the rule is empty.  This ensures that there is room
+      ** enough on the stack to push the LHS value */
+      if( yyRuleInfoNRhs[yyruleno]==0 ){
+#ifdef YYTRACKMAXSTACKDEPTH
+        if( (int)(yypParser->yytos - yypParser->yystack)>yypParser->yyhwm ){
+          yypParser->yyhwm++;
+          assert( yypParser->yyhwm ==
+                  (int)(yypParser->yytos - yypParser->yystack));
+        }
+#endif
+#if YYSTACKDEPTH>0 
+        if( yypParser->yytos>=yypParser->yystackEnd ){
+          yyStackOverflow(yypParser);
+          break;
+        }
+#else
+        if( yypParser->yytos>=&yypParser->yystack[yypParser->yystksz-1] ){
+          if( yyGrowStack(yypParser) ){
+            yyStackOverflow(yypParser);
+            break;
+          }
+        }
+#endif
+      }
+      yyact = yy_reduce(yypParser,yyruleno,yymajor,yyminor ParseCTX_PARAM);
+    }else if( yyact <= YY_MAX_SHIFTREDUCE ){
+      yy_shift(yypParser,yyact,(YYCODETYPE)yymajor,yyminor);
+#ifndef YYNOERRORRECOVERY
+      yypParser->yyerrcnt--;
+#endif
+      break;
+    }else if( yyact==YY_ACCEPT_ACTION ){
+      yypParser->yytos--;
+      yy_accept(yypParser);
+      return;
+    }else{
+      assert( yyact == YY_ERROR_ACTION );
+      yyminorunion.yy0 = yyminor;
+#ifdef YYERRORSYMBOL
+      int yymx;
+#endif
+#ifndef NDEBUG
+      if( yyTraceFILE ){
+        fprintf(yyTraceFILE,"%sSyntax Error!\n",yyTracePrompt);
+      }
+#endif
+#ifdef YYERRORSYMBOL
+      /* A syntax error has occurred.
+      ** The response to an error depends upon whether or not the
+      ** grammar defines an error token "ERROR".  
+      **
+      ** This is what we do if the grammar does define ERROR:
+      **
+      **  * Call the %syntax_error function.
+      **
+      **  * Begin popping the stack until we enter a state where
+      **    it is legal to shift the error symbol, then shift
+      **    the error symbol.
+      **
+      **  * Set the error count to three.
+      **
+      **  * Begin accepting and shifting new tokens.  No new error
+      **    processing will occur until three tokens have been
+      **    shifted successfully.
+      **
+      */
+      if( yypParser->yyerrcnt<0 ){
+        yy_syntax_error(yypParser,yymajor,yyminor);
+      }
+      yymx = yypParser->yytos->major;
+      if( yymx==YYERRORSYMBOL || yyerrorhit ){
+#ifndef NDEBUG
+        if( yyTraceFILE ){
+          fprintf(yyTraceFILE,"%sDiscard input token %s\n",
+             yyTracePrompt,yyTokenName[yymajor]);
+        }
+#endif
+        yy_destructor(yypParser, (YYCODETYPE)yymajor, &yyminorunion);
+        yymajor = YYNOCODE;
+      }else{
+        while( yypParser->yytos > yypParser->yystack ){
+          yyact = yy_find_reduce_action(yypParser->yytos->stateno,
+                                        YYERRORSYMBOL);
+          if( yyact<=YY_MAX_SHIFTREDUCE ) break;
+          yy_pop_parser_stack(yypParser);
+        }
+        if( yypParser->yytos <= yypParser->yystack || yymajor==0 ){
+          yy_destructor(yypParser,(YYCODETYPE)yymajor,&yyminorunion);
+          yy_parse_failed(yypParser);
+#ifndef YYNOERRORRECOVERY
+          yypParser->yyerrcnt = -1;
+#endif
+          yymajor = YYNOCODE;
+        }else if( yymx!=YYERRORSYMBOL ){
+          yy_shift(yypParser,yyact,YYERRORSYMBOL,yyminor);
+        }
+      }
+      yypParser->yyerrcnt = 3;
+      yyerrorhit = 1;
+      if( yymajor==YYNOCODE ) break;
+      yyact = yypParser->yytos->stateno;
+#elif defined(YYNOERRORRECOVERY)
+      /* If the YYNOERRORRECOVERY macro is defined, then do not attempt to
+      ** do any kind of error recovery.  Instead, simply invoke the syntax
+      ** error routine and continue going as if nothing had happened.
+      **
+      ** Applications can set this macro (for example inside %include) if
+      ** they intend to abandon the parse upon the first syntax error seen.
+      */
+      yy_syntax_error(yypParser,yymajor, yyminor);
+      yy_destructor(yypParser,(YYCODETYPE)yymajor,&yyminorunion);
+      break;
+#else  /* YYERRORSYMBOL is not defined */
+      /* This is what we do if the grammar does not define ERROR:
+      **
+      **  * Report an error message, and throw away the input token.
+      **
+      **  * If the input token is $, then fail the parse.
+      **
+      ** As before, subsequent error messages are suppressed until
+      ** three input tokens have been successfully shifted.
+      */
+      if( yypParser->yyerrcnt<=0 ){
+        yy_syntax_error(yypParser,yymajor, yyminor);
+      }
+      yypParser->yyerrcnt = 3;
+      yy_destructor(yypParser,(YYCODETYPE)yymajor,&yyminorunion);
+      if( yyendofinput ){
+        yy_parse_failed(yypParser);
+#ifndef YYNOERRORRECOVERY
+        yypParser->yyerrcnt = -1;
+#endif
+      }
+      break;
+#endif
+    }
+  }
+#ifndef NDEBUG
+  if( yyTraceFILE ){
+    yyStackEntry *i;
+    char cDiv = '[';
+    fprintf(yyTraceFILE,"%sReturn. Stack=",yyTracePrompt);
+    for(i=&yypParser->yystack[1]; i<=yypParser->yytos; i++){
+      fprintf(yyTraceFILE,"%c%s", cDiv, yyTokenName[i->major]);
+      cDiv = ' ';
+    }
+    fprintf(yyTraceFILE,"]\n");
+  }
+#endif
+  return;
+}
+
+/*
+** Return the fallback token corresponding to canonical token iToken, or
+** 0 if iToken has no fallback.
+*/
+int ParseFallback(int iToken){
+#ifdef YYFALLBACK
+  assert( iToken<(int)(sizeof(yyFallback)/sizeof(yyFallback[0])) );
+  return yyFallback[iToken];
+#else
+  (void)iToken;
+  return 0;
+#endif
+}
+#line 412 "src/parser/parser.y"
+
+bool ParseShifts(void *p, int yymajor) {
+  yyParser *pParser = (yyParser*)p;
+  YYACTIONTYPE yyact = pParser->yytos->stateno;
+  std::vector<YYACTIONTYPE> speculation;
+  size_t offset = pParser->yytos - pParser->yystack;
+  size_t end = offset + 1;
+
+  while (1) {
+    // printf("STATE %d => ", yyact);
+    yyact = yy_find_shift_action((YYCODETYPE)yymajor, yyact);
+    // printf("ACTION %d => ", yyact);
+    if (yyact >= YY_MIN_REDUCE) {
+      int yyruleno = yyact - YY_MIN_REDUCE;
+      int yygoto = yyRuleInfoLhs[yyruleno];
+      int yysize = yyRuleInfoNRhs[yyruleno];
+      // printf("REDUCE %d by %d => ", yyruleno, yysize);
+      YYACTIONTYPE stateno;
+      offset += yysize; // remove tokens
+      if (offset < end) {
+        stateno = pParser->yystack[offset].stateno;
+        end = ++offset;
+        speculation.clear();
+      } else {
+      	stateno = speculation[offset-end];
+        speculation.resize(++offset-end);
+      }
+      // printf("FIND %d %d => ", stateno, yygoto);
+      yyact = yy_find_reduce_action(stateno, (YYCODETYPE)yygoto);
+      speculation.push_back(yyact);
+      // printf("%d\n", yyact);
+    } else if (yyact <= YY_MAX_SHIFTREDUCE) {
+      // printf("shift\n");
+      return true;
+    } else if (yyact == YY_ACCEPT_ACTION) {
+      // printf("accept\n");
+      return true;
+    } else {
+      // printf("reject\n");
+      return false;
+    }
+  }
+}
+#line 4336 "src/parser/parser.c"
@@ -217,6 +217,8 @@ POLICY_STATIC_DEFINES(LogHeaderAlignPolicy)
 POLICY_STATIC_DEFINES(BulkLoggingDirPolicy)
 POLICY_STATIC_DEFINES(EvictionConfigPolicy)
 POLICY_STATIC_DEFINES(SharedCacheTimeoutConfig)
+POLICY_STATIC_DEFINES(SharedCacheMaterializePolicy)
+POLICY_STATIC_DEFINES(SharedCacheWorkerThreads)
 
 /********************************************************************
  * Non-Trivial Defaults
@@ -305,6 +307,32 @@ void EvictionConfigPolicy::set(EvictionConfigPolicy& p, const JAST& json) {
   }
 }
 
+void SharedCacheMaterializePolicy::set(SharedCacheMaterializePolicy& p, const JAST& json) {
+  auto json_policy = json.expect_string();
+  if (!json_policy) {
+    return;
+  }
+  auto policy = job_cache::parse_materialize_policy(*json_policy);
+  if (!policy) {
+    std::cerr << "Ignoring unknown " << key << " '" << *json_policy
+              << "', expected copy, reflink or hardlink-readonly" << std::endl;
+    return;
+  }
+  p.materialize_policy = *policy;
+}
+
+void SharedCacheWorkerThreads::set(SharedCacheWorkerThreads& p, const JAST& json) {
+  auto json_threads = json.expect_integer();
+  if (!json_threads) {
+    return;
+  }
+  if (*json_threads < 0) {
+    std::cerr << "Ignoring negative " << key << " " << *json_threads << std::endl;
+    return;
+  }
+  p.shared_cache_worker_threads = *json_threads;
+}
+
 void SharedCacheTimeoutConfig::set(SharedCacheTimeoutConfig& p, const JAST& json) {
   auto json_read_retries = json.get("read_retries").expect_integer();
   auto json_connect_retries = json.get("connect_retries").expect_integer();
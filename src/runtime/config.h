@@ -265,6 +265,47 @@ struct EvictionConfigPolicy {
   static void set_env_var(EvictionConfigPolicy& p, const char* env_var) {}
 };
 
+struct SharedCacheMaterializePolicy {
+  using type = job_cache::MaterializePolicy;
+  using input_type = type;
+  static constexpr const char* key = "shared_cache_materialize";
+  static constexpr bool allowed_in_wakeroot = true;
+  static constexpr bool allowed_in_userconfig = true;
+  type materialize_policy = job_cache::MaterializePolicy::Reflink;
+  static constexpr type SharedCacheMaterializePolicy::*value =
+      &SharedCacheMaterializePolicy::materialize_policy;
+  static constexpr Override<input_type> override_value = nullptr;
+  static constexpr const char* env_var = nullptr;
+
+  SharedCacheMaterializePolicy() {}
+  static void set(SharedCacheMaterializePolicy& p, const JAST& json);
+  static void set_input(SharedCacheMaterializePolicy& p, const input_type& v) { p.*value = v; }
+  static void emit(const SharedCacheMaterializePolicy& p, std::ostream& os) {
+    os << job_cache::to_string(p.materialize_policy);
+  }
+  static void set_env_var(SharedCacheMaterializePolicy& p, const char* env_var) {}
+};
+
+struct SharedCacheWorkerThreads {
+  using type = int64_t;
+  using input_type = type;
+  static constexpr const char* key = "shared_cache_worker_threads";
+  static constexpr bool allowed_in_wakeroot = true;
+  static constexpr bool allowed_in_userconfig = true;
+  // 0 lets the daemon serve one read per core
+  type shared_cache_worker_threads = 0;
+  static constexpr type SharedCacheWorkerThreads::*value =
+      &SharedCacheWorkerThreads::shared_cache_worker_threads;
+  static constexpr Override<input_type> override_value = nullptr;
+  static constexpr const char* env_var = nullptr;
+
+  SharedCacheWorkerThreads() {}
+  static void set(SharedCacheWorkerThreads& p, const JAST& json);
+  static void set_input(SharedCacheWorkerThreads& p, const input_type& v) { p.*value = v; }
+  static void emit(const SharedCacheWorkerThreads& p, std::ostream& os) { os << p.*value; }
+  static void set_env_var(SharedCacheWorkerThreads& p, const char* env_var) {}
+};
+
 struct SharedCacheTimeoutConfig {
   using type = job_cache::TimeoutConfig;
   using input_type = type;
@@ -435,7 +476,8 @@ struct WakeConfigImpl : public Policies... {
 using WakeConfigImplFull =
     WakeConfigImpl<UserConfigPolicy, VersionPolicy, LogHeaderPolicy, LogHeaderSourceWidthPolicy,
                    LabelFilterPolicy, EvictionConfigPolicy, SharedCacheMissOnFailure,
-                   LogHeaderAlignPolicy, BulkLoggingDirPolicy, SharedCacheTimeoutConfig>;
+                   LogHeaderAlignPolicy, BulkLoggingDirPolicy, SharedCacheTimeoutConfig,
+                   SharedCacheMaterializePolicy, SharedCacheWorkerThreads>;
 
 struct WakeConfig final : public WakeConfigImplFull {
   static bool init(const std::string& wakeroot_path, const WakeConfigOverrides& overrides);
@@ -22,14 +22,19 @@
 #include "database.h"
 
 #include <fcntl.h>
+#include <signal.h>
 #include <sqlite3.h>
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
 
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -38,13 +43,26 @@
 #include "wcl/iterator.h"
 
 // Increment every time the database schema changes
-#define SCHEMA_VERSION "6"
+#define SCHEMA_VERSION "7"
 
 #define VISIBLE 0
 #define INPUT 1
 #define OUTPUT 2
 #define INDEXES 3
 
+// Write buffered job output once this much has accumulated
+#define LOG_FLUSH_BYTES (1024 * 1024)
+
+// Job output which has not yet been inserted into the log table
+struct LogChunk {
+  long job;
+  int descriptor;
+  double seconds;
+  std::string output;
+  LogChunk(long job_, int descriptor_, double seconds_, const char *buffer, int size)
+      : job(job_), descriptor(descriptor_), seconds(seconds_), output(buffer, size) {}
+};
+
 struct Database::detail {
   bool debugdb;
   sqlite3 *db;
@@ -91,6 +109,22 @@ struct Database::detail {
   sqlite3_stmt *get_interleaved_output;
 
   long run_id;
+  std::vector<LogChunk> logs;
+  std::unordered_map<long, size_t> last_log;  // job => index of its newest chunk in logs
+  size_t log_bytes;
+
+  // Writes which nothing waits on are applied by a writer thread in group-committed transactions.
+  // Everything else first waits for the writer to catch up, so it never touches sqlite concurrently.
+  std::thread writer;
+  std::mutex mutex;
+  std::condition_variable wake_writer;
+  std::condition_variable wake_waiters;
+  std::vector<std::function<void()>> writes;
+  uint64_t queued, applied;  // sequence numbers of submitted and committed writes
+  bool stop;
+  std::vector<std::string> errors;  // reported by writes, printed by the interpreter thread
+  bool fatal;
+  bool failed;  // the writer hit an sqlite error and applies nothing more
   detail(bool debugdb_)
       : debugdb(debugdb_),
         db(0),
@@ -129,9 +163,19 @@ struct Database::detail {
         get_all_runs(0),
         get_edges(0),
         get_file_dependency(0),
-        get_interleaved_output(0) {}
+        get_interleaved_output(0),
+        log_bytes(0),
+        queued(0),
+        applied(0),
+        stop(false),
+        fatal(false),
+        failed(false) {}
 };
 
+static void flush_logs(Database::detail *imp);
+static void stop_writer(Database::detail *imp);
+static void sync_writes(Database::detail *imp);
+
 static void close_db(Database::detail *imp) {
   if (imp->db) {
     int ret = sqlite3_close(imp->db);
@@ -166,6 +210,110 @@ static int schema_cb(void *data, int columns, char **values, char **labels) {
   return -1;
 }
 
+static void single_step(const char *why, sqlite3_stmt *stmt, bool debug);
+static void defer_error(Database::detail *imp, const std::string &error, bool fatal);
+
+// The writer thread must not exit(1) while the interpreter thread is still running,
+// so sqlite failures there unwind to write_loop and are reported by the interpreter.
+static thread_local bool on_writer = false;
+
+struct WriteFailure {
+  std::string message;
+};
+
+static void fail(const std::string &message) {
+  if (on_writer) throw WriteFailure{message};
+  std::cerr << message << std::endl;
+  exit(1);
+}
+
+static void write_loop(Database::detail *imp) {
+  on_writer = true;
+  std::unique_lock<std::mutex> lock(imp->mutex);
+  while (true) {
+    imp->wake_writer.wait(lock, [imp] { return imp->stop || !imp->writes.empty(); });
+    if (imp->writes.empty()) return;
+
+    std::vector<std::function<void()>> batch;
+    batch.swap(imp->writes);
+    lock.unlock();
+
+    try {
+      single_step("Could not begin a transaction", imp->begin_txn, imp->debugdb);
+      for (auto &write : batch) write();
+      single_step("Could not commit a transaction", imp->commit_txn, imp->debugdb);
+    } catch (const WriteFailure &failure) {
+      // Leave the transaction open; nothing more reaches wake.db before the interpreter exits
+      defer_error(imp, failure.message, true);
+      lock.lock();
+      imp->failed = true;
+      imp->wake_waiters.notify_all();
+      return;
+    }
+
+    lock.lock();
+    imp->applied += batch.size();
+    imp->wake_waiters.notify_all();
+  }
+}
+
+static void report_errors(Database::detail *imp) {
+  std::vector<std::string> errors;
+  bool fatal;
+  {
+    std::lock_guard<std::mutex> lock(imp->mutex);
+    errors.swap(imp->errors);
+    fatal = imp->fatal;
+  }
+  for (auto &error : errors) status_get_generic_stream(STREAM_ERROR) << error << std::endl;
+  if (fatal) exit(1);
+}
+
+static void defer_error(Database::detail *imp, const std::string &error, bool fatal) {
+  std::lock_guard<std::mutex> lock(imp->mutex);
+  imp->errors.push_back(error);
+  imp->fatal = imp->fatal || fatal;
+}
+
+// Apply a write which must happen inside a transaction; nothing waits for the result
+static void submit(Database::detail *imp, std::function<void()> &&write) {
+  if (!imp->writer.joinable()) {
+    single_step("Could not begin a transaction", imp->begin_txn, imp->debugdb);
+    write();
+    single_step("Could not commit a transaction", imp->commit_txn, imp->debugdb);
+    report_errors(imp);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(imp->mutex);
+  imp->writes.emplace_back(std::move(write));
+  ++imp->queued;
+  imp->wake_writer.notify_one();
+}
+
+// Wait until every write submitted so far has been committed
+static void sync_writes(Database::detail *imp) {
+  flush_logs(imp);
+  if (imp->writer.joinable()) {
+    std::unique_lock<std::mutex> lock(imp->mutex);
+    uint64_t target = imp->queued;
+    imp->wake_waiters.wait(lock,
+                           [imp, target] { return imp->failed || imp->applied >= target; });
+  }
+  report_errors(imp);
+}
+
+static void stop_writer(Database::detail *imp) {
+  if (!imp->writer.joinable()) return;
+  {
+    std::lock_guard<std::mutex> lock(imp->mutex);
+    imp->stop = true;
+    imp->wake_writer.notify_one();
+  }
+  imp->writer.join();
+  report_errors(imp);
+}
+
 std::string Database::open(bool wait, bool memory, bool tty) {
   if (imp->db) return "";
   // Increment the SCHEMA_VERSION every time the below string changes.
@@ -189,7 +337,11 @@ std::string Database::open(bool wait, bool memory, bool tty) {
       "  file_id  integer primary key,"
       "  path     text    not null,"
       "  hash     text    not null,"
-      "  modified integer not null);"
+      "  modified integer not null,"  // the hash is reused while the lstat stays the same
+      "  changed  integer not null,"
+      "  size     integer not null,"
+      "  inode    integer not null,"
+      "  device   integer not null);"
       "create unique index if not exists filenames on files(path);"
       "create table if not exists stats("
       "  stat_id    integer primary key autoincrement,"
@@ -337,8 +489,10 @@ std::string Database::open(bool wait, bool memory, bool tty) {
       " (select t.job_id from files f, filetree t"
       "  where f.path=? and f.hash<>? and t.file_id=f.file_id and t.access=1)";
   const char *sql_insert_file =
-      "insert or ignore into files(hash, modified, path) values (?, ?, ?)";
-  const char *sql_update_file = "update files set hash=?, modified=? where path=?";
+      "insert or ignore into files(hash, modified, changed, size, inode, device, path)"
+      " values (?, ?, ?, ?, ?, ?, ?)";
+  const char *sql_update_file =
+      "update files set hash=?, modified=?, changed=?, size=?, inode=?, device=? where path=?";
   const char *sql_get_log =
       "select output from log where job_id=? and descriptor=? order by log_id";
   const char *sql_replay_log = "select descriptor, output from log where job_id=? order by log_id";
@@ -371,7 +525,9 @@ std::string Database::open(bool wait, bool memory, bool tty) {
       "  where j1.job_id=?2 and j1.directory=j2.directory and j1.commandline=j2.commandline"
       "  and j1.environment=j2.environment and j1.stdin=j2.stdin and j1.is_atty=j2.is_atty and "
       "j2.job_id<>?2)";
-  const char *sql_fetch_hash = "select hash from files where path=? and modified=?";
+  const char *sql_fetch_hash =
+      "select hash from files"
+      " where path=? and modified=? and changed=? and size=? and inode=? and device=?";
   const char *sql_delete_jobs =
       "delete from jobs where job_id in"
       " (select job_id from jobs where keep=0 and use_id<>? except select job_id from filetree "
@@ -483,12 +639,28 @@ std::string Database::open(bool wait, bool memory, bool tty) {
   PREPARE(sql_insert_unhashed_file, insert_unhashed_file);
   PREPARE(sql_get_interleaved_output, get_interleaved_output);
 
+  // sqlite debug logging goes to the status streams, which belong to the interpreter thread
+  if (!imp->debugdb && sqlite3_threadsafe()) {
+    // Signal handlers must keep running on the main thread
+    sigset_t block, saved;
+    sigfillset(&block);
+    pthread_sigmask(SIG_BLOCK, &block, &saved);
+    imp->stop = false;
+    imp->writer = std::thread(write_loop, imp.get());
+    pthread_sigmask(SIG_SETMASK, &saved, nullptr);
+  }
+
   return "";
 }
 
 void Database::close() {
   int ret;
 
+  if (imp->db) {
+    flush_logs(imp.get());
+    stop_writer(imp.get());
+  }
+
 #define FINALIZE(member)                                                                       \
   if (imp->member) {                                                                           \
     ret = sqlite3_finalize(imp->member);                                                       \
@@ -564,15 +736,13 @@ static void finish_stmt(const char *why, sqlite3_stmt *stmt, bool debug) {
 
   ret = sqlite3_reset(stmt);
   if (ret != SQLITE_OK) {
-    std::cerr << why << "; sqlite3_reset: " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
-    exit(1);
+    fail(std::string(why) + "; sqlite3_reset: " + sqlite3_errmsg(sqlite3_db_handle(stmt)));
   }
 
   ret = sqlite3_clear_bindings(stmt);
   if (ret != SQLITE_OK) {
-    std::cerr << why << "; sqlite3_clear_bindings: " << sqlite3_errmsg(sqlite3_db_handle(stmt))
-              << std::endl;
-    exit(1);
+    fail(std::string(why) + "; sqlite3_clear_bindings: " +
+         sqlite3_errmsg(sqlite3_db_handle(stmt)));
   }
 }
 
@@ -581,17 +751,18 @@ static void single_step(const char *why, sqlite3_stmt *stmt, bool debug) {
 
   ret = sqlite3_step(stmt);
   if (ret != SQLITE_DONE) {
-    std::cerr << why << "; sqlite3_step: " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
-    std::cerr << "The failing statement was: ";
+    std::stringstream s;
+    s << why << "; sqlite3_step: " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
+    s << "The failing statement was: ";
 #if SQLITE_VERSION_NUMBER >= 3014000
     char *tmp = sqlite3_expanded_sql(stmt);
-    std::cerr << tmp;
+    s << tmp;
     sqlite3_free(tmp);
 #else
-    std::cerr << sqlite3_sql(stmt);
+    s << sqlite3_sql(stmt);
 #endif
-    std::cerr << std::endl;
-    exit(1);
+    sqlite3_reset(stmt);
+    fail(s.str());
   }
 
   finish_stmt(why, stmt, debug);
@@ -601,9 +772,8 @@ static void bind_blob(const char *why, sqlite3_stmt *stmt, int index, const char
   int ret;
   ret = sqlite3_bind_blob(stmt, index, str, len, SQLITE_STATIC);
   if (ret != SQLITE_OK) {
-    std::cerr << why << "; sqlite3_bind_blob(" << index
-              << "): " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
-    exit(1);
+    fail(std::string(why) + "; sqlite3_bind_blob(" + std::to_string(index) +
+         "): " + sqlite3_errmsg(sqlite3_db_handle(stmt)));
   }
 }
 
@@ -616,9 +786,8 @@ static void bind_string(const char *why, sqlite3_stmt *stmt, int index, const ch
   int ret;
   ret = sqlite3_bind_text(stmt, index, str, len, SQLITE_STATIC);
   if (ret != SQLITE_OK) {
-    std::cerr << why << "; sqlite3_bind_text(" << index
-              << "): " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
-    exit(1);
+    fail(std::string(why) + "; sqlite3_bind_text(" + std::to_string(index) +
+         "): " + sqlite3_errmsg(sqlite3_db_handle(stmt)));
   }
 }
 
@@ -630,9 +799,8 @@ static void bind_integer(const char *why, sqlite3_stmt *stmt, int index, long x)
   int ret;
   ret = sqlite3_bind_int64(stmt, index, x);
   if (ret != SQLITE_OK) {
-    std::cerr << why << "; sqlite3_bind_int64(" << index
-              << "): " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
-    exit(1);
+    fail(std::string(why) + "; sqlite3_bind_int64(" + std::to_string(index) +
+         "): " + sqlite3_errmsg(sqlite3_db_handle(stmt)));
   }
 }
 
@@ -640,9 +808,8 @@ static void bind_double(const char *why, sqlite3_stmt *stmt, int index, double x
   int ret;
   ret = sqlite3_bind_double(stmt, index, x);
   if (ret != SQLITE_OK) {
-    std::cerr << why << "; sqlite3_bind_double(" << index
-              << "): " << sqlite3_errmsg(sqlite3_db_handle(stmt)) << std::endl;
-    exit(1);
+    fail(std::string(why) + "; sqlite3_bind_double(" + std::to_string(index) +
+         "): " + sqlite3_errmsg(sqlite3_db_handle(stmt)));
   }
 }
 
@@ -652,6 +819,7 @@ static std::string rip_column(sqlite3_stmt *stmt, int col) {
 }
 
 void Database::entropy(uint64_t *key, int words) {
+  sync_writes(imp.get());
   const char *why = "Could not restore entropy";
   int word;
 
@@ -674,6 +842,7 @@ void Database::entropy(uint64_t *key, int words) {
 }
 
 void Database::prepare(const std::string &cmdline) {
+  sync_writes(imp.get());
   struct timespec now;
   clock_gettime(CLOCK_REALTIME, &now);
   int64_t ts = static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
@@ -686,6 +855,7 @@ void Database::prepare(const std::string &cmdline) {
 }
 
 void Database::clean() {
+  sync_writes(imp.get());
   const char *why = "Could not compute critical path";
   begin_txn();
   while (sqlite3_step(imp->revtop_order) == SQLITE_ROW) {
@@ -721,6 +891,7 @@ Usage Database::reuse_job(const std::string &directory, const std::string &envir
                           const std::string &commandline, const std::string &stdin_file,
                           uint64_t signature, bool is_atty, const std::string &visible, bool check,
                           long &job, std::vector<FileReflection> &files, double *pathtime) {
+  sync_writes(imp.get());
   Usage out;
   long stat_id;
 
@@ -804,6 +975,7 @@ Usage Database::reuse_job(const std::string &directory, const std::string &envir
 }
 
 Usage Database::predict_job(uint64_t hashcode, double *pathtime) {
+  sync_writes(imp.get());
   Usage out;
   const char *why = "Could not predict a job";
   bind_integer(why, imp->predict_job, 1, hashcode);
@@ -834,6 +1006,7 @@ void Database::insert_job(const std::string &directory, const std::string &comma
                           const std::string &environment, const std::string &stdin_file,
                           uint64_t signature, const std::string &label, const std::string &stack,
                           bool is_atty, const std::string &visible, long *job) {
+  sync_writes(imp.get());
   const char *why = "Could not insert a job";
   begin_txn();
   bind_integer(why, imp->insert_job, 1, imp->run_id);
@@ -893,85 +1066,86 @@ void Database::finish_job(long job, const std::string &inputs, const std::string
     if (!output_set.count(path)) unhashed_outputs.emplace_back(std::move(path));
   });
 
-  const char *why = "Could not save job inputs and outputs";
-  begin_txn();
-
-  bind_integer(why, imp->add_stats, 1, hashcode);
-  bind_integer(why, imp->add_stats, 2, reality.status);
-  bind_double(why, imp->add_stats, 3, reality.runtime);
-  bind_double(why, imp->add_stats, 4, reality.cputime);
-  bind_integer(why, imp->add_stats, 5, reality.membytes);
-  bind_integer(why, imp->add_stats, 6, reality.ibytes);
-  bind_integer(why, imp->add_stats, 7, reality.obytes);
-  single_step(why, imp->add_stats, imp->debugdb);
-  bind_integer(why, imp->link_stats, 1, sqlite3_last_insert_rowid(imp->db));
-  bind_integer(why, imp->link_stats, 2, starttime);
-  bind_integer(why, imp->link_stats, 3, endtime);
-  bind_integer(why, imp->link_stats, 4, keep ? 1 : 0);
-  bind_integer(why, imp->link_stats, 5, job);
-  single_step(why, imp->link_stats, imp->debugdb);
-
-  // Grab the visible set
-  std::set<std::string> visible;
-  bind_integer(why, imp->get_tree, 1, job);
-  bind_integer(why, imp->get_tree, 2, VISIBLE);
-  while (sqlite3_step(imp->get_tree) == SQLITE_ROW) visible.insert(rip_column(imp->get_tree, 0));
-  finish_stmt(why, imp->get_tree, imp->debugdb);
+  // Output must be in the database before the job is finished
+  flush_logs(imp.get());
+
+  Database::detail *imp = this->imp.get();
+  submit(imp, [imp, job, inputs, output_set, unhashed_outputs, starttime, endtime, hashcode, keep,
+               reality] {
+    const char *why = "Could not save job inputs and outputs";
+
+    bind_integer(why, imp->add_stats, 1, hashcode);
+    bind_integer(why, imp->add_stats, 2, reality.status);
+    bind_double(why, imp->add_stats, 3, reality.runtime);
+    bind_double(why, imp->add_stats, 4, reality.cputime);
+    bind_integer(why, imp->add_stats, 5, reality.membytes);
+    bind_integer(why, imp->add_stats, 6, reality.ibytes);
+    bind_integer(why, imp->add_stats, 7, reality.obytes);
+    single_step(why, imp->add_stats, imp->debugdb);
+    bind_integer(why, imp->link_stats, 1, sqlite3_last_insert_rowid(imp->db));
+    bind_integer(why, imp->link_stats, 2, starttime);
+    bind_integer(why, imp->link_stats, 3, endtime);
+    bind_integer(why, imp->link_stats, 4, keep ? 1 : 0);
+    bind_integer(why, imp->link_stats, 5, job);
+    single_step(why, imp->link_stats, imp->debugdb);
+
+    // Grab the visible set
+    std::set<std::string> visible;
+    bind_integer(why, imp->get_tree, 1, job);
+    bind_integer(why, imp->get_tree, 2, VISIBLE);
+    while (sqlite3_step(imp->get_tree) == SQLITE_ROW) visible.insert(rip_column(imp->get_tree, 0));
+    finish_stmt(why, imp->get_tree, imp->debugdb);
+
+    // Insert inputs, confirming they are visible
+    scan_until_sep('\0', inputs, [&](const std::string &input) {
+      if (visible.find(input) == visible.end()) {
+        std::stringstream s;
+        s << "Job " << job << " erroneously added input '" << input
+          << "' which was not a visible file." << std::endl;
+        defer_error(imp, s.str(), false);
+      } else {
+        bind_integer(why, imp->insert_tree, 1, INPUT);
+        bind_integer(why, imp->insert_tree, 2, job);
+        bind_string(why, imp->insert_tree, 3, input);
+        single_step(why, imp->insert_tree, imp->debugdb);
+      }
+    });
 
-  // Insert inputs, confirming they are visible
-  scan_until_sep('\0', inputs, [&, this](const std::string &input) {
-    if (visible.find(input) == visible.end()) {
-      std::stringstream s;
-      s << "Job " << job << " erroneously added input '" << input
-        << "' which was not a visible file." << std::endl;
-      status_get_generic_stream(STREAM_ERROR) << s.str() << std::endl;
-    } else {
-      bind_integer(why, imp->insert_tree, 1, INPUT);
+    // Insert outputs
+    for (const auto &output : output_set) {
+      bind_integer(why, imp->insert_tree, 1, OUTPUT);
       bind_integer(why, imp->insert_tree, 2, job);
-      bind_string(why, imp->insert_tree, 3, input);
+      bind_string(why, imp->insert_tree, 3, output);
       single_step(why, imp->insert_tree, imp->debugdb);
     }
-  });
 
-  // Insert outputs
-  for (const auto &output : output_set) {
-    bind_integer(why, imp->insert_tree, 1, OUTPUT);
-    bind_integer(why, imp->insert_tree, 2, job);
-    bind_string(why, imp->insert_tree, 3, output);
-    single_step(why, imp->insert_tree, imp->debugdb);
-  }
-
-  // Insert unhashed outputs
-  for (const auto &unhashed_output : unhashed_outputs) {
-    bind_integer(why, imp->insert_unhashed_file, 1, job);
-    bind_string(why, imp->insert_unhashed_file, 2, unhashed_output);
-    single_step(why, imp->insert_unhashed_file, imp->debugdb);
-  }
-
-  bind_integer(why, imp->delete_prior, 1, imp->run_id);
-  bind_integer(why, imp->delete_prior, 2, job);
-  single_step(why, imp->delete_prior, imp->debugdb);
-
-  bind_integer(why, imp->delete_overlap, 1, imp->run_id);
-  bind_integer(why, imp->delete_overlap, 2, job);
-  single_step(why, imp->delete_overlap, imp->debugdb);
+    // Insert unhashed outputs
+    for (const auto &unhashed_output : unhashed_outputs) {
+      bind_integer(why, imp->insert_unhashed_file, 1, job);
+      bind_string(why, imp->insert_unhashed_file, 2, unhashed_output);
+      single_step(why, imp->insert_unhashed_file, imp->debugdb);
+    }
 
-  bool fail = false;
-  bind_integer(why, imp->detect_overlap, 1, job);
-  while (sqlite3_step(imp->detect_overlap) == SQLITE_ROW) {
-    std::stringstream s;
-    s << "File output by multiple Jobs: " << rip_column(imp->detect_overlap, 0) << std::endl;
-    status_get_generic_stream(STREAM_ERROR) << s.str() << std::endl;
-    fail = true;
-  }
-  finish_stmt(why, imp->detect_overlap, imp->debugdb);
+    bind_integer(why, imp->delete_prior, 1, imp->run_id);
+    bind_integer(why, imp->delete_prior, 2, job);
+    single_step(why, imp->delete_prior, imp->debugdb);
 
-  end_txn();
+    bind_integer(why, imp->delete_overlap, 1, imp->run_id);
+    bind_integer(why, imp->delete_overlap, 2, job);
+    single_step(why, imp->delete_overlap, imp->debugdb);
 
-  if (fail) exit(1);
+    bind_integer(why, imp->detect_overlap, 1, job);
+    while (sqlite3_step(imp->detect_overlap) == SQLITE_ROW) {
+      std::stringstream s;
+      s << "File output by multiple Jobs: " << rip_column(imp->detect_overlap, 0) << std::endl;
+      defer_error(imp, s.str(), true);
+    }
+    finish_stmt(why, imp->detect_overlap, imp->debugdb);
+  });
 }
 
 std::vector<std::string> Database::clear_jobs() {
+  sync_writes(imp.get());
   const char *why = "Could not clear jobs";
   std::vector<std::string> out;
 
@@ -997,14 +1171,18 @@ std::vector<std::string> Database::clear_jobs() {
 }
 
 void Database::tag_job(long job, const std::string &uri, const std::string &content) {
-  const char *why = "Could not tag a job";
-  bind_integer(why, imp->tag_job, 1, job);
-  bind_string(why, imp->tag_job, 2, uri);
-  bind_string(why, imp->tag_job, 3, content);
-  single_step(why, imp->tag_job, imp->debugdb);
+  Database::detail *imp = this->imp.get();
+  submit(imp, [imp, job, uri, content] {
+    const char *why = "Could not tag a job";
+    bind_integer(why, imp->tag_job, 1, job);
+    bind_string(why, imp->tag_job, 2, uri);
+    bind_string(why, imp->tag_job, 3, content);
+    single_step(why, imp->tag_job, imp->debugdb);
+  });
 }
 
 std::vector<FileReflection> Database::get_tree(int kind, long job) {
+  sync_writes(imp.get());
   std::vector<FileReflection> out;
   const char *why = "Could not read job tree";
   bind_integer(why, imp->get_tree, 1, job);
@@ -1015,18 +1193,48 @@ std::vector<FileReflection> Database::get_tree(int kind, long job) {
   return out;
 }
 
+// Insert all buffered job output in a single write
+static void flush_logs(Database::detail *imp) {
+  if (imp->logs.empty()) return;
+
+  auto logs = std::make_shared<std::vector<LogChunk>>(std::move(imp->logs));
+  submit(imp, [imp, logs] {
+    const char *why = "Could not save job output";
+    for (auto &chunk : *logs) {
+      bind_integer(why, imp->insert_log, 1, chunk.job);
+      bind_integer(why, imp->insert_log, 2, chunk.descriptor);
+      bind_double(why, imp->insert_log, 3, chunk.seconds);
+      bind_string(why, imp->insert_log, 4, chunk.output.data(), chunk.output.size());
+      single_step(why, imp->insert_log, imp->debugdb);
+    }
+  });
+
+  imp->logs.clear();
+  imp->last_log.clear();
+  imp->log_bytes = 0;
+}
+
 void Database::save_output(long job, int descriptor, const char *buffer, int size, double runtime) {
-  const char *why = "Could not save job output";
-  bind_integer(why, imp->insert_log, 1, job);
-  bind_integer(why, imp->insert_log, 2, descriptor);
-  bind_double(why, imp->insert_log, 3, runtime);
-  bind_string(why, imp->insert_log, 4, buffer, size);
-  single_step(why, imp->insert_log, imp->debugdb);
+  // Consecutive writes to the same descriptor of a job share one row.
+  // A write to the other descriptor starts a new row, so interleaving is preserved.
+  auto it = imp->last_log.find(job);
+  if (it != imp->last_log.end() && imp->logs[it->second].descriptor == descriptor) {
+    imp->logs[it->second].output.append(buffer, size);
+  } else {
+    imp->last_log[job] = imp->logs.size();
+    imp->logs.emplace_back(job, descriptor, runtime, buffer, size);
+  }
+
+  imp->log_bytes += size;
+  if (imp->log_bytes >= LOG_FLUSH_BYTES) flush_logs(imp.get());
 }
 
+void Database::flush_output() { flush_logs(imp.get()); }
+
 std::string Database::get_output(long job, int descriptor) const {
   std::stringstream out;
   const char *why = "Could not read job output";
+  sync_writes(imp.get());
   bind_integer(why, imp->get_log, 1, job);
   bind_integer(why, imp->get_log, 2, descriptor);
   while (sqlite3_step(imp->get_log) == SQLITE_ROW) {
@@ -1039,6 +1247,7 @@ std::string Database::get_output(long job, int descriptor) const {
 
 void Database::replay_output(long job, const char *stdout, const char *stderr) {
   const char *why = "Could not replay job output";
+  sync_writes(imp.get());
   bind_integer(why, imp->replay_log, 1, job);
   while (sqlite3_step(imp->replay_log) == SQLITE_ROW) {
     int fd = sqlite3_column_int64(imp->replay_log, 0);
@@ -1049,28 +1258,38 @@ void Database::replay_output(long job, const char *stdout, const char *stderr) {
   finish_stmt(why, imp->replay_log, imp->debugdb);
 }
 
-void Database::add_hash(const std::string &file, const std::string &hash, long modified) {
-  const char *why = "Could not insert a hash";
-  begin_txn();
-  bind_string(why, imp->wipe_file, 1, file);
-  bind_string(why, imp->wipe_file, 2, hash);
-  single_step(why, imp->wipe_file, imp->debugdb);
-  bind_string(why, imp->update_file, 1, hash);
-  bind_integer(why, imp->update_file, 2, modified);
-  bind_string(why, imp->update_file, 3, file);
-  single_step(why, imp->update_file, imp->debugdb);
-  bind_string(why, imp->insert_file, 1, hash);
-  bind_integer(why, imp->insert_file, 2, modified);
-  bind_string(why, imp->insert_file, 3, file);
-  single_step(why, imp->insert_file, imp->debugdb);
-  end_txn();
+static void bind_stamp(const char *why, sqlite3_stmt *stmt, int index, const FileStamp &stamp) {
+  bind_integer(why, stmt, index, stamp.modified);
+  bind_integer(why, stmt, index + 1, stamp.changed);
+  bind_integer(why, stmt, index + 2, stamp.size);
+  bind_integer(why, stmt, index + 3, stamp.inode);
+  bind_integer(why, stmt, index + 4, stamp.device);
+}
+
+void Database::add_hash(const std::string &file, const std::string &hash, const FileStamp &stamp) {
+  Database::detail *imp = this->imp.get();
+  submit(imp, [imp, file, hash, stamp] {
+    const char *why = "Could not insert a hash";
+    bind_string(why, imp->wipe_file, 1, file);
+    bind_string(why, imp->wipe_file, 2, hash);
+    single_step(why, imp->wipe_file, imp->debugdb);
+    bind_string(why, imp->update_file, 1, hash);
+    bind_stamp(why, imp->update_file, 2, stamp);
+    bind_string(why, imp->update_file, 7, file);
+    single_step(why, imp->update_file, imp->debugdb);
+    bind_string(why, imp->insert_file, 1, hash);
+    bind_stamp(why, imp->insert_file, 2, stamp);
+    bind_string(why, imp->insert_file, 7, file);
+    single_step(why, imp->insert_file, imp->debugdb);
+  });
 }
 
-std::string Database::get_hash(const std::string &file, long modified) {
+std::string Database::get_hash(const std::string &file, const FileStamp &stamp) {
+  sync_writes(imp.get());
   std::string out;
   const char *why = "Could not fetch a hash";
   bind_string(why, imp->fetch_hash, 1, file);
-  bind_integer(why, imp->fetch_hash, 2, modified);
+  bind_stamp(why, imp->fetch_hash, 2, stamp);
   if (sqlite3_step(imp->fetch_hash) == SQLITE_ROW) out = rip_column(imp->fetch_hash, 0);
   finish_stmt(why, imp->fetch_hash, imp->debugdb);
   return out;
@@ -1355,6 +1574,7 @@ static std::vector<JobReflection> find_all(const Database *db, sqlite3_stmt *que
 }
 
 std::vector<std::string> Database::get_outputs() const {
+  sync_writes(imp.get());
   const char *why = "Could not get outputs";
   std::vector<std::string> out;
 
@@ -1440,6 +1660,7 @@ std::vector<JobReflection> Database::matching(
     const std::vector<std::vector<std::string>> &core_filters,
     std::vector<std::vector<std::string>> input_file_filters,
     std::vector<std::vector<std::string>> output_file_filters) {
+  sync_writes(imp.get());
   std::string input_file_join = "";
   if (!input_file_filters.empty()) {
     input_file_filters.push_back({"access = 1"});
@@ -1564,6 +1785,7 @@ std::vector<JobReflection> Database::matching(
 }
 
 std::vector<JobEdge> Database::get_edges() {
+  sync_writes(imp.get());
   std::vector<JobEdge> out;
   while (sqlite3_step(imp->get_edges) == SQLITE_ROW) {
     out.emplace_back(sqlite3_column_int64(imp->get_edges, 0),
@@ -1574,6 +1796,7 @@ std::vector<JobEdge> Database::get_edges() {
 }
 
 std::vector<JobTag> Database::get_tags() {
+  sync_writes(imp.get());
   std::vector<JobTag> out;
   while (sqlite3_step(imp->get_all_tags) == SQLITE_ROW) {
     out.emplace_back(sqlite3_column_int64(imp->get_all_tags, 0), rip_column(imp->get_all_tags, 1),
@@ -1584,6 +1807,7 @@ std::vector<JobTag> Database::get_tags() {
 }
 
 std::vector<RunReflection> Database::get_runs() const {
+  sync_writes(imp.get());
   std::vector<RunReflection> out;
   begin_txn();
   while (sqlite3_step(imp->get_all_runs) == SQLITE_ROW) {
@@ -1602,6 +1826,7 @@ std::vector<std::pair<std::string, int>> Database::get_interleaved_output(long j
   std::vector<std::pair<std::string, int>> out;
 
   const char *why = "Could not bind args";
+  sync_writes(imp.get());
   bind_integer(why, imp->get_interleaved_output, 1, job_id);
   while (sqlite3_step(imp->get_interleaved_output) == SQLITE_ROW) {
     out.emplace_back(rip_column(imp->get_interleaved_output, 0),
@@ -1613,5 +1838,6 @@ std::vector<std::pair<std::string, int>> Database::get_interleaved_output(long j
 }
 
 std::vector<FileDependency> Database::get_file_dependencies() const {
+  sync_writes(imp.get());
   return get_all_file_dependencies(this, imp->get_file_dependency);
 }
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include "compat/mtime.h"
 #include "json/json5.h"
 
 struct FileReflection {
@@ -148,8 +149,9 @@ struct Database {
 
   void tag_job(long job, const std::string &uri, const std::string &content);
 
-  void save_output(  // call only if needs_build -> true
+  void save_output(  // call only if needs_build -> true; buffered until flush_output
       long job, int descriptor, const char *buffer, int size, double runtime);
+  void flush_output();
   std::string get_output(long job, int descriptor) const;
   void replay_output(long job, const char *stdout, const char *stderr);
 
@@ -164,9 +166,10 @@ struct Database {
   //    of the removed files
   std::vector<std::string> clear_jobs();
 
-  void add_hash(const std::string &file, const std::string &hash, long modified);
+  // A hash is only returned while the file's stamp matches the one it was added with
+  void add_hash(const std::string &file, const std::string &hash, const FileStamp &stamp);
 
-  std::string get_hash(const std::string &file, long modified);
+  std::string get_hash(const std::string &file, const FileStamp &stamp);
 
   // In core_filters, the outer vec is a set of filters to be AND'd together, inner vec is a set of
   // queries to be OR'd together. This holds for input_file_filters and output_file_filters as well
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Open Group Base Specifications Issue 7
+#define _XOPEN_SOURCE 700
+#define _POSIX_C_SOURCE 200809L
+
+#include "file_hasher.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "blake2/blake2.h"
+#include "compat/nofollow.h"
+#include "job_cache/hash.h"
+#include "wcl/tracing.h"
+#include "wcl/unique_fd.h"
+
+// The cases below follow tools/wake-hash so that both give the same hashes
+
+static std::string hash_link(const std::string &file, std::string &error) {
+  std::vector<char> buffer(8192, 0);
+
+  while (true) {
+    ssize_t bytes_read = readlink(file.c_str(), buffer.data(), buffer.size());
+    if (bytes_read < 0) {
+      error = "readlink(" + file + "): " + strerror(errno);
+      return "BadHash";
+    }
+    if (static_cast<size_t>(bytes_read) != buffer.size()) {
+      buffer.resize(bytes_read);
+      break;
+    }
+    buffer.resize(2 * buffer.size(), 0);
+  }
+
+  return Hash256::blake2b(std::string(buffer.data(), buffer.size())).to_hex();
+}
+
+static std::string hash_contents(const std::string &file, int fd, std::string &error) {
+  blake2b_state S;
+  uint8_t hash[32], buffer[8192];
+  ssize_t got;
+
+  blake2b_init(&S, sizeof(hash));
+  while ((got = read(fd, &buffer[0], sizeof(buffer))) > 0) blake2b_update(&S, &buffer[0], got);
+  blake2b_final(&S, &hash[0], sizeof(hash));
+
+  if (got < 0) {
+    error = "read(" + file + "): " + strerror(errno);
+    return "BadHash";
+  }
+
+  return Hash256::from_hash(&hash).to_hex();
+}
+
+// Anything that is not a symlink, directory, or regular file
+static std::string hash_exotic() {
+  Hash256 out;
+  out.data[0] = 1;
+  return out.to_hex();
+}
+
+static std::string hash_dir() { return Hash256().to_hex(); }
+
+std::string hash_file(const std::string &file, std::string &error) {
+  // O_NONBLOCK so that a FIFO can't hold up a thread of the pool
+  auto fd = wcl::unique_fd::open(file.c_str(), O_RDONLY | O_NOFOLLOW | O_NONBLOCK);
+
+  if (!fd) {
+    if (fd.error() == EISDIR) return hash_dir();
+    if (fd.error() == ELOOP || fd.error() == EMLINK) return hash_link(file, error);
+    if (fd.error() == ENXIO) return hash_exotic();
+    error = "open(" + file + "): " + strerror(fd.error());
+    return "BadHash";
+  }
+
+  struct stat stat;
+  if (fstat(fd->get(), &stat) != 0) {
+    if (errno == EISDIR) return hash_dir();
+    error = "fstat(" + file + "): " + strerror(errno);
+    return "BadHash";
+  }
+
+  if (S_ISDIR(stat.st_mode)) return hash_dir();
+  if (S_ISLNK(stat.st_mode)) return hash_link(file, error);
+  if (S_ISREG(stat.st_mode)) return hash_contents(file, fd->get(), error);
+
+  return hash_exotic();
+}
+
+static void set_flag(int fd, int get, int set, int flag) {
+  int flags = fcntl(fd, get, 0);
+  if (flags != -1) fcntl(fd, set, flags | flag);
+}
+
+FileHasher::FileHasher(size_t threads) : stop(false) {
+  if (pipe(done_fd) != 0) {
+    wcl::log::error("pipe: %s", strerror(errno)).urgent()();
+    exit(1);
+  }
+  for (int fd : done_fd) {
+    set_flag(fd, F_GETFD, F_SETFD, FD_CLOEXEC);
+    // One unread byte is enough to wake the job table up
+    set_flag(fd, F_GETFL, F_SETFL, O_NONBLOCK);
+  }
+
+  // Signal handlers must keep running on the main thread
+  sigset_t block, saved;
+  sigfillset(&block);
+  pthread_sigmask(SIG_BLOCK, &block, &saved);
+  if (threads == 0) threads = 1;
+  for (size_t i = 0; i < threads; ++i) workers.emplace_back(&FileHasher::work, this);
+  pthread_sigmask(SIG_SETMASK, &saved, nullptr);
+}
+
+FileHasher::~FileHasher() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  ready.notify_all();
+  for (auto &worker : workers) worker.join();
+  (void)close(done_fd[0]);
+  (void)close(done_fd[1]);
+}
+
+void FileHasher::submit(std::shared_ptr<HashBatch> batch) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < batch->files.size(); ++i) queue.push_back(Item{batch, i});
+  }
+  ready.notify_all();
+}
+
+std::vector<std::shared_ptr<HashBatch>> FileHasher::take_done() {
+  char buffer[64];
+  while (read(done_fd[0], buffer, sizeof(buffer)) > 0) {
+  }
+
+  std::vector<std::shared_ptr<HashBatch>> out;
+  std::lock_guard<std::mutex> lock(mutex);
+  out.swap(done);
+  return out;
+}
+
+void FileHasher::work() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    ready.wait(lock, [this] { return stop || !queue.empty(); });
+    if (stop) return;
+
+    Item item = std::move(queue.front());
+    queue.pop_front();
+    lock.unlock();
+
+    HashBatch &batch = *item.batch;
+    batch.hashes[item.index] = hash_file(batch.files[item.index], batch.errors[item.index]);
+    bool last = --batch.remaining == 0;
+
+    lock.lock();
+    if (last) {
+      done.emplace_back(std::move(item.batch));
+      (void)!write(done_fd[1], "x", 1);
+    }
+  }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FILE_HASHER_H
+#define FILE_HASHER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Returns the hash of file exactly as wake-hash prints it, or "BadHash"
+// with error saying why.
+std::string hash_file(const std::string &file, std::string &error);
+
+// The files of one hash_files call
+struct HashBatch {
+  std::vector<std::string> files;
+  std::vector<std::string> hashes;  // filled in as the files are hashed
+  std::vector<std::string> errors;  // set where the hash is "BadHash"
+  std::atomic<size_t> remaining;
+
+  explicit HashBatch(std::vector<std::string> files_)
+      : files(std::move(files_)),
+        hashes(files.size()),
+        errors(files.size()),
+        remaining(files.size()) {}
+};
+
+// Hashes files on a pool of threads, so that the outputs of a job are hashed
+// without starting a wake-hash job of their own. The files of every batch
+// share one queue, so a large batch is spread over all the threads and a
+// small one submitted after it is not stuck behind it for long.
+//
+// fd() becomes readable when a batch is done; take_done() returns the
+// batches finished since it was last called and drains fd().
+class FileHasher {
+ public:
+  explicit FileHasher(size_t threads);
+  ~FileHasher();
+
+  FileHasher(const FileHasher &) = delete;
+  FileHasher &operator=(const FileHasher &) = delete;
+
+  int fd() const { return done_fd[0]; }
+  void submit(std::shared_ptr<HashBatch> batch);
+  std::vector<std::shared_ptr<HashBatch>> take_done();
+
+ private:
+  struct Item {
+    std::shared_ptr<HashBatch> batch;
+    size_t index;
+  };
+
+  std::mutex mutex;  // guards everything below
+  std::condition_variable ready;
+  std::deque<Item> queue;
+  std::vector<std::shared_ptr<HashBatch>> done;
+  bool stop;
+
+  int done_fd[2];
+  std::vector<std::thread> workers;
+
+  void work();
+};
+
+#endif
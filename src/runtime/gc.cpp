@@ -22,23 +22,47 @@
 #include "gc.h"
 
 #include <assert.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 
+#include "json/json5.h"
 #include "status.h"
 
 #define INITIAL_HEAP_SIZE 1024
+// Size of the to-space chunks claimed by each thread in a parallel collection
+#define LAB_PADS 4096
+// Smaller collections are not worth waking up the other threads
+#define PARALLEL_MIN_PADS (1 << 16)
+// Survivors older than this are counted together in the allocation site histograms
+#define SURVIVAL_AGES 16
 
 bool HeapAgeTracker::heapAgeTracker = false;
-std::unordered_map<const HeapObject *, uint32_t> HeapAgeTracker::age_map;
+uint32_t HeapAgeTracker::current_site = 0;
+HeapAgeTracker::Region HeapAgeTracker::regions[3];
+std::vector<std::string> HeapAgeTracker::site_names;
+std::vector<uint64_t> HeapAgeTracker::site_allocated;
+uintptr_t HeapGenerations::old_begin = 0;
+uintptr_t HeapGenerations::old_end = 0;
+uintptr_t HeapGenerations::young_begin = 0;
+uintptr_t HeapGenerations::young_end = 0;
+uintptr_t HeapGenerations::collect_begin = 0;
+uintptr_t HeapGenerations::collect_end = UINTPTR_MAX;
+std::vector<HeapPointerBase *> HeapGenerations::remembered;
+std::vector<HeapObject *> HeapGenerations::dirty;
 static std::ofstream g_csv;
 
 HeapObject::~HeapObject() {}
@@ -77,11 +101,32 @@ HeapStep MovedObject::explore(HeapStep step) { return to->explore(step); }
 
 void MovedObject::format(std::ostream &os, FormatState &state) const { to->format(os, state); }
 
+HeapObject *PadObject::copyto(Evacuator &ev) {
+  assert(0 /* unreachable */);
+  return nullptr;
+}
+
+PadObject *PadObject::scan(Evacuator &ev) { return this + 1; }
+
+HeapObject *MovedObject::copyto(Evacuator &ev) { return to; }
+
+PadObject *MovedObject::scan(Evacuator &ev) {
+  assert(0 /* unreachable */);
+  return nullptr;
+}
+
 Category MovedObject::category() const {
   // invoked by ~Target
   return to->category();
 }
 
+// How many objects from one allocation site survived their Nth collection
+struct SiteStats {
+  uint64_t objects[SURVIVAL_AGES];
+  uint64_t pads[SURVIVAL_AGES];
+  SiteStats() : objects(), pads() {}
+};
+
 struct HeapStats {
   const char *type;
   size_t objects, pads;
@@ -92,6 +137,7 @@ struct Space {
   size_t size;
   size_t alloc;
   PadObject *array;
+  std::vector<uint32_t> tags;  // the HeapAgeTracker side table
 
   Space(size_t size_ = INITIAL_HEAP_SIZE);
   ~Space();
@@ -104,20 +150,188 @@ Space::Space(size_t size_)
       alloc(size_),
       array(static_cast<PadObject *>(::malloc(sizeof(PadObject) * size))) {
   assert(array);
+  if (HeapAgeTracker::enabled()) tags.resize(alloc);
 }
 
 Space::~Space() { ::free(array); }
 
 void Space::resize(size_t size_) {
   if (alloc < size_ || 3 * size_ < alloc) {
-    alloc = size_ + (size_ >> 1);
+    // realloc to zero bytes would free the array, as happens when an empty heap is collected
+    alloc = std::max(size_ + (size_ >> 1), static_cast<size_t>(1));
     void *tmp = ::realloc(static_cast<void *>(array), sizeof(PadObject) * alloc);
     assert(tmp);
     array = static_cast<PadObject *>(tmp);
   }
+  if (HeapAgeTracker::enabled()) tags.resize(alloc);
   size = size_;
 }
 
+// A parallel collection leaves the original object alone until every thread is done,
+// except for this word, which holds the forwarding pointer once the object is copied.
+// For a DestroyableObject, this overwrites 'next'.
+static HeapObject *&forwarding(HeapObject *obj) { return reinterpret_cast<MovedObject *>(obj)->to; }
+
+struct Evacuator::Shared {
+  // Every pad in the spaces being collected has two claim bits: CLAIMED, then DONE
+  struct Region {
+    uintptr_t begin, end;
+    std::atomic<uint64_t> *bits;
+  };
+  Region regions[2];
+
+  std::atomic<PadObject *> free;  // unclaimed to-space
+  PadObject *end;
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::vector<Range> ranges;  // unscanned objects any thread may take
+  int threads;
+  int idle;
+  std::atomic<int> hungry;  // idle threads with no range waiting for them
+
+  Shared(PadObject *free_, PadObject *end_, int threads_)
+      : regions(), free(free_), end(end_), threads(threads_), idle(0), hungry(0) {}
+
+  void update() {
+    hungry.store(idle - static_cast<int>(ranges.size()), std::memory_order_relaxed);
+  }
+
+  // Find the claim bits for an object; returns the word and sets 'claimed' to its CLAIMED bit
+  std::atomic<uint64_t> &bits(const HeapObject *obj, uint64_t &claimed) const {
+    uintptr_t x = reinterpret_cast<uintptr_t>(obj);
+    const Region *r = &regions[0];
+    if (x - r->begin >= r->end - r->begin) ++r;
+    assert(x - r->begin < r->end - r->begin);
+    size_t pad = (x - r->begin) / sizeof(PadObject);
+    claimed = static_cast<uint64_t>(1) << (2 * (pad % 32));
+    return r->bits[pad / 32];
+  }
+
+  bool copied(const HeapObject *obj) const {
+    uint64_t claimed;
+    return bits(obj, claimed).load(std::memory_order_acquire) & (claimed << 1);
+  }
+};
+
+Evacuator::Evacuator(Shared &shared_)
+    : shared(shared_), lab_scan(nullptr), lab_free(nullptr), lab_end(nullptr) {}
+
+HeapObject *Evacuator::forward(HeapObject *obj) {
+  uint64_t claimed;
+  std::atomic<uint64_t> &bits = shared.bits(obj, claimed);
+  uint64_t done = claimed << 1;
+
+  uint64_t old = bits.load(std::memory_order_acquire);
+  while (!(old & claimed)) {
+    if (bits.compare_exchange_weak(old, old | claimed, std::memory_order_acquire)) {
+      HeapObject *to = obj->copyto(*this);
+      forwarding(obj) = to;
+      bits.fetch_or(done, std::memory_order_release);
+      return to;
+    }
+  }
+
+  // Another thread won the race; wait for it to publish the forwarding pointer
+  while (!(old & done)) {
+    std::this_thread::yield();
+    old = bits.load(std::memory_order_acquire);
+  }
+  return forwarding(obj);
+}
+
+PadObject *Evacuator::refill(size_t pads) {
+  if (pads > LAB_PADS / 4) {
+    // Big objects get space of their own, so a retired LAB wastes less than 1/4 of itself
+    PadObject *out = shared.free.fetch_add(pads);
+    assert(out + pads <= shared.end);
+    ranges.emplace_back(out, out + pads);
+    return out;
+  }
+
+  retire();
+  lab_scan = lab_free = shared.free.fetch_add(LAB_PADS);
+  lab_end = lab_free + LAB_PADS;
+  assert(lab_end <= shared.end);
+
+  PadObject *out = lab_free;
+  lab_free += pads;
+  return out;
+}
+
+void Evacuator::retire() {
+  if (lab_scan != lab_free) ranges.emplace_back(lab_scan, lab_free);
+  // Keep the to-space walkable
+  while (lab_free != lab_end) lab_free = PadObject::place(lab_free);
+  lab_scan = lab_free;
+}
+
+void Evacuator::scan(Range range) {
+  for (PadObject *pad = range.first; pad != range.second;) {
+    HeapObject *obj = pad;
+    pad = obj->scan(*this);
+    if (shared.hungry.load(std::memory_order_relaxed) > 0) share();
+  }
+}
+
+void Evacuator::share() {
+  Range range;
+  if (!ranges.empty()) {
+    // The oldest range likely leads to the most work
+    range = ranges.front();
+    ranges.pop_front();
+  } else if (lab_scan != lab_free) {
+    range = Range(lab_scan, lab_free);
+    lab_scan = lab_free;
+  } else {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  shared.ranges.push_back(range);
+  shared.update();
+  shared.cond.notify_one();
+}
+
+bool Evacuator::steal() {
+  std::unique_lock<std::mutex> lock(shared.mutex);
+  ++shared.idle;
+  shared.update();
+  while (shared.ranges.empty()) {
+    if (shared.idle == shared.threads) {
+      // Every thread is out of work, so the collection is complete
+      shared.cond.notify_all();
+      return false;
+    }
+    shared.cond.wait(lock);
+  }
+  --shared.idle;
+  ranges.push_back(shared.ranges.back());
+  shared.ranges.pop_back();
+  shared.update();
+  return true;
+}
+
+void Evacuator::run() {
+  do {
+    for (;;) {
+      if (!ranges.empty()) {
+        Range range = ranges.back();
+        ranges.pop_back();
+        scan(range);
+      } else if (lab_scan != lab_free) {
+        // Objects copied while scanning this range land after it (like Cheney)
+        Range range(lab_scan, lab_free);
+        lab_scan = lab_free;
+        scan(range);
+      } else {
+        break;
+      }
+    }
+  } while (steal());
+  retire();
+}
+
 struct Heap::Imp {
   int profile_heap;
   double heap_factor;
@@ -133,7 +347,34 @@ struct Heap::Imp {
   size_t gc_count;
   size_t total_gc_time;
 
-  Imp(int profile_heap_, double heap_factor_)
+  // Generational collection state; only used when nursery_pads != 0
+  size_t nursery_pads;
+  Space nursery;
+  PadObject *old_free;
+  PadObject *old_end;
+  HeapObject *tenured;  // finalize list for objects promoted out of the nursery
+
+  size_t minor_count;
+  size_t major_count;
+  double minor_gc_time;
+  double major_gc_time;
+
+  // Parallel collection state; the worker threads are started on first use
+  int threads;
+  std::vector<std::thread> workers;
+  std::mutex pool_mutex;
+  std::condition_variable pool_wake;
+  std::condition_variable pool_done;
+  Evacuator::Shared *batch;  // the collection the workers should join
+  size_t epoch;
+  int running;
+  bool quit;
+  std::unique_ptr<std::atomic<uint64_t>[]> claims;
+  size_t claim_words;
+
+  std::vector<SiteStats> sites;  // indexed by HeapAgeTracker site
+
+  Imp(int profile_heap_, double heap_factor_, size_t nursery_pads_, int threads_)
       : profile_heap(profile_heap_),
         heap_factor(heap_factor_),
         spaces(),
@@ -145,24 +386,138 @@ struct Heap::Imp {
         previous_alloc(1),
         finalize(nullptr),
         gc_count(0),
-        total_gc_time(0) {}
+        total_gc_time(0),
+        nursery_pads(nursery_pads_),
+        nursery(nursery_pads_ ? nursery_pads_ : 1),
+        old_free(spaces[space].array),
+        old_end(spaces[space].array + spaces[space].size),
+        tenured(nullptr),
+        minor_count(0),
+        major_count(0),
+        minor_gc_time(0),
+        major_gc_time(0),
+        threads(threads_),
+        batch(nullptr),
+        epoch(0),
+        running(0),
+        quit(false),
+        claim_words(0) {}
+  ~Imp();
+
+  // Is a collection of this many pads worth doing in parallel?
+  bool parallel(size_t pads) const {
+    // The HeapAgeTracker used by --profile-heap is not thread-safe
+    return threads > 1 && !profile_heap && pads >= PARALLEL_MIN_PADS;
+  }
+
+  // Extra to-space needed by a collection of this many pads to cover LAB fragmentation
+  size_t slack(size_t pads) const {
+    return parallel(pads) ? pads / 3 + threads * LAB_PADS : 0;
+  }
+
+  std::atomic<uint64_t> *claim_bits(size_t words);
+  PadObject *evacuate(Evacuator::Shared &shared, Evacuator &ev);
+  void worker();
 };
 
-Heap::Heap(int profile_heap_, double heap_factor_)
-    : imp(new Imp(profile_heap_, heap_factor_)),
-      roots(),
-      free(imp->spaces[imp->space].array),
-      end(free + imp->spaces[imp->space].size) {}
+Heap::Imp::~Imp() {
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    quit = true;
+  }
+  pool_wake.notify_all();
+  for (auto &t : workers) t.join();
+}
+
+// Zeroed claim bits, reused between collections
+std::atomic<uint64_t> *Heap::Imp::claim_bits(size_t words) {
+  if (claim_words < words) {
+    claims.reset(new std::atomic<uint64_t>[words]);
+    claim_words = words;
+  }
+  for (size_t i = 0; i < words; ++i) claims[i].store(0, std::memory_order_relaxed);
+  return claims.get();
+}
+
+// Run the workers alongside 'ev' until everything reachable is copied; returns the new free
+PadObject *Heap::Imp::evacuate(Evacuator::Shared &shared, Evacuator &ev) {
+  if (workers.empty()) {
+    // Signal handlers must keep running on the main thread
+    sigset_t block, saved;
+    sigfillset(&block);
+    pthread_sigmask(SIG_BLOCK, &block, &saved);
+    for (int i = 1; i < threads; ++i) workers.emplace_back(&Imp::worker, this);
+    pthread_sigmask(SIG_SETMASK, &saved, nullptr);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    batch = &shared;
+    running = threads - 1;
+    ++epoch;
+  }
+  pool_wake.notify_all();
+
+  ev.run();
+
+  std::unique_lock<std::mutex> lock(pool_mutex);
+  pool_done.wait(lock, [this] { return running == 0; });
+  batch = nullptr;
+  return shared.free.load();
+}
+
+void Heap::Imp::worker() {
+  size_t seen = 0;
+  std::unique_lock<std::mutex> lock(pool_mutex);
+  for (;;) {
+    pool_wake.wait(lock, [&] { return quit || epoch != seen; });
+    if (quit) return;
+    seen = epoch;
+    Evacuator ev(*batch);
+    lock.unlock();
+    ev.run();
+    lock.lock();
+    if (--running == 0) pool_done.notify_one();
+  }
+}
+
+Heap::Heap(int profile_heap_, double heap_factor_, size_t nursery_bytes_, int threads_)
+    : imp(new Imp(profile_heap_, heap_factor_,
+                  (nursery_bytes_ + sizeof(PadObject) - 1) / sizeof(PadObject), threads_)),
+      roots() {
+  if (imp->nursery_pads) {
+    free = imp->nursery.array;
+    end = free + imp->nursery.size;
+  } else {
+    free = imp->spaces[imp->space].array;
+    end = free + imp->spaces[imp->space].size;
+  }
+  update_generations();
+  update_tracker();
+}
 
 Heap::~Heap() {
-  GC(0);
-  assert(free == imp->spaces[imp->space].array);
+  collect(0, false);
+  assert(free == (imp->nursery_pads ? imp->nursery.array : imp->spaces[imp->space].array));
+  assert(!imp->nursery_pads || imp->old_free == imp->spaces[imp->space].array);
+  // Later heaps start out non-generational
+  imp->nursery_pads = 0;
+  update_generations();
+  for (auto &r : HeapAgeTracker::regions) r = HeapAgeTracker::Region();
 }
 
-size_t Heap::used() const { return (free - imp->spaces[imp->space].array) * sizeof(PadObject); }
+size_t Heap::used() const {
+  if (imp->nursery_pads) {
+    Space &old = imp->spaces[imp->space];
+    return ((imp->old_free - old.array) + (free - imp->nursery.array)) * sizeof(PadObject);
+  } else {
+    return (free - imp->spaces[imp->space].array) * sizeof(PadObject);
+  }
+}
 
 size_t Heap::alloc() const {
-  return (imp->spaces[0].alloc + imp->spaces[1].alloc) * sizeof(PadObject);
+  size_t nursery = imp->nursery_pads ? imp->nursery.alloc : 0;
+  return (imp->spaces[0].alloc + imp->spaces[1].alloc + nursery) * sizeof(PadObject);
 }
 
 size_t Heap::avail() const { return (end - free) * sizeof(PadObject); }
@@ -172,15 +527,49 @@ void *Heap::scratch(size_t bytes) {
   Space &idle = imp->spaces[imp->space ^ 1];
   if (idle.alloc < size) idle.resize(size);
   if (imp->peak_alloc < alloc()) imp->peak_alloc = alloc();
+  update_tracker();
   return idle.array;
 }
 
+void Heap::update_tracker() {
+  Space *spaces[3] = {&imp->spaces[0], &imp->spaces[1], &imp->nursery};
+  for (int i = 0; i < 3; ++i) {
+    HeapAgeTracker::Region &r = HeapAgeTracker::regions[i];
+    r.begin = reinterpret_cast<uintptr_t>(spaces[i]->array);
+    r.end = reinterpret_cast<uintptr_t>(spaces[i]->array + spaces[i]->tags.size());
+    r.tags = spaces[i]->tags.data();
+  }
+}
+
+void Heap::update_generations() {
+  HeapGenerations::collect_begin = 0;
+  HeapGenerations::collect_end = UINTPTR_MAX;
+  if (imp->nursery_pads) {
+    Space &old = imp->spaces[imp->space];
+    HeapGenerations::old_begin = reinterpret_cast<uintptr_t>(old.array);
+    HeapGenerations::old_end = reinterpret_cast<uintptr_t>(old.array + old.size);
+    HeapGenerations::young_begin = reinterpret_cast<uintptr_t>(imp->nursery.array);
+    HeapGenerations::young_end =
+        reinterpret_cast<uintptr_t>(imp->nursery.array + imp->nursery.size);
+  } else {
+    HeapGenerations::old_begin = HeapGenerations::old_end = 0;
+    HeapGenerations::young_begin = HeapGenerations::young_end = 0;
+  }
+}
+
 void Heap::report() const {
   if (imp->profile_heap) {
     std::stringstream s;
     s << "------------------------------------------" << std::endl;
     s << "Peak live heap " << (imp->most_pads * 8) << " bytes" << std::endl;
     s << "Peak System Alloc: " << imp->peak_alloc << std::endl;
+    if (imp->nursery_pads) {
+      s << std::fixed << std::setprecision(2);
+      s << "Minor collections: " << imp->minor_count << " (" << imp->minor_gc_time << " ms)"
+        << std::endl;
+      s << "Major collections: " << imp->major_count << " (" << imp->major_gc_time << " ms)"
+        << std::endl;
+    }
     s << "------------------------------------------" << std::endl;
     s << "  Object type          Objects       Bytes" << std::endl;
     s << "  ----------------------------------------" << std::endl;
@@ -193,7 +582,37 @@ void Heap::report() const {
     s << "------------------------------------------" << std::endl;
     // TODO: Add that this is coming from profile
     status_get_generic_stream(STREAM_REPORT) << s.str() << std::endl;
+    report_sites();
+  }
+}
+
+// Dump survival histograms for every allocation site, busiest first
+void Heap::report_sites() const {
+  const std::vector<std::string> &names = HeapAgeTracker::site_names;
+  const std::vector<uint64_t> &allocated = HeapAgeTracker::site_allocated;
+  std::vector<uint32_t> order;
+  for (uint32_t i = 0; i < names.size(); ++i)
+    if (allocated[i]) order.push_back(i);
+  std::sort(order.begin(), order.end(),
+            [&](uint32_t a, uint32_t b) { return allocated[a] > allocated[b]; });
+
+  std::ofstream f("heap_sites.json", std::ios::out | std::ios::trunc);
+  f << "{\"survival_ages\":" << SURVIVAL_AGES << ",\"sites\":[";
+  for (size_t i = 0; i < order.size(); ++i) {
+    uint32_t site = order[i];
+    SiteStats empty;
+    const SiteStats &x = site < imp->sites.size() ? imp->sites[site] : empty;
+    if (i) f << ",";
+    f << std::endl
+      << "{\"site\":\"" << json_escape(names[site]) << "\",\"allocated\":" << allocated[site]
+      << ",\"survived\":[";
+    for (int age = 0; age < SURVIVAL_AGES; ++age) f << (age ? "," : "") << x.objects[age];
+    f << "],\"survived_bytes\":[";
+    for (int age = 0; age < SURVIVAL_AGES; ++age)
+      f << (age ? "," : "") << x.pads[age] * sizeof(PadObject);
+    f << "]}";
   }
+  f << "]}" << std::endl;
 }
 
 struct ObjectStats {
@@ -207,7 +626,58 @@ struct StatOrder {
   bool operator()(Kind a, Kind b) { return a.second.pads > b.second.pads; }
 };
 
+// Destroy the unreachable objects on a finalize list; survivors are prepended to 'tail'
+static size_t finalize_list(HeapObject *list, HeapObject *&tail) {
+  HeapObject *next;
+  size_t deleted_objs = 0;
+  // Iterate through objects in the (from space) and delete those which weren't moved
+  for (HeapObject *obj = list; obj; obj = next) {
+    // If we moved this object to the to space update its pointers to the to heap
+    if (typeid(*obj) == typeid(MovedObject)) {
+      MovedObject *mo = static_cast<MovedObject *>(obj);
+      DestroyableObject *keep = static_cast<DestroyableObject *>(mo->to);
+      next = keep->next;
+      keep->next = tail;
+      tail = keep;
+    } else {  // if we did not move it destroy it
+      next = static_cast<DestroyableObject *>(obj)->next;
+      obj->~HeapObject();
+      deleted_objs++;
+    }
+  }
+  return deleted_objs;
+}
+
+// After a parallel collection, turn the copied objects on a finalize list into MovedObjects
+static void install_forwarding(HeapObject *list, const Evacuator::Shared &shared) {
+  HeapObject *next;
+  for (HeapObject *obj = list; obj; obj = next) {
+    DestroyableObject *from = static_cast<DestroyableObject *>(obj);
+    if (shared.copied(obj)) {
+      DestroyableObject *to = static_cast<DestroyableObject *>(forwarding(obj));
+      next = to->next;
+      // Restore the link overwritten by the forwarding pointer, then destroy like moveto
+      from->next = next;
+      obj->~HeapObject();
+      new (obj) MovedObject(to);
+    } else {
+      next = from->next;
+    }
+  }
+}
+
 void Heap::GC(size_t requested_pads) {
+  // A minor collection promotes every nursery survivor, so it needs that much old space
+  bool minor = false;
+  if (imp->nursery_pads) {
+    size_t young_pads = free - imp->nursery.array;
+    minor = static_cast<size_t>(imp->old_end - imp->old_free) >=
+            young_pads + imp->slack(young_pads);
+  }
+  collect(requested_pads, minor);
+}
+
+void Heap::collect(size_t requested_pads, bool minor) {
   auto gc_start = std::chrono::system_clock::now();
   std::time_t current_t = std::chrono::system_clock::to_time_t(gc_start);
   std::tm *local_tm = std::localtime(&current_t);
@@ -220,26 +690,93 @@ void Heap::GC(size_t requested_pads) {
                      << std::setw(3) << ms.count();
   imp->gc_count += 1;
 
+  bool generational = imp->nursery_pads != 0;
   Space &from = imp->spaces[imp->space];
-  size_t no_gc_overrun = (free - from.array) + requested_pads;
-  size_t estimate_desired_size = imp->heap_factor * imp->last_pads + requested_pads;
-  size_t elems = std::max(no_gc_overrun, estimate_desired_size);
-
-  // Resize the to space based on the above "calculation"
-  imp->space ^= 1;
-  Space &to = imp->spaces[imp->space];
-  to.resize(elems);
-  if (imp->peak_alloc < alloc()) imp->peak_alloc = alloc();
+  size_t young_pads = generational ? free - imp->nursery.array : 0;
+  size_t old_pads = minor ? 0 : generational ? imp->old_free - from.array : free - from.array;
+  bool parallel = imp->parallel(young_pads + old_pads);
+  size_t elems = 0;
+  Placement progress(nullptr, nullptr);
+
+  if (minor) {
+    // Promote nursery survivors to the end of the old space
+    HeapGenerations::collect_begin = HeapGenerations::young_begin;
+    HeapGenerations::collect_end = HeapGenerations::young_end;
+    progress = Placement(imp->old_free, imp->old_free);
+  } else {
+    // A generational old space must also have room to absorb the next nursery
+    size_t headroom = generational ? imp->nursery.size : requested_pads;
+    size_t no_gc_overrun = old_pads + young_pads + imp->slack(old_pads + young_pads) + headroom;
+    size_t estimate_desired_size = imp->heap_factor * imp->last_pads + headroom;
+    elems = std::max(no_gc_overrun, estimate_desired_size);
+
+    // Resize the to space based on the above "calculation"
+    imp->space ^= 1;
+    Space &to = imp->spaces[imp->space];
+    to.resize(elems);
+    if (imp->peak_alloc < alloc()) imp->peak_alloc = alloc();
+    update_tracker();
+    progress = Placement(to.array, to.array);
+  }
 
-  Placement progress(to.array, to.array);
   std::map<const char *, ObjectStats> stats;
 
+  // A parallel collection copies the roots on this thread, then shares the scanning
+  PadObject *to_end = minor ? imp->old_end : imp->spaces[imp->space].array + elems;
+  Evacuator::Shared shared(progress.free, to_end, imp->threads);
+  Evacuator ev(shared);
+  if (parallel) {
+    size_t young_words = (young_pads + 31) / 32;
+    std::atomic<uint64_t> *bits = imp->claim_bits(young_words + (old_pads + 31) / 32);
+    Evacuator::Shared::Region young = {reinterpret_cast<uintptr_t>(imp->nursery.array),
+                                       reinterpret_cast<uintptr_t>(imp->nursery.array + young_pads),
+                                       bits};
+    Evacuator::Shared::Region old = {reinterpret_cast<uintptr_t>(from.array),
+                                     reinterpret_cast<uintptr_t>(from.array + old_pads),
+                                     bits + young_words};
+    shared.regions[0] = young;
+    shared.regions[1] = old;
+  }
+
   // Move and compact all root objects over to the new space
   for (RootRing *root = roots.next; root != &roots; root = root->next) {
-    if (!root->root) continue;
-    auto out = root->root->moveto(progress.free);
-    progress.free = out.free;
-    root->root = out.obj;
+    if (!root->root || !HeapGenerations::collecting(root->root)) continue;
+    if (parallel) {
+      root->root = ev.forward(root->root);
+    } else {
+      auto out = root->root->moveto(progress.free);
+      progress.free = out.free;
+      root->root = out.obj;
+    }
+  }
+
+  // Old objects which point into the nursery are also roots for a minor collection
+  if (minor) {
+    for (HeapPointerBase *slot : HeapGenerations::remembered) {
+      if (parallel) {
+        slot->evacuate(&ev);
+      } else {
+        progress.free = slot->moveto(progress.free);
+      }
+    }
+    // So are old objects which touched their malloc'd HeapPointers since the last collection.
+    // Objects promoted by earlier collections were fully scanned on the way out of the nursery.
+    for (HeapObject *obj : HeapGenerations::dirty) {
+      if (parallel) {
+        obj->scan(ev);
+      } else {
+        progress.free = obj->descend(progress.free).free;
+      }
+    }
+  }
+  HeapGenerations::remembered.clear();
+  HeapGenerations::dirty.clear();
+
+  if (parallel) {
+    PadObject *copied = imp->evacuate(shared, ev);
+    progress = Placement(copied, copied);
+    install_forwarding(imp->finalize, shared);
+    if (!minor) install_forwarding(imp->tenured, shared);
   }
 
   int profile = imp->profile_heap;
@@ -252,9 +789,10 @@ void Heap::GC(size_t requested_pads) {
     auto next = progress.obj->descend(progress.free);
     if (profile) {
       ObjectStats &s = stats[progress.obj->type()];
+      size_t pads = static_cast<PadObject *>(next.obj) - static_cast<PadObject *>(progress.obj);
       ++s.objects;
       total_objs++;
-      s.pads += (static_cast<PadObject *>(next.obj) - static_cast<PadObject *>(progress.obj));
+      s.pads += pads;
 
       HeapObject *ho = static_cast<HeapObject *>(progress.obj);
       auto obj_age = HeapAgeTracker::getAge(ho);
@@ -265,40 +803,61 @@ void Heap::GC(size_t requested_pads) {
       } else {
         ++old_objects;
       }
+
+      // Every object scanned here just survived a collection, so its age is at least 1
+      if (obj_age > 0) {
+        uint32_t site = HeapAgeTracker::getSite(ho);
+        if (imp->sites.size() <= site) imp->sites.resize(site + 1);
+        size_t bucket = std::min(obj_age, static_cast<uint32_t>(SURVIVAL_AGES)) - 1;
+        ++imp->sites[site].objects[bucket];
+        imp->sites[site].pads[bucket] += pads;
+      }
     }
     progress = next;
   }
 
-  DestroyableObject *tail = nullptr;
-  HeapObject *next;
   size_t deleted_objs = 0;
-  // Iterate through objects in the (from space) and delete those which weren't moved
-  for (HeapObject *obj = imp->finalize; obj; obj = next) {
-    // If we moved this object to the to space update its pointers to the to heap
-    if (typeid(*obj) == typeid(MovedObject)) {
-      MovedObject *mo = static_cast<MovedObject *>(obj);
-      DestroyableObject *keep = static_cast<DestroyableObject *>(mo->to);
-      next = keep->next;
-      keep->next = tail;
-      tail = keep;
-    } else {  // if we did not move it destroy it
-      next = static_cast<DestroyableObject *>(obj)->next;
-      obj->~HeapObject();
-      deleted_objs++;
-    }
+  if (generational) {
+    // Nursery survivors join the tenured finalize list
+    HeapObject *tail = minor ? imp->tenured : nullptr;
+    if (!minor) deleted_objs += finalize_list(imp->tenured, tail);
+    deleted_objs += finalize_list(imp->finalize, tail);
+    imp->tenured = tail;
+    imp->finalize = nullptr;
+  } else {
+    HeapObject *tail = nullptr;
+    deleted_objs += finalize_list(imp->finalize, tail);
+    // Update to the last object in the to space
+    imp->finalize = tail;
   }
-  // Update to the last object in the to space
-  imp->finalize = tail;
 
-  end = to.array + elems;            // elems doesn't include the extra 50% from resize
-  free = progress.free;              // The place to append new things on the heap
-  imp->last_pads = free - to.array;  // how many bytes were copied to the to space
-  // Contain heap growth due to no_gc_overrun pessimism
-  size_t desired_sized = imp->heap_factor * imp->last_pads + requested_pads;
-  if (desired_sized < elems) {
-    end =
-        to.array + desired_sized;  // Update the end to be smaller if we don't need that much space
+  Space &to = imp->spaces[imp->space];
+  if (generational) {
+    // The nursery is now empty; grow it if a single request will not fit
+    if (imp->nursery.size < requested_pads) imp->nursery.resize(requested_pads);
+    free = imp->nursery.array;
+    end = free + imp->nursery.size;
+    imp->old_free = progress.free;
+    if (!minor) {
+      imp->last_pads = imp->old_free - to.array;
+      imp->old_end = to.array + elems;
+      // Contain heap growth due to no_gc_overrun pessimism
+      size_t desired_sized = imp->heap_factor * imp->last_pads + imp->nursery.size;
+      if (desired_sized < elems) imp->old_end = to.array + desired_sized;
+    }
+  } else {
+    end = to.array + elems;            // elems doesn't include the extra 50% from resize
+    free = progress.free;              // The place to append new things on the heap
+    imp->last_pads = free - to.array;  // how many bytes were copied to the to space
+    // Contain heap growth due to no_gc_overrun pessimism
+    size_t desired_sized = imp->heap_factor * imp->last_pads + requested_pads;
+    if (desired_sized < elems) {
+      end = to.array +
+            desired_sized;  // Update the end to be smaller if we don't need that much space
+    }
   }
+  update_generations();
+  update_tracker();
 
   double actual_growth = alloc() / (double)imp->previous_alloc;
   imp->previous_alloc = alloc();
@@ -307,6 +866,18 @@ void Heap::GC(size_t requested_pads) {
   std::chrono::duration<double> elapsed = gc_end - gc_start;
   double gc_duration_ms = elapsed.count() * 1000.0;
   imp->total_gc_time += gc_duration_ms;
+  if (generational) {
+    if (minor) {
+      ++imp->minor_count;
+      imp->minor_gc_time += gc_duration_ms;
+    } else {
+      ++imp->major_count;
+      imp->major_gc_time += gc_duration_ms;
+    }
+  }
+  const char *kind = !generational ? "full" : minor ? "minor" : "major";
+  // Live data in the space being collected into
+  size_t live_pads = generational ? imp->old_free - to.array : imp->last_pads;
 
   if (imp->profile_heap) {
     std::stringstream s;
@@ -320,23 +891,29 @@ void Heap::GC(size_t requested_pads) {
                "Factor, Total allocated (bytes), Current Semisphere, Semisphere 0 allocated, "
                "Semisphere 1 allocated, Live Heap (bytes), Free Space in Semi, "
             << "Percentage used of Semi, Percentage used of Alloc, Requested Space, Deleted, Young "
-               "Objects (<2), Mid Objects (<5), Old Objects (>5), Total Objects\n";
+               "Objects (<2), Mid Objects (<5), Old Objects (>5), Total Objects, Collection\n";
     }
 
     if (imp->profile_heap > 1 && !top.empty()) {
-      double free_space = (end - free) * sizeof(PadObject);
-      double used_space = (imp->last_pads) * sizeof(PadObject);
+      PadObject *semi_free = generational ? imp->old_free : free;
+      PadObject *semi_end = generational ? imp->old_end : end;
+      double free_space = (semi_end - semi_free) * sizeof(PadObject);
+      double used_space = live_pads * sizeof(PadObject);
       double total_space = free_space + used_space;
       double percentage_used_semi = (used_space / total_space) * 100;
       double percentage_used_allocated = (used_space / alloc()) * 100;
 
       s << "------------------------------------------" << std::endl;
       s << std::fixed << std::setprecision(2);
-      s << "GC Number: " << imp->gc_count << std::endl;
+      s << "GC Number: " << imp->gc_count << " (" << kind << ")" << std::endl;
       s << "Current Time Stamp: " << curent_time_string.str() << std::endl;
       s << "Current GC Duration: " << gc_duration_ms << " ms" << std::endl;
       s << "Total actual allocated: " << alloc() << std::endl;
       s << "Live heap: " << used_space << " bytes" << std::endl;
+      if (minor) {
+        s << "Nursery: " << (young_pads * sizeof(PadObject)) << " bytes, " << total_objs
+          << " objects promoted" << std::endl;
+      }
       s << "Free Space left in semisphere: " << free_space << " bytes" << std::endl;
       s << "Percentage used of semisphere: " << percentage_used_semi << std::endl;
       s << "Percentage used of total allocated: " << percentage_used_allocated << std::endl;
@@ -360,14 +937,16 @@ void Heap::GC(size_t requested_pads) {
             << imp->spaces[1].alloc * sizeof(PadObject) << ", " << used_space << ", " << free_space
             << ", " << percentage_used_semi << ", " << percentage_used_allocated << ", "
             << requested_pads * sizeof(PadObject) << ", " << deleted_objs << ", " << young_objects
-            << ", " << mid_objects << ", " << old_objects << ", " << total_objs << "\n";
+            << ", " << mid_objects << ", " << old_objects << ", " << total_objs << ", " << kind
+            << "\n";
 
       // TODO: Say that this is from profiling
       status_get_generic_stream(STREAM_REPORT) << s.str() << std::endl;
     }
 
-    if (imp->last_pads > imp->most_pads) {
-      imp->most_pads = imp->last_pads;
+    // Minor collections only see the promoted objects, so only full/major ones track the peak
+    if (!minor && live_pads > imp->most_pads) {
+      imp->most_pads = live_pads;
       size_t max = top.size();
       if (max > sizeof(imp->peak) / sizeof(imp->peak[0]))
         max = sizeof(imp->peak) / sizeof(imp->peak[0]);
@@ -382,6 +961,14 @@ void Heap::GC(size_t requested_pads) {
   }
 }
 
+uint32_t HeapAgeTracker::registerSite(const std::string &name) {
+  // Sites must fit in 24 bits; lump any excess in with the runtime
+  if (site_names.size() >= (1 << 24)) return 0;
+  site_names.push_back(name);
+  site_allocated.push_back(0);
+  return site_names.size() - 1;
+}
+
 Category Value::category() const { return VALUE; }
 
 DestroyableObject::DestroyableObject(Heap &h) : next(h.imp->finalize) { h.imp->finalize = this; }
@@ -20,11 +20,14 @@
 
 #include <stdint.h>
 
+#include <deque>
 #include <iostream>
 #include <memory>
 #include <ostream>
+#include <string>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 #ifdef DEBUG_GC
 #include <cassert>
 #endif
@@ -39,6 +42,7 @@ struct HeapObject;
 struct HeapPointerBase;
 struct DestroyableObject;
 struct PadObject;
+struct Evacuator;
 struct FormatState;
 struct Promise;
 template <typename T>
@@ -57,33 +61,114 @@ struct HeapStep {
   HeapObject **found;
 };
 
+// The age and allocation site of every object, for --profile-heap.
+// These are kept in a side table with one tag per pad, so objects do not grow.
+// A tag holds the allocation site in its high 24 bits and the age in its low 8 bits.
+// The age counts how many collections copied the object (saturating at 255).
 struct HeapAgeTracker {
-  static void initTracker(bool enable) { heapAgeTracker = enable; }
+  static void initTracker(bool enable) {
+    heapAgeTracker = enable;
+    if (site_names.empty()) registerSite("<runtime>");
+  }
+  static bool enabled() { return heapAgeTracker; }
+
+  // Name a new allocation site; site 0 is used for anything outside wake functions
+  static uint32_t registerSite(const std::string &name);
+  // Attribute all future allocations to this site
+  static void setSite(uint32_t site) { current_site = site; }
 
-  static void setAge(const HeapObject *obj, uint32_t age) {
+  // A new object was constructed
+  static void born(const HeapObject *obj) {
     if (!heapAgeTracker) return;
-    age_map[obj] = age;
+    uint32_t *t = tag(obj);
+    if (t) *t = current_site << 8;
+    ++site_allocated[current_site];
+  }
+
+  // An object survived a collection by moving from 'from' to 'to'
+  static void moved(const HeapObject *from, const HeapObject *to) {
+    if (!heapAgeTracker) return;
+    uint32_t *f = tag(from), *t = tag(to);
+    if (f && t) *t = (*f & 0xff) == 0xff ? *f : *f + 1;
   }
 
   static uint32_t getAge(const HeapObject *obj) {
     if (!heapAgeTracker) return 0;
-    auto it = age_map.find(obj);
-    if (it == age_map.end()) {
-      return 0;
-    }
-    return it->second;
+    uint32_t *t = tag(obj);
+    return t ? *t & 0xff : 0;
   }
 
-  static void removeAge(const HeapObject *obj) {
-    if (!heapAgeTracker) return;
-    age_map.erase(obj);
+  static uint32_t getSite(const HeapObject *obj) {
+    if (!heapAgeTracker) return 0;
+    uint32_t *t = tag(obj);
+    return t ? *t >> 8 : 0;
   }
 
  private:
   // Don't want any instances of this
   HeapAgeTracker() = delete;
+
+  // Find the tag of an object in the side table of its space
+  static uint32_t *tag(const HeapObject *obj) {
+    uintptr_t x = reinterpret_cast<uintptr_t>(obj);
+    for (auto &r : regions)
+      if (x - r.begin < r.end - r.begin) return r.tags + (x - r.begin) / sizeof(void *);
+    return nullptr;
+  }
+
+  struct Region {
+    uintptr_t begin, end;
+    uint32_t *tags;
+  };
+
   static bool heapAgeTracker;
-  static std::unordered_map<const HeapObject *, uint32_t> age_map;
+  static uint32_t current_site;
+  static Region regions[3];
+  static std::vector<std::string> site_names;
+  static std::vector<uint64_t> site_allocated;
+  friend struct Heap;
+};
+
+// Address ranges used by the generational collector (see --heap-nursery).
+// When generational collection is disabled, the tenured range is empty and
+// every object is collected.
+struct HeapGenerations {
+  // Is this heap slot inside the old generation?
+  static bool tenured(const void *slot) {
+    uintptr_t x = reinterpret_cast<uintptr_t>(slot);
+    return x - old_begin < old_end - old_begin;
+  }
+
+  // Does this object live in the nursery?
+  static bool young(const void *obj) {
+    uintptr_t x = reinterpret_cast<uintptr_t>(obj);
+    return x - young_begin < young_end - young_begin;
+  }
+
+  // Is this object being evacuated by the current collection?
+  static bool collecting(const void *obj) {
+    uintptr_t x = reinterpret_cast<uintptr_t>(obj);
+    return x - collect_begin < collect_end - collect_begin;
+  }
+
+  // Record an old slot which now points into the nursery
+  static void remember(HeapPointerBase *slot) { remembered.push_back(slot); }
+
+  // Record an old object which just stored a HeapPointer in malloc'd memory
+  // (eg: Target::table), where the write barrier cannot see it
+  static void touch(HeapObject *obj) {
+    if (tenured(obj) && (dirty.empty() || dirty.back() != obj)) dirty.push_back(obj);
+  }
+
+ private:
+  // Don't want any instances of this
+  HeapGenerations() = delete;
+  static uintptr_t old_begin, old_end;
+  static uintptr_t young_begin, young_end;
+  static uintptr_t collect_begin, collect_end;
+  static std::vector<HeapPointerBase *> remembered;
+  static std::vector<HeapObject *> dirty;
+  friend struct Heap;
 };
 
 enum Category { VALUE, WORK };
@@ -92,6 +177,9 @@ struct HeapObject {
   virtual Placement moveto(PadObject *free) = 0;
   virtual Placement descend(PadObject *free) = 0;
   virtual HeapStep explore(HeapStep step) = 0;
+  // Used by parallel collections instead of moveto/descend (see Evacuator)
+  virtual HeapObject *copyto(Evacuator &ev) = 0;
+  virtual PadObject *scan(Evacuator &ev) = 0;
   virtual const char *type() const = 0;
   virtual void format(std::ostream &os, FormatState &state) const = 0;
   virtual Category category() const = 0;
@@ -191,14 +279,22 @@ struct RootPointer {
 struct HeapPointerBase {
   HeapPointerBase(HeapObject *obj_) : obj(obj_) {}
   PadObject *moveto(PadObject *free);
+  Evacuator *evacuate(Evacuator *ev);
   HeapStep explore(HeapStep step);
 
  protected:
+  // Call after every store to 'obj' (the write barrier)
+  void barrier();
   HeapObject *obj;
 };
 
+inline void HeapPointerBase::barrier() {
+  if (HeapGenerations::tenured(this) && HeapGenerations::young(obj))
+    HeapGenerations::remember(this);
+}
+
 inline PadObject *HeapPointerBase::moveto(PadObject *free) {
-  if (!obj) return free;
+  if (!obj || !HeapGenerations::collecting(obj)) return free;
   Placement out = obj->moveto(free);
   obj = out.obj;
   return out.free;
@@ -224,18 +320,26 @@ struct HeapPointer : public HeapPointerBase {
   T *operator->() const { return get(); }
   T &operator*() const { return *get(); }
 
+  HeapPointer &operator=(const HeapPointer &x) {
+    obj = x.obj;
+    barrier();
+    return *this;
+  }
   template <typename Y>
   HeapPointer &operator=(HeapPointer<Y> x) {
     obj = static_cast<T *>(x.get());
+    barrier();
     return *this;
   }
   template <typename Y>
   HeapPointer &operator=(const RootPointer<Y> &x) {
     obj = static_cast<T *>(x.get());
+    barrier();
     return *this;
   }
   HeapPointer &operator=(T *x) {
     obj = x;
+    barrier();
     return *this;
   }
 };
@@ -251,6 +355,8 @@ struct PadObject final : public HeapObject {
   Placement moveto(PadObject *free) override;
   Placement descend(PadObject *free) override;
   HeapStep explore(HeapStep step) override;
+  HeapObject *copyto(Evacuator &ev) override;
+  PadObject *scan(Evacuator &ev) override;
   const char *type() const override;
   void format(std::ostream &os, FormatState &state) const override;
   Category category() const override;
@@ -266,18 +372,65 @@ struct alignas(PadObject) MovedObject final : public HeapObject {
   Placement moveto(PadObject *free) override;
   Placement descend(PadObject *free) override;
   HeapStep explore(HeapStep step) override;
+  HeapObject *copyto(Evacuator &ev) override;
+  PadObject *scan(Evacuator &ev) override;
   const char *type() const override;
   void format(std::ostream &os, FormatState &state) const override;
   Category category() const override;
 };
 
+// Per-thread state of a parallel collection.
+// Each thread copies objects into its own local allocation buffer (LAB) of to-space,
+// and threads race to claim an object with an atomic CAS on a side table of claim bits.
+// Copied objects are scanned Cheney-style, except that ranges of unscanned objects
+// are handed to idle threads.
+struct Evacuator {
+  struct Shared;  // defined in gc.cpp
+  typedef std::pair<PadObject *, PadObject *> Range;
+
+  explicit Evacuator(Shared &shared_);
+
+  // Claim space for the copy of an object
+  PadObject *alloc(size_t pads) {
+    if (static_cast<size_t>(lab_end - lab_free) < pads) return refill(pads);
+    PadObject *out = lab_free;
+    lab_free += pads;
+    return out;
+  }
+
+  // Return the to-space copy of 'obj', copying it unless another thread already has
+  HeapObject *forward(HeapObject *obj);
+  // Scan everything reachable from the objects copied so far
+  void run();
+
+ private:
+  PadObject *refill(size_t pads);
+  void retire();
+  void scan(Range range);
+  void share();
+  bool steal();
+
+  Shared &shared;
+  PadObject *lab_scan;  // objects in [lab_scan, lab_free) have been copied, but not scanned
+  PadObject *lab_free;
+  PadObject *lab_end;
+  std::deque<Range> ranges;  // more unscanned objects
+};
+
+inline Evacuator *HeapPointerBase::evacuate(Evacuator *ev) {
+  if (obj && HeapGenerations::collecting(obj)) obj = ev->forward(obj);
+  return ev;
+}
+
 struct GCNeededException {
   size_t needed;
   GCNeededException(size_t needed_) : needed(needed_) {}
 };
 
 struct Heap {
-  Heap(int profile_heap_, double heap_factor_);
+  // A non-zero nursery_bytes_ enables generational collection.
+  // With threads_ > 1, large collections copy the heap in parallel.
+  Heap(int profile_heap_, double heap_factor_, size_t nursery_bytes_ = 0, int threads_ = 1);
   ~Heap();
 
   // Call this from main loop (no pointers on stack) when GCNeededException
@@ -336,6 +489,11 @@ struct Heap {
 
  private:
   struct Imp;
+  void collect(size_t requested_pads, bool minor);
+  void update_generations();
+  void update_tracker();
+  void report_sites() const;
+
   std::unique_ptr<Imp> imp;
   RootRing roots;
   PadObject *free;
@@ -365,6 +523,8 @@ struct alignas(PadObject) GCObject : public B {
   Placement moveto(PadObject *free) final override;
   Placement descend(PadObject *free) final override;
   HeapStep explore(HeapStep step) final override;
+  HeapObject *copyto(Evacuator &ev) final override;
+  PadObject *scan(Evacuator &ev) final override;
   // Can be further specialized
   const char *type() const override;
 
@@ -386,7 +546,7 @@ template <typename T, typename B>
 template <typename... ARGS>
 T *GCObject<T, B>::claim(Heap &h, ARGS &&...args) {
   T *obj = new (h.claim(sizeof(T) / sizeof(PadObject))) T(std::forward<ARGS>(args)...);
-  HeapAgeTracker::setAge(obj, 0);
+  HeapAgeTracker::born(obj);
   return obj;
 }
 
@@ -394,7 +554,7 @@ template <typename T, typename B>
 template <typename... ARGS>
 T *GCObject<T, B>::alloc(Heap &h, ARGS &&...args) {
   T *obj = new (h.alloc(sizeof(T) / sizeof(PadObject))) T(std::forward<ARGS>(args)...);
-  HeapAgeTracker::setAge(obj, 0);
+  HeapAgeTracker::born(obj);
   return obj;
 }
 
@@ -403,13 +563,8 @@ Placement GCObject<T, B>::moveto(PadObject *free) {
   if (alignof(T) > alignof(PadObject))
     while (((uintptr_t)free & (alignof(T) - 1))) free = PadObject::place(free);
   T *from = self();
-
-  uint32_t old_age = HeapAgeTracker::getAge(from);
   T *to = new (free) T(std::move(*from));
-
-  HeapAgeTracker::setAge(to, old_age + 1);
-  HeapAgeTracker::removeAge(from);
-
+  HeapAgeTracker::moved(from, to);
   from->~T();
   new (from) MovedObject(to);
   return Placement(to, to->objend());
@@ -421,6 +576,20 @@ Placement GCObject<T, B>::descend(PadObject *free) {
                    self()->template recurse<PadObject *, &HeapPointerBase::moveto>(free));
 }
 
+template <typename T, typename B>
+HeapObject *GCObject<T, B>::copyto(Evacuator &ev) {
+  // Unlike moveto, leave the vtable of 'from' intact; Heap installs the MovedObject later
+  T *from = self();
+  size_t pads = from->objend() - static_cast<PadObject *>(static_cast<HeapObject *>(from));
+  return new (ev.alloc(pads)) T(std::move(*from));
+}
+
+template <typename T, typename B>
+PadObject *GCObject<T, B>::scan(Evacuator &ev) {
+  self()->template recurse<Evacuator *, &HeapPointerBase::evacuate>(&ev);
+  return self()->objend();
+}
+
 template <typename T, typename B>
 HeapStep GCObject<T, B>::explore(HeapStep step) {
   return self()->template recurse<HeapStep, &HeapPointerBase::explore>(step);
@@ -54,6 +54,7 @@
 #include "compat/spawn.h"
 #include "config.h"
 #include "database.h"
+#include "file_hasher.h"
 #include "prim.h"
 #include "status.h"
 #include "types/data.h"
@@ -81,6 +82,8 @@ void set_job_cache(job_cache::Cache *cache) {
 #define MAX_SELF_FDS 24
 // The default memory to provision for jobs (2MB)
 #define DEFAULT_PHYS_USAGE (2 * 1024 * 1024)
+// How often buffered job output is written to the database
+#define LOG_FLUSH_SECONDS 1.0
 
 // #define DEBUG_PROGRESS
 
@@ -235,9 +238,14 @@ double Job::threads() const {
   return estimate;
 }
 
+// Jobs which are pending or running, keyed by pathtime and holding their expected runtime.
+// Keeping these ordered makes finding the next critical job O(log n) instead of a scan.
+typedef std::multimap<double, double> CriticalPaths;
+
 // A Task is a job that is not yet forked
 struct Task {
   RootPointer<Job> job;
+  CriticalPaths::iterator critical;
   std::string dir;
   std::string stdin_file;
   std::string environ;
@@ -274,6 +282,7 @@ struct JobEntry {
   int pipe_stderr;       // -1 if closed
   std::string echo_line;
   std::list<Status>::iterator status;
+  CriticalPaths::iterator critical;
   std::unique_ptr<std::streambuf> stdout_linebuf;
   std::unique_ptr<std::streambuf> stderr_linebuf;
 
@@ -291,6 +300,27 @@ struct JobEntry {
   double runtime(struct timespec now);
 };
 
+// A CacheRead is a job_cache_read waiting on the job cache daemon's response
+struct CacheRead {
+  std::unique_ptr<job_cache::AsyncRead> read;
+  RootPointer<Continuation> continuation;
+
+  CacheRead(std::unique_ptr<job_cache::AsyncRead> read_, RootPointer<Continuation> &&continuation_)
+      : read(std::move(read_)), continuation(std::move(continuation_)) {}
+};
+
+// A HashFiles is a hash_files call waiting on the files the database had no hash for
+struct HashFiles {
+  std::vector<std::string> files;
+  std::vector<FileStamp> stamps;
+  std::vector<std::string> hashes;  // empty where batch hashes the file
+  std::vector<size_t> missing;      // index in files of each file in batch
+  std::shared_ptr<HashBatch> batch;
+  RootPointer<Continuation> continuation;
+
+  HashFiles(RootPointer<Continuation> &&continuation_) : continuation(std::move(continuation_)) {}
+};
+
 double JobEntry::runtime(struct timespec now) {
   return now.tv_sec - job->start.tv_sec + (now.tv_nsec - job->start.tv_nsec) / 1000000000.0;
 }
@@ -306,7 +336,14 @@ struct JobTable::detail {
   long num_running;
   std::map<pid_t, std::shared_ptr<JobEntry>> pidmap;
   std::map<int, std::shared_ptr<JobEntry>> pipes;
+  std::map<uint64_t, std::unique_ptr<CacheRead>> cache_reads;  // keyed by request id
+  std::vector<std::unique_ptr<CacheRead>> ready_cache_reads;     // done but not yet resumed
+  int cache_fd = -1;  // the job cache's connection, once it has been added to poll
+  std::map<HashBatch *, std::unique_ptr<HashFiles>> hash_files;  // keyed by their batch
+  std::vector<std::unique_ptr<HashFiles>> ready_hash_files;       // done but not yet resumed
+  std::unique_ptr<FileHasher> hasher;  // started by the first hash_files that needs it
   std::vector<std::unique_ptr<Task>> pending;
+  CriticalPaths critical;  // pending + pidmap
   sigset_t block;  // signals that can race with poll.wait()
   Database *db;
   double active, limit;              // CPUs
@@ -318,6 +355,7 @@ struct JobTable::detail {
   bool check;
   bool batch;
   struct timespec wall;
+  struct timespec log_flush;  // when job output was last written to the database
   RUsage childrenUsage;
 
   std::unordered_map<int, std::unique_ptr<std::streambuf>> fd_bufs;
@@ -333,6 +371,14 @@ struct JobTable::detail {
     for (auto &entry : pipes) {
       entry.second.reset();
     }
+    for (auto &entry : cache_reads) {
+      entry.second.reset();
+    }
+    ready_cache_reads.clear();
+    for (auto &entry : hash_files) {
+      entry.second.reset();
+    }
+    ready_hash_files.clear();
     for (auto &entry : fd_bufs) {
       entry.second.release();
     }
@@ -348,17 +394,11 @@ CriticalJob JobTable::detail::critJob(double nexttime) const {
   CriticalJob out;
   out.pathtime = nexttime;
   out.runtime = 0;
-  for (auto &pm : pidmap) {
-    Job *job = pm.second->job.get();
-    if (job->pathtime > out.pathtime) {
-      out.pathtime = job->pathtime;
-      out.runtime = job->record.runtime;
-    }
-  }
-  for (auto &j : pending) {
-    if (j->job->pathtime > out.pathtime) {
-      out.pathtime = j->job->pathtime;
-      out.runtime = j->job->record.runtime;
+  if (!critical.empty()) {
+    auto longest = critical.rbegin();
+    if (longest->first > out.pathtime) {
+      out.pathtime = longest->first;
+      out.runtime = longest->second;
     }
   }
   return out;
@@ -495,6 +535,7 @@ JobTable::JobTable(Database *db, ResourceBudget memory, ResourceBudget cpu, bool
   imp->phys_active = 0;
   imp->phys_limit = memory.get(get_physical_memory());
   memset(&imp->childrenUsage, 0, sizeof(struct RUsage));
+  clock_gettime(CLOCK_REALTIME, &imp->log_flush);
 
   // Double-check that ::parse() did not do something crazy.
   assert(imp->limit > 0);
@@ -826,6 +867,7 @@ static void launch(JobTable *jobtable) {
     }
     std::shared_ptr<JobEntry> entry = std::make_shared<JobEntry>(
         jobtable->imp.get(), std::move(task.job), std::move(out), std::move(err));
+    entry->critical = task.critical;
 
     int stdout_stream[2];
     int stderr_stream[2];
@@ -915,6 +957,66 @@ JobEntry::~JobEntry() {
   }
 }
 
+// job_cache_read returns the response as JSON text for parseJSONBody
+static std::string cache_response_json(const job_cache::FindJobResponse &response) {
+  std::stringstream result_json_stream;
+  result_json_stream << response.to_json();
+  return result_json_stream.str();
+}
+
+// Drains every read the job cache has finished since the last call in one batch,
+// moving each from cache_reads over to ready_cache_reads to be resumed later
+static void take_done_cache_reads(JobTable::detail *imp) {
+  if (!internal_job_cache) return;
+  for (uint64_t id : internal_job_cache->take_done()) {
+    auto it = imp->cache_reads.find(id);
+    // Blocking reads aren't in cache_reads
+    if (it == imp->cache_reads.end()) continue;
+    imp->ready_cache_reads.emplace_back(std::move(it->second));
+    imp->cache_reads.erase(it);
+  }
+}
+
+// Hands a finished job_cache_read its result
+static void resume_cache_read(Runtime &runtime, CacheRead &cache_read) {
+  std::string result_json_str = cache_response_json(cache_read.read->get());
+  runtime.heap.guarantee(String::reserve(result_json_str.size()) + reserve_result());
+  cache_read.continuation->resume(
+      runtime, claim_result(runtime.heap, true, String::claim(runtime.heap, result_json_str)));
+}
+
+// Moves the hash_files calls whose files are all hashed over to ready_hash_files
+static void take_done_hash_files(JobTable::detail *imp) {
+  if (!imp->hasher) return;
+  for (auto &batch : imp->hasher->take_done()) {
+    auto it = imp->hash_files.find(batch.get());
+    assert(it != imp->hash_files.end());
+    imp->ready_hash_files.emplace_back(std::move(it->second));
+    imp->hash_files.erase(it);
+  }
+}
+
+static void resume_hash_files(Runtime &runtime, Database *db, HashFiles &hash_files) {
+  HashBatch &batch = *hash_files.batch;
+  for (size_t i = 0; i < hash_files.missing.size(); ++i) {
+    size_t index = hash_files.missing[i];
+    if (!batch.errors[i].empty()) {
+      status_get_generic_stream(STREAM_ERROR) << "hash_files: " << batch.errors[i] << std::endl;
+    }
+    db->add_hash(hash_files.files[index], batch.hashes[i], hash_files.stamps[index]);
+    hash_files.hashes[index] = std::move(batch.hashes[i]);
+  }
+
+  size_t need = reserve_list(hash_files.hashes.size());
+  for (auto &hash : hash_files.hashes) need += String::reserve(hash.size());
+  runtime.heap.guarantee(need);
+
+  std::vector<Value *> vals;
+  vals.reserve(hash_files.hashes.size());
+  for (auto &hash : hash_files.hashes) vals.push_back(String::claim(runtime.heap, hash));
+  hash_files.continuation->resume(runtime, claim_list(runtime.heap, vals.size(), vals.data()));
+}
+
 bool JobTable::wait(Runtime &runtime) {
   char buffer[4096];
   struct timespec nowait;
@@ -922,8 +1024,30 @@ bool JobTable::wait(Runtime &runtime) {
 
   launch(this);
 
+  // job_cache_read only queues its request so that all the reads made
+  // while the interpreter ran reach the daemon together as a batch.
+  if (!imp->cache_reads.empty()) internal_job_cache->flush();
+
+  // Reads are resumed here rather than in job_cache_read because
+  // the heap must not be collected while a primitive runs. Other reads
+  // may have been answered while a primitive talked to the daemon too.
+  take_done_cache_reads(imp.get());
+  take_done_hash_files(imp.get());
+  if (!imp->ready_cache_reads.empty() || !imp->ready_hash_files.empty()) {
+    for (auto &cache_read : imp->ready_cache_reads) {
+      resume_cache_read(runtime, *cache_read);
+    }
+    imp->ready_cache_reads.clear();
+    for (auto &hash_files : imp->ready_hash_files) {
+      resume_hash_files(runtime, imp->db, *hash_files);
+    }
+    imp->ready_hash_files.clear();
+    return true;
+  }
+
   bool compute = false;
-  while (!exit_now() && imp->num_running) {
+  while (!exit_now() &&
+         (imp->num_running || !imp->cache_reads.empty() || !imp->hash_files.empty())) {
     // Block all signals we expect to interrupt pselect
     sigset_t saved;
     sigprocmask(SIG_BLOCK, &imp->block, &saved);
@@ -934,6 +1058,14 @@ bool JobTable::wait(Runtime &runtime) {
     if (child_ready) timeout = &nowait;
     if (exit_now()) timeout = &nowait;
 
+    // Wake up at least once a second so cache reads can time out
+    struct timespec cache_timeout;
+    if (!timeout && !imp->cache_reads.empty()) {
+      cache_timeout.tv_sec = 1;
+      cache_timeout.tv_nsec = 0;
+      timeout = &cache_timeout;
+    }
+
 #if !defined(__linux__)
     struct timespec alarm;
     // In case SIGALRM with SA_RESTART doesn't stop pselect
@@ -962,6 +1094,11 @@ bool JobTable::wait(Runtime &runtime) {
     int done = 0;
 
     for (auto fd : ready_fds) {
+      // Responses are handled below, along with reads that timed out
+      if (fd == imp->cache_fd) continue;
+      // As are hashed files
+      if (imp->hasher && fd == imp->hasher->fd()) continue;
+
       auto it = imp->pipes.find(fd);
       assert(it != imp->pipes.end());  // ready_fds <= poll_fds == pipes.keys()
       std::shared_ptr<JobEntry> entry = it->second;
@@ -1007,6 +1144,35 @@ bool JobTable::wait(Runtime &runtime) {
       }
     }
 
+    // All reads share one connection. Stepping it when nothing was sent
+    // is cheap and gives reads that timed out a chance to be retried.
+    if (!imp->cache_reads.empty()) {
+      internal_job_cache->step();
+      take_done_cache_reads(imp.get());
+      for (auto &cache_read : imp->ready_cache_reads) {
+        resume_cache_read(runtime, *cache_read);
+        ++done;
+      }
+      imp->ready_cache_reads.clear();
+    }
+
+    if (!imp->hash_files.empty()) {
+      take_done_hash_files(imp.get());
+      for (auto &hash_files : imp->ready_hash_files) {
+        resume_hash_files(runtime, imp->db, *hash_files);
+        ++done;
+      }
+      imp->ready_hash_files.clear();
+    }
+
+    // Job output is buffered by the database; write it out periodically for wake --last
+    double dflush = (now.tv_sec - imp->log_flush.tv_sec) +
+                    (now.tv_nsec - imp->log_flush.tv_nsec) / 1000000000.0;
+    if (dflush >= LOG_FLUSH_SECONDS) {
+      imp->db->flush_output();
+      imp->log_flush = now;
+    }
+
     int status;
     pid_t pid;
     child_ready = false;
@@ -1032,6 +1198,7 @@ bool JobTable::wait(Runtime &runtime) {
       std::shared_ptr<JobEntry> entry = it->second;
       imp->pidmap.erase(it);
       assert(entry);
+      imp->critical.erase(entry->critical);
 
       entry->pid = 0;
       entry->status->merged = true;
@@ -1214,6 +1381,8 @@ static PRIMFN(prim_job_launch) {
   auto &heap = jobtable->imp->pending;
   heap.emplace_back(new Task(runtime.heap.root(job), dir->as_str(), stdin_file->as_str(),
                              env->as_str(), cmd->as_str(), mpz_cmp_si(is_atty, 0) != 0));
+  heap.back()->critical =
+      jobtable->imp->critical.emplace(job->pathtime, job->record.runtime);
   std::push_heap(heap.begin(), heap.end());
 
   // If a scheduled job claims a longer critical path, we need to adjust the total path time
@@ -1606,7 +1775,9 @@ static PRIMFN(prim_add_hash) {
   EXPECT(2);
   STRING(file, 0);
   STRING(hash, 1);
-  jobtable->imp->db->add_hash(file->as_str(), hash->as_str(), getmtime_ns(file->c_str()));
+  FileStamp stamp;
+  (void)getstamp(file->c_str(), &stamp);
+  jobtable->imp->db->add_hash(file->as_str(), hash->as_str(), stamp);
   RETURN(args[0]);
 }
 
@@ -1618,10 +1789,93 @@ static PRIMFN(prim_get_hash) {
   JobTable *jobtable = static_cast<JobTable *>(data);
   EXPECT(1);
   STRING(file, 0);
-  std::string hash = jobtable->imp->db->get_hash(file->as_str(), getmtime_ns(file->c_str()));
+  FileStamp stamp;
+  (void)getstamp(file->c_str(), &stamp);
+  std::string hash = jobtable->imp->db->get_hash(file->as_str(), stamp);
   RETURN(String::alloc(runtime.heap, hash));
 }
 
+static PRIMTYPE(type_hash_files) {
+  TypeVar list;
+  Data::typeList.clone(list);
+  list[0].unify(Data::typeString);
+  return args.size() == 1 && args[0]->unify(Data::typeString) && out->unify(list);
+}
+
+// Takes imploded files and returns their hashes in the same order, recording
+// them like add_hash. A file whose stamp has not changed since it was last
+// hashed is not read again. The others are hashed by wake's own threads and
+// the list is returned once they all are, without waiting for a job slot.
+static PRIMFN(prim_hash_files) {
+  JobTable *jobtable = static_cast<JobTable *>(data);
+  JobTable::detail *imp = jobtable->imp.get();
+  EXPECT(1);
+  STRING(imploded, 0);
+
+  std::vector<std::string> files;
+  const char *end = imploded->c_str() + imploded->size();
+  for (const char *tok = imploded->c_str(); tok < end;) {
+    const char *nul = static_cast<const char *>(memchr(tok, 0, end - tok));
+    if (!nul) nul = end;
+    files.emplace_back(tok, nul - tok);
+    tok = nul + 1;
+  }
+
+  // Reserve for the list of 64-digit hashes up front, so that collecting
+  // garbage does not repeat the lookups below
+  size_t bound = reserve_list(files.size()) + files.size() * String::reserve(64);
+  runtime.heap.reserve(std::max(bound, Tuple::fulfiller_pads));
+
+  std::vector<FileStamp> stamps(files.size());
+  std::vector<std::string> hashes(files.size());
+  std::vector<size_t> missing;
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (getstamp(files[i].c_str(), &stamps[i]) == 0) {
+      hashes[i] = imp->db->get_hash(files[i], stamps[i]);
+    }
+    if (hashes[i].empty()) missing.push_back(i);
+  }
+
+  if (missing.empty()) {
+    // Only a hash recorded by add_hash in some other form can exceed the bound
+    size_t need = reserve_list(hashes.size());
+    for (auto &hash : hashes) need += String::reserve(hash.size());
+    runtime.heap.reserve(need);
+  }
+
+  status_get_generic_stream(STREAM_LOG) << "hash_files: reused " << files.size() - missing.size()
+                                        << " of " << files.size() << " hashes" << std::endl;
+
+  if (missing.empty()) {
+    std::vector<Value *> vals;
+    vals.reserve(hashes.size());
+    for (auto &hash : hashes) vals.push_back(String::claim(runtime.heap, hash));
+    RETURN(claim_list(runtime.heap, vals.size(), vals.data()));
+  }
+
+  // Reserved above; nothing may be reserved after the files are submitted
+  // or they would be submitted again
+  Continuation *continuation = scope->claim_fulfiller(runtime, output);
+  auto hash_files = std::make_unique<HashFiles>(runtime.heap.root(continuation));
+
+  std::vector<std::string> to_hash;
+  to_hash.reserve(missing.size());
+  for (size_t i : missing) to_hash.push_back(files[i]);
+  hash_files->files = std::move(files);
+  hash_files->stamps = std::move(stamps);
+  hash_files->hashes = std::move(hashes);
+  hash_files->missing = std::move(missing);
+  hash_files->batch = std::make_shared<HashBatch>(std::move(to_hash));
+
+  if (!imp->hasher) {
+    imp->hasher = std::make_unique<FileHasher>(get_concurrency());
+    imp->poll.add(imp->hasher->fd());
+  }
+  imp->hasher->submit(hash_files->batch);
+  HashBatch *key = hash_files->batch.get();
+  imp->hash_files.emplace(key, std::move(hash_files));
+}
+
 static PRIMTYPE(type_get_modtime) {
   return args.size() == 1 && args[0]->unify(Data::typeString) && out->unify(Data::typeInteger);
 }
@@ -1763,6 +2017,7 @@ static PRIMTYPE(type_job_cache_read) {
 }
 
 static PRIMFN(prim_job_cache_read) {
+  JobTable *jobtable = static_cast<JobTable *>(data);
   wcl::log::info("prim_job_cache_read enter")();
   auto defer = wcl::make_defer([]() { wcl::log::info("prim_job_cache_read exit")(); });
   EXPECT(1);
@@ -1790,23 +2045,33 @@ static PRIMFN(prim_job_cache_read) {
     RETURN(claim_result(runtime.heap, false, String::claim(runtime.heap, s)));
   }
 
+  // The result is delivered by JobTable::wait once the daemon responds so
+  // that the interpreter can keep running while the daemon works. Nothing
+  // may be reserved after the request is queued or it would be queued again.
+  runtime.heap.reserve(Tuple::fulfiller_pads);
+  Continuation *continuation = scope->claim_fulfiller(runtime, output);
+  RootPointer<Continuation> root = runtime.heap.root(continuation);
+
   // Now we actully perform the request
   // TODO: It's probably not great that wake hard-fails if this json isn't
   // valid. I should fix that.
   job_cache::FindJobRequest request(jast);
-  job_cache::FindJobResponse response = internal_job_cache->read(request);
+  auto cache_read = std::make_unique<CacheRead>(
+      internal_job_cache->read_async(std::move(request)), std::move(root));
 
-  // Because I'm very lazy however we also return a string and not a JValue.
-  // This is because the `measure_jast` function is defined in json.cpp and I
-  // don't want to lift it or duplicate it right now.
-  // TODO: lift the measure_jast function
-  std::stringstream result_json_stream;
-  result_json_stream << response.to_json();
-  std::string result_json_str = result_json_stream.str();
-  size_t need = String::reserve(result_json_str.size()) + reserve_result();
-  runtime.heap.reserve(need);
+  if (cache_read->read->done()) {
+    jobtable->imp->ready_cache_reads.emplace_back(std::move(cache_read));
+    return;
+  }
 
-  RETURN(claim_result(runtime.heap, true, String::claim(runtime.heap, result_json_str)));
+  // The job cache's fd stays the same even if it reconnects so it only
+  // needs to be added once.
+  if (jobtable->imp->cache_fd == -1) {
+    jobtable->imp->cache_fd = internal_job_cache->fd();
+    jobtable->imp->poll.add(jobtable->imp->cache_fd);
+  }
+  uint64_t id = cache_read->read->id();
+  jobtable->imp->cache_reads.emplace(id, std::move(cache_read));
 }
 
 static PRIMTYPE(type_job_cache_add) {
@@ -1931,8 +2196,9 @@ void prim_register_job(JobTable *jobtable, PrimMap &pmap) {
   // Adds a job to the job cache
   prim_register(pmap, "job_cache_add", prim_job_cache_add, type_job_cache_add, PRIM_IMPURE);
 
-  // Adds a job to the job cache
-  prim_register(pmap, "job_cache_read", prim_job_cache_read, type_job_cache_read, PRIM_IMPURE);
+  // Looks up a job in the job cache. The result is delivered once the daemon responds.
+  prim_register(pmap, "job_cache_read", prim_job_cache_read, type_job_cache_read, PRIM_IMPURE,
+                jobtable);
 
   /*****************************************************************************************
    * Dead-code elimination ok, but not CSE/const-prop ok (must be ordered wrt. filesystem) *
@@ -1941,6 +2207,7 @@ void prim_register_job(JobTable *jobtable, PrimMap &pmap) {
   // Get's the hash of a file if it was previouslly hashed in the database by a cached
   // job this session. Returns the empty string otherwise.
   prim_register(pmap, "get_hash", prim_get_hash, type_get_hash, PRIM_ORDERED, jobtable);
+  prim_register(pmap, "hash_files", prim_hash_files, type_hash_files, PRIM_IMPURE, jobtable);
 
   // Get's the modtime of a file, super simple
   prim_register(pmap, "get_modtime", prim_get_modtime, type_get_modtime, PRIM_ORDERED);
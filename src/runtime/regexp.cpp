@@ -22,6 +22,7 @@
 #include <re2/re2.h>
 
 #include <string>
+#include <vector>
 
 #include "prim.h"
 #include "types/data.h"
@@ -126,6 +127,80 @@ static PRIMFN(prim_match) {
   RETURN(claim_bool(runtime.heap, out));
 }
 
+static PRIMTYPE(type_lmatch) {
+  TypeVar list;
+  Data::typeList.clone(list);
+  list[0].unify(Data::typeString);
+  return args.size() == 2 && args[0]->unify(Data::typeRegExp) && args[1]->unify(list) &&
+         out->unify(list);
+}
+
+struct CMatch final : public GCObject<CMatch, Continuation> {
+  HeapPointer<RegExp> exp;
+  HeapPointer<Record> list;
+  HeapPointer<Record> progress;
+  HeapPointer<Scope> scope;
+  size_t output;
+
+  CMatch(RegExp *exp_, Record *list_, Scope *scope_, size_t output_)
+      : exp(exp_), list(list_), progress(list_), scope(scope_), output(output_) {}
+
+  template <typename T, T (HeapPointerBase::*memberfn)(T x)>
+  T recurse(T arg) {
+    arg = Continuation::recurse<T, memberfn>(arg);
+    arg = (exp.*memberfn)(arg);
+    arg = (list.*memberfn)(arg);
+    arg = (progress.*memberfn)(arg);
+    arg = (scope.*memberfn)(arg);
+    return arg;
+  }
+
+  void execute(Runtime &runtime) override;
+};
+
+void CMatch::execute(Runtime &runtime) {
+  while (progress->size() == 2 && *progress->at(0) && *progress->at(1))
+    progress = progress->at(1)->coerce<Record>();
+
+  if (progress->size() == 2) {
+    next = nullptr;  // reschedule
+    if (*progress->at(0)) {
+      progress->at(1)->await(runtime, this);
+    } else {
+      progress->at(0)->await(runtime, this);
+    }
+    return;
+  }
+
+  std::vector<Value *> strs;
+  for (Record *scan = list.get(); scan->size() == 2; scan = scan->at(1)->coerce<Record>())
+    strs.push_back(scan->at(0)->coerce<String>());
+
+  // Reserve for the longest result first so matching is never repeated
+  runtime.heap.reserve(reserve_list(strs.size()));
+
+  // RE2 matching is thread-safe, and nothing moves the heap until we claim below
+  std::vector<char> match(strs.size());
+  RE2 *re = exp->exp.get();
+  runtime.parallel(strs.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i != end; ++i)
+      match[i] = RE2::FullMatch(sp(static_cast<String *>(strs[i])), *re);
+  });
+
+  size_t found = 0;
+  for (size_t i = 0; i < strs.size(); ++i)
+    if (match[i]) strs[found++] = strs[i];
+
+  scope->at(output)->fulfill(runtime, claim_list(runtime.heap, found, strs.data()));
+}
+
+static PRIMFN(prim_lmatch) {
+  EXPECT(2);
+  REGEXP(arg0, 0);
+  RECORD(arg1, 1);
+  runtime.schedule(CMatch::alloc(runtime.heap, arg0, arg1, scope, output));
+}
+
 static PRIMTYPE(type_extract) {
   TypeVar list;
   Data::typeList.clone(list);
@@ -263,6 +338,7 @@ void prim_register_regexp(PrimMap &pmap) {
   prim_register(pmap, "re2str", prim_re2str, type_re2str, PRIM_PURE);
   prim_register(pmap, "quote", prim_quote, type_quote, PRIM_PURE);
   prim_register(pmap, "match", prim_match, type_match, PRIM_PURE);
+  prim_register(pmap, "lmatch", prim_lmatch, type_lmatch, PRIM_PURE);
   prim_register(pmap, "extract", prim_extract, type_extract, PRIM_PURE);
   prim_register(pmap, "replace", prim_replace, type_replace, PRIM_PURE);
   prim_register(pmap, "tokenize", prim_tokenize, type_tokenize, PRIM_PURE);
@@ -25,6 +25,14 @@
 #include <signal.h>
 #include <sys/time.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "job.h"
 #include "optimizer/ssa.h"
 #include "profile.h"
@@ -47,13 +55,129 @@ void Work::format(std::ostream &os, FormatState &state) const { os << "Work"; }
 
 Category Work::category() const { return WORK; }
 
-Runtime::Runtime(Profile *profile_, int profile_heap, double heap_factor)
+// The chunks owned by one thread of a Runtime::parallel call.
+// The owner takes chunks from the front; idle threads steal them from the back.
+struct ChunkDeque {
+  std::mutex mutex;
+  size_t front, back;
+
+  bool take(size_t &chunk, bool owner) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (front == back) return false;
+    chunk = owner ? front++ : --back;
+    return true;
+  }
+};
+
+struct Runtime::Pool {
+  int threads;
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  std::unique_ptr<ChunkDeque[]> deques;
+  const std::function<void(size_t, size_t)> *fn;  // the current call
+  size_t items;
+  size_t grain;
+  size_t epoch;
+  int running;
+  bool quit;
+
+  Pool(int threads_)
+      : threads(threads_),
+        deques(new ChunkDeque[threads_]),
+        fn(nullptr),
+        items(0),
+        grain(1),
+        epoch(0),
+        running(0),
+        quit(false) {}
+  ~Pool();
+
+  void run(size_t items_, size_t grain_, const std::function<void(size_t, size_t)> &fn_);
+  void work(int self);
+  void worker(int self);
+};
+
+Runtime::Pool::~Pool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = true;
+  }
+  wake.notify_all();
+  for (auto &t : workers) t.join();
+}
+
+void Runtime::Pool::run(size_t items_, size_t grain_,
+                        const std::function<void(size_t, size_t)> &fn_) {
+  if (workers.empty()) {
+    // Signal handlers must keep running on the main thread
+    sigset_t block, saved;
+    sigfillset(&block);
+    pthread_sigmask(SIG_BLOCK, &block, &saved);
+    for (int i = 1; i < threads; ++i) workers.emplace_back(&Pool::worker, this, i);
+    pthread_sigmask(SIG_SETMASK, &saved, nullptr);
+  }
+
+  // Deal out contiguous runs of chunks, so each thread starts on its own part of the input
+  size_t chunks = (items_ + grain_ - 1) / grain_;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < threads; ++i) {
+      deques[i].front = chunks * i / threads;
+      deques[i].back = chunks * (i + 1) / threads;
+    }
+    fn = &fn_;
+    items = items_;
+    grain = grain_;
+    running = threads - 1;
+    ++epoch;
+  }
+  wake.notify_all();
+
+  work(0);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  done.wait(lock, [this] { return running == 0; });
+  fn = nullptr;
+}
+
+// Run chunks until every deque is empty; no chunks are added during a call
+void Runtime::Pool::work(int self) {
+  size_t chunk;
+  for (;;) {
+    bool found = deques[self].take(chunk, true);
+    for (int i = 1; !found && i < threads; ++i)
+      found = deques[(self + i) % threads].take(chunk, false);
+    if (!found) return;
+    size_t begin = chunk * grain;
+    (*fn)(begin, std::min(begin + grain, items));
+  }
+}
+
+void Runtime::Pool::worker(int self) {
+  size_t seen = 0;
+  std::unique_lock<std::mutex> lock(mutex);
+  for (;;) {
+    wake.wait(lock, [&] { return quit || epoch != seen; });
+    if (quit) return;
+    seen = epoch;
+    lock.unlock();
+    work(self);
+    lock.lock();
+    if (--running == 0) done.notify_one();
+  }
+}
+
+Runtime::Runtime(Profile *profile_, int profile_heap, double heap_factor, size_t heap_nursery,
+                 int heap_threads, int eval_threads)
     : abort(false),
       profile(profile_),
-      heap(profile_heap, heap_factor),
+      heap(profile_heap, heap_factor, heap_nursery, heap_threads),
       stack(heap.root<Work>(nullptr)),
       output(heap.root<HeapObject>(nullptr)),
-      sources(heap.root<HeapObject>(nullptr)) {
+      sources(heap.root<HeapObject>(nullptr)),
+      pool(eval_threads > 1 ? new Pool(eval_threads) : nullptr) {
   if (profile) {
     struct sigaction sa;
     memset(&sa, 0, sizeof(sa));
@@ -77,6 +201,16 @@ Runtime::~Runtime() {
   setitimer(ITIMER_PROF, &timer, 0);
 }
 
+void Runtime::parallel(size_t items, const std::function<void(size_t, size_t)> &fn,
+                       size_t grain) {
+  // Small inputs are not worth waking up the other threads
+  if (pool && items > grain) {
+    pool->run(items, grain, fn);
+  } else if (items) {
+    fn(0, items);
+  }
+}
+
 struct Interpret final : public GCObject<Interpret, Work> {
   RFun *fun;
   size_t index;
@@ -113,7 +247,21 @@ struct InterpretContext {
   void finish(Promise *p);
 };
 
+// The allocation site reported by --profile-heap for objects made by this function
+static uint32_t heap_site(RFun *fun) {
+  static std::unordered_map<RFun *, uint32_t> sites;
+  auto it = sites.find(fun);
+  if (it != sites.end()) return it->second;
+  std::stringstream ss;
+  ss << fun->label << ": " << fun->fragment.location();
+  uint32_t site = HeapAgeTracker::registerSite(ss.str());
+  sites[fun] = site;
+  return site;
+}
+
 void Interpret::execute(Runtime &runtime) {
+  if (HeapAgeTracker::enabled()) HeapAgeTracker::setSite(heap_site(fun));
+
   InterpretContext context(runtime);
   context.interpret = this;
   context.scope = scope.get();
@@ -440,6 +588,7 @@ void Runtime::run() {
     }
     Work *w = stack.get();
     stack = w->next;
+    HeapAgeTracker::setSite(0);
     try {
       w->execute(*this);
       if (lprofile && trace_needed) {
@@ -18,8 +18,13 @@
 #ifndef RUNTIME_H
 #define RUNTIME_H
 
+#include <functional>
+
 #include "gc.h"
 
+// Runtime::parallel hands out work in chunks of this many items by default
+#define PARALLEL_GRAIN 1024
+
 struct RFun;
 struct Closure;
 struct Runtime;
@@ -51,10 +56,17 @@ struct Runtime {
   RootPointer<HeapObject> output;
   RootPointer<Record> sources;  // Vector String
 
-  Runtime(Profile *profile_, int profile_heap, double heap_factor);
+  Runtime(Profile *profile_, int profile_heap, double heap_factor, size_t heap_nursery = 0,
+          int heap_threads = 1, int eval_threads = 1);
   ~Runtime();
   void run();
 
+  // Call fn on chunks [begin, end) covering [0, items), using up to eval_threads threads.
+  // fn may read the heap, but must not allocate, fulfill Promises, schedule Work or throw.
+  // Threads share out chunks of grain items; use a small grain when each item is expensive.
+  void parallel(size_t items, const std::function<void(size_t begin, size_t end)> &fn,
+                size_t grain = PARALLEL_GRAIN);
+
   void schedule(Work *work) {
 #ifdef DEBUG_GC
     assert(!work->next);
@@ -68,6 +80,10 @@ struct Runtime {
   // Caller must guarantee clo->applied==0 and clo->fun.args()==1
   static size_t reserve_apply(RFun *fun);
   void claim_apply(Closure *clo, HeapObject *value, Continuation *cont, Scope *caller);
+
+ private:
+  struct Pool;
+  std::unique_ptr<Pool> pool;
 };
 
 struct Continuation : public Work {
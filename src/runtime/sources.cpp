@@ -334,12 +334,19 @@ static PRIMFN(prim_sources) {
     high = std::lower_bound(low, high, prefixH, promise_lexical);
   }
 
+  // RE2 matching is thread-safe, and nothing moves the heap until we reserve below
+  std::vector<char> match(high - low);
+  runtime.parallel(match.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i != end; ++i) {
+      String *s = low[i].coerce<String>();
+      re2::StringPiece piece(s->c_str() + skip, s->size() - skip);
+      match[i] = RE2::FullMatch(piece, *arg1->exp);
+    }
+  });
+
   std::vector<Value *> found;
-  for (Promise *i = low; i != high; ++i) {
-    String *s = i->coerce<String>();
-    re2::StringPiece piece(s->c_str() + skip, s->size() - skip);
-    if (RE2::FullMatch(piece, *arg1->exp)) found.push_back(s);
-  }
+  for (size_t i = 0; i < match.size(); ++i)
+    if (match[i]) found.push_back(low[i].coerce<String>());
 
   runtime.heap.reserve(reserve_list(found.size()));
   RETURN(claim_list(runtime.heap, found.size(), found.data()));
@@ -163,6 +163,7 @@ struct CTargetFill final : public GCObject<CTargetFill, Continuation> {
 
 void CTargetFill::execute(Runtime &runtime) {
   target->table[hash].promise.fulfill(runtime, value.get());
+  HeapGenerations::touch(target.get());
 }
 
 struct CTargetArgs final : public GCObject<CTargetArgs, Continuation> {
@@ -213,6 +214,7 @@ void CTargetArgs::execute(Runtime &runtime) {
 
   auto ref = target->table.insert(std::make_pair(hash, TargetValue(subhash, subhashesp)));
   ref.first->second.promise.await(runtime, cont.get());
+  HeapGenerations::touch(target.get());
 
   if (!(ref.first->second.subhash == subhash)) {
     std::stringstream ss;
@@ -158,7 +158,7 @@ Record *Record::claim(Heap &h, Constructor *cons, size_t size) {
   bool big = size > 4;
   if (big) {
     Record *out = new (h.claim(reserve(size))) BigRecord(cons, size);
-    HeapAgeTracker::setAge(out, 0);
+    HeapAgeTracker::born(out);
     return out;
   } else {
     PadObject *dest = h.claim(reserve(size));
@@ -385,7 +385,7 @@ Scope *Scope::claim(Heap &h, size_t size, Scope *next, Scope *parent, RFun *fun)
   bool big = size > 4;
   if (big) {
     Scope *out = new (h.claim(reserve(size))) BigScope(size, next, parent, fun);
-    HeapAgeTracker::setAge(out, 0);
+    HeapAgeTracker::born(out);
     return out;
   } else {
     PadObject *dest = h.claim(reserve(size));
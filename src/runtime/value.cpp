@@ -76,38 +76,38 @@ String::String(const char *str, size_t length) : length(length) { memcpy(data(),
 
 String *String::claim(Heap &h, size_t length) {
   String *out = new (h.claim(reserve(length))) String(length);
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   return out;
 }
 
 String *String::claim(Heap &h, const std::string &str) {
   String *out = new (h.claim(reserve(str.size()))) String(str.c_str(), str.size());
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   return out;
 }
 
 String *String::claim(Heap &h, const char *str, size_t length) {
   String *out = new (h.claim(reserve(length))) String(str, length);
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   out->c_str()[length] = 0;
   return out;
 }
 
 String *String::alloc(Heap &h, size_t length) {
   String *out = new (h.alloc(reserve(length))) String(length);
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   return out;
 }
 
 String *String::alloc(Heap &h, const std::string &str) {
   String *out = new (h.alloc(reserve(str.size()))) String(str.c_str(), str.size());
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   return out;
 }
 
 String *String::alloc(Heap &h, const char *str, size_t length) {
   String *out = new (h.alloc(reserve(length))) String(str, length);
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   out->c_str()[length] = 0;
   return out;
 }
@@ -203,14 +203,14 @@ Integer::Integer(const Integer &i) : length(i.length) {
 
 Integer *Integer::claim(Heap &h, const MPZ &mpz) {
   Integer *out = new (h.claim(reserve(mpz))) Integer(mpz.value[0]._mp_size);
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   memcpy(out->data(), mpz.value[0]._mp_d, sizeof(mp_limb_t) * abs(out->length));
   return out;
 }
 
 Integer *Integer::alloc(Heap &h, const MPZ &mpz) {
   Integer *out = new (h.alloc(reserve(mpz))) Integer(mpz.value[0]._mp_size);
-  HeapAgeTracker::setAge(out, 0);
+  HeapAgeTracker::born(out);
   memcpy(out->data(), mpz.value[0]._mp_d, sizeof(mp_limb_t) * abs(out->length));
   return out;
 }
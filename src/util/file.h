@@ -39,6 +39,8 @@ class FileContent {
 
   void clearNewLines();
   void addNewline(const uint8_t *first_column);
+  // Byte offsets of the line starts found by the lexer
+  const std::vector<size_t> &newlineOffsets() const { return newlines; }
 
   StringSegment segment() const { return ss; }
   const char *filename() const { return fname.c_str(); }
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Open Group Base Specifications Issue 7
+#define _XOPEN_SOURCE 700
+#define _POSIX_C_SOURCE 200809L
+
+#include "job_handoff.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace job_handoff {
+
+// Starts with a NUL so it can't be mistaken for JSON
+static const char magic[8] = {'\0', 'w', 'a', 'k', 'e', 'f', 'r', 'm'};
+static const uint32_t version = 1;
+
+// Payloads up to this size are cheaper to send through FUSE than to put in
+// a file of their own
+static const size_t inline_limit = 64 * 1024;
+
+enum class Storage : uint32_t { Inline = 0, SharedMemory = 1 };
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t kind;
+  uint32_t storage;
+  uint32_t reserved;
+  uint64_t size;
+};
+
+static std::string frame(Kind kind, Storage storage, const std::string &data) {
+  Header header;
+  memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.kind = static_cast<uint32_t>(kind);
+  header.storage = static_cast<uint32_t>(storage);
+  header.reserved = 0;
+  header.size = data.size();
+
+  std::string out(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.append(data);
+  return out;
+}
+
+static bool write_shm(const std::string &payload, const std::string &dir, std::string &shm) {
+  std::string path = dir + "/wake-handoff.XXXXXX";
+  std::vector<char> name(path.begin(), path.end());
+  name.push_back('\0');
+  int fd = mkstemp(name.data());
+  if (fd == -1) return false;
+
+  const char *data = payload.data();
+  size_t left = payload.size();
+  while (left != 0) {
+    ssize_t got = write(fd, data, left);
+    if (got == -1 && errno == EINTR) continue;
+    if (got <= 0) {
+      (void)close(fd);
+      (void)unlink(name.data());
+      return false;
+    }
+    data += got;
+    left -= got;
+  }
+
+  if (close(fd) != 0) {
+    (void)unlink(name.data());
+    return false;
+  }
+  shm = name.data();
+  return true;
+}
+
+static bool read_shm(const std::string &name, std::string &payload, std::string &error) {
+  int fd = open(name.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+  if (fd == -1) {
+    error = "open " + name + ": " + strerror(errno);
+    return false;
+  }
+  (void)unlink(name.c_str());
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    error = "fstat " + name + ": " + strerror(errno);
+    (void)close(fd);
+    return false;
+  }
+
+  if (st.st_size == 0) {
+    payload.clear();
+  } else {
+    void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      error = "mmap " + name + ": " + strerror(errno);
+      (void)close(fd);
+      return false;
+    }
+    payload.assign(static_cast<const char *>(map), st.st_size);
+    (void)munmap(map, st.st_size);
+  }
+
+  (void)close(fd);
+  return true;
+}
+
+bool is_frame(const std::string &data) {
+  return data.size() >= sizeof(magic) && memcmp(data.data(), magic, sizeof(magic)) == 0;
+}
+
+std::string pack(Kind kind, const std::string &payload, std::string &shm) {
+  return pack(kind, payload, shm, "/dev/shm");
+}
+
+std::string pack(Kind kind, const std::string &payload, std::string &shm,
+                 const std::string &shm_dir) {
+  shm.clear();
+  if (payload.size() > inline_limit && write_shm(payload, shm_dir, shm)) {
+    return frame(kind, Storage::SharedMemory, shm);
+  }
+  // Without shared memory the payload still gets through, only slower
+  return frame(kind, Storage::Inline, payload);
+}
+
+bool unpack(const std::string &data, Kind kind, std::string &payload, std::string &error) {
+  Header header;
+  if (!is_frame(data) || data.size() < sizeof(header)) {
+    error = "not a handoff frame";
+    return false;
+  }
+  memcpy(&header, data.data(), sizeof(header));
+
+  if (header.version != version) {
+    error = "handoff version " + std::to_string(header.version) + " is not " +
+            std::to_string(version) + "; are wakebox and fuse-waked from different releases?";
+    return false;
+  }
+  if (header.kind != static_cast<uint32_t>(kind)) {
+    error = "unexpected handoff kind " + std::to_string(header.kind);
+    return false;
+  }
+  if (header.size != data.size() - sizeof(header)) {
+    error = "truncated handoff frame";
+    return false;
+  }
+
+  std::string body = data.substr(sizeof(header));
+  switch (static_cast<Storage>(header.storage)) {
+    case Storage::Inline:
+      payload = std::move(body);
+      return true;
+    case Storage::SharedMemory:
+      // Only ever a file we could have made ourselves
+      if (body.compare(0, 9, "/dev/shm/") != 0 || body.find("/..") != std::string::npos) {
+        error = "bad handoff file " + body;
+        return false;
+      }
+      return read_shm(body, payload, error);
+  }
+
+  error = "unknown handoff storage " + std::to_string(header.storage);
+  return false;
+}
+
+static void put_u64(std::string &out, uint64_t x) {
+  out.append(reinterpret_cast<const char *>(&x), sizeof(x));
+}
+
+static bool get_u64(const std::string &in, size_t &pos, uint64_t &x) {
+  if (in.size() - pos < sizeof(x)) return false;
+  memcpy(&x, in.data() + pos, sizeof(x));
+  pos += sizeof(x);
+  return true;
+}
+
+// [u64 ibytes] [u64 obytes] [u64 #inputs] [u64 #outputs] then each path as [u64 size] [bytes]
+std::string encode_result(const Result &result) {
+  size_t size = 4 * sizeof(uint64_t);
+  for (auto &x : result.inputs) size += sizeof(uint64_t) + x.size();
+  for (auto &x : result.outputs) size += sizeof(uint64_t) + x.size();
+
+  std::string out;
+  out.reserve(size);
+  put_u64(out, result.ibytes);
+  put_u64(out, result.obytes);
+  put_u64(out, result.inputs.size());
+  put_u64(out, result.outputs.size());
+  for (auto *paths : {&result.inputs, &result.outputs}) {
+    for (auto &x : *paths) {
+      put_u64(out, x.size());
+      out.append(x);
+    }
+  }
+  return out;
+}
+
+bool decode_result(const std::string &payload, Result &result) {
+  size_t pos = 0;
+  uint64_t ninputs, noutputs;
+  if (!get_u64(payload, pos, result.ibytes) || !get_u64(payload, pos, result.obytes) ||
+      !get_u64(payload, pos, ninputs) || !get_u64(payload, pos, noutputs)) {
+    return false;
+  }
+
+  // Every path takes at least its size, which bounds how much to reserve
+  size_t most = (payload.size() - pos) / sizeof(uint64_t);
+  if (ninputs > most || noutputs > most - ninputs) return false;
+
+  result.inputs.clear();
+  result.outputs.clear();
+  result.inputs.reserve(ninputs);
+  result.outputs.reserve(noutputs);
+  for (uint64_t i = 0; i < ninputs + noutputs; ++i) {
+    uint64_t size;
+    if (!get_u64(payload, pos, size) || payload.size() - pos < size) return false;
+    auto &paths = i < ninputs ? result.inputs : result.outputs;
+    paths.emplace_back(payload, pos, size);
+    pos += size;
+  }
+
+  return pos == payload.size();
+}
+
+}  // namespace job_handoff
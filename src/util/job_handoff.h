@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JOB_HANDOFF_H
+#define JOB_HANDOFF_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// How wakebox and fuse-waked hand each other the visible files of a job and
+// the files it read and wrote, through the .i.<job> and .o.<job> files.
+// Everything is sent as a frame:
+//
+//   [8 byte magic] [u32 version] [u32 kind] [u32 storage] [u32 0] [u64 size] [data]
+//
+// Small payloads are the data itself. Larger ones are written to a file in
+// shared memory and the data is its name, so only a few dozen bytes ever
+// pass through FUSE however big the job is. A reader refuses frames of
+// another version rather than guessing. Both ends run on the same host so
+// integers are in native byte order.
+namespace job_handoff {
+
+enum class Kind : uint32_t { Visible = 1, Result = 2 };
+
+struct Result {
+  uint64_t ibytes, obytes;
+  std::vector<std::string> inputs;
+  std::vector<std::string> outputs;
+  Result() : ibytes(0), obytes(0), inputs(), outputs() {}
+};
+
+bool is_frame(const std::string &data);
+
+// Returns the frame for payload. If the payload went to shared memory then
+// shm is set to its file. The receiver removes the file as soon as it opens
+// it, but the sender should also remove it in case the receiver never does.
+std::string pack(Kind kind, const std::string &payload, std::string &shm);
+// Like pack, but with the shared memory file in shm_dir. If it can't be
+// written there, the payload is sent inline. Frames that point outside of
+// /dev/shm are refused by unpack, so this is only useful for testing.
+std::string pack(Kind kind, const std::string &payload, std::string &shm,
+                 const std::string &shm_dir);
+bool unpack(const std::string &frame, Kind kind, std::string &payload, std::string &error);
+
+std::string encode_result(const Result &result);
+bool decode_result(const std::string &payload, Result &result);
+
+}  // namespace job_handoff
+
+#endif
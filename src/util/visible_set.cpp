@@ -0,0 +1,144 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "visible_set.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <functional>
+
+// Starts with a NUL so it can't be mistaken for JSON
+static const char magic[8] = {'\0', 'w', 'a', 'k', 'e', 'v', 'i', 's'};
+static const uint32_t version = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t count;
+  uint32_t slots;
+  uint32_t arena;
+};
+
+// FNV-1a
+static uint64_t hash_path(const char *path, size_t len) {
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= (uint8_t)path[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+VisibleSet::VisibleSet(std::vector<std::string> paths) : count(0), slots(), arena() {
+  // In reverse order a path comes after every path below it, so a directory
+  // that was also listed shares their bytes instead of needing its own.
+  std::sort(paths.begin(), paths.end(), std::greater<std::string>());
+  paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+
+  slots.resize(16);
+  for (auto &path : paths) {
+    if (path.empty() || contains(path)) continue;
+
+    uint32_t offset = arena.size();
+    arena += path;
+    insert(offset, path.size());
+    for (size_t i = 1; i < path.size(); ++i) {
+      if (path[i] == '/' && !contains(path.data(), i)) insert(offset, i);
+    }
+  }
+}
+
+bool VisibleSet::contains(const char *path, size_t len) const {
+  if (slots.empty() || len == 0) return false;
+
+  size_t mask = slots.size() - 1;
+  for (size_t i = hash_path(path, len) & mask;; i = (i + 1) & mask) {
+    const Slot &slot = slots[i];
+    if (slot.length == 0) return false;
+    if (slot.length == len && memcmp(arena.data() + slot.offset, path, len) == 0) return true;
+  }
+}
+
+void VisibleSet::insert(uint32_t offset, uint32_t length) {
+  // Keep the table at most half full so that probes stay short
+  if (2 * (count + 1) > slots.size()) grow();
+
+  size_t mask = slots.size() - 1;
+  size_t i = hash_path(arena.data() + offset, length) & mask;
+  while (slots[i].length != 0) i = (i + 1) & mask;
+  slots[i].offset = offset;
+  slots[i].length = length;
+  ++count;
+}
+
+void VisibleSet::grow() {
+  std::vector<Slot> old(slots.size() * 2, Slot{0, 0});
+  old.swap(slots);
+  count = 0;
+  for (auto &slot : old) {
+    if (slot.length != 0) insert(slot.offset, slot.length);
+  }
+}
+
+std::string VisibleSet::serialize() const {
+  Header header;
+  memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.count = count;
+  header.slots = slots.size();
+  header.arena = arena.size();
+
+  std::string out;
+  out.reserve(sizeof(header) + slots.size() * sizeof(Slot) + arena.size());
+  out.append(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.append(reinterpret_cast<const char *>(slots.data()), slots.size() * sizeof(Slot));
+  out.append(arena);
+  return out;
+}
+
+bool VisibleSet::is_serialized(const char *data, size_t len) {
+  return len >= sizeof(magic) && memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+bool VisibleSet::deserialize(const char *data, size_t len, VisibleSet &out) {
+  Header header;
+  if (len < sizeof(header)) return false;
+  memcpy(&header, data, sizeof(header));
+  if (memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version) return false;
+
+  // The table must be a power of 2 with room left to end every probe
+  if (header.slots == 0 || (header.slots & (header.slots - 1)) != 0) return false;
+  if (header.count >= header.slots) return false;
+  if (len != sizeof(header) + uint64_t(header.slots) * sizeof(Slot) + header.arena) return false;
+
+  std::vector<Slot> slots(header.slots);
+  memcpy(slots.data(), data + sizeof(header), header.slots * sizeof(Slot));
+
+  size_t used = 0;
+  for (auto &slot : slots) {
+    if (slot.length == 0) continue;
+    if (uint64_t(slot.offset) + slot.length > header.arena) return false;
+    ++used;
+  }
+  if (used != header.count) return false;
+
+  out.count = header.count;
+  out.slots = std::move(slots);
+  out.arena.assign(data + sizeof(header) + header.slots * sizeof(Slot), header.arena);
+  return true;
+}
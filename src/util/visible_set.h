@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VISIBLE_SET_H
+#define VISIBLE_SET_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// The files a sandboxed job may see, built once when the job starts.
+// A path is visible if it was listed or if it is a directory on the way to
+// something that was, so that is precomputed and a lookup is one probe of
+// an open addressed hash table which never allocates. The paths are kept
+// in one buffer and a directory shares the bytes of the first path listed
+// below it.
+//
+// The set can be saved to and loaded from a flat binary form which is just
+// its memory layout, so loading it is a couple of copies rather than a
+// parse. The form uses native byte order as it never leaves the host.
+class VisibleSet {
+ public:
+  VisibleSet() : count(0), slots(), arena() {}
+  explicit VisibleSet(std::vector<std::string> paths);
+
+  bool contains(const char *path, size_t len) const;
+  bool contains(const std::string &path) const { return contains(path.data(), path.size()); }
+
+  // Listed paths plus the directories leading to them
+  size_t size() const { return count; }
+
+  std::string serialize() const;
+  // Does data start like the output of serialize?
+  static bool is_serialized(const char *data, size_t len);
+  static bool deserialize(const char *data, size_t len, VisibleSet &out);
+
+ private:
+  struct Slot {
+    uint32_t offset;
+    uint32_t length;  // 0 for an empty slot
+  };
+
+  size_t count;
+  std::vector<Slot> slots;  // the size is a power of 2
+  std::string arena;
+
+  void insert(uint32_t offset, uint32_t length);
+  void grow();
+};
+
+#endif
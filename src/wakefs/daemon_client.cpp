@@ -33,7 +33,9 @@
 #include "fuse.h"
 #include "json/json5.h"
 #include "util/execpath.h"
+#include "util/job_handoff.h"
 #include "util/mkdir_parents.h"
+#include "util/visible_set.h"
 
 // The user-id and group-id are used so that fuse daemons with different uid:gid pairs
 // running within the same build can co-exist without trying to share. The kernel
@@ -73,8 +75,15 @@ bool daemon_client::connect(std::vector<std::string> &visible, bool close_live_f
       int exit_delay = 4 * delay.tv_sec;
       if (exit_delay < 2) exit_delay = 2;
       std::string delayStr = std::to_string(exit_delay);
-      const char *env[3] = {"PATH=/usr/bin:/bin:/usr/sbin:/sbin", 0, 0};
-      if (getenv("DEBUG_FUSE_WAKE")) env[1] = "DEBUG_FUSE_WAKE=1";
+      const char *env[5] = {"PATH=/usr/bin:/bin:/usr/sbin:/sbin", 0, 0, 0, 0};
+      int envs = 1;
+      if (getenv("DEBUG_FUSE_WAKE")) env[envs++] = "DEBUG_FUSE_WAKE=1";
+      if (getenv("MULTI_THREAD_FUSE_WAKE")) env[envs++] = "MULTI_THREAD_FUSE_WAKE=1";
+      std::string cache;
+      if (const char *timeout = getenv("CACHE_FUSE_WAKE")) {
+        cache = std::string("CACHE_FUSE_WAKE=") + timeout;
+        env[envs++] = cache.c_str();
+      }
       execle(executable.c_str(), "fuse-waked", mount_path.c_str(), delayStr.c_str(), nullptr, env);
       std::cerr << "execl " << executable << ": " << strerror(errno) << std::endl;
       exit(1);
@@ -115,18 +124,24 @@ bool daemon_client::connect(std::vector<std::string> &visible, bool close_live_f
   // We can safely release the global handle now that we hold a live_fd
   (void)close(ffd);
 
-  // The fuse-waked process takes an input file containing visible files, json formatted.
-  JAST for_daemon(JSON_OBJECT);
-  auto &vis = for_daemon.add("visible", JSON_ARRAY);
-  for (auto &s : visible) vis.add(std::move(s));
-
-  std::ofstream ijson(visibles_path);
-  ijson << for_daemon;
-  if (ijson.fail()) {
+  // The fuse-waked process takes an input file containing visible files. It also accepts
+  // JSON, but a serialized VisibleSet spares it building the index for every job, and
+  // a large one is handed over in shared memory rather than written through FUSE.
+  // We only need to make the relative paths visible; absolute paths are already.
+  std::vector<std::string> relative;
+  for (auto &s : visible)
+    if (!s.empty() && s[0] != '/') relative.push_back(std::move(s));
+
+  std::string frame = job_handoff::pack(job_handoff::Kind::Visible,
+                                        VisibleSet(std::move(relative)).serialize(), visible_shm);
+  std::ofstream ivis(visibles_path, std::ios::binary);
+  ivis << frame;
+  if (ivis.fail()) {
     std::cerr << "write " << visibles_path << ": " << strerror(errno) << std::endl;
+    if (!visible_shm.empty()) (void)unlink(visible_shm.c_str());
     return false;
   }
-  ijson.close();
+  ivis.close();
   return true;
 }
 
@@ -135,8 +150,11 @@ bool daemon_client::disconnect(std::string &result) {
   (void)!write(live_fd, "x", 1);  // the ! convinces older gcc that it's ok to ignore the write
   (void)fsync(live_fd);
 
+  // The daemon removed the visible files when it read them, unless it failed first
+  if (!visible_shm.empty()) (void)unlink(visible_shm.c_str());
+
   // Read the output file
-  std::ifstream ifs(output_path);
+  std::ifstream ifs(output_path, std::ios::binary);
   result.assign((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
   if (ifs.fail()) {
     std::cerr << "read " << output_path << ": " << strerror(errno) << std::endl;
@@ -45,6 +45,7 @@
 #include "json/json5.h"
 #include "namespace.h"
 #include "util/execpath.h"
+#include "util/job_handoff.h"
 #include "util/shell.h"
 
 #ifndef HOST_NAME_MAX
@@ -113,15 +114,43 @@ int execve_wrapper(const std::vector<std::string> &command,
   return errno;
 }
 
+// The daemon answers in the form it was asked in, which is a job_handoff
+// frame unless it predates them and sent JSON.
+static bool read_daemon_output(const std::string &daemon_output, job_handoff::Result &result,
+                               std::string &error) {
+  if (job_handoff::is_frame(daemon_output)) {
+    std::string payload;
+    if (!job_handoff::unpack(daemon_output, job_handoff::Kind::Result, payload, error)) return false;
+    if (!job_handoff::decode_result(payload, result)) {
+      error = "malformed result from fuse-waked";
+      return false;
+    }
+    return true;
+  }
+
+  JAST jast;
+  std::stringstream ss;
+  if (!JAST::parse(daemon_output, ss, jast)) {
+    error = ss.str();
+    return false;
+  }
+
+  result.ibytes = std::stoll(jast.get("ibytes").value);
+  result.obytes = std::stoll(jast.get("obytes").value);
+  for (auto &x : jast.get("inputs").children) result.inputs.push_back(std::move(x.second.value));
+  for (auto &x : jast.get("outputs").children) result.outputs.push_back(std::move(x.second.value));
+  return true;
+}
+
 static bool collect_result_metadata(const std::string daemon_output, const struct timeval &start,
                                     const struct timeval &stop, const pid_t pid, const int status,
                                     const RUsage &rusage, bool timed_out,
                                     std::string &result_json) {
-  JAST from_daemon;
-  std::stringstream ss;
-  if (!JAST::parse(daemon_output, ss, from_daemon)) {
+  std::string error;
+  job_handoff::Result from_daemon;
+  if (!read_daemon_output(daemon_output, from_daemon, error)) {
     // stderr is closed, so report the error on the only output we have
-    result_json = ss.str();
+    result_json = error;
     return false;
   }
 
@@ -129,13 +158,15 @@ static bool collect_result_metadata(const std::string daemon_output, const struc
   auto &usage = result_jast.add("usage", JSON_OBJECT);
   usage.add("status", status);
   usage.add("membytes", static_cast<long long>(rusage.membytes));
-  usage.add("inbytes", std::stoll(from_daemon.get("ibytes").value));
-  usage.add("outbytes", std::stoll(from_daemon.get("obytes").value));
+  usage.add("inbytes", static_cast<long long>(from_daemon.ibytes));
+  usage.add("outbytes", static_cast<long long>(from_daemon.obytes));
   usage.add("runtime", stop.tv_sec - start.tv_sec + (stop.tv_usec - start.tv_usec) / 1000000.0);
   usage.add("cputime", rusage.utime + rusage.stime);
 
-  result_jast.add("inputs", JSON_ARRAY).children = std::move(from_daemon.get("inputs").children);
-  result_jast.add("outputs", JSON_ARRAY).children = std::move(from_daemon.get("outputs").children);
+  auto &inputs = result_jast.add("inputs", JSON_ARRAY);
+  for (auto &x : from_daemon.inputs) inputs.add(std::move(x));
+  auto &outputs = result_jast.add("outputs", JSON_ARRAY);
+  for (auto &x : from_daemon.outputs) outputs.add(std::move(x));
   result_jast.add_bool("timed-out", timed_out);
 
   char hostname[HOST_NAME_MAX + 1];
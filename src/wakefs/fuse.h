@@ -40,7 +40,7 @@ struct daemon_client {
   // File held open by each child of wakebox. When all children close it,
   // the daemon releases the resources for that job.
   const std::string subdir_live_file;
-  // JSON input file to the fuse daemon, listing which files should be visible.
+  // Input file to the fuse daemon, listing which files should be visible.
   const std::string visibles_path;
 
   daemon_client(const std::string &base_dir);
@@ -51,6 +51,8 @@ struct daemon_client {
  protected:
   // file descriptor for opened 'subdir_live_file'
   int live_fd;
+  // shared memory holding the visible files, if they were too big to send inline
+  std::string visible_shm;
 };
 
 struct json_args {
@@ -0,0 +1,5 @@
+#! /bin/sh
+
+WAKE="${1:+$1/wake}"
+"${WAKE:-wake}" --stdout=warning,report --heap-nursery 0.01 test
+"${WAKE:-wake}" --stdout=warning,report --heap-nursery 0.01 --heap-factor 1.1 test
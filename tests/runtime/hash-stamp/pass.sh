@@ -0,0 +1,20 @@
+#! /bin/sh
+
+WAKE="${1:+$1/wake}"
+rm -f wake.db data data.link1 data.link2
+printf one > data
+touch -t 202001010000 data
+# The debug stream reports how many hashes were reused from wake.db
+"${WAKE:-wake}" --stdout=warning,report,debug test
+"${WAKE:-wake}" --stdout=warning,report,debug test
+# Rewriting the file with the same size and modification time still changes its ctime
+printf two > data
+touch -t 202001010000 data
+"${WAKE:-wake}" --stdout=warning,report,debug test
+# Once the file has another link its ctime is no longer part of the stamp,
+# so linking it again, as the job cache does, does not make it rehashed
+ln data data.link1
+"${WAKE:-wake}" --stdout=warning,report,debug test
+ln data data.link2
+"${WAKE:-wake}" --stdout=warning,report,debug test
+rm -f wake.db data data.link1 data.link2
@@ -0,0 +1,9 @@
+#! /bin/sh
+
+WAKE="${1:+$1/wake}"
+rm -rf .wake-ssa
+"${WAKE:-wake}" --stdout=warning,report test
+"${WAKE:-wake}" --stdout=warning,report test
+ls .wake-ssa | wc -l | tr -d " "
+"${WAKE:-wake}" --stdout=warning,report --no-ssa-cache test
+rm -rf .wake-ssa
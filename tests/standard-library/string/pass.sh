@@ -4,3 +4,5 @@ WAKE="${1:+$1/wake}"
 "${WAKE:-wake}" --stdout=warning,report testToBytes
 "${WAKE:-wake}" --stdout=warning,report testToUnicode
 "${WAKE:-wake}" --stdout=warning,report testEquality
+"${WAKE:-wake}" --stdout=warning,report testFilterMatches
+"${WAKE:-wake}" --stdout=warning,report --eval-threads 4 testFilterMatches
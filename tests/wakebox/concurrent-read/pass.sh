@@ -0,0 +1,60 @@
+#!/bin/sh
+# Runs several jobs at once, each reading its own input through fuse-waked.
+# Checks that every job reports exactly its own input and prints the
+# aggregate read throughput. Raise JOBS and MB (per job) to use this as a
+# benchmark, and compare against MULTI_THREAD_FUSE_WAKE=1 or
+# CACHE_FUSE_WAKE=<seconds>. Those only take effect when no fuse-waked is
+# already running.
+
+# It's not valid to call wakebox with an empty PATH.
+# So we fill PATH with some typical values.
+export PATH=/bin:/sbin:/usr/bin:/usr/sbin:/usr/local/bin
+
+JOBS=${JOBS:-8}
+MB=${MB:-16}
+
+trap 'rm -f data.* params.* stats.*' EXIT
+
+i=0
+while [ $i -lt $JOBS ]; do
+  dd if=/dev/zero of=data.$i bs=1048576 count=$MB 2>/dev/null || exit 1
+  cat > params.$i <<JSON
+{
+  "command": ["/bin/sh", "-c", "cat data.$i > /dev/null"],
+  "environment": ["PATH=/usr/bin:/bin:/usr/sbin:/sbin"],
+  "directory": ".",
+  "stdin": "",
+  "mount-ops": [{"type": "workspace", "destination": "."}],
+  "visible": ["data.$i"]
+}
+JSON
+  i=$((i+1))
+done
+
+start=$(date +%s.%N)
+pids=
+i=0
+while [ $i -lt $JOBS ]; do
+  ${1}/wakebox -p params.$i -o stats.$i &
+  pids="$pids $!"
+  i=$((i+1))
+done
+for pid in $pids; do
+  wait $pid || exit 1
+done
+end=$(date +%s.%N)
+
+i=0
+while [ $i -lt $JOBS ]; do
+  jq -e --arg f "data.$i" '[.inputs[] | select(test("data\\."))] == [$f]' stats.$i >/dev/null || {
+    echo "job $i reported the wrong inputs:" 1>&2
+    cat stats.$i 1>&2
+    exit 1
+  }
+  i=$((i+1))
+done
+
+echo "$start $end" | awk -v jobs=$JOBS -v mb=$MB '{
+  secs = $2 - $1
+  printf "%d jobs read %dMB in %.2fs: %.1fMB/s\n", jobs, jobs * mb, secs, jobs * mb / secs
+}' 1>&2
@@ -0,0 +1,37 @@
+#!/bin/sh
+# fuse-waked still takes a job's visible files as JSON, for clients from
+# before the binary handoff, and answers such a job in JSON. This speaks
+# that protocol to the daemon directly, the way daemon_client does.
+
+export PATH=/bin:/sbin:/usr/bin:/usr/sbin:/usr/local/bin
+
+MOUNT=$(pwd)/.fuse/json-handoff
+JOB=$$
+
+trap 'rm -f input.txt output.json' EXIT
+
+echo hello > input.txt
+mkdir -p .fuse || exit 1
+
+tries=0
+until [ -e "$MOUNT/.f.fuse-waked" ]; do
+  [ $tries -lt 50 ] || { echo "fuse-waked did not start" 1>&2; exit 1; }
+  [ $tries -eq 0 ] && { ${1}/../lib/wake/fuse-waked "$MOUNT" 1 || exit 1; }
+  tries=$((tries+1))
+  sleep 0.1
+done
+
+exec 3<"$MOUNT/.f.fuse-waked" || exit 1
+exec 4<>"$MOUNT/.l.$JOB" || exit 1
+echo '{"visible":["input.txt"]}' > "$MOUNT/.i.$JOB" || exit 1
+cat "$MOUNT/$JOB/input.txt" > /dev/null || exit 1
+# This write fails by design; it makes the daemon produce the result
+(echo x >&4) 2>/dev/null
+cat "$MOUNT/.o.$JOB" > output.json || exit 1
+exec 4>&- 3<&-
+
+jq -e '.inputs == ["input.txt"] and .outputs == [] and .ibytes == 6' output.json > /dev/null || {
+  echo "unexpected result:" 1>&2
+  cat output.json 1>&2
+  exit 1
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Gives a job enough visible files, and has it read enough of them, that
+# both its visible set and its result are over the 64KB that fits inline.
+# Both then go between wakebox and fuse-waked in shared memory, or inline
+# if /dev/shm can't be written.
+
+# It's not valid to call wakebox with an empty PATH.
+# So we fill PATH with some typical values.
+export PATH=/bin:/sbin:/usr/bin:/usr/sbin:/usr/local/bin
+
+FILES=2000
+
+trap 'rm -rf inputs params.json stats.json' EXIT
+
+rm -rf inputs
+mkdir inputs || exit 1
+(cd inputs && awk -v n=$FILES 'BEGIN { for (i = 0; i < n; ++i) {
+  f = sprintf("handoff-input-with-a-fairly-long-name-%04d.txt", i); print i > f; close(f) } }') || exit 1
+
+{
+  echo '{'
+  echo '  "command": ["/bin/sh", "-c", "cat inputs/handoff-* > /dev/null"],'
+  echo '  "environment": ["PATH=/usr/bin:/bin:/usr/sbin:/sbin"],'
+  echo '  "directory": ".",'
+  echo '  "stdin": "",'
+  echo '  "mount-ops": [{"type": "workspace", "destination": "."}],'
+  echo '  "visible": ["inputs",'
+  ls inputs | sed 's/.*/    "inputs\/&",/'
+  echo '    "inputs"]'
+  echo '}'
+} > params.json
+
+${1}/wakebox -p params.json -o stats.json || exit 1
+
+READ=$(jq '[.inputs[] | select(startswith("inputs/handoff-"))] | length' stats.json)
+if [ "$READ" != "$FILES" ]; then
+  echo "expected $FILES inputs, got $READ" 1>&2
+  exit 1
+fi
@@ -26,6 +26,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <fuse.h>
+#include <fuse_lowlevel.h>
 #include <signal.h>
 #include <stdio.h>
 #include <string.h>
@@ -37,43 +38,83 @@
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "compat/nofollow.h"
 #include "compat/utimens.h"
 #include "json/json5.h"
 #include "util/execpath.h"
+#include "util/job_handoff.h"
 #include "util/unlink.h"
+#include "util/visible_set.h"
 
 #define MAX_JSON (128 * 1024 * 1024)
 
+// Letting the kernel cache needs a way to make it forget a job, see forget_job
+#if FUSE_VERSION >= 29 && !defined(__APPLE__)
+#define HAVE_KERNEL_CACHE 1
+#endif
+
 // We ensure STDIN is /dev/null, so this is a safe sentinel value for open files
 #define BAD_FD STDIN_FILENO
 
 // How long to wait for a new client to connect before the daemon exits
 static int linger_timeout;
+static struct fuse_chan *fc;
+static std::mutex hardlinks_mutex;
 static std::set<std::string> hardlinks = {};
 
+// With CACHE_FUSE_WAKE=<seconds>, the kernel may answer lookups and stats
+// from its cache for that long and keeps the pages of inputs across opens.
+// Inputs cannot change while a job runs, so this is only unsafe if a job's
+// files change underneath it, which breaks the job anyway.
+static int cache_timeout = 0;
+
 // How to retry umount while quitting
 // (2^8-1)*100ms = 25.5s worst-case quit time
 #define QUIT_RETRY_MS 100
 #define QUIT_RETRY_ATTEMPTS 8
 
+// Requests may be served by several threads. Each job has its own lock so that
+// jobs never wait on each other, only on the requests of the same job.
 struct Job {
-  std::set<std::string> files_visible;
+  std::mutex mutex;  // guards everything below
+  bool erased;       // no longer in context.jobs
+  VisibleSet files_visible;
   std::set<std::string> files_read;
   std::set<std::string> files_wrote;
-  std::string json_in;
-  std::string json_out;
+  std::string json_in;     // the visible files, as JSON or a job_handoff frame
+  std::string json_out;    // answered in the same form as json_in
+  std::string result_shm;  // where a large framed json_out keeps its payload
+  bool framed;
   long ibytes, obytes;
   int json_in_uses;
   int json_out_uses;
   int uses;
 
-  Job() : ibytes(0), obytes(0), json_in_uses(0), json_out_uses(0), uses(0) {}
+  Job()
+      : erased(false),
+        framed(false),
+        ibytes(0),
+        obytes(0),
+        json_in_uses(0),
+        json_out_uses(0),
+        uses(0) {}
+  // The client normally removes result_shm; this covers it never reading it
+  ~Job() {
+    if (!result_shm.empty()) (void)unlink(result_shm.c_str());
+  }
 
   void parse();
   void dump();
@@ -85,6 +126,17 @@ struct Job {
 };
 
 void Job::parse() {
+  if (job_handoff::is_frame(json_in)) {
+    framed = true;
+    std::string payload, error;
+    if (!job_handoff::unpack(json_in, job_handoff::Kind::Visible, payload, error)) {
+      fprintf(stderr, "Parse error: %s\n", error.c_str());
+    } else if (!VisibleSet::deserialize(payload.data(), payload.size(), files_visible)) {
+      fprintf(stderr, "Parse error: malformed visible set\n");
+    }
+    return;
+  }
+
   JAST jast;
   std::stringstream s;
   if (!JAST::parse(json_in, s, jast)) {
@@ -93,31 +145,23 @@ void Job::parse() {
   }
 
   // We only need to make the relative paths visible; absolute paths are already
-  files_visible.clear();
+  std::vector<std::string> visible;
   for (auto &x : jast.get("visible").children)
     if (!x.second.value.empty() && x.second.value[0] != '/')
-      files_visible.insert(std::move(x.second.value));
+      visible.push_back(std::move(x.second.value));
+  files_visible = VisibleSet(std::move(visible));
 }
 
 void Job::dump() {
   if (!json_out.empty()) return;
 
-  bool first;
-  std::stringstream s;
-
-  s << "{\"ibytes\":" << ibytes << ",\"obytes\":" << obytes << ",\"inputs\":[";
-
   for (auto &x : files_wrote) files_read.erase(x);
 
-  first = true;
-  for (auto &x : files_read) {
-    s << (first ? "" : ",") << "\"" << json_escape(x) << "\"";
-    first = false;
-  }
+  job_handoff::Result result;
+  result.ibytes = ibytes;
+  result.obytes = obytes;
+  result.inputs.assign(files_read.begin(), files_read.end());
 
-  s << "],\"outputs\":[";
-
-  first = true;
   const std::string prefix = ".fuse_hidden";
   for (auto &x : files_wrote) {
     // files prefixed with .fuse_hidden are implementation details of libfuse
@@ -127,7 +171,31 @@ void Job::dump() {
     size_t lastslash = x.rfind("/");
     if (lastslash != std::string::npos) start = lastslash + 1;
     if (x.compare(start, prefix.length(), prefix) == 0) continue;
+    result.outputs.push_back(x);
+  }
+
+  // Answer in the form the client asked in
+  if (framed) {
+    json_out = job_handoff::pack(job_handoff::Kind::Result, job_handoff::encode_result(result),
+                                 result_shm);
+    return;
+  }
+
+  bool first;
+  std::stringstream s;
+
+  s << "{\"ibytes\":" << ibytes << ",\"obytes\":" << obytes << ",\"inputs\":[";
 
+  first = true;
+  for (auto &x : result.inputs) {
+    s << (first ? "" : ",") << "\"" << json_escape(x) << "\"";
+    first = false;
+  }
+
+  s << "],\"outputs\":[";
+
+  first = true;
+  for (auto &x : result.outputs) {
     s << (first ? "" : ",") << "\"" << json_escape(x) << "\"";
     first = false;
   }
@@ -138,23 +206,23 @@ void Job::dump() {
 }
 
 struct Context {
-  std::map<std::string, Job> jobs;
-  int rootfd, uses;
-  Context() : jobs(), rootfd(-1), uses(0) {}
+  // Held shared to look up a job and exclusively to add or remove one.
+  // Never held while waiting for a Job::mutex.
+  std::shared_timed_mutex mutex;
+  std::map<std::string, std::shared_ptr<Job>> jobs;
+  // Checked by the signal handler, so kept outside of the lock
+  std::atomic<size_t> live_jobs;
+  std::atomic<int> uses;
+  int rootfd;
+  Context() : jobs(), live_jobs(0), uses(0), rootfd(-1) {}
   bool should_exit() const;
 };
 
-bool Context::should_exit() const { return 0 == uses && jobs.empty(); }
+bool Context::should_exit() const { return 0 == uses && 0 == live_jobs; }
 
 static Context context;
 
-bool Job::is_visible(const std::string &path) {
-  if (files_visible.find(path) != files_visible.end()) return true;
-
-  auto i = files_visible.lower_bound(path + "/");
-  return i != files_visible.end() && i->size() > path.size() && (*i)[path.size()] == '/' &&
-         0 == i->compare(0, path.size(), path);
-}
+bool Job::is_visible(const std::string &path) { return files_visible.contains(path); }
 
 bool Job::is_writeable(const std::string &path) {
   return files_wrote.find(path) != files_wrote.end();
@@ -164,6 +232,143 @@ bool Job::is_readable(const std::string &path) { return is_visible(path) || is_w
 
 bool Job::should_erase() const { return 0 == uses && 0 == json_in_uses && 0 == json_out_uses; }
 
+// A job which stays locked for as long as this is in scope
+struct LockedJob {
+  std::shared_ptr<Job> job;
+  std::unique_lock<std::mutex> lock;
+  LockedJob() : job(), lock() {}
+  explicit LockedJob(std::shared_ptr<Job> job_) : job(std::move(job_)), lock(job->mutex) {}
+  LockedJob(LockedJob &&) = default;
+  // Unlock before letting go of the job, which could free the mutex
+  LockedJob &operator=(LockedJob &&other) {
+    lock = std::move(other.lock);
+    job = std::move(other.job);
+    return *this;
+  }
+  explicit operator bool() const { return bool(job); }
+  Job *operator->() const { return job.get(); }
+  Job &operator*() const { return *job; }
+};
+
+static LockedJob find_job(const std::string &id) {
+  std::shared_ptr<Job> job;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(context.mutex);
+    auto it = context.jobs.find(id);
+    if (it == context.jobs.end()) return LockedJob();
+    job = it->second;
+  }
+  LockedJob out(std::move(job));
+  // It might have been erased between the lookup and taking its lock
+  if (out->erased) return LockedJob();
+  return out;
+}
+
+#ifdef HAVE_KERNEL_CACHE
+// Invalidations can't be sent while serving a request, which may hold a
+// lock the kernel needs for them, so one thread sends them all in order.
+struct Forgetter {
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::deque<std::string> ids;
+  bool stop = false;
+  std::thread thread;
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      wake.wait(lock, [this] { return stop || !ids.empty(); });
+      if (stop) return;
+      std::string id = std::move(ids.front());
+      ids.pop_front();
+      lock.unlock();
+      for (const char *prefix : {"", ".i.", ".o.", ".l."}) {
+        std::string name = prefix + id;
+        fuse_lowlevel_notify_inval_entry(fc, FUSE_ROOT_ID, name.c_str(), name.size());
+      }
+      lock.lock();
+    }
+  }
+};
+
+static Forgetter forgetter;
+#endif
+
+// Started by wakefuse_init and joined before the filesystem is unmounted
+static void start_forgetting() {
+#ifdef HAVE_KERNEL_CACHE
+  if (cache_timeout > 0) forgetter.thread = std::thread([] { forgetter.run(); });
+#endif
+}
+
+static void stop_forgetting() {
+#ifdef HAVE_KERNEL_CACHE
+  if (!forgetter.thread.joinable()) return;
+  {
+    std::lock_guard<std::mutex> lock(forgetter.mutex);
+    forgetter.stop = true;
+  }
+  forgetter.wake.notify_one();
+  forgetter.thread.join();
+#endif
+}
+
+// Job ids are pids, which get reused. A new job must not see what the
+// kernel cached for an old job with the same id, so drop the old job's
+// directory and its .i/.o/.l files from the kernel's cache. Otherwise a
+// stat of .o.<id> could report the old job's result size.
+static void forget_job(const std::string &id) {
+#ifdef HAVE_KERNEL_CACHE
+  if (cache_timeout <= 0) return;
+  {
+    std::lock_guard<std::mutex> lock(forgetter.mutex);
+    forgetter.ids.push_back(id);
+  }
+  forgetter.wake.notify_one();
+#else
+  (void)id;
+#endif
+}
+
+static bool has_job(const std::string &id) {
+  std::shared_lock<std::shared_timed_mutex> lock(context.mutex);
+  return context.jobs.find(id) != context.jobs.end();
+}
+
+// Like find_job, but adds the job if it does not exist yet
+static LockedJob add_job(const std::string &id) {
+  for (;;) {
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::shared_timed_mutex> lock(context.mutex);
+      auto &slot = context.jobs[id];
+      if (!slot) {
+        slot = std::make_shared<Job>();
+        ++context.live_jobs;
+      }
+      job = slot;
+    }
+    LockedJob out(std::move(job));
+    if (!out->erased) return out;
+    // Lost a race with erase_job; it is about to drop the old entry
+    out.lock.unlock();
+    std::this_thread::yield();
+  }
+}
+
+// Removes a job nothing uses anymore. This releases the job's lock.
+static void erase_job(const std::string &id, LockedJob &job) {
+  job->erased = true;
+  job.lock.unlock();
+  std::unique_lock<std::shared_timed_mutex> lock(context.mutex);
+  auto it = context.jobs.find(id);
+  if (it != context.jobs.end() && it->second == job.job) {
+    context.jobs.erase(it);
+    --context.live_jobs;
+    forget_job(id);
+  }
+}
+
 static std::pair<std::string, std::string> split_key(const char *path) {
   const char *end = strchr(path + 1, '/');
   if (end) {
@@ -174,7 +379,7 @@ static std::pair<std::string, std::string> split_key(const char *path) {
 }
 
 struct Special {
-  std::map<std::string, Job>::iterator job;
+  LockedJob job;
   char kind;
   Special() : job(), kind(0) {}
   operator bool() const { return kind; }
@@ -185,23 +390,22 @@ static Special is_special(const char *path) {
 
   if (path[0] != '/' || path[1] != '.' || !path[2] || path[3] != '.' || !path[4]) return out;
 
-  auto it = context.jobs.find(path + 4);
   switch (path[2]) {
     case 'f':
       out.kind = strcmp(path + 4, "fuse-waked") ? 0 : 'f';
       return out;
     case 'o':
-      if (it != context.jobs.end() && !it->second.json_out.empty()) {
+      out.job = find_job(path + 4);
+      if (out.job && !out.job->json_out.empty()) {
         out.kind = path[2];
-        out.job = it;
+      } else {
+        out.job = LockedJob();
       }
       return out;
     case 'i':
     case 'l':
-      if (it != context.jobs.end()) {
-        out.kind = path[2];
-        out.job = it;
-      }
+      out.job = find_job(path + 4);
+      if (out.job) out.kind = path[2];
       return out;
     default:
       return out;
@@ -210,7 +414,7 @@ static Special is_special(const char *path) {
 
 // If exit_attempts is > 0, we are in the impossible-to-stop process of exiting.
 // On a clean shutdown, exit_attempts will only ever be increased if context.should_exit() is true.
-static volatile int exit_attempts = 0;
+static std::atomic<int> exit_attempts(0);
 
 // You must make context.should_exit() false BEFORE calling cancel_exit.
 // Return of 'true' guarantees the process will not exit
@@ -244,7 +448,7 @@ static void schedule_exit() {
 }
 
 static const char *trace_out(int code) {
-  static char buf[20];
+  static thread_local char buf[20];
   if (code < 0) {
     return strerror(-code);
   } else {
@@ -262,11 +466,11 @@ static int wakefuse_getattr(const char *path, struct stat *stbuf) {
     switch (s.kind) {
       case 'i':
         stbuf->st_mode = S_IFREG | 0644;
-        stbuf->st_size = s.job->second.json_in.size();
+        stbuf->st_size = s.job->json_in.size();
         return res;
       case 'o':
         stbuf->st_mode = S_IFREG | 0444;
-        stbuf->st_size = s.job->second.json_out.size();
+        stbuf->st_size = s.job->json_out.size();
         return res;
       case 'l':
         stbuf->st_mode = S_IFREG | 0644;
@@ -290,8 +494,8 @@ static int wakefuse_getattr(const char *path, struct stat *stbuf) {
     return res;
   }
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") {
     int res = fstat(context.rootfd, stbuf);
@@ -301,7 +505,7 @@ static int wakefuse_getattr(const char *path, struct stat *stbuf) {
     return res;
   }
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
   int res = fstatat(context.rootfd, key.second.c_str(), stbuf, AT_SYMLINK_NOFOLLOW);
   if (res == -1) res = -errno;
@@ -328,12 +532,12 @@ static int wakefuse_access(const char *path, int mask) {
   auto key = split_key(path);
   if (key.first.empty()) return 0;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return 0;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
   int res = faccessat(context.rootfd, key.second.c_str(), mask, 0);
   if (res == -1) return -errno;
@@ -353,18 +557,18 @@ static int wakefuse_readlink(const char *path, char *buf, size_t size) {
   auto key = split_key(path);
   if (key.first.empty()) return -EINVAL;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EINVAL;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
   int res = readlinkat(context.rootfd, key.second.c_str(), buf, size - 1);
   if (res == -1) return -errno;
 
   buf[res] = '\0';
-  it->second.files_read.insert(std::move(key.second));
+  job->files_read.insert(std::move(key.second));
   return 0;
 }
 
@@ -384,22 +588,28 @@ static int wakefuse_readdir(const char *path, void *buf, fuse_fill_dir_t filler,
   auto key = split_key(path);
   if (key.first.empty()) {
     filler(buf, ".f.fuse-waked", 0, 0);
-    for (auto &job : context.jobs) {
+    std::vector<std::pair<std::string, std::shared_ptr<Job>>> jobs;
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(context.mutex);
+      jobs.assign(context.jobs.begin(), context.jobs.end());
+    }
+    for (auto &job : jobs) {
       filler(buf, job.first.c_str(), 0, 0);
       filler(buf, (".l." + job.first).c_str(), 0, 0);
       filler(buf, (".i." + job.first).c_str(), 0, 0);
-      if (!job.second.json_out.empty()) filler(buf, (".o." + job.first).c_str(), 0, 0);
+      std::unique_lock<std::mutex> lock(job.second->mutex);
+      if (!job.second->json_out.empty()) filler(buf, (".o." + job.first).c_str(), 0, 0);
     }
     return 0;
   }
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   int dfd;
   if (key.second == ".") {
     dfd = dup(context.rootfd);
-  } else if (!it->second.is_readable(key.second)) {
+  } else if (!job->is_readable(key.second)) {
     return -ENOENT;
   } else {
     dfd = openat(context.rootfd, key.second.c_str(), O_RDONLY | O_NOFOLLOW | O_DIRECTORY);
@@ -428,7 +638,7 @@ static int wakefuse_readdir(const char *path, void *buf, fuse_fill_dir_t filler,
     }
     file += de->d_name;
 
-    if (!it->second.is_readable(file)) {
+    if (!job->is_readable(file)) {
       // Allow '.' and '..' links in this directory.
       // This directory was earlier checked as visible (for '.') and
       // the parent of a readable directory should also be visible (for '..').
@@ -456,8 +666,8 @@ static int wakefuse_mknod(const char *path, mode_t mode, dev_t rdev) {
   auto key = split_key(path);
   if (key.first.empty()) return -EEXIST;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) {
+  auto job = find_job(key.first);
+  if (!job) {
     if (key.second == ".")
       return -EACCES;
     else
@@ -466,9 +676,9 @@ static int wakefuse_mknod(const char *path, mode_t mode, dev_t rdev) {
 
   if (key.second == ".") return -EEXIST;
 
-  if (it->second.is_visible(key.second)) return -EEXIST;
+  if (job->is_visible(key.second)) return -EEXIST;
 
-  if (!it->second.is_writeable(key.second)) (void)deep_unlink(context.rootfd, key.second.c_str());
+  if (!job->is_writeable(key.second)) (void)deep_unlink(context.rootfd, key.second.c_str());
 
   int res;
   if (S_ISREG(mode)) {
@@ -492,7 +702,7 @@ static int wakefuse_mknod(const char *path, mode_t mode, dev_t rdev) {
 
   if (res == -1) return -errno;
 
-  it->second.files_wrote.insert(std::move(key.second));
+  job->files_wrote.insert(std::move(key.second));
   return 0;
 }
 
@@ -511,19 +721,19 @@ static int wakefuse_create(const char *path, mode_t mode, struct fuse_file_info
   if (key.second == "." && key.first.size() > 3 && key.first[0] == '.' && key.first[1] == 'l' &&
       key.first[2] == '.' && key.first[3] != '.') {
     std::string jobid = key.first.substr(3);
-    Job &job = context.jobs[jobid];
-    ++job.uses;
+    LockedJob job = add_job(jobid);
+    ++job->uses;
     if (!cancel_exit()) {
-      --job.uses;
-      if (job.should_erase()) context.jobs.erase(jobid);
+      --job->uses;
+      if (job->should_erase()) erase_job(jobid, job);
       return -EPERM;
     }
     fi->fh = BAD_FD;
     return 0;
   }
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) {
+  auto job = find_job(key.first);
+  if (!job) {
     if (key.second == ".")
       return -EACCES;
     else
@@ -532,15 +742,15 @@ static int wakefuse_create(const char *path, mode_t mode, struct fuse_file_info
 
   if (key.second == ".") return -EEXIST;
 
-  if (it->second.is_visible(key.second)) return -EEXIST;
+  if (job->is_visible(key.second)) return -EEXIST;
 
-  if (!it->second.is_writeable(key.second)) (void)deep_unlink(context.rootfd, key.second.c_str());
+  if (!job->is_writeable(key.second)) (void)deep_unlink(context.rootfd, key.second.c_str());
 
   int fd = openat(context.rootfd, key.second.c_str(), fi->flags, mode);
   if (fd == -1) return -errno;
 
   fi->fh = fd;
-  it->second.files_wrote.insert(std::move(key.second));
+  job->files_wrote.insert(std::move(key.second));
   return 0;
 }
 
@@ -556,8 +766,8 @@ static int wakefuse_mkdir(const char *path, mode_t mode) {
   auto key = split_key(path);
   if (key.first.empty()) return -EEXIST;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) {
+  auto job = find_job(key.first);
+  if (!job) {
     if (key.second == ".")
       return -EACCES;
     else
@@ -566,9 +776,9 @@ static int wakefuse_mkdir(const char *path, mode_t mode) {
 
   if (key.second == ".") return -EEXIST;
 
-  if (it->second.is_visible(key.second)) return -EEXIST;
+  if (job->is_visible(key.second)) return -EEXIST;
 
-  bool create_new = !it->second.is_writeable(key.second);
+  bool create_new = !job->is_writeable(key.second);
   if (create_new) {
     // Remove any file or link that might be in the way
     int res = unlinkat(context.rootfd, key.second.c_str(), 0);
@@ -583,7 +793,7 @@ static int wakefuse_mkdir(const char *path, mode_t mode) {
 
   if (res == -1) return -errno;
 
-  it->second.files_wrote.insert(std::move(key.second));
+  job->files_wrote.insert(std::move(key.second));
   return 0;
 }
 
@@ -599,20 +809,20 @@ static int wakefuse_unlink(const char *path) {
   auto key = split_key(path);
   if (key.first.empty()) return -EPERM;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EPERM;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
   int res = unlinkat(context.rootfd, key.second.c_str(), 0);
   if (res == -1) return -errno;
 
-  it->second.files_wrote.erase(key.second);
-  it->second.files_read.erase(key.second);
+  job->files_wrote.erase(key.second);
+  job->files_read.erase(key.second);
   return 0;
 }
 
@@ -637,18 +847,18 @@ static int wakefuse_rmdir(const char *path) {
   auto key = split_key(path);
   if (key.first.empty()) return -EACCES;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EACCES;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
   int res = unlinkat(context.rootfd, key.second.c_str(), AT_REMOVEDIR);
   if (res == -1) {
-    if ((errno == ENOTEMPTY) && !has_written_children(key.second, it->second)) {
+    if ((errno == ENOTEMPTY) && !has_written_children(key.second, *job)) {
       // Let the fuse client process believe that the directory was unlinked,
       // even though the underlying filesystem still has a populated directory.
     } else {
@@ -656,8 +866,8 @@ static int wakefuse_rmdir(const char *path) {
     }
   }
 
-  it->second.files_wrote.erase(key.second);
-  it->second.files_read.erase(key.second);
+  job->files_wrote.erase(key.second);
+  job->files_read.erase(key.second);
   return 0;
 }
 
@@ -673,8 +883,8 @@ static int wakefuse_symlink(const char *from, const char *to) {
   auto key = split_key(to);
   if (key.first.empty()) return -EEXIST;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) {
+  auto job = find_job(key.first);
+  if (!job) {
     if (key.second == ".")
       return -EACCES;
     else
@@ -683,14 +893,14 @@ static int wakefuse_symlink(const char *from, const char *to) {
 
   if (key.second == ".") return -EEXIST;
 
-  if (it->second.is_visible(key.second)) return -EEXIST;
+  if (job->is_visible(key.second)) return -EEXIST;
 
-  if (!it->second.is_writeable(key.second)) (void)deep_unlink(context.rootfd, key.second.c_str());
+  if (!job->is_writeable(key.second)) (void)deep_unlink(context.rootfd, key.second.c_str());
 
   int res = symlinkat(from, context.rootfd, key.second.c_str());
   if (res == -1) return -errno;
 
-  it->second.files_wrote.insert(std::move(key.second));
+  job->files_wrote.insert(std::move(key.second));
   return 0;
 }
 
@@ -736,13 +946,13 @@ static int wakefuse_rename(const char *from, const char *to) {
   auto keyf = split_key(from);
   if (keyf.first.empty()) return -EACCES;
 
-  auto it = context.jobs.find(keyf.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(keyf.first);
+  if (!job) return -ENOENT;
 
   if (keyf.second == ".") return -EACCES;
 
   if (keyt.second == ".") {
-    if (context.jobs.find(keyt.first) == context.jobs.end())
+    if (!has_job(keyt.first))
       return -EACCES;
     else
       return -EEXIST;
@@ -750,24 +960,24 @@ static int wakefuse_rename(const char *from, const char *to) {
 
   if (keyt.first != keyf.first) return -EXDEV;
 
-  if (!it->second.is_readable(keyf.second)) return -ENOENT;
+  if (!job->is_readable(keyf.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(keyf.second)) return -EACCES;
+  if (!job->is_writeable(keyf.second)) return -EACCES;
 
-  if (it->second.is_visible(keyt.second)) return -EACCES;
+  if (job->is_visible(keyt.second)) return -EACCES;
 
-  if (!it->second.is_writeable(keyt.second)) (void)deep_unlink(context.rootfd, keyt.second.c_str());
+  if (!job->is_writeable(keyt.second)) (void)deep_unlink(context.rootfd, keyt.second.c_str());
 
   int res = renameat(context.rootfd, keyf.second.c_str(), context.rootfd, keyt.second.c_str());
   if (res == -1) return -errno;
 
-  it->second.files_wrote.erase(keyf.second);
-  it->second.files_read.erase(keyf.second);
-  it->second.files_wrote.insert(keyt.second);
+  job->files_wrote.erase(keyf.second);
+  job->files_read.erase(keyf.second);
+  job->files_wrote.insert(keyt.second);
 
   // Move any children as well
-  move_members(it->second.files_wrote, it->second.files_wrote, keyf.second, keyt.second);
-  move_members(it->second.files_read, it->second.files_wrote, keyf.second, keyt.second);
+  move_members(job->files_wrote, job->files_wrote, keyf.second, keyt.second);
+  move_members(job->files_read, job->files_wrote, keyf.second, keyt.second);
 
   return 0;
 }
@@ -789,13 +999,13 @@ static int wakefuse_link(const char *from, const char *to) {
   auto keyf = split_key(from);
   if (keyf.first.empty()) return -EACCES;
 
-  auto it = context.jobs.find(keyf.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(keyf.first);
+  if (!job) return -ENOENT;
 
   if (keyf.second == ".") return -EACCES;
 
   if (keyt.second == ".") {
-    if (context.jobs.find(keyt.first) == context.jobs.end())
+    if (!has_job(keyt.first))
       return -EACCES;
     else
       return -EEXIST;
@@ -803,18 +1013,21 @@ static int wakefuse_link(const char *from, const char *to) {
 
   if (keyt.first != keyf.first) return -EXDEV;
 
-  if (!it->second.is_readable(keyf.second)) return -ENOENT;
+  if (!job->is_readable(keyf.second)) return -ENOENT;
 
-  if (it->second.is_visible(keyt.second)) return -EEXIST;
+  if (job->is_visible(keyt.second)) return -EEXIST;
 
-  if (!it->second.is_writeable(keyt.second)) (void)deep_unlink(context.rootfd, keyt.second.c_str());
+  if (!job->is_writeable(keyt.second)) (void)deep_unlink(context.rootfd, keyt.second.c_str());
 
   int res = linkat(context.rootfd, keyf.second.c_str(), context.rootfd, keyt.second.c_str(), 0);
   if (res == -1) return -errno;
 
-  hardlinks.insert(std::string(to));
+  {
+    std::unique_lock<std::mutex> lock(hardlinks_mutex);
+    hardlinks.insert(std::string(to));
+  }
 
-  it->second.files_wrote.insert(std::move(keyt.second));
+  job->files_wrote.insert(std::move(keyt.second));
   return 0;
 }
 
@@ -830,14 +1043,14 @@ static int wakefuse_chmod(const char *path, mode_t mode) {
   auto key = split_key(path);
   if (key.first.empty()) return -EACCES;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EACCES;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
 #ifdef __linux__
   // Linux is broken and violates POSIX by returning EOPNOTSUPP even for non-symlinks
@@ -862,14 +1075,14 @@ static int wakefuse_chown(const char *path, uid_t uid, gid_t gid) {
   auto key = split_key(path);
   if (key.first.empty()) return -EACCES;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EACCES;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
   int res = fchownat(context.rootfd, key.second.c_str(), uid, gid, AT_SYMLINK_NOFOLLOW);
   if (res == -1) return -errno;
@@ -888,7 +1101,7 @@ static int wakefuse_truncate(const char *path, off_t size) {
     switch (s.kind) {
       case 'i':
         if (size <= MAX_JSON) {
-          s.job->second.json_in.resize(size);
+          s.job->json_in.resize(size);
           return 0;
         } else {
           return -ENOSPC;
@@ -901,14 +1114,14 @@ static int wakefuse_truncate(const char *path, off_t size) {
   auto key = split_key(path);
   if (key.first.empty()) return -EISDIR;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EISDIR;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
   int fd = openat(context.rootfd, key.second.c_str(), O_WRONLY | O_NOFOLLOW);
   if (fd == -1) return -errno;
@@ -919,7 +1132,7 @@ static int wakefuse_truncate(const char *path, off_t size) {
     (void)close(fd);
     return res;
   } else {
-    it->second.files_wrote.insert(std::move(key.second));
+    job->files_wrote.insert(std::move(key.second));
     (void)close(fd);
     return 0;
   }
@@ -937,19 +1150,19 @@ static int wakefuse_utimens(const char *path, const struct timespec ts[2]) {
   auto key = split_key(path);
   if (key.first.empty()) return -EACCES;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EACCES;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
   int res = wake_utimensat(context.rootfd, key.second.c_str(), ts);
   if (res == -1) return -errno;
 
-  it->second.files_wrote.insert(std::move(key.second));
+  job->files_wrote.insert(std::move(key.second));
   return 0;
 }
 
@@ -964,13 +1177,13 @@ static int wakefuse_open(const char *path, struct fuse_file_info *fi) {
   if (auto s = is_special(path)) {
     switch (s.kind) {
       case 'i':
-        ++s.job->second.json_in_uses;
+        ++s.job->json_in_uses;
         break;
       case 'o':
-        ++s.job->second.json_out_uses;
+        ++s.job->json_out_uses;
         break;
       case 'l':
-        ++s.job->second.uses;
+        ++s.job->uses;
         break;
       case 'f': {
         // This lowers context.should_exit().
@@ -994,20 +1207,27 @@ static int wakefuse_open(const char *path, struct fuse_file_info *fi) {
   auto key = split_key(path);
   if (key.first.empty()) return -EINVAL;  // open is for files only
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EINVAL;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (hardlinks.count(std::string(path))) {
-    fi->direct_io = true;
+  {
+    std::unique_lock<std::mutex> lock(hardlinks_mutex);
+    if (hardlinks.count(std::string(path))) fi->direct_io = true;
   }
 
   int fd = openat(context.rootfd, key.second.c_str(), fi->flags, 0);
   if (fd == -1) return -errno;
 
+  // An input does not change while the job runs, so its pages stay valid
+  if (cache_timeout > 0 && !fi->direct_io && (fi->flags & O_ACCMODE) == O_RDONLY &&
+      !job->is_writeable(key.second)) {
+    fi->keep_cache = 1;
+  }
+
   fi->fh = fd;
   return 0;
 }
@@ -1032,23 +1252,26 @@ static int wakefuse_read(const char *path, char *buf, size_t size, off_t offset,
                          struct fuse_file_info *fi) {
   if (fi->fh != BAD_FD) {
     auto key = split_key(path);
-    auto it = context.jobs.find(key.first);
-    if (it == context.jobs.end()) return -ENOENT;
+    auto job = find_job(key.first);
+    if (!job) return -ENOENT;
 
+    // Other reads of this job need not wait for the data
+    job.lock.unlock();
     int res = pread(fi->fh, buf, size, offset);
     if (res == -1) res = -errno;
+    job.lock.lock();
 
-    it->second.ibytes += res;
-    it->second.files_read.insert(std::move(key.second));
+    job->ibytes += res;
+    job->files_read.insert(std::move(key.second));
     return res;
   }
 
   if (auto s = is_special(path)) {
     switch (s.kind) {
       case 'i':
-        return read_str(s.job->second.json_in, buf, size, offset);
+        return read_str(s.job->json_in, buf, size, offset);
       case 'o':
-        return read_str(s.job->second.json_out, buf, size, offset);
+        return read_str(s.job->json_out, buf, size, offset);
       default:
         return 0;
     }
@@ -1065,6 +1288,69 @@ static int wakefuse_read_trace(const char *path, char *buf, size_t size, off_t o
   return out;
 }
 
+#ifdef HAVE_KERNEL_CACHE
+// Like wakefuse_read, but hands libfuse the file and offset rather than the
+// data, so that it can splice the data to the kernel without copying it.
+static int wakefuse_read_buf(const char *path, struct fuse_bufvec **bufp, size_t size,
+                             off_t offset, struct fuse_file_info *fi) {
+  struct fuse_bufvec *bv = (struct fuse_bufvec *)malloc(sizeof(struct fuse_bufvec));
+  if (!bv) return -ENOMEM;
+  *bv = FUSE_BUFVEC_INIT(size);
+
+  if (fi->fh == BAD_FD) {
+    // libfuse frees this along with bv
+    char *mem = (char *)malloc(size);
+    if (!mem) {
+      free(bv);
+      return -ENOMEM;
+    }
+    int res = wakefuse_read(path, mem, size, offset, fi);
+    if (res < 0) {
+      free(mem);
+      free(bv);
+      return res;
+    }
+    bv->buf[0].mem = mem;
+    bv->buf[0].size = res;
+    *bufp = bv;
+    return 0;
+  }
+
+  // libfuse reads no further than the end of the file
+  struct stat st;
+  if (fstat(fi->fh, &st) == -1) {
+    int res = -errno;
+    free(bv);
+    return res;
+  }
+  off_t left = st.st_size > offset ? st.st_size - offset : 0;
+
+  auto key = split_key(path);
+  auto job = find_job(key.first);
+  if (!job) {
+    free(bv);
+    return -ENOENT;
+  }
+
+  job->ibytes += std::min((off_t)size, left);
+  job->files_read.insert(std::move(key.second));
+
+  bv->buf[0].flags = (enum fuse_buf_flags)(FUSE_BUF_IS_FD | FUSE_BUF_FD_SEEK);
+  bv->buf[0].fd = fi->fh;
+  bv->buf[0].pos = offset;
+  *bufp = bv;
+  return 0;
+}
+
+static int wakefuse_read_buf_trace(const char *path, struct fuse_bufvec **bufp, size_t size,
+                                   off_t offset, struct fuse_file_info *fi) {
+  int out = wakefuse_read_buf(path, bufp, size, offset, fi);
+  fprintf(stderr, "read_buf(%s, %lu, %lld) = %s\n", path, (unsigned long)size,
+          (long long)offset, trace_out(out));
+  return out;
+}
+#endif
+
 static int write_str(std::string &str, const char *buf, size_t size, off_t offset) {
   if (offset >= MAX_JSON) {
     return 0;
@@ -1081,24 +1367,26 @@ static int wakefuse_write(const char *path, const char *buf, size_t size, off_t
                           struct fuse_file_info *fi) {
   if (fi->fh != BAD_FD) {
     auto key = split_key(path);
-    auto it = context.jobs.find(key.first);
-    if (it == context.jobs.end()) return -ENOENT;
+    auto job = find_job(key.first);
+    if (!job) return -ENOENT;
 
-    if (!it->second.is_writeable(key.second)) return -EACCES;
+    if (!job->is_writeable(key.second)) return -EACCES;
 
+    job.lock.unlock();
     int res = pwrite(fi->fh, buf, size, offset);
     if (res == -1) res = -errno;
+    job.lock.lock();
 
-    it->second.obytes += res;
+    job->obytes += res;
     return res;
   }
 
   if (auto s = is_special(path)) {
     switch (s.kind) {
       case 'i':
-        return write_str(s.job->second.json_in, buf, size, offset);
+        return write_str(s.job->json_in, buf, size, offset);
       case 'l':
-        s.job->second.dump();
+        s.job->dump();
         return -ENOSPC;
       default:
         return -EACCES;
@@ -1122,12 +1410,12 @@ static int wakefuse_statfs(const char *path, struct statvfs *stbuf) {
   if (key.first.empty() || is_special(path)) {
     fd = dup(context.rootfd);
   } else {
-    auto it = context.jobs.find(key.first);
-    if (it == context.jobs.end()) {
+    auto job = find_job(key.first);
+    if (!job) {
       return -ENOENT;
     } else if (key.second == ".") {
       fd = dup(context.rootfd);
-    } else if (!it->second.is_readable(key.second)) {
+    } else if (!job->is_readable(key.second)) {
       return -ENOENT;
     } else {
       fd = openat(context.rootfd, key.second.c_str(), O_RDONLY | O_NOFOLLOW);
@@ -1164,18 +1452,18 @@ static int wakefuse_release(const char *path, struct fuse_file_info *fi) {
         --context.uses;
         break;
       case 'i':
-        if (--s.job->second.json_in_uses == 0) s.job->second.parse();
+        if (--s.job->json_in_uses == 0) s.job->parse();
         break;
       case 'o':
-        --s.job->second.json_out_uses;
+        --s.job->json_out_uses;
         break;
       case 'l':
-        --s.job->second.uses;
+        --s.job->uses;
         break;
       default:
         return -EIO;
     }
-    if ('f' != s.kind && s.job->second.should_erase()) context.jobs.erase(s.job);
+    if ('f' != s.kind && s.job->should_erase()) erase_job(path + 4, s.job);
     if (context.should_exit()) schedule_exit();
   }
 
@@ -1225,14 +1513,14 @@ static int wakefuse_fallocate(const char *path, int mode, off_t offset, off_t le
   auto key = split_key(path);
   if (key.first.empty()) return -EISDIR;
 
-  auto it = context.jobs.find(key.first);
-  if (it == context.jobs.end()) return -ENOENT;
+  auto job = find_job(key.first);
+  if (!job) return -ENOENT;
 
   if (key.second == ".") return -EISDIR;
 
-  if (!it->second.is_readable(key.second)) return -ENOENT;
+  if (!job->is_readable(key.second)) return -ENOENT;
 
-  if (!it->second.is_writeable(key.second)) return -EACCES;
+  if (!job->is_writeable(key.second)) return -EACCES;
 
   int fd = openat(context.rootfd, key.second.c_str(), O_WRONLY | O_NOFOLLOW);
   if (fd == -1) return -errno;
@@ -1242,7 +1530,7 @@ static int wakefuse_fallocate(const char *path, int mode, off_t offset, off_t le
     (void)close(fd);
     return -res;
   } else {
-    it->second.files_wrote.insert(std::move(key.second));
+    job->files_wrote.insert(std::move(key.second));
     (void)close(fd);
     return 0;
   }
@@ -1259,14 +1547,35 @@ static int wakefuse_fallocate_trace(const char *path, int mode, off_t offset, of
 
 static std::string path;
 static struct fuse *fh;
-static struct fuse_chan *fc;
 static sigset_t saved;
+static bool multithreaded;
 
 static struct fuse_operations wakefuse_ops;
 
 static void *wakefuse_init(struct fuse_conn_info *conn) {
-  // unblock signals
-  sigprocmask(SIG_SETMASK, &saved, 0);
+  // Before signals are unblocked, so that none are handled on its thread
+  start_forgetting();
+
+#ifdef HAVE_KERNEL_CACHE
+  if (cache_timeout > 0) {
+    if (conn->capable & FUSE_CAP_SPLICE_READ) conn->want |= FUSE_CAP_SPLICE_READ;
+    // Drop cached pages anyway if a file's size or mtime changes
+    if (conn->capable & FUSE_CAP_AUTO_INVAL_DATA) conn->want |= FUSE_CAP_AUTO_INVAL_DATA;
+  }
+#endif
+
+  if (multithreaded) {
+    // fuse_loop_mt blocks all signals in its workers, so give them a thread
+    // of their own. This also keeps handle_exit from ever interrupting a
+    // worker in the middle of a request.
+    std::thread([] {
+      pthread_sigmask(SIG_SETMASK, &saved, 0);
+      for (;;) pause();
+    }).detach();
+  } else {
+    // unblock signals
+    sigprocmask(SIG_SETMASK, &saved, 0);
+  }
 
   return 0;
 }
@@ -1321,7 +1630,7 @@ static void handle_exit(int sig) {
       gettimeofday(&now, nullptr);
       double waited = (now.tv_sec - start.tv_sec) + (now.tv_usec - start.tv_usec) / 1000000.0;
       fprintf(stderr, "Unable to umount on attempt %d, %.1fs after we started to shutdown\n",
-              exit_attempts, waited);
+              exit_attempts.load(), waited);
     }
   }
 
@@ -1369,6 +1678,12 @@ static void handle_exit(int sig) {
 
 int main(int argc, char *argv[]) {
   bool debug = getenv("DEBUG_FUSE_WAKE");
+  // With MULTI_THREAD_FUSE_WAKE, requests from all the jobs on this host are
+  // served in parallel. It stays opt-in until it has been measured to help.
+  multithreaded = getenv("MULTI_THREAD_FUSE_WAKE");
+#ifdef HAVE_KERNEL_CACHE
+  if (const char *cache = getenv("CACHE_FUSE_WAKE")) cache_timeout = atoi(cache);
+#endif
 
   wakefuse_ops.init = wakefuse_init;
   wakefuse_ops.getattr = debug ? wakefuse_getattr_trace : wakefuse_getattr;
@@ -1389,6 +1704,11 @@ int main(int argc, char *argv[]) {
   wakefuse_ops.utimens = debug ? wakefuse_utimens_trace : wakefuse_utimens;
   wakefuse_ops.open = debug ? wakefuse_open_trace : wakefuse_open;
   wakefuse_ops.read = debug ? wakefuse_read_trace : wakefuse_read;
+#ifdef HAVE_KERNEL_CACHE
+  if (cache_timeout > 0) {
+    wakefuse_ops.read_buf = debug ? wakefuse_read_buf_trace : wakefuse_read_buf;
+  }
+#endif
   wakefuse_ops.write = debug ? wakefuse_write_trace : wakefuse_write;
   wakefuse_ops.statfs = debug ? wakefuse_statfs_trace : wakefuse_statfs;
   wakefuse_ops.release = debug ? wakefuse_release_trace : wakefuse_release;
@@ -1557,6 +1877,16 @@ int main(int argc, char *argv[]) {
     goto rmroot;
   }
 
+  if (cache_timeout > 0) {
+    std::string timeout = std::to_string(cache_timeout);
+    std::string opts =
+        "-oentry_timeout=" + timeout + ",negative_timeout=" + timeout + ",attr_timeout=" + timeout;
+    if (fuse_opt_add_arg(&args, opts.c_str()) != 0) {
+      fprintf(stderr, "fuse_opt_add_arg cache failed\n");
+      goto rmroot;
+    }
+  }
+
   fc = fuse_mount(path.c_str(), &args);
   if (!fc) {
     fprintf(stderr, "fuse_mount failed\n");
@@ -1579,7 +1909,7 @@ int main(int argc, char *argv[]) {
     close(null);
   }
 
-  if (fuse_loop(fh) != 0) {
+  if ((multithreaded ? fuse_loop_mt(fh) : fuse_loop(fh)) != 0) {
     fprintf(stderr, "fuse_loop failed");
     goto unmount;
   }
@@ -1588,8 +1918,17 @@ int main(int argc, char *argv[]) {
 
   // Block signals again
   sigprocmask(SIG_BLOCK, &block, 0);
+  if (multithreaded) {
+    // The signal thread from wakefuse_init still accepts them
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGINT, &sa, 0);
+    sigaction(SIGQUIT, &sa, 0);
+    sigaction(SIGTERM, &sa, 0);
+    sigaction(SIGALRM, &sa, 0);
+  }
 
 unmount:
+  stop_forgetting();
   // out-of-order completion: unmount THEN destroy
   fuse_unmount(path.c_str(), fc);
   if (fh) fuse_destroy(fh);
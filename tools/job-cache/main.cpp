@@ -23,6 +23,8 @@
 #include <json/json5.h>
 #include <wcl/tracing.h>
 
+#include <thread>
+
 // TODO: It would be nice if this could be wcl::optional<const V&> but wcl::optional does
 // not play nice with references at this point in time. We might want to explicitly
 // special case that at some point to gain that very powerful feature. It can be optimized
@@ -90,13 +92,15 @@ int main(int argc, char** argv) {
   Argument low_cache_size("--low-cache-size");
   Argument max_cache_size("--max-cache-size");
   Argument seconds_to_live("--seconds-to-live");
+  Argument worker_threads("--worker-threads");
   ArgParser parser;
   parser.arg(cache_dir)
       .arg(bulk_logging_dir)
       .arg(eviction_policy)
       .arg(low_cache_size)
       .arg(max_cache_size)
-      .arg(seconds_to_live);
+      .arg(seconds_to_live)
+      .arg(worker_threads);
 
   parser.parse(argc, argv);
 
@@ -153,10 +157,22 @@ int main(int argc, char** argv) {
     }
   }
 
+  // By default serve one read per core
+  size_t num_workers = std::thread::hardware_concurrency();
+  if (worker_threads.value) {
+    try {
+      num_workers = std::stoul(*worker_threads.value);
+    } catch (...) {
+      std::cerr << "`" << *worker_threads.value << "` is not a valid number of threads"
+                << std::endl;
+      return 1;
+    }
+  }
+
   int status = 1;
   {
     job_cache::DaemonCache dcache(std::move(*cache_dir.value), std::move(*bulk_logging_dir.value),
-                                  config);
+                                  config, num_workers);
     status = dcache.run();
   }
 
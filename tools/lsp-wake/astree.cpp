@@ -18,11 +18,14 @@
 
 #include "astree.h"
 
+#include <wcl/tracing.h>
+
 #include <algorithm>
 #include <cassert>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <set>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -55,12 +58,6 @@ void ASTree::recordComments(CSTElement def, int level) {
 }
 
 void ASTree::diagnoseProject(const std::function<void(FileDiagnostics &)> &processFileDiagnostics) {
-  usages.clear();
-  definitions.clear();
-  types.clear();
-  packages.clear();
-  comments.clear();
-
   bool enumok = true;
   auto allFiles = find_all_wakefiles(enumok, true, false, absLibDir, absWorkDir, stdout, false);
 
@@ -68,13 +65,10 @@ void ASTree::diagnoseProject(const std::function<void(FileDiagnostics &)> &proce
   LSPReporter lspReporter(diagnostics, allFiles);
   reporter = &lspReporter;
 
-  std::unique_ptr<Top> top(new Top);
-  top->def_package = "nothing";
-  top->body = std::unique_ptr<Expr>(new VarRef(FRAGMENT_CPP_LINE, "Nil@wake"));
-
   std::vector<ExternalFile> externalFiles;
   externalFiles.reserve(allFiles.size());
 
+  std::vector<std::pair<std::string, FileContent *>> contents;
   for (auto &filename : allFiles) {
     auto it = changedFiles.find(filename);
     FileContent *fcontent;
@@ -86,31 +80,214 @@ void ASTree::diagnoseProject(const std::function<void(FileDiagnostics &)> &proce
     } else {
       fcontent = it->second.get();
     }
+    contents.emplace_back(filename, fcontent);
+  }
+
+  // A file that could not be read has nothing to fingerprint, so nothing is reused
+  bool readok = std::all_of(diagnostics.begin(), diagnostics.end(),
+                            [](const FileDiagnostics &d) { return d.second.empty(); });
 
-    CST cst(*fcontent, lspReporter);
-    dst_top(cst.root(), *top);
-    recordComments(cst.root(), 0);
+  std::set<std::string> present(allFiles.begin(), allFiles.end());
+  for (auto it = files.begin(); it != files.end();) {
+    it = present.count(it->first) ? std::next(it) : files.erase(it);
   }
-  flatten_exports(*top);
+  for (auto &content : contents) updateFileInfo(content.first, *content.second);
+  reporter = &lspReporter;
+
+  std::map<std::string, std::vector<std::string>> packageFiles;
+  std::set<std::string> globalPackages;
+  for (auto &file : files) {
+    packageFiles[file.second.package].push_back(file.first);
+    if (file.second.global) globalPackages.insert(file.second.package);
+  }
+
+  // Every package can see the globals, so the packages that define them are everyone's dependency
+  std::map<std::string, std::set<std::string>> dependencies;
+  for (auto &file : files) {
+    auto &deps = dependencies[file.second.package];
+    for (auto &imp : file.second.imports)
+      if (packageFiles.count(imp)) deps.insert(imp);
+    deps.insert(globalPackages.begin(), globalPackages.end());
+  }
+
+  // A package, with all the packages it depends on directly or not
+  std::map<std::string, std::set<std::string>> closures;
+  for (auto &package : packageFiles) {
+    auto &closure = closures[package.first];
+    std::vector<std::string> todo = {package.first};
+    while (!todo.empty()) {
+      std::string next = std::move(todo.back());
+      todo.pop_back();
+      if (!closure.insert(next).second) continue;
+      for (auto &dep : dependencies[next]) todo.push_back(dep);
+    }
+  }
+
+  std::map<std::string, Hash> fingerprints;
+  for (auto &package : packageFiles) {
+    std::vector<uint64_t> codes;
+    for (auto &filename : package.second) {
+      Hash(filename).push(codes);
+      files[filename].fingerprint.push(codes);
+    }
+    fingerprints[package.first] = Hash(codes);
+  }
+
+  // Check the packages whose own files or whose dependencies changed since their last check, and
+  // parse everything those depend on so that their imports can be bound
+  std::map<std::string, Hash> keys;
+  std::set<std::string> rechecked, parsed;
+  for (auto &package : packageFiles) {
+    std::vector<uint64_t> codes;
+    for (auto &dep : closures[package.first]) fingerprints[dep].push(codes);
+    Hash key(codes);
+    keys[package.first] = key;
+
+    auto it = packageResults.find(package.first);
+    if (!readok || it == packageResults.end() || !(it->second.key == key)) {
+      rechecked.insert(package.first);
+      parsed.insert(closures[package.first].begin(), closures[package.first].end());
+    }
+  }
+
+  for (auto it = packageResults.begin(); it != packageResults.end();) {
+    it = packageFiles.count(it->first) ? std::next(it) : packageResults.erase(it);
+  }
+  wcl::log::info("Checking %zu of %zu packages", rechecked.size(), packageFiles.size())();
+
+  usages.clear();
+  definitions.clear();
+  types.clear();
+  packages.clear();
+  comments.clear();
+
+  if (!rechecked.empty()) {
+    std::unique_ptr<Top> top(new Top);
+    top->def_package = "nothing";
+    top->body = std::unique_ptr<Expr>(new VarRef(FRAGMENT_CPP_LINE, "Nil@wake"));
 
-  for (auto &p : top->packages) {
-    for (auto &f : p.second->files) {
-      packages.emplace_back(
-          SymbolDefinition(p.first, f.content->fragment.location(), "Package", KIND_PACKAGE, true));
+    for (auto &content : contents) {
+      if (!parsed.count(files[content.first].package)) continue;
+      CST cst(*content.second, lspReporter);
+      dst_top(cst.root(), *top);
+      recordComments(cst.root(), 0);
     }
+    flatten_exports(*top);
+
+    for (auto &p : top->packages) {
+      for (auto &f : p.second->files) {
+        packages.emplace_back(SymbolDefinition(p.first, f.content->fragment.location(), "Package",
+                                               KIND_PACKAGE, true));
+      }
+    }
+
+    PrimMap pmap = prim_register_internal();
+    bool isTreeBuilt = true;
+    std::unique_ptr<Expr> root = bind_refs(std::move(top), pmap, isTreeBuilt);
+
+    if (root != nullptr) explore(root.get(), true);
+
+    fillDefinitionDocumentationFields();
   }
 
-  PrimMap pmap = prim_register_internal();
-  bool isTreeBuilt = true;
-  std::unique_ptr<Expr> root = bind_refs(std::move(top), pmap, isTreeBuilt);
+  mergeResults(rechecked, diagnostics);
+  for (auto &package : rechecked) {
+    // Until every file can be read again, check everything each time
+    packageResults[package].key = readok ? keys[package] : Hash();
+  }
 
   for (auto &diagnosticEntry : diagnostics) {
     processFileDiagnostics(diagnosticEntry);
   }
+}
 
-  if (root != nullptr) explore(root.get(), true);
+void ASTree::updateFileInfo(const std::string &filename, FileContent &content) {
+  StringSegment ss = content.segment();
+  Hash fingerprint(ss.start, ss.size());
+  auto it = files.find(filename);
+  if (it != files.end() && it->second.fingerprint == fingerprint) return;
+
+  // Problems in the file are reported when its package is checked
+  std::map<std::string, std::vector<Diagnostic>> ignored;
+  LSPReporter scratchReporter(ignored, {});
+  reporter = &scratchReporter;
+  Top top;
+  // Leave out the builtin types, which every Top starts with, to see only this file's globals
+  top.globals = Symbols();
+  CST cst(content, scratchReporter);
+  const char *name = dst_top(cst.root(), top);
+
+  FileInfo &info = files[filename];
+  info.fingerprint = fingerprint;
+  info.package = name;
+  info.imports.clear();
+  const Imports &imports = top.packages[name]->files.back().content->imports;
+  for (auto &all : imports.import_all) info.imports.insert(all.first);
+  for (auto *symbols : {&imports.mixed, &imports.defs, &imports.types, &imports.topics}) {
+    for (auto &symbol : *symbols) {
+      size_t at = symbol.second.qualified.rfind('@');
+      if (at != std::string::npos) info.imports.insert(symbol.second.qualified.substr(at + 1));
+    }
+  }
+  info.imports.erase(info.package);
+  info.global =
+      !top.globals.defs.empty() || !top.globals.types.empty() || !top.globals.topics.empty();
+}
 
-  fillDefinitionDocumentationFields();
+// Diagnostics can't be assigned, only copied
+static void replaceDiagnostics(std::map<std::string, std::vector<Diagnostic>> &diagnostics,
+                               const ASTree::FileDiagnostics &entry) {
+  diagnostics.erase(entry.first);
+  diagnostics.emplace(entry);
+}
+
+void ASTree::mergeResults(const std::set<std::string> &rechecked,
+                          std::map<std::string, std::vector<Diagnostic>> &diagnostics) {
+  // Only keep what this check found in the packages it was for
+  std::map<std::string, PackageResults> found;
+  auto resultsFor = [&](const std::string &filename) -> PackageResults * {
+    auto it = files.find(filename);
+    if (it == files.end() || !rechecked.count(it->second.package)) return nullptr;
+    return &found[it->second.package];
+  };
+
+  for (auto &def : definitions)
+    if (auto *results = resultsFor(def.location.filename)) results->definitions.push_back(def);
+  for (auto &use : usages)
+    if (auto *results = resultsFor(use.usage.filename)) results->usages.push_back(use);
+  for (auto &p : packages)
+    if (auto *results = resultsFor(p.location.filename)) results->packages.push_back(p);
+  for (auto &comment : comments)
+    if (auto *results = resultsFor(comment.first.filename)) results->comments.push_back(comment);
+
+  if (!rechecked.empty()) otherDiagnostics.clear();
+  for (auto &entry : diagnostics) {
+    auto it = files.find(entry.first);
+    if (it == files.end()) {
+      if (!rechecked.empty()) otherDiagnostics.emplace(entry);
+    } else if (rechecked.count(it->second.package)) {
+      found[it->second.package].diagnostics.emplace(entry);
+    }
+  }
+
+  for (auto &package : rechecked) {
+    packageResults[package] = std::move(found[package]);
+  }
+
+  // Put the results of every package back together
+  definitions.clear();
+  usages.clear();
+  packages.clear();
+  comments.clear();
+  for (auto &entry : otherDiagnostics) replaceDiagnostics(diagnostics, entry);
+  for (auto &package : packageResults) {
+    PackageResults &results = package.second;
+    definitions.insert(definitions.end(), results.definitions.begin(), results.definitions.end());
+    usages.insert(usages.end(), results.usages.begin(), results.usages.end());
+    packages.insert(packages.end(), results.packages.begin(), results.packages.end());
+    comments.insert(results.comments.begin(), results.comments.end());
+    for (auto &entry : results.diagnostics) replaceDiagnostics(diagnostics, entry);
+  }
 }
 
 Location ASTree::findDefinitionLocation(const Location &locationToDefine) {
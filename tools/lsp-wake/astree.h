@@ -31,6 +31,7 @@
 #include "dst/expr.h"
 #include "symbol_definition.h"
 #include "util/diagnostic.h"
+#include "util/hash.h"
 
 class ASTree {
  public:
@@ -103,6 +104,34 @@ class ASTree {
   std::vector<SymbolDefinition> packages;
   std::unordered_map<LineLocation, Comment, HashLineLocation, EqualLineLocation> comments;
 
+  // The package a wake file belongs to and the packages it needs, kept while its content is
+  // unchanged so that only edited files are parsed to work out what needs to be checked again
+  struct FileInfo {
+    Hash fingerprint;
+    std::string package;
+    std::set<std::string> imports;
+    bool global;  // defines globals, which every package can see
+  };
+
+  // What the last check found in the files of one package, reused while neither the package nor
+  // any package it depends on changes. The key covers the fingerprints of all of them.
+  struct PackageResults {
+    Hash key;
+    std::vector<SymbolDefinition> definitions;
+    std::vector<SymbolUsage> usages;
+    std::vector<SymbolDefinition> packages;
+    std::vector<std::pair<LineLocation, Comment>> comments;
+    std::map<std::string, std::vector<Diagnostic>> diagnostics;
+  };
+
+  std::map<std::string, FileInfo> files;
+  std::map<std::string, PackageResults> packageResults;
+  std::map<std::string, std::vector<Diagnostic>> otherDiagnostics;  // not in any wake file
+
+  void updateFileInfo(const std::string &filename, FileContent &content);
+  void mergeResults(const std::set<std::string> &rechecked,
+                    std::map<std::string, std::vector<Diagnostic>> &diagnostics);
+
   class LSPReporter : public DiagnosticReporter {
    private:
     std::map<std::string, std::vector<Diagnostic>> &diagnostics;
@@ -385,14 +385,15 @@ TEST_FUNC(void, fuzz_loop, const FuzzLoopConfig& config, bool lru, wcl::xoshiro_
   job_cache::EvictionConfig lru_config = job_cache::EvictionConfig::lru_config(low_size, max_size);
   job_cache::EvictionConfig ttl_config = job_cache::EvictionConfig::ttl_config(seconds_to_live);
   job_cache::TimeoutConfig tconfig;
-  job_cache::Cache cache(config.cache_dir, "", (lru ? lru_config : ttl_config), tconfig, false);
+  job_cache::Cache cache(config.cache_dir, "", (lru ? lru_config : ttl_config),
+                         job_cache::MaterializePolicy::Copy, 0, tconfig, false);
 
   std::string out_dir = wcl::join_paths(config.dir, "outputs");
   for (size_t i = 0; i < config.number_of_steps; ++i) {
     // First find the job that we care about
     const TestJob& job = job_pool.step(gen, config);
     auto find_job_request = job.generate_find_request(out_dir);
-    auto result = cache.read(find_job_request);
+    auto result = cache.read(std::move(find_job_request));
     if (result.match) {
       for (auto file : job.output_files) {
         std::ifstream t(wcl::join_paths(out_dir, file.path));
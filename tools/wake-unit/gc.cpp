@@ -0,0 +1,214 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <wcl/xoshiro_256.h>
+
+#include <deque>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "runtime/gc.h"
+#include "runtime/value.h"
+#include "unit.h"
+
+// A graph node which may point at other nodes, a string, and a finalized leaf
+struct Node final : public GCObject<Node, Value> {
+  long id;
+  HeapPointer<Node> left;
+  HeapPointer<Node> right;
+  HeapPointer<String> name;
+  HeapPointer<HeapObject> leaf;
+
+  Node(long id_, String *name_) : id(id_), name(name_) {}
+
+  template <typename T, T (HeapPointerBase::*memberfn)(T x)>
+  T recurse(T arg) {
+    arg = Value::recurse<T, memberfn>(arg);
+    arg = (left.*memberfn)(arg);
+    arg = (right.*memberfn)(arg);
+    arg = (name.*memberfn)(arg);
+    arg = (leaf.*memberfn)(arg);
+    return arg;
+  }
+
+  void format(std::ostream &os, FormatState &state) const override { os << "Node"; }
+  Hash shallow_hash() const override { return Hash(); }
+};
+
+// A DestroyableObject which counts how many of its kind are alive
+struct Leaf final : public GCObject<Leaf, DestroyableObject> {
+  typedef GCObject<Leaf, DestroyableObject> Parent;
+  static long live;
+
+  long id;
+  std::vector<long> payload;
+
+  Leaf(Heap &h, long id_) : Parent(h), id(id_), payload(3, id_) { ++live; }
+  Leaf(Leaf &&l) : Parent(std::move(l)), id(l.id), payload(std::move(l.payload)) { ++live; }
+  ~Leaf() { --live; }
+
+  void format(std::ostream &os, FormatState &state) const override { os << "Leaf"; }
+  Hash shallow_hash() const override { return Hash(); }
+};
+
+long Leaf::live = 0;
+
+static const size_t node_pads = Node::reserve() + String::reserve(24) + Leaf::reserve();
+
+// Add 'count' nodes with random edges to the heap; the roots keep a few of them alive.
+// Space for them must have been reserved.
+static void grow(Heap &h, std::deque<RootPointer<Node>> &roots, std::vector<Node *> &nodes,
+                 wcl::xoshiro_256 &rng, long count) {
+  std::uniform_int_distribution<int> coin(0, 3);
+  std::uniform_int_distribution<int> length(0, 24);
+  for (long i = 0; i < count; ++i) {
+    long id = nodes.size();
+    std::string name(length(rng), 'a' + id % 26);
+    Node *node = Node::claim(h, id, String::claim(h, name));
+    if (coin(rng) == 0) node->leaf = Leaf::claim(h, h, id);
+    if (!nodes.empty()) {
+      std::uniform_int_distribution<size_t> pick(0, nodes.size() - 1);
+      // Mostly point to older nodes, but also make some cycles
+      if (coin(rng) != 0) node->left = nodes[pick(rng)];
+      if (coin(rng) != 0) node->right = nodes[pick(rng)];
+      if (coin(rng) == 0) nodes[pick(rng)]->right = node;
+    }
+    nodes.push_back(node);
+  }
+  for (int i = 0; i < 8; ++i) {
+    std::uniform_int_distribution<size_t> pick(0, nodes.size() - 1);
+    roots.emplace_back(h.root(nodes[pick(rng)]));
+  }
+}
+
+// Describe the graph reachable from the roots, independent of where objects live
+static std::string describe(const std::deque<RootPointer<Node>> &roots, long *leaves) {
+  std::unordered_map<const Node *, long> index;
+  std::vector<const Node *> order;
+  auto visit = [&](const Node *n) -> long {
+    if (!n) return -1;
+    auto it = index.insert(std::make_pair(n, static_cast<long>(order.size())));
+    if (it.second) order.push_back(n);
+    return it.first->second;
+  };
+
+  std::stringstream ss;
+  for (auto &r : roots) ss << visit(r.get()) << " ";
+  *leaves = 0;
+  for (size_t i = 0; i < order.size(); ++i) {
+    const Node *n = order[i];
+    ss << n->id << ":" << visit(n->left.get()) << "," << visit(n->right.get()) << ","
+       << n->name->as_str();
+    if (n->leaf) {
+      const Leaf *leaf = static_cast<const Leaf *>(n->leaf.get());
+      ss << "," << leaf->id << "/" << leaf->payload.size();
+      ++*leaves;
+    }
+    ss << std::endl;
+  }
+  return ss.str();
+}
+
+// Build and mutate a random graph, collecting after every step, and return the final shape
+TEST_FUNC(std::string, gc_stress, int threads, size_t nursery_bytes) {
+  std::string out;
+  {
+    uint64_t seedV = 0xfeedfacecafebeef;
+    std::tuple<uint64_t, uint64_t, uint64_t, uint64_t> seed = {seedV, seedV, seedV, seedV};
+    wcl::xoshiro_256 rng(seed);
+    Heap h(0, 4.0, nursery_bytes, threads);
+    std::deque<RootPointer<Node>> roots;
+
+    for (int round = 0; round < 6; ++round) {
+      long count = 20000;
+      h.guarantee(count * node_pads);
+      // Only the roots survived the last collection
+      std::vector<Node *> nodes;
+      for (auto &r : roots) nodes.push_back(r.get());
+      grow(h, roots, nodes, rng, count);
+
+      // Drop some roots, so there is garbage to find
+      if (round % 2 == 1)
+        for (size_t i = roots.size() / 3; i > 0; --i) roots.pop_front();
+
+      long before, after;
+      std::string expect = describe(roots, &before);
+      h.GC(0);
+      std::string actual = describe(roots, &after);
+      EXPECT_EQUAL(expect, actual);
+      EXPECT_EQUAL(before, after);
+      // Unreachable leaves are destroyed, except tenured ones which wait for a major collection
+      h.GC(0);
+      if (!nursery_bytes) EXPECT_EQUAL(after, Leaf::live);
+      out = actual;
+    }
+    roots.clear();
+  }
+  EXPECT_EQUAL(0, Leaf::live);
+  return out;
+}
+
+TEST(gc_parallel_matches_serial) {
+  std::string serial = TEST_FUNC_CALL(gc_stress, 1, 0);
+  std::string parallel = TEST_FUNC_CALL(gc_stress, 4, 0);
+  EXPECT_FALSE(serial.empty());
+  EXPECT_EQUAL(serial, parallel);
+}
+
+TEST(gc_parallel_generational) {
+  std::string serial = TEST_FUNC_CALL(gc_stress, 1, 1024 * 1024);
+  std::string parallel = TEST_FUNC_CALL(gc_stress, 8, 1024 * 1024);
+  EXPECT_FALSE(serial.empty());
+  EXPECT_EQUAL(serial, parallel);
+}
+
+// The --profile-heap side table follows objects as they are copied.
+// Ages count the collections which copied an object, so minor collections skip tenured objects.
+TEST_FUNC(void, gc_age_tracking, size_t nursery_bytes, uint32_t old_age, uint32_t young_age) {
+  HeapAgeTracker::initTracker(true);
+  uint32_t site = HeapAgeTracker::registerSite("gc_age_tracking");
+  {
+    Heap h(0, 4.0, nursery_bytes, 1);
+    h.guarantee(2 * node_pads);
+    HeapAgeTracker::setSite(site);
+    RootPointer<Node> old = h.root(Node::claim(h, 0, String::claim(h, "old")));
+    HeapAgeTracker::setSite(0);
+    EXPECT_EQUAL(0u, HeapAgeTracker::getAge(old.get()));
+    EXPECT_EQUAL(site, HeapAgeTracker::getSite(old.get()));
+
+    h.GC(node_pads);
+    h.guarantee(node_pads);
+    RootPointer<Node> young = h.root(Node::claim(h, 1, String::claim(h, "young")));
+    h.GC(0);
+    h.GC(0);
+
+    EXPECT_EQUAL(old_age, HeapAgeTracker::getAge(old.get()));
+    EXPECT_EQUAL(site, HeapAgeTracker::getSite(old.get()));
+    EXPECT_EQUAL(old_age, HeapAgeTracker::getAge(old->name.get()));
+    EXPECT_EQUAL(young_age, HeapAgeTracker::getAge(young.get()));
+    EXPECT_EQUAL(0u, HeapAgeTracker::getSite(young.get()));
+  }
+  HeapAgeTracker::initTracker(false);
+}
+
+TEST(gc_age_tracking) {
+  TEST_FUNC_CALL(gc_age_tracking, 0, 3u, 2u);
+  TEST_FUNC_CALL(gc_age_tracking, 1024 * 1024, 1u, 1u);
+}
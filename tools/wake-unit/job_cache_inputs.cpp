@@ -0,0 +1,192 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "job_cache/bloom.h"
+#include "job_cache/input_manifest.h"
+#include "unit.h"
+
+static std::vector<Hash256> make_hashes(const std::string& prefix, size_t count) {
+  std::vector<Hash256> out;
+  for (size_t i = 0; i < count; ++i) out.push_back(Hash256::blake2b(prefix + std::to_string(i)));
+  return out;
+}
+
+TEST(job_cache_bloom_round_trip) {
+  BloomFilter bloom;
+  for (const auto& hash : make_hashes("input", 20)) bloom.add_hash(hash);
+  EXPECT_EQUAL(BloomFilter::bits / 8, bloom.size());
+
+  BloomFilter copy = BloomFilter::from_data(bloom.data(), bloom.size());
+  EXPECT_TRUE(memcmp(bloom.data(), copy.data(), bloom.size()) == 0);
+  EXPECT_TRUE(copy.is_subset_of(bloom));
+  EXPECT_TRUE(bloom.is_subset_of(copy));
+
+  // A filter of the wrong width, like the 64-bit integers of old caches,
+  // reads back as full so it only matches a request that is full too
+  int64_t legacy = 0x1234;
+  BloomFilter full = BloomFilter::from_data(&legacy, sizeof(legacy));
+  EXPECT_FALSE(full.is_subset_of(bloom));
+  EXPECT_TRUE(bloom.is_subset_of(full));
+  EXPECT_TRUE(full.is_subset_of(full));
+}
+
+TEST(job_cache_bloom_no_false_negatives) {
+  // A job whose inputs are among the request's visible files must always
+  // pass, whichever of them it read
+  std::vector<Hash256> visible = make_hashes("visible", 500);
+  BloomFilter request;
+  for (const auto& hash : visible) request.add_hash(hash);
+
+  for (size_t stride = 1; stride <= 50; ++stride) {
+    BloomFilter job;
+    for (size_t i = 0; i < visible.size(); i += stride) job.add_hash(visible[i]);
+    EXPECT_TRUE(job.is_subset_of(request)) << "stride " << stride;
+  }
+
+  for (const auto& hash : visible) {
+    BloomFilter job;
+    job.add_hash(hash);
+    EXPECT_TRUE(job.is_subset_of(request));
+  }
+
+  BloomFilter empty;
+  EXPECT_TRUE(empty.is_subset_of(request));
+  EXPECT_TRUE(empty.is_subset_of(BloomFilter()));
+}
+
+TEST(job_cache_bloom_rejects) {
+  // With a typical number of visible files most jobs that read something
+  // else are turned away by the filter alone
+  BloomFilter request;
+  for (const auto& hash : make_hashes("visible", 100)) request.add_hash(hash);
+
+  size_t passed = 0;
+  for (const auto& hash : make_hashes("other", 1000)) {
+    BloomFilter job;
+    job.add_hash(hash);
+    if (job.is_subset_of(request)) ++passed;
+  }
+  EXPECT_TRUE(passed < 50) << passed << " of 1000 unrelated jobs passed";
+}
+
+using ManifestEntries = std::vector<std::pair<std::string, Hash256>>;
+
+static ManifestEntries decode_manifest(const std::string& data, bool& ok) {
+  ManifestEntries out;
+  ok = job_cache::InputManifest::for_each(data.data(), data.size(),
+                                          [&](const std::string& path, const Hash256& hash) {
+                                            out.emplace_back(path, hash);
+                                            return true;
+                                          });
+  return out;
+}
+
+static bool same_entries(const ManifestEntries& a, const ManifestEntries& b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i) {
+    Hash256 hash = a[i].second;
+    if (a[i].first != b[i].first || hash != b[i].second) return false;
+  }
+  return true;
+}
+
+TEST(job_cache_manifest_empty) {
+  std::string data = job_cache::InputManifest::encode({});
+  EXPECT_TRUE(data.empty());
+
+  bool ok = false;
+  EXPECT_TRUE(decode_manifest(data, ok).empty());
+  EXPECT_TRUE(ok);
+}
+
+TEST(job_cache_manifest_round_trip) {
+  // Each path shares all of the previous one at some point, and one is
+  // listed twice so it shares the whole path and stores no suffix
+  ManifestEntries sorted = {
+      {"", Hash256::blake2b("root")},
+      {"/workspace/src", Hash256::blake2b("dir")},
+      {"/workspace/src/a.c", Hash256::blake2b("a")},
+      {"/workspace/src/a.c", Hash256::blake2b("a again")},
+      {"/workspace/src/a.cc", Hash256::blake2b("a++")},
+      {"/workspace/src/b.c", Hash256::blake2b("b")},
+      {"/workspace/zzz", Hash256::blake2b("z")},
+  };
+
+  // Entries are stored by path whatever order they are given in
+  ManifestEntries shuffled = {sorted[5], sorted[2], sorted[6], sorted[0],
+                              sorted[4], sorted[1], sorted[3]};
+  std::string data = job_cache::InputManifest::encode(shuffled);
+
+  bool ok = false;
+  ManifestEntries decoded = decode_manifest(data, ok);
+  EXPECT_TRUE(ok);
+  EXPECT_EQUAL(sorted.size(), decoded.size());
+  EXPECT_TRUE(decoded[2].first == decoded[3].first);
+  for (size_t i = 0; i + 1 < decoded.size(); ++i) {
+    EXPECT_TRUE(decoded[i].first <= decoded[i + 1].first) << decoded[i].first;
+  }
+
+  // The two entries for a.c may come back in either order
+  ManifestEntries expected = sorted;
+  if (decoded[2].second != expected[2].second) std::swap(expected[2], expected[3]);
+  EXPECT_TRUE(same_entries(expected, decoded));
+
+  // Front coding only pays off if the shared prefixes are left out
+  size_t raw = 0;
+  for (const auto& entry : sorted) raw += entry.first.size() + sizeof(entry.second.data);
+  EXPECT_TRUE(data.size() < raw);
+}
+
+TEST(job_cache_manifest_malformed) {
+  ManifestEntries entries = {
+      {"/workspace/a", Hash256::blake2b("a")},
+      {"/workspace/b", Hash256::blake2b("b")},
+  };
+  std::string data = job_cache::InputManifest::encode(entries);
+
+  // Cut anywhere but between two entries the manifest is refused
+  size_t first = job_cache::InputManifest::encode({entries[0]}).size();
+  bool ok = true;
+  for (size_t len = 1; len < data.size(); ++len) {
+    ManifestEntries decoded = decode_manifest(data.substr(0, len), ok);
+    if (len == first) {
+      EXPECT_TRUE(ok && same_entries({entries[0]}, decoded));
+    } else {
+      EXPECT_FALSE(ok) << "truncated to " << len;
+    }
+  }
+
+  // The first entry can't share a prefix with anything
+  std::string bad = data;
+  bad[0] = 1;
+  decode_manifest(bad, ok);
+  EXPECT_FALSE(ok);
+
+  // Stopping early is reported the same way
+  size_t seen = 0;
+  EXPECT_FALSE(job_cache::InputManifest::for_each(data.data(), data.size(),
+                                                  [&](const std::string&, const Hash256&) {
+                                                    ++seen;
+                                                    return false;
+                                                  }));
+  EXPECT_EQUAL(size_t(1), seen);
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "job_cache/job_cache.h"
+#include "job_cache/job_cache_impl_common.h"
+#include "unit.h"
+#include "util/unlink.h"
+
+static std::string make_temp_dir() {
+  char dir[] = "job_cache_materialize.XXXXXX";
+  if (mkdtemp(dir) == nullptr) return "";
+  return dir;
+}
+
+static void write_file(const std::string& path, size_t size, mode_t mode) {
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  std::vector<char> chunk(1 << 20, 'x');
+  for (size_t left = size; left != 0;) {
+    size_t n = std::min(left, chunk.size());
+    n = write(fd, chunk.data(), n);
+    left -= n;
+  }
+  close(fd);
+  chmod(path.c_str(), mode);
+}
+
+static ino_t inode(const std::string& path) {
+  struct stat buf = {};
+  stat(path.c_str(), &buf);
+  return buf.st_ino;
+}
+
+static nlink_t links(const std::string& path) {
+  struct stat buf = {};
+  stat(path.c_str(), &buf);
+  return buf.st_nlink;
+}
+
+static JAST job_key(const std::string& client_cwd) {
+  JAST request(JSON_OBJECT);
+  request.add("wakeroot", "/workspace");
+  request.add("cwd", ".");
+  request.add("command_line", "touch out.txt");
+  request.add("environment", "");
+  request.add("stdin", "");
+  request.add("client_cwd", client_cwd);
+  request.add("runner_hash", "runner");
+  request.add("input_files", JAST(JSON_ARRAY));
+  return request;
+}
+
+static job_cache::Cache* make_cache(const std::string& dir, job_cache::MaterializePolicy policy) {
+  return new job_cache::Cache(dir, "", job_cache::EvictionConfig::ttl_config(3600), policy, 0,
+                              job_cache::TimeoutConfig(), false);
+}
+
+// Adds are not answered so keep asking until the daemon has stored the job
+static bool read_until_hit(job_cache::Cache& cache, const std::string& client_cwd,
+                           const std::string& out_dir) {
+  for (int i = 0; i < 100; ++i) {
+    JAST request = job_key(client_cwd);
+    JAST redirect(JSON_OBJECT);
+    redirect.add("/workspace", out_dir);
+    request.add("dir_redirects", std::move(redirect));
+    if (cache.read(job_cache::FindJobRequest(request)).match) return true;
+    usleep(20000);
+  }
+  return false;
+}
+
+TEST(job_cache_hardlink_readonly) {
+  std::string dir = make_temp_dir();
+  ASSERT_FALSE(dir.empty());
+  std::string blob = dir + "/blob";
+  std::string dst = dir + "/dst";
+  write_file(blob, 1024, 0444);
+
+  // Outputs that could be written to, or whose mode differs, are never linked
+  EXPECT_FALSE(try_hardlink_readonly(blob.c_str(), dst.c_str(), 0644));
+  EXPECT_FALSE(try_hardlink_readonly(blob.c_str(), dst.c_str(), 0555));
+  EXPECT_TRUE(access(dst.c_str(), F_OK) < 0);
+
+  EXPECT_TRUE(try_hardlink_readonly(blob.c_str(), dst.c_str(), 0444));
+  EXPECT_EQUAL(inode(blob), inode(dst));
+
+  unlink(dst.c_str());
+  unlink(blob.c_str());
+  rmdir(dir.c_str());
+}
+
+// Clients sharing a daemon each get their own policy, whichever of them
+// launched it
+TEST(job_cache_materialize_per_client) {
+  std::string dir = make_temp_dir();
+  ASSERT_FALSE(dir.empty());
+  char buf[4096];
+  std::string cwd = getcwd(buf, sizeof(buf)) ? buf : "";
+  std::string cache_dir = dir + "/cache";
+  std::string source = dir + "/out.txt";
+  write_file(source, 1024, 0444);
+
+  setenv("WAKE_SHARED_CACHE_FAST_CLOSE", "1", 1);
+  {
+    std::unique_ptr<job_cache::Cache> linking(
+        make_cache(cache_dir, job_cache::MaterializePolicy::HardlinkReadonly));
+    std::unique_ptr<job_cache::Cache> copying(
+        make_cache(cache_dir, job_cache::MaterializePolicy::Copy));
+
+    JAST add = job_key(cwd);
+    for (const char* key : {"stdout", "stderr"}) add.add(key, "");
+    for (const char* key : {"status", "mem", "ibytes", "obytes"}) add.add(key, 0);
+    for (const char* key : {"runtime", "cputime"}) add.add(key, 0.0);
+    add.add("input_dirs", JAST(JSON_ARRAY));
+    JAST outputs(JSON_ARRAY);
+    job_cache::OutputFile output;
+    output.source = source;
+    output.path = "/workspace/out.txt";
+    output.hash = Hash256::blake2b(std::string(1024, 'x'));
+    output.mode = 0444;
+    outputs.add("", output.to_json());
+    add.add("output_files", std::move(outputs));
+    linking->add(job_cache::AddJobRequest(add));
+
+    ASSERT_TRUE(read_until_hit(*linking, cwd, dir + "/linked"));
+    ASSERT_TRUE(read_until_hit(*copying, cwd, dir + "/copied"));
+    EXPECT_TRUE(links(dir + "/linked/out.txt") > 1);
+    EXPECT_EQUAL(nlink_t(1), links(dir + "/copied/out.txt"));
+  }
+  unsetenv("WAKE_SHARED_CACHE_FAST_CLOSE");
+
+  // The daemon removes its key as it exits
+  std::string key = cache_dir + "/.key";
+  for (int i = 0; i < 500 && access(key.c_str(), F_OK) == 0; ++i) usleep(10000);
+  deep_unlink(AT_FDCWD, dir.c_str());
+}
+
+// Measures how long it takes to put one cached output in place on a hit
+// with each materialization policy, for outputs from 1KB to 1GB. The
+// numbers depend heavily on the filesystem so run it from a directory on
+// the same filesystem as the cache with `wake-unit --tag bench`.
+TEST(job_cache_materialize_bench, "bench") {
+  using clock = std::chrono::steady_clock;
+  std::string dir = make_temp_dir();
+  ASSERT_FALSE(dir.empty());
+  std::string blob = dir + "/blob";
+
+  auto time_us = [&](size_t iterations, auto materialize) {
+    auto start = clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      std::string dst = dir + "/out" + std::to_string(i);
+      materialize(dst);
+      unlink(dst.c_str());
+    }
+    auto total = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start);
+    return total.count() / int64_t(iterations);
+  };
+
+  std::cout << "job cache hit latency per output:" << std::endl;
+  for (size_t size = 1 << 10; size <= size_t(1) << 30; size <<= 5) {
+    write_file(blob, size, 0444);
+    // Keep the largest sizes from taking minutes
+    size_t iterations = std::max<size_t>(1, (size_t(64) << 20) / size);
+    iterations = std::min<size_t>(iterations, 200);
+
+    int64_t copy_us = time_us(iterations, [&](const std::string& dst) {
+      copy_file(blob.c_str(), dst.c_str(), 0444, O_EXCL);
+    });
+    int64_t reflink_us = time_us(iterations, [&](const std::string& dst) {
+      copy_or_reflink(blob.c_str(), dst.c_str(), 0444, O_EXCL);
+    });
+    int64_t hardlink_us = time_us(iterations, [&](const std::string& dst) {
+      EXPECT_TRUE(try_hardlink_readonly(blob.c_str(), dst.c_str(), 0444));
+    });
+
+    std::cout << "  " << (size >> 10) << "KB: copy " << copy_us << "us, reflink " << reflink_us
+              << "us, hardlink-readonly " << hardlink_us << "us" << std::endl;
+    unlink(blob.c_str());
+  }
+
+  rmdir(dir.c_str());
+}
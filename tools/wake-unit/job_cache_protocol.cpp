@@ -0,0 +1,244 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "job_cache/binary.h"
+#include "job_cache/types.h"
+#include "unit.h"
+
+static std::string json_string(const JAST& json) {
+  std::stringstream s;
+  s << json;
+  return s.str();
+}
+
+// A request whose visible files are spread over a handful of directories
+// the way a real workspace's would be.
+static job_cache::FindJobRequest make_find_request(size_t visible) {
+  JAST request(JSON_OBJECT);
+  request.add("wakeroot", "/workspace");
+  request.add("cwd", ".");
+  request.add("command_line", "gcc -c main.c");
+  request.add("environment", "PATH=/usr/bin");
+  request.add("stdin", "");
+  request.add("client_cwd", "/workspace");
+  request.add("runner_hash", "runner");
+
+  JAST inputs(JSON_ARRAY);
+  for (size_t i = 0; i < visible; ++i) {
+    std::string path = "src/module" + std::to_string(i % 37) + "/file" + std::to_string(i) + ".c";
+    JAST input(JSON_OBJECT);
+    input.add("path", path);
+    input.add("hash", Hash256::blake2b(path).to_hex());
+    inputs.add("", std::move(input));
+  }
+  request.add("input_files", std::move(inputs));
+
+  JAST redirect(JSON_OBJECT);
+  redirect.add("/workspace", "/home/user/workspace");
+  request.add("dir_redirects", std::move(redirect));
+
+  return job_cache::FindJobRequest(request);
+}
+
+static std::string encode(const job_cache::FindJobRequest& request) {
+  job_cache::BinaryWriter out(job_cache::BinaryMethod::Read);
+  request.to_binary(out);
+  return out.finish();
+}
+
+TEST(job_cache_binary_find_request) {
+  auto request = make_find_request(1000);
+  request.materialize = job_cache::MaterializePolicy::HardlinkReadonly;
+  std::string frame = encode(request);
+
+  job_cache::BinaryReader in(frame);
+  ASSERT_FALSE(in.failed());
+  EXPECT_TRUE(in.method() == job_cache::BinaryMethod::Read);
+  job_cache::FindJobRequest decoded(in);
+  ASSERT_FALSE(in.failed());
+
+  EXPECT_EQUAL(json_string(request.to_json()), json_string(decoded.to_json()));
+  EXPECT_TRUE(decoded.materialize == job_cache::MaterializePolicy::HardlinkReadonly);
+  EXPECT_EQUAL(request.dir_hashes.size(), decoded.dir_hashes.size());
+  EXPECT_EQUAL(std::string(reinterpret_cast<const char*>(request.bloom.data()),
+                           request.bloom.size()),
+               std::string(reinterpret_cast<const char*>(decoded.bloom.data()),
+                           decoded.bloom.size()));
+}
+
+TEST(job_cache_find_request_materialize) {
+  // A request that doesn't name a policy gets the default
+  auto request = make_find_request(10);
+  EXPECT_TRUE(request.materialize == job_cache::MaterializePolicy::Reflink);
+
+  for (auto policy : {job_cache::MaterializePolicy::Copy, job_cache::MaterializePolicy::Reflink,
+                      job_cache::MaterializePolicy::HardlinkReadonly}) {
+    request.materialize = policy;
+    job_cache::FindJobRequest decoded(request.to_json());
+    EXPECT_TRUE(decoded.materialize == policy) << job_cache::to_string(policy);
+  }
+}
+
+TEST(job_cache_binary_read_batch) {
+  std::deque<job_cache::FindJobRequest> requests;
+  for (size_t visible = 10; visible <= 50; visible += 20) {
+    requests.emplace_back(make_find_request(visible));
+  }
+
+  job_cache::BinaryWriter out(job_cache::BinaryMethod::ReadBatch);
+  out.write_varint(requests.size());
+  for (size_t i = 0; i < requests.size(); ++i) {
+    out.write_varint(100 + i);
+    requests[i].to_binary(out);
+  }
+  std::string frame = out.finish();
+
+  // Directories shared between the jobs are only written once so the
+  // batch is smaller than the requests sent on their own
+  size_t separate = 0;
+  for (const auto& request : requests) separate += encode(request).size();
+  EXPECT_TRUE(frame.size() < separate);
+
+  job_cache::BinaryReader in(frame);
+  ASSERT_FALSE(in.failed());
+  EXPECT_TRUE(in.method() == job_cache::BinaryMethod::ReadBatch);
+  ASSERT_EQUAL(requests.size(), in.read_count());
+  for (size_t i = 0; i < requests.size(); ++i) {
+    EXPECT_EQUAL(100 + i, in.read_varint());
+    job_cache::FindJobRequest decoded(in);
+    ASSERT_FALSE(in.failed());
+    EXPECT_EQUAL(json_string(requests[i].to_json()), json_string(decoded.to_json()));
+  }
+}
+
+TEST(job_cache_binary_find_response) {
+  job_cache::MatchingJob job;
+  job.client_cwd = "/workspace";
+  job.output_info.stdout_str = "out";
+  job.output_info.stderr_str = "err";
+  job.output_info.status = -9;
+  job.output_info.runtime = 1.5;
+  job.output_info.cputime = 0.25;
+  job.output_info.mem = 1 << 20;
+  job.output_info.ibytes = 42;
+  job.output_info.obytes = 1ull << 40;
+  for (int i = 0; i < 10; ++i) {
+    job_cache::CachedOutputFile file;
+    file.path = "/workspace/build/obj" + std::to_string(i) + ".o";
+    file.hash = Hash256::blake2b(file.path);
+    file.mode = 0644;
+    job.output_files.push_back(file);
+  }
+  job_cache::CachedOutputDir dir;
+  dir.path = "/workspace/build";
+  dir.mode = 0755;
+  job.output_dirs.push_back(dir);
+  job_cache::CachedOutputSymlink symlink;
+  symlink.path = "/workspace/build/link";
+  symlink.value = "obj0.o";
+  job.output_symlinks.push_back(symlink);
+  job.input_files.push_back("src/main.c");
+  job.input_dirs.push_back("src");
+
+  job_cache::FindJobResponse response(wcl::make_some<job_cache::MatchingJob>(job));
+  job_cache::BinaryWriter out(job_cache::BinaryMethod::Response);
+  response.to_binary(out);
+  std::string frame = out.finish();
+
+  job_cache::BinaryReader in(frame);
+  job_cache::FindJobResponse decoded(in);
+  ASSERT_FALSE(in.failed());
+  EXPECT_EQUAL(json_string(response.to_json()), json_string(decoded.to_json()));
+
+  job_cache::FindJobResponse miss(wcl::optional<job_cache::MatchingJob>{});
+  job_cache::BinaryWriter miss_out(job_cache::BinaryMethod::Response);
+  miss.to_binary(miss_out);
+  std::string miss_frame = miss_out.finish();
+  job_cache::BinaryReader miss_in(miss_frame);
+  EXPECT_FALSE(bool(job_cache::FindJobResponse(miss_in).match));
+  EXPECT_FALSE(miss_in.failed());
+}
+
+TEST(job_cache_binary_truncated) {
+  std::string frame = encode(make_find_request(100));
+
+  // A frame whose size doesn't match its header is rejected outright
+  std::string short_frame = frame.substr(0, frame.size() - 1);
+  job_cache::BinaryReader short_in(short_frame);
+  EXPECT_TRUE(short_in.failed());
+
+  // A frame that claims to be complete but stops early fails part way through
+  std::string cut = frame.substr(0, frame.size() / 2);
+  uint32_t size = cut.size() - job_cache::binary_frame_header_size;
+  for (size_t i = 0; i < 4; ++i) cut[1 + i] = char(uint8_t(size >> (8 * i)));
+  job_cache::BinaryReader cut_in(cut);
+  EXPECT_FALSE(cut_in.failed());
+  job_cache::FindJobRequest decoded(cut_in);
+  EXPECT_TRUE(cut_in.failed());
+}
+
+// Compares the cost of moving a large request over the socket in each
+// encoding: serializing it on the client and deserializing it in the daemon.
+// Run with `wake-unit --tag bench` to see the numbers.
+TEST(job_cache_protocol_bench, "bench") {
+  using clock = std::chrono::steady_clock;
+  constexpr int iterations = 20;
+  auto request = make_find_request(10000);
+
+  size_t json_bytes = 0;
+  auto json_start = clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    JAST message(JSON_OBJECT);
+    message.add("method", "cache/read");
+    message.add("params", request.to_json());
+    std::string wire = json_string(message);
+    json_bytes = wire.size();
+
+    JAST json;
+    std::stringstream errors;
+    ASSERT_TRUE(JAST::parse(wire, errors, json));
+    job_cache::FindJobRequest decoded(json.get("params"));
+  }
+  auto json_time = clock::now() - json_start;
+
+  size_t binary_bytes = 0;
+  auto binary_start = clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    std::string wire = encode(request);
+    binary_bytes = wire.size();
+
+    job_cache::BinaryReader in(wire);
+    job_cache::FindJobRequest decoded(in);
+    ASSERT_FALSE(in.failed());
+  }
+  auto binary_time = clock::now() - binary_start;
+
+  auto per_iteration_us = [](clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count() / iterations;
+  };
+  std::cout << "job cache request with 10000 visible files:" << std::endl;
+  std::cout << "  json:   " << json_bytes << " bytes, " << per_iteration_us(json_time) << "us"
+            << std::endl;
+  std::cout << "  binary: " << binary_bytes << " bytes, " << per_iteration_us(binary_time) << "us"
+            << std::endl;
+}
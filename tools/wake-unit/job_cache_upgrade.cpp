@@ -0,0 +1,262 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "job_cache/db_helpers.h"
+#include "job_cache/input_manifest.h"
+#include "job_cache/job_cache.h"
+#include "job_cache/job_cache_impl_common.h"
+#include "unit.h"
+#include "util/mkdir_parents.h"
+#include "util/unlink.h"
+#include "wcl/filepath.h"
+
+static const std::string output_content = "cached output\n";
+
+static std::string current_dir() {
+  char buf[4096];
+  return getcwd(buf, sizeof(buf)) ? buf : "";
+}
+
+static std::string read_file(const std::string& path) {
+  std::ifstream in(path);
+  std::stringstream s;
+  s << in.rdbuf();
+  return s.str();
+}
+
+static void write_file(const std::string& path, const std::string& content) {
+  mkdir_with_parents(wcl::parent_and_base(path)->first, 0777);
+  std::ofstream out(path);
+  out << content;
+}
+
+static JAST job_key() {
+  JAST request(JSON_OBJECT);
+  request.add("wakeroot", "/workspace");
+  request.add("cwd", ".");
+  request.add("command_line", "cat src/a.c src/b.c");
+  request.add("environment", "PATH=/usr/bin");
+  request.add("stdin", "");
+  request.add("client_cwd", current_dir());
+  request.add("runner_hash", "runner");
+  return request;
+}
+
+// The job reads two files and lists the directory they are in
+static job_cache::AddJobRequest make_add_request(const std::string& source) {
+  JAST request = job_key();
+  request.add("stdout", "");
+  request.add("stderr", "");
+  request.add("status", 0);
+  request.add("runtime", 1.0);
+  request.add("cputime", 1.0);
+  request.add("mem", 1024);
+  request.add("ibytes", 1024);
+  request.add("obytes", 1024);
+
+  JAST inputs(JSON_ARRAY);
+  for (const char* name : {"a.c", "b.c"}) {
+    job_cache::InputFile input;
+    input.path = std::string("/workspace/src/") + name;
+    input.hash = Hash256::blake2b(name);
+    inputs.add("", input.to_json());
+  }
+  request.add("input_files", std::move(inputs));
+
+  JAST dirs(JSON_ARRAY);
+  job_cache::InputDir dir;
+  dir.path = "/workspace/src";
+  dir.hash = Hash256::blake2b("a.c:b.c:");
+  dirs.add("", dir.to_json());
+  request.add("input_dirs", std::move(dirs));
+
+  JAST outputs(JSON_ARRAY);
+  job_cache::OutputFile output;
+  output.source = source;
+  output.path = "/workspace/out.txt";
+  output.hash = Hash256::blake2b(output_content);
+  output.mode = 0644;
+  outputs.add("", output.to_json());
+  request.add("output_files", std::move(outputs));
+
+  return job_cache::AddJobRequest(request);
+}
+
+static job_cache::FindJobRequest make_find_request(const std::string& out_dir) {
+  JAST request = job_key();
+
+  // Like wake, list the directory among the visible files with its hash
+  std::vector<std::pair<std::string, Hash256>> files = {
+      {"/workspace/src", Hash256::blake2b("a.c:b.c:")},
+      {"/workspace/src/a.c", Hash256::blake2b("a.c")},
+      {"/workspace/src/b.c", Hash256::blake2b("b.c")},
+  };
+  JAST visible(JSON_ARRAY);
+  for (const auto& file : files) {
+    JAST json(JSON_OBJECT);
+    json.add("path", file.first);
+    json.add("hash", file.second.to_hex());
+    visible.add("", std::move(json));
+  }
+  request.add("input_files", std::move(visible));
+
+  JAST redirect(JSON_OBJECT);
+  redirect.add("/workspace", out_dir);
+  request.add("dir_redirects", std::move(redirect));
+
+  return job_cache::FindJobRequest(request);
+}
+
+static std::unique_ptr<job_cache::Cache> make_cache(const std::string& dir) {
+  job_cache::TimeoutConfig tconfig;
+  return std::make_unique<job_cache::Cache>(dir, "", job_cache::EvictionConfig::ttl_config(3600),
+                                            job_cache::MaterializePolicy::Copy, 0, tconfig,
+                                            false);
+}
+
+// Adds are not answered so keep asking until the daemon has stored the job
+static bool read_until_hit(job_cache::Cache& cache, const std::string& out_dir) {
+  for (int i = 0; i < 100; ++i) {
+    if (cache.read(make_find_request(out_dir)).match) return true;
+    usleep(20000);
+  }
+  return false;
+}
+
+static int64_t query_integer(std::shared_ptr<job_cache::Database> db, const std::string& sql) {
+  job_cache::PreparedStatement query(db, sql);
+  query.step();
+  int64_t out = query.read_integer(0);
+  query.reset();
+  return out;
+}
+
+// Rewrites a copy of a current cache the way the very first caches stored
+// it: an integer bloom filter, a row per input in input_files/input_dirs,
+// and each output kept in its job's folder rather than in the blob store.
+static void downgrade_to_version_0(const std::string& dir) {
+  auto db = std::make_shared<job_cache::Database>(dir);
+  job_cache::PreparedStatement select_inputs(db, "select job, files, dirs from job_inputs");
+  job_cache::PreparedStatement add_file(db, "insert into input_files (path, hash, job) values (?, ?, ?)");
+  job_cache::PreparedStatement add_dir(db, "insert into input_dirs (path, hash, job) values (?, ?, ?)");
+  job_cache::PreparedStatement select_outputs(db, "select job, hash from output_files");
+
+  auto add_rows = [](job_cache::PreparedStatement& add, int64_t job_id, const void* data, size_t size) {
+    return job_cache::InputManifest::for_each(data, size,
+                                              [&](const std::string& path, const Hash256& hash) {
+                                                add.bind_string(1, path);
+                                                add.bind_string(2, hash.to_hex());
+                                                add.bind_integer(3, job_id);
+                                                add.step();
+                                                add.reset();
+                                                return true;
+                                              });
+  };
+
+  while (select_inputs.step() == SQLITE_ROW) {
+    int64_t job_id = select_inputs.read_integer(0);
+    size_t size;
+    const void* files = select_inputs.read_blob(1, &size);
+    add_rows(add_file, job_id, files, size);
+    const void* dirs = select_inputs.read_blob(2, &size);
+    add_rows(add_dir, job_id, dirs, size);
+  }
+  select_inputs.reset();
+
+  while (select_outputs.step() == SQLITE_ROW) {
+    int64_t job_id = select_outputs.read_integer(0);
+    char group[3];
+    snprintf(group, sizeof(group), "%02x", unsigned(job_id & 0xFF));
+    std::string legacy = wcl::join_paths(dir, group, std::to_string(job_id),
+                                         select_outputs.read_string(1));
+    write_file(legacy, output_content);
+  }
+  select_outputs.reset();
+
+  for (const char* sql : {"delete from job_inputs", "update jobs set bloom_filter = 12345",
+                          "delete from blobs", "pragma user_version = 0"}) {
+    job_cache::PreparedStatement statement(db, sql);
+    statement.step();
+    statement.reset();
+  }
+}
+
+TEST(job_cache_upgrade_from_version_0) {
+  char temp[] = "job_cache_upgrade.XXXXXX";
+  ASSERT_TRUE(mkdtemp(temp) != nullptr);
+  std::string root = temp;
+  std::string current = wcl::join_paths(root, "current");
+  std::string legacy = wcl::join_paths(root, "legacy");
+  std::string source = wcl::join_paths(root, "source", "out.txt");
+  write_file(source, output_content);
+
+  // The daemons go away as soon as their client does
+  setenv("WAKE_SHARED_CACHE_FAST_CLOSE", "1", 1);
+
+  {
+    auto cache = make_cache(current);
+    cache->add(make_add_request(source));
+    ASSERT_TRUE(read_until_hit(*cache, wcl::join_paths(root, "out1")));
+  }
+
+  // Take a consistent copy of the current cache to downgrade
+  {
+    auto db = std::make_shared<job_cache::Database>(current);
+    mkdir(legacy.c_str(), 0777);
+    job_cache::PreparedStatement copy(db, "vacuum into '" + wcl::join_paths(legacy, "cache.db") + "'");
+    copy.step();
+    copy.reset();
+  }
+  downgrade_to_version_0(legacy);
+
+  // A new daemon upgrades the copy when it starts and the job still hits
+  {
+    auto cache = make_cache(legacy);
+    std::string out_dir = wcl::join_paths(root, "out2");
+    auto response = cache->read(make_find_request(out_dir));
+    ASSERT_TRUE(bool(response.match));
+    EXPECT_EQUAL(output_content, read_file(wcl::join_paths(out_dir, "out.txt")));
+  }
+  unsetenv("WAKE_SHARED_CACHE_FAST_CLOSE");
+
+  auto db = std::make_shared<job_cache::Database>(legacy);
+  EXPECT_EQUAL(int64_t(3), query_integer(db, "pragma user_version"));
+  EXPECT_EQUAL(int64_t(0), query_integer(db, "select count(*) from input_files"));
+  EXPECT_EQUAL(int64_t(0), query_integer(db, "select count(*) from input_dirs"));
+  EXPECT_EQUAL(int64_t(1), query_integer(db, "select count(*) from job_inputs"));
+  EXPECT_EQUAL(int64_t(1), query_integer(db, "select refcount from blobs"));
+  db.reset();
+
+  // The output moved into the blob store and its job's folder is gone
+  std::string hash = Hash256::blake2b(output_content).to_hex();
+  EXPECT_EQUAL(output_content, read_file(wcl::join_paths(legacy, blob_path(hash))));
+  EXPECT_TRUE(access(wcl::join_paths(legacy, "01", "1").c_str(), F_OK) != 0);
+
+  deep_unlink(AT_FDCWD, root.c_str());
+}
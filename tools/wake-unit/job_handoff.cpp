@@ -0,0 +1,106 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <util/job_handoff.h>
+
+#include <unistd.h>
+
+#include <string>
+
+#include "unit.h"
+
+TEST(job_handoff_inline) {
+  std::string shm, payload, error;
+  std::string frame = job_handoff::pack(job_handoff::Kind::Visible, "small", shm);
+  EXPECT_TRUE(shm.empty());
+  EXPECT_TRUE(job_handoff::is_frame(frame));
+  EXPECT_FALSE(job_handoff::is_frame("{\"visible\":[]}"));
+
+  ASSERT_TRUE(job_handoff::unpack(frame, job_handoff::Kind::Visible, payload, error)) << error;
+  EXPECT_EQUAL(std::string("small"), payload);
+
+  EXPECT_FALSE(job_handoff::unpack(frame, job_handoff::Kind::Result, payload, error));
+  EXPECT_FALSE(job_handoff::unpack(frame.substr(0, frame.size() - 1), job_handoff::Kind::Visible,
+                                   payload, error));
+
+  // A frame from another release is refused rather than misread
+  std::string other = frame;
+  other[8] ^= 0x40;
+  EXPECT_FALSE(job_handoff::unpack(other, job_handoff::Kind::Visible, payload, error));
+}
+
+TEST(job_handoff_shared_memory) {
+  if (access("/dev/shm", W_OK) != 0) return;
+
+  std::string big(1 << 20, 'x');
+  big[12345] = 'y';
+
+  std::string shm, payload, error;
+  std::string frame = job_handoff::pack(job_handoff::Kind::Visible, big, shm);
+  ASSERT_FALSE(shm.empty());
+  EXPECT_TRUE(frame.size() < 100u);
+
+  ASSERT_TRUE(job_handoff::unpack(frame, job_handoff::Kind::Visible, payload, error)) << error;
+  EXPECT_TRUE(payload == big);
+  // The receiver cleans up after itself, and only once
+  EXPECT_TRUE(access(shm.c_str(), F_OK) != 0);
+  EXPECT_FALSE(job_handoff::unpack(frame, job_handoff::Kind::Visible, payload, error));
+}
+
+TEST(job_handoff_fallback) {
+  std::string big(1 << 20, 'x');
+  big[54321] = 'y';
+
+  // Nowhere to put shared memory, so the payload goes inline
+  std::string shm, payload, error;
+  std::string frame =
+      job_handoff::pack(job_handoff::Kind::Result, big, shm, "/nonexistent/wake-handoff");
+  EXPECT_TRUE(shm.empty());
+  EXPECT_TRUE(frame.size() > big.size());
+
+  ASSERT_TRUE(job_handoff::unpack(frame, job_handoff::Kind::Result, payload, error)) << error;
+  EXPECT_TRUE(payload == big);
+
+  // A frame naming a file outside of /dev/shm is refused
+  if (access("/tmp", W_OK) != 0) return;
+  frame = job_handoff::pack(job_handoff::Kind::Result, big, shm, "/tmp");
+  ASSERT_FALSE(shm.empty());
+  EXPECT_FALSE(job_handoff::unpack(frame, job_handoff::Kind::Result, payload, error));
+  EXPECT_TRUE(access(shm.c_str(), F_OK) == 0);
+  (void)unlink(shm.c_str());
+}
+
+TEST(job_handoff_result) {
+  job_handoff::Result result;
+  result.ibytes = 1ULL << 40;
+  result.obytes = 7;
+  result.inputs = {"src/a.c", "", "include/\"quoted\".h"};
+  result.outputs = {"build/a.o"};
+
+  std::string data = job_handoff::encode_result(result);
+  job_handoff::Result decoded;
+  ASSERT_TRUE(job_handoff::decode_result(data, decoded));
+  EXPECT_EQUAL(result.ibytes, decoded.ibytes);
+  EXPECT_EQUAL(result.obytes, decoded.obytes);
+  EXPECT_TRUE(result.inputs == decoded.inputs);
+  EXPECT_TRUE(result.outputs == decoded.outputs);
+
+  for (size_t len = 0; len < data.size(); ++len) {
+    EXPECT_FALSE(job_handoff::decode_result(data.substr(0, len), decoded));
+  }
+  EXPECT_FALSE(job_handoff::decode_result(data + "x", decoded));
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/runtime.h"
+
+#include <atomic>
+#include <vector>
+
+#include "unit.h"
+
+// Every item is visited exactly once, however the chunks are stolen
+TEST_FUNC(void, runtime_parallel_covers, int threads, size_t items, size_t grain) {
+  Runtime runtime(nullptr, 0, 4.0, 0, 1, threads);
+  for (int round = 0; round < 3; ++round) {
+    std::vector<std::atomic<int>> seen(items);
+    for (auto &x : seen) x.store(0);
+    std::atomic<size_t> calls(0);
+    runtime.parallel(
+        items,
+        [&](size_t begin, size_t end) {
+          ++calls;
+          for (size_t i = begin; i < end; ++i) ++seen[i];
+        },
+        grain);
+    size_t bad = 0;
+    for (auto &x : seen) bad += x.load() != 1;
+    EXPECT_EQUAL(0u, bad);
+    EXPECT_EQUAL(items != 0, calls.load() != 0);
+  }
+}
+
+TEST(runtime_parallel) {
+  TEST_FUNC_CALL(runtime_parallel_covers, 1, 100000, PARALLEL_GRAIN);
+  TEST_FUNC_CALL(runtime_parallel_covers, 4, 0, PARALLEL_GRAIN);
+  TEST_FUNC_CALL(runtime_parallel_covers, 4, 10, PARALLEL_GRAIN);
+  TEST_FUNC_CALL(runtime_parallel_covers, 4, 100000, PARALLEL_GRAIN);
+  TEST_FUNC_CALL(runtime_parallel_covers, 7, PARALLEL_GRAIN * 33 + 1, PARALLEL_GRAIN);
+  // One item per chunk, as used for parsing wake files
+  TEST_FUNC_CALL(runtime_parallel_covers, 4, 300, 1);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "optimizer/ssa_cache.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "optimizer/ssa.h"
+#include "runtime/runtime.h"
+#include "unit.h"
+
+static CPPFile cppFile(__FILE__);
+
+static PRIMFN(prim_test) {}
+
+static PrimMap make_pmap(int flags) {
+  PrimMap pmap;
+  prim_register(pmap, "ssa_cache_test", prim_test, nullptr, flags);
+  return pmap;
+}
+
+// \x. ssa_cache_test x
+static std::unique_ptr<Term> make_term() {
+  std::unique_ptr<RFun> fun(new RFun(FRAGMENT_CPP_LINE, "test", 0, 1));
+  fun->terms.emplace_back(new RArg("x"));
+  fun->terms.emplace_back(new RPrim("ssa_cache_test", nullptr, nullptr, PRIM_PURE,
+                                    std::vector<size_t>{make_arg(0, 0)}));
+  return std::move(fun);
+}
+
+// An entry this wake can't link must miss, so that the workspace is recompiled
+TEST(ssa_cache_unknown_prim) {
+  char temp[] = "ssa_cache.XXXXXX";
+  ASSERT_TRUE(mkdtemp(temp) != nullptr);
+  std::string dir = temp;
+  Runtime runtime(nullptr, 0, 4.0, 0, 1, 1);
+  std::vector<ExternalFile> wakefiles;
+  std::string type;
+
+  std::unique_ptr<Term> term = make_term();
+  {
+    SSACache cache(dir);
+    cache.key("test");
+    cache.save(term.get(), wakefiles, type);
+  }
+
+  {
+    SSACache cache(dir);
+    cache.key("test");
+    EXPECT_TRUE(cache.load(runtime, wakefiles, type, make_pmap(PRIM_PURE)) != nullptr);
+  }
+
+  // A primitive with other flags can't be used either, and the entry is gone after
+  {
+    SSACache cache(dir);
+    cache.key("test");
+    EXPECT_TRUE(cache.load(runtime, wakefiles, type, make_pmap(PRIM_IMPURE)) == nullptr);
+    EXPECT_TRUE(cache.load(runtime, wakefiles, type, make_pmap(PRIM_PURE)) == nullptr);
+  }
+
+  {
+    SSACache cache(dir);
+    cache.key("test");
+    cache.save(term.get(), wakefiles, type);
+    EXPECT_TRUE(cache.load(runtime, wakefiles, type, PrimMap()) == nullptr);
+    cache.remove();
+  }
+
+  EXPECT_EQUAL(0, rmdir(dir.c_str()));
+}
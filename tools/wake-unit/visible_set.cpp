@@ -0,0 +1,140 @@
+/*
+ * Copyright 2023 SiFive, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You should have received a copy of LICENSE.Apache2 along with
+ * this software. If not, you may obtain a copy at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <util/visible_set.h>
+#include <wcl/xoshiro_256.h>
+
+#include <string.h>
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "unit.h"
+
+// What fuse-waked did before VisibleSet
+static bool set_is_visible(const std::set<std::string> &visible, const std::string &path) {
+  if (visible.find(path) != visible.end()) return true;
+
+  auto i = visible.lower_bound(path + "/");
+  return i != visible.end() && i->size() > path.size() && (*i)[path.size()] == '/' &&
+         0 == i->compare(0, path.size(), path);
+}
+
+// Relative paths, like fuse-waked looks up, but with odd components
+static std::vector<std::string> random_paths(wcl::xoshiro_256 &gen, size_t n) {
+  static const char *parts[] = {"a", "b", "src", "include", "x.h", "y.cpp", ".", ""};
+  std::vector<std::string> out;
+  for (size_t i = 0; i < n; ++i) {
+    std::string path = parts[gen() % 7];
+    for (size_t depth = gen() % 5; depth != 0; --depth) {
+      path += "/";
+      path += parts[gen() % 8];
+    }
+    out.push_back(path);
+  }
+  return out;
+}
+
+TEST(visible_set_directories) {
+  VisibleSet set({"src/util/file.h", "src/util", "build/out.o", "top"});
+
+  EXPECT_TRUE(set.contains("src/util/file.h"));
+  EXPECT_TRUE(set.contains("src/util"));
+  EXPECT_TRUE(set.contains("src"));
+  EXPECT_TRUE(set.contains("build"));
+  EXPECT_TRUE(set.contains("top"));
+  EXPECT_FALSE(set.contains("src/util/file"));
+  EXPECT_FALSE(set.contains("src/uti"));
+  EXPECT_FALSE(set.contains("src/util/file.h/x"));
+  EXPECT_FALSE(set.contains("top/x"));
+  EXPECT_FALSE(set.contains(""));
+  EXPECT_EQUAL(6u, set.size());
+}
+
+TEST(visible_set_matches_set) {
+  wcl::xoshiro_256 gen(wcl::xoshiro_256::get_rng_seed());
+  for (int round = 0; round < 20; ++round) {
+    auto paths = random_paths(gen, 200);
+    std::set<std::string> reference(paths.begin(), paths.end());
+    VisibleSet set(paths);
+
+    for (auto &probe : random_paths(gen, 2000)) {
+      EXPECT_EQUAL(set_is_visible(reference, probe), set.contains(probe)) << probe;
+    }
+  }
+}
+
+TEST(visible_set_serialize) {
+  VisibleSet set({"src/util/file.h", "src/wcl/trie.h", "README.md"});
+  std::string data = set.serialize();
+  ASSERT_TRUE(VisibleSet::is_serialized(data.data(), data.size()));
+  EXPECT_FALSE(VisibleSet::is_serialized("{\"visible\":[]}", 14));
+
+  VisibleSet loaded;
+  ASSERT_TRUE(VisibleSet::deserialize(data.data(), data.size(), loaded));
+  EXPECT_EQUAL(set.size(), loaded.size());
+  EXPECT_TRUE(loaded.contains("src/wcl/trie.h"));
+  EXPECT_TRUE(loaded.contains("src/wcl"));
+  EXPECT_FALSE(loaded.contains("src/wcl/optional.h"));
+
+  // Anything truncated or pointing outside of the paths is rejected
+  for (size_t len = 0; len < data.size(); ++len) {
+    EXPECT_FALSE(VisibleSet::deserialize(data.data(), len, loaded));
+  }
+  uint32_t slots;
+  memcpy(&slots, data.data() + 16, sizeof(slots));
+  std::string bad = data;
+  for (uint32_t i = 0; i < slots; ++i) memset(&bad[24 + 8 * i], 0xff, 4);
+  EXPECT_FALSE(VisibleSet::deserialize(bad.data(), bad.size(), loaded));
+}
+
+// Compares lookups against the std::set fuse-waked used before, for a job
+// with 50k visible files. Run with `wake-unit --tag bench`.
+TEST(visible_set_bench, "bench") {
+  using clock = std::chrono::steady_clock;
+  std::vector<std::string> paths;
+  for (int i = 0; i < 50000; ++i) {
+    paths.push_back("toolchain/lib/gcc/" + std::to_string(i % 97) + "/include/header" +
+                    std::to_string(i) + ".h");
+  }
+  std::set<std::string> reference(paths.begin(), paths.end());
+  VisibleSet set(paths);
+
+  std::vector<std::string> probes;
+  for (int i = 0; i < 200000; ++i) {
+    probes.push_back("toolchain/lib/gcc/" + std::to_string(i % 101) + "/include/header" +
+                     std::to_string(i % 70000) + ".h");
+  }
+
+  auto time_ns = [&](auto lookup) {
+    size_t hits = 0;
+    auto start = clock::now();
+    for (auto &probe : probes) hits += lookup(probe);
+    auto total = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+    return std::make_pair(total.count() / int64_t(probes.size()), hits);
+  };
+
+  auto before = time_ns([&](const std::string &p) { return set_is_visible(reference, p); });
+  auto after = time_ns([&](const std::string &p) { return set.contains(p); });
+  EXPECT_EQUAL(before.second, after.second);
+
+  std::cout << "visible lookup with 50k files: std::set " << before.first << "ns, VisibleSet "
+            << after.first << "ns" << std::endl;
+}
@@ -56,6 +56,7 @@ struct CommandLineOptions {
   bool tcheck;
   bool dumpssa;
   bool optim;
+  bool ssacache;
   bool exports;
   bool timeline;
   bool simple_timeline;
@@ -70,6 +71,9 @@ struct CommandLineOptions {
   const char *jobs_str;
   const char *memory_str;
   const char *heapf;
+  const char *heapn;
+  const char *heapt;
+  const char *evalt;
   const char *profile;
   const char *init;
   const char *chdir;
@@ -118,9 +122,13 @@ struct CommandLineOptions {
       {'q', "quiet", GOPT_ARGUMENT_FORBIDDEN},
       {0, "no-wait", GOPT_ARGUMENT_FORBIDDEN},
       {0, "no-workspace", GOPT_ARGUMENT_FORBIDDEN},
+      {0, "no-ssa-cache", GOPT_ARGUMENT_FORBIDDEN},
       {0, "no-tty", GOPT_ARGUMENT_FORBIDDEN},
       {0, "fatal-warnings", GOPT_ARGUMENT_FORBIDDEN},
       {0, "heap-factor", GOPT_ARGUMENT_REQUIRED | GOPT_ARGUMENT_NO_HYPHEN},
+      {0, "heap-nursery", GOPT_ARGUMENT_REQUIRED | GOPT_ARGUMENT_NO_HYPHEN},
+      {0, "heap-threads", GOPT_ARGUMENT_REQUIRED | GOPT_ARGUMENT_NO_HYPHEN},
+      {0, "eval-threads", GOPT_ARGUMENT_REQUIRED | GOPT_ARGUMENT_NO_HYPHEN},
       {0, "profile-heap", GOPT_ARGUMENT_FORBIDDEN | GOPT_REPEATABLE},
       {0, "profile", GOPT_ARGUMENT_REQUIRED},
       {'C', "chdir", GOPT_ARGUMENT_REQUIRED},
@@ -211,6 +219,7 @@ struct CommandLineOptions {
     tcheck = arg(options, "stop-after-type-check")->count;
     dumpssa = arg(options, "stop-after-ssa")->count;
     optim = !arg(options, "no-optimize")->count;
+    ssacache = !arg(options, "no-ssa-cache")->count;
     exports = arg(options, "exports")->count;
     timeline = arg(options, "timeline")->count;
     simple_timeline = arg(options, "simple-timeline")->count;
@@ -223,6 +232,9 @@ struct CommandLineOptions {
     jobs_str = arg(options, "jobs")->argument;
     memory_str = arg(options, "memory")->argument;
     heapf = arg(options, "heap-factor")->argument;
+    heapn = arg(options, "heap-nursery")->argument;
+    heapt = arg(options, "heap-threads")->argument;
+    evalt = arg(options, "eval-threads")->argument;
     profile = arg(options, "profile")->argument;
     init = arg(options, "init")->argument;
     chdir = arg(options, "chdir")->argument;
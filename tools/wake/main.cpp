@@ -36,6 +36,7 @@
 #include <random>
 #include <set>
 #include <sstream>
+#include <thread>
 
 #include "cli_options.h"
 #include "describe.h"
@@ -46,6 +47,7 @@
 #include "json/json5.h"
 #include "markup.h"
 #include "optimizer/ssa.h"
+#include "optimizer/ssa_cache.h"
 #include "parser/cst.h"
 #include "parser/parser.h"
 #include "parser/syntax.h"
@@ -257,8 +259,12 @@ void print_help(const char *argv0) {
     << "    --no-tty           Surpress interactive build progress interface"              << std::endl
     << "    --no-wait          Do not wait to obtain database lock; fail immediately"      << std::endl
     << "    --no-workspace     Do not open a database or scan for sources files"           << std::endl
+    << "    --no-ssa-cache     Recompile wake files instead of reusing .wake-ssa"          << std::endl
     << "    --fatal-warnings   Do not execute if there are any warnings"                   << std::endl
     << "    --heap-factor X    Heap-size is X * live data after the last GC (default 4.0)" << std::endl
+    << "    --heap-nursery MB  Collect young objects in an MB nursery (default 0: off)"    << std::endl
+    << "    --heap-threads N   Copy large heaps with N threads during GC (default 1)"      << std::endl
+    << "    --eval-threads N   Parse wake files and match sources with N threads (cores)"  << std::endl
     << "    --profile-heap     Report memory consumption on every garbage collection"      << std::endl
     << "    --profile     FILE Report runtime breakdown by stack trace to HTML/JSON file"  << std::endl
     << "    --chdir    -C PATH Locate database and default package starting from PATH"     << std::endl
@@ -328,6 +334,35 @@ class TerminalReporter : public DiagnosticReporter {
   }
 };
 
+// Holds the diagnostics of a wake file parsed off the main thread until they can be reported
+class BufferedReporter : public DiagnosticReporter {
+ public:
+  void replay(DiagnosticReporter &to) {
+    for (auto &d : diagnostics) {
+      switch (d.getSeverity()) {
+        case S_ERROR:
+          to.reportError(d.getLocation(), d.getMessage());
+          break;
+        case S_WARNING:
+          to.reportWarning(d.getLocation(), d.getMessage());
+          break;
+        case S_INFORMATION:
+          to.reportInfo(d.getLocation(), d.getMessage());
+          break;
+        case S_HINT:
+          to.reportHint(d.getLocation(), d.getMessage());
+          break;
+      }
+    }
+    diagnostics.clear();
+  }
+
+ private:
+  std::vector<Diagnostic> diagnostics;
+
+  void report(Diagnostic diagnostic) { diagnostics.emplace_back(std::move(diagnostic)); }
+};
+
 std::string get_date() {
   auto now = std::chrono::system_clock::now();
   auto time = std::chrono::system_clock::to_time_t(now);
@@ -422,6 +457,39 @@ int main(int argc, char **argv) {
     }
   }
 
+  size_t heap_nursery = 0;
+  if (clo.heapn) {
+    char *tail;
+    double megabytes = strtod(clo.heapn, &tail);
+    if (*tail || megabytes < 0) {
+      std::cerr << "Cannot run with " << clo.heapn << " heap-nursery (must be >= 0)!" << std::endl;
+      return 1;
+    }
+    heap_nursery = megabytes * 1024 * 1024;
+  }
+
+  int heap_threads = 1;
+  if (clo.heapt) {
+    char *tail;
+    heap_threads = strtol(clo.heapt, &tail, 10);
+    if (*tail || heap_threads < 1 || heap_threads > 256) {
+      std::cerr << "Cannot run with " << clo.heapt << " heap-threads (must be 1-256)!" << std::endl;
+      return 1;
+    }
+  }
+
+  // Parsing and source matching are short bursts, so by default use every core
+  int eval_threads = std::thread::hardware_concurrency();
+  eval_threads = std::max(1, std::min(256, eval_threads));
+  if (clo.evalt) {
+    char *tail;
+    eval_threads = strtol(clo.evalt, &tail, 10);
+    if (*tail || eval_threads < 1 || eval_threads > 256) {
+      std::cerr << "Cannot run with " << clo.evalt << " eval-threads (must be 1-256)!" << std::endl;
+      return 1;
+    }
+  }
+
   // Change directory to the location of the invoked script
   // and execute the specified target function
   if (clo.shebang) {
@@ -565,7 +633,9 @@ int main(int argc, char **argv) {
   if (job_cache_dir != nullptr) {
     cache = std::make_unique<job_cache::Cache>(
         job_cache_dir, WakeConfig::get()->bulk_logging_dir, WakeConfig::get()->eviction_config,
-        WakeConfig::get()->timeout_config, WakeConfig::get()->cache_miss_on_failure);
+        WakeConfig::get()->materialize_policy, WakeConfig::get()->shared_cache_worker_threads,
+        WakeConfig::get()->timeout_config,
+        WakeConfig::get()->cache_miss_on_failure);
     set_job_cache(cache.get());
   }
 
@@ -684,7 +754,8 @@ int main(int argc, char **argv) {
   }
 
   Profile tree;
-  Runtime runtime(clo.profile ? &tree : nullptr, clo.profileh, heap_factor);
+  Runtime runtime(clo.profile ? &tree : nullptr, clo.profileh, heap_factor, heap_nursery,
+                  heap_threads, eval_threads);
   bool sources = false;
   {
     auto start = std::chrono::steady_clock::now();
@@ -704,14 +775,59 @@ int main(int argc, char **argv) {
   int longest_src_dir = -1;
   bool warned_conflict = false;
 
+  char *none = nullptr;
+  char **cmdline = &none;
+  std::string command;
+
+  if (clo.exec) {
+    command = clo.exec;
+  } else if (clo.argc > 1) {
+    command = clo.argv[1];
+    cmdline = clo.argv + 2;
+  }
+
   // Read all wake build files
   bool ok = true;
   Scope::debug = clo.debug;
   std::unique_ptr<Top> top(new Top);
   std::vector<ExternalFile> wakefiles;
   wakefiles.reserve(wakefilenames.size());
-
   {
+    auto start = std::chrono::steady_clock::now();
+    for (auto &wakefile : wakefilenames) wakefiles.emplace_back(terminalReporter, wakefile.c_str());
+    auto stop = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    wcl::log::info("Reading wake files took %f seconds", duration)();
+  }
+
+  // An unchanged workspace can reuse the SSA from the last run with the same command-line.
+  // Hash is keyed by sip_key, so entries are never shared between workspaces.
+  SSACache ssa_cache(".wake-ssa");
+  bool use_ssa_cache = clo.workspace && clo.ssacache && !noexecute;
+  std::unique_ptr<Term> ssa;
+  std::string type_desc;
+
+  if (use_ssa_cache && !terminalReporter.errors) {
+    auto start = std::chrono::steady_clock::now();
+    ssa_cache.key(VERSION_STR);
+    ssa_cache.key_executable();
+    ssa_cache.key(clo.exec ? "exec" : clo.argc > 1 ? "argv" : "none");
+    ssa_cache.key(command);
+    ssa_cache.key(clo.in ? clo.in : "");
+    ssa_cache.key(src_dir);
+    ssa_cache.key(clo.optim ? "optimize" : "");
+    ssa_cache.key(clo.debug ? "debug" : "");
+    for (auto &file : wakefiles) ssa_cache.key_file(file);
+    // Only the names and flags of the primitives are checked here, so an entry this wake can't
+    // link is recompiled below; the JobTable they run on doesn't exist yet.
+    ssa = ssa_cache.load(runtime, wakefiles, type_desc, prim_register_all(nullptr, nullptr));
+    auto stop = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    wcl::log::info("SSA cache %s took %f seconds", ssa ? "hit" : "miss", duration)();
+  }
+
+  bool cached = ssa != nullptr;
+  if (!cached) {
     // While the slow cache alert is helpful, its also flakey.
     // In order to support automated flows better we only emit it when
     // a terminal is being used, which is a good indicator of a human
@@ -721,6 +837,21 @@ int main(int argc, char **argv) {
 
     auto start = std::chrono::steady_clock::now();
 
+    // Lexing and parsing each file is independent; only dst_top must see the files in order
+    std::vector<std::unique_ptr<CST>> csts(wakefiles.size());
+    std::vector<BufferedReporter> diagnostics(wakefiles.size());
+    runtime.parallel(
+        wakefiles.size(),
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i)
+            csts[i].reset(new CST(wakefiles[i], diagnostics[i]));
+        },
+        1);
+
+    auto parsed = std::chrono::steady_clock::now();
+    auto parsing = std::chrono::duration_cast<std::chrono::duration<double>>(parsed - start).count();
+    wcl::log::info("Parsing wake files took %f seconds", parsing)();
+
     for (size_t i = 0; i < wakefilenames.size(); i++) {
       auto &wakefile = wakefilenames[i];
 
@@ -735,10 +866,9 @@ int main(int argc, char **argv) {
 
       if (clo.verbose && clo.debug) std::cerr << "Parsing " << wakefile << std::endl;
 
-      wakefiles.emplace_back(terminalReporter, wakefile.c_str());
-      FileContent &file = wakefiles.back();
-      CST cst(file, terminalReporter);
-      auto package = dst_top(cst.root(), *top);
+      diagnostics[i].replay(terminalReporter);
+      auto package = dst_top(csts[i]->root(), *top);
+      csts[i].reset();
 
       // Does this file inform our choice of a default package?
       size_t slash = wakefile.find_last_of('/');
@@ -751,6 +881,7 @@ int main(int argc, char **argv) {
           warned_conflict = false;
         } else if (dirlen == longest_src_dir) {
           if (top->def_package != package && !warned_conflict) {
+            use_ssa_cache = false;
             std::cerr << "Directory " << (dir.empty() ? "." : dir.c_str())
                       << " has wakefiles with both package '" << top->def_package << "' and '"
                       << package << "'. This prevents default package selection;"
@@ -763,7 +894,9 @@ int main(int argc, char **argv) {
     }
 
     auto stop = std::chrono::steady_clock::now();
+    auto merging = std::chrono::duration_cast<std::chrono::duration<double>>(stop - parsed).count();
     auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    wcl::log::info("Merging wake files took %f seconds", merging)();
     wcl::log::info("Scanning wake files took %f seconds", duration)();
 
     if (!clo.quiet && alerted_slow_cache && is_stdout_tty) {
@@ -772,7 +905,7 @@ int main(int argc, char **argv) {
     }
   }
 
-  if (clo.in) {
+  if (clo.in && !cached) {
     auto it = top->packages.find(clo.in);
     if (it == top->packages.end()) {
       std::cerr << "Package '" << clo.in << "' selected by --in does not exist!" << std::endl;
@@ -829,19 +962,10 @@ int main(int argc, char **argv) {
     }
   }
 
-  char *none = nullptr;
-  char **cmdline = &none;
-  std::string command;
-
-  if (clo.exec) {
-    command = clo.exec;
-  } else if (clo.argc > 1) {
-    command = clo.argv[1];
-    cmdline = clo.argv + 2;
-  }
-
   ExprParser cmdExpr(command);
-  if (clo.exec) {
+  if (cached) {
+    // the SSA already includes the command-line
+  } else if (clo.exec) {
     top->body = cmdExpr.expr(terminalReporter);
   } else if (clo.argc > 1) {
     top->body =
@@ -851,8 +975,6 @@ int main(int argc, char **argv) {
     top->body = std::unique_ptr<Expr>(new VarRef(FRAGMENT_CPP_LINE, "Nil@wake"));
   }
 
-  TypeVar type = top->body->typeVar;
-
   if (clo.parse) top->format(std::cout, 0);
   if (notype) return (ok && !terminalReporter.errors) ? 0 : 1;
 
@@ -887,11 +1009,21 @@ int main(int argc, char **argv) {
                   cmdline);
   PrimMap pmap = prim_register_all(&info, &jobtable);
 
-  bool isTreeBuilt = true;
-  std::unique_ptr<Expr> root = bind_refs(std::move(top), pmap, isTreeBuilt);
-  if (!isTreeBuilt) ok = false;
+  std::unique_ptr<Expr> root;
+  if (cached) {
+    ssa_cache.link(pmap);
+  } else {
+    TypeVar type = top->body->typeVar;
+    bool isTreeBuilt = true;
+    root = bind_refs(std::move(top), pmap, isTreeBuilt);
+    if (!isTreeBuilt) ok = false;
 
-  sums_ok();
+    sums_ok();
+
+    std::stringstream desc;
+    type.format(desc, type);
+    type_desc = desc.str();
+  }
 
   if (clo.tcheck) std::cout << root.get();
 
@@ -967,18 +1099,24 @@ int main(int argc, char **argv) {
     }
   }
 
-  // Convert AST to optimized SSA
-  std::unique_ptr<Term> ssa = Term::fromExpr(std::move(root), runtime);
-  if (clo.optim) ssa = Term::optimize(std::move(ssa), runtime);
+  if (!cached) {
+    // Convert AST to optimized SSA
+    ssa = Term::fromExpr(std::move(root), runtime);
+    if (clo.optim) ssa = Term::optimize(std::move(ssa), runtime);
 
-  // Upon request, dump out the SSA
-  if (clo.dumpssa) {
-    TermFormat format;
-    ssa->format(std::cout, format);
-  }
+    // Upon request, dump out the SSA
+    if (clo.dumpssa) {
+      TermFormat format;
+      ssa->format(std::cout, format);
+    }
 
-  // Implement scope
-  ssa = Term::scope(std::move(ssa), runtime);
+    // Implement scope
+    ssa = Term::scope(std::move(ssa), runtime);
+
+    // Warnings are only reported when the wake files are compiled, so keep those uncached
+    if (use_ssa_cache && !terminalReporter.warnings)
+      ssa_cache.save(ssa.get(), wakefiles, type_desc);
+  }
 
   // Exit without execution for these arguments
   if (noexecute) return 0;
@@ -1001,6 +1139,15 @@ int main(int argc, char **argv) {
   status_finish();
 
   runtime.heap.report();
+
+  // Time spent connecting to the job cache shows up next to the samples,
+  // which are also in milliseconds.
+  if (clo.profile && cache) {
+    const auto &stats = cache->connect_stats();
+    std::string name = "job cache connect (" + std::to_string(stats.connects) +
+                       " connections): " + std::string(job_cache_dir);
+    tree.children[name].count += (stats.microseconds + 999) / 1000;
+  }
   tree.report(clo.profile, command);
 
   bool pass = true;
@@ -1020,9 +1167,7 @@ int main(int argc, char **argv) {
     }
     std::ostream &os = pass ? (std::cout) : (std::cerr);
     if (clo.verbose) {
-      os << command << ": ";
-      type.format(os, type);
-      os << " = ";
+      os << command << ": " << type_desc << " = ";
     }
     if (!clo.quiet || !pass) {
       HeapObject::format(os, v, clo.debug, clo.verbose ? 0 : -1);